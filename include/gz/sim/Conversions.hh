@@ -90,6 +90,29 @@ namespace gz
     void GZ_SIM_VISIBLE
     set(msgs::Time *_msg, const std::chrono::steady_clock::duration &_in);
 
+    /// \brief Helper function that sets a mutable msgs::Geometry object
+    /// to the values contained in a sdf::Geometry object. Unlike
+    /// convert, this writes into an existing message, so callers on hot
+    /// paths can reuse message storage instead of copying a temporary.
+    /// \param[out] _msg Geometry message to set.
+    /// \param[in] _in SDF geometry object.
+    void GZ_SIM_VISIBLE
+    set(msgs::Geometry *_msg, const sdf::Geometry &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Material object
+    /// to the values contained in a sdf::Material object.
+    /// \param[out] _msg Material message to set.
+    /// \param[in] _in SDF material object.
+    void GZ_SIM_VISIBLE
+    set(msgs::Material *_msg, const sdf::Material &_in);
+
+    /// \brief Helper function that sets a mutable msgs::Scene object
+    /// to the values contained in a sdf::Scene object.
+    /// \param[out] _msg Scene message to set.
+    /// \param[in] _in SDF scene object.
+    void GZ_SIM_VISIBLE
+    set(msgs::Scene *_msg, const sdf::Scene &_in);
+
     /// \brief Generic conversion from an SDF geometry to another type.
     /// \param[in] _in SDF geometry.
     /// \return Conversion result.
@@ -20,8 +20,12 @@
 #include <gz/msgs/serialized.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
 
+#include <google/protobuf/arena.h>
+
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -51,6 +55,11 @@ namespace gz
     class GZ_SIM_HIDDEN EntityComponentManagerPrivate;
     class EntityComponentManagerDiff;
 
+    namespace detail
+    {
+      template<typename ...ComponentTypeTs> class CachedView;
+    }
+
     /// \brief Type alias for the graph that holds entities.
     /// Each vertex is an entity, and the direction points from the parent to
     /// its children.
@@ -77,6 +86,9 @@ namespace gz
       /// it can have additional parameters if the need arises in the future.
       /// Additionally, not every data member is copied making its behavior
       /// different from what would be expected from a copy constructor.
+      /// Component instances already held by this object are refreshed in
+      /// place where they still match the source, so repeatedly snapshotting
+      /// a structurally stable world does not allocate.
       /// \param[in] _from Object to copy from
       public: void CopyFrom(const EntityComponentManager &_fromEcm);
 
@@ -119,6 +131,18 @@ namespace gz
       public: Entity Clone(Entity _entity, Entity _parent,
                   const std::string &_name, bool _allowRename);
 
+      /// \brief Get the mapping from each entity in the most recently
+      /// cloned subtree to its clone. The map is refilled by every Clone
+      /// call, so callers that need it must read it before cloning again.
+      /// Systems that mirror entities in external structures can use this
+      /// as a cloned-from hint to duplicate from the already-built
+      /// template instead of rebuilding the clone from scratch.
+      /// \return Map from original entity to cloned entity for the last
+      /// Clone call; empty if nothing was cloned yet.
+      /// \sa Clone
+      public: const std::unordered_map<Entity, Entity> &
+          ClonedEntityMap() const;
+
       /// \brief Get the number of entities on the server.
       /// \return Entity count.
       public: size_t EntityCount() const;
@@ -201,6 +225,15 @@ namespace gz
       /// \return True if the provided _typeId has been created.
       public: bool HasComponentType(const ComponentTypeId _typeId) const;
 
+      /// \brief Get the structural epoch of this manager. The epoch is
+      /// incremented whenever a component is created or removed, or when
+      /// entity removal requests are processed. Cached component pointers
+      /// tagged with the epoch at which they were resolved remain valid
+      /// while the epoch is unchanged, so callers can skip repeated
+      /// lookups between structural changes.
+      /// \return Monotonically increasing structural change counter.
+      public: uint64_t StructuralEpoch() const;
+
       /// \brief Check whether an entity has a specific component type.
       /// \param[in] _entity The entity to check.
       /// \param[in] _typeId Component type id to check.
@@ -360,6 +393,25 @@ namespace gz
               std::vector<Entity> ChildrenByComponents(Entity _parent,
                    const ComponentTypeTs &..._desiredComponents) const;
 
+      /// \brief Opt a component type into a reverse value index. Once
+      /// enabled, EntityByComponents and EntitiesByComponents queries whose
+      /// first desired component is of this type probe a hash bucket keyed
+      /// by the component value instead of scanning every entity that has
+      /// the component, so frequent lookups (e.g. by components::Name during
+      /// entity spawning) stay cheap as the world grows.
+      ///
+      /// The index is maintained incrementally: component creation, removal
+      /// and SetComponentData mark entries stale, and stale entries are
+      /// refreshed lazily on the next indexed query. Component values
+      /// modified in place without going through the ECM must be announced
+      /// with SetChanged, which is already required for change tracking.
+      ///
+      /// Enabling an index for a type that already has one is a no-op.
+      /// \tparam ComponentTypeT Component type to index. Its wrapped data
+      /// type must be hashable with std::hash and have an equality operator.
+      public: template<typename ComponentTypeT>
+              void EnableComponentValueIndex();
+
       /// why is this required?
       private: template <typename T>
                struct identity;  // NOLINT
@@ -447,6 +499,72 @@ namespace gz
                   bool(const Entity &_entity,
                        ComponentTypeTs *...)>>::type _f);
 
+      /// \brief A parallel version of Each(). The matched entity set is
+      /// partitioned into contiguous ranges, and the callback is invoked for
+      /// each range from a pool of worker threads. Iteration order across
+      /// entities is unspecified, and the callback cannot stop iteration
+      /// early.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired component types,
+      /// in the order they're listed on the template.
+      /// \tparam ComponentTypeTs All the desired component types.
+      /// \warning The callback is invoked concurrently from multiple threads,
+      /// so it must be thread-safe: component access should be read-only, and
+      /// any writes to state shared between invocations (including the ECM
+      /// itself, e.g. creating or removing entities or components) must be
+      /// deferred or externally synchronized. Like Each(), this function
+      /// should not be called outside of a System's PreUpdate, Update, or
+      /// PostUpdate callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  void(const Entity &_entity,
+                       const ComponentTypeTs *...)>>::type _f) const;
+
+      /// \brief A parallel version of Each() with mutable component access.
+      /// The matched entity set is partitioned into contiguous ranges, and
+      /// the callback is invoked for each range from a pool of worker
+      /// threads. Iteration order across entities is unspecified, and the
+      /// callback cannot stop iteration early.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired component types,
+      /// in the order they're listed on the template.
+      /// \tparam ComponentTypeTs All the desired mutable component types.
+      /// \warning The callback is invoked concurrently from multiple threads,
+      /// so it must be thread-safe: writes should be confined to the
+      /// components of the entity passed to the invocation, and any writes to
+      /// state shared between invocations (including the ECM itself, e.g.
+      /// creating or removing entities or components) must be deferred or
+      /// externally synchronized. Like Each(), this function should not be
+      /// called outside of a System's PreUpdate, Update, or PostUpdate
+      /// callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  void(const Entity &_entity,
+                       ComponentTypeTs *...)>>::type _f);
+
+      /// \brief Get a typed handle to the cached view for a set of component
+      /// types. The handle resolves the underlying view once (creating it if
+      /// needed) and tags it with the manager's structural epoch, so its
+      /// Each() calls go straight to the view's packed arrays and only repeat
+      /// the view lookup after a structural change. This removes the per-call
+      /// view key construction and map probe of Each(), which adds up for
+      /// systems that run many queries per iteration over small entity sets.
+      ///
+      /// Handles are cheap to construct and copy, and remain valid for the
+      /// lifetime of this manager. Typical use is to store the handle as a
+      /// system member:
+      ///
+      ///  auto view = ecm.CachedView<components::Pose,
+      ///      components::LinearVelocity>();
+      ///  view.Each([](const Entity &, const components::Pose *,
+      ///      const components::LinearVelocity *) { ...; return true; });
+      ///
+      /// \tparam ComponentTypeTs All the desired component types.
+      /// \return A handle offering Each()-style iteration over the view.
+      /// \sa detail::CachedView
+      public: template<typename ...ComponentTypeTs>
+              detail::CachedView<ComponentTypeTs...> CachedView() const;
+
       /// \brief Call a function for each parameter in a pack.
       /// \param[in] _f Function to be called.
       /// \param[in] _components Parameters which should be passed to the
@@ -567,6 +685,41 @@ namespace gz
       public: std::unordered_set<ComponentTypeId>
           ComponentTypesWithPeriodicChanges() const;
 
+      /// \brief Subscribe to change events for a component type. After
+      /// each step, UpdateComponentChangeSubscriptions builds a packed
+      /// list of the entities affected by the subscribed kind of change
+      /// from the change tracking that all subscriptions share, so a
+      /// dozen change-watching systems cost one pass over the dirty data
+      /// instead of one scan each. The current list is available through
+      /// ComponentChangeList until the next update overwrites it.
+      /// \param[in] _typeId Component type to watch.
+      /// \param[in] _kind Kind of change to watch for.
+      /// \return Id identifying the subscription.
+      /// \sa ComponentChangeList
+      public: uint64_t SubscribeComponentChanges(
+          const ComponentTypeId _typeId, const ComponentChangeKind _kind);
+
+      /// \brief Drop a component change subscription.
+      /// \param[in] _subscriptionId Id returned by
+      /// SubscribeComponentChanges. Unknown ids are ignored.
+      public: void UnsubscribeComponentChanges(
+          const uint64_t _subscriptionId);
+
+      /// \brief Get the entities affected by a subscription's change kind
+      /// during the last processed step.
+      /// \param[in] _subscriptionId Id returned by
+      /// SubscribeComponentChanges.
+      /// \return Packed list of affected entities; empty for unknown ids.
+      public: const std::vector<Entity> &ComponentChangeList(
+          const uint64_t _subscriptionId) const;
+
+      /// \brief Rebuild the packed entity lists of all component change
+      /// subscriptions from the current change tracking. The simulation
+      /// runner calls this at the end of every step, before the change
+      /// tracking is cleared; it normally doesn't need to be called
+      /// manually.
+      public: void UpdateComponentChangeSubscriptions();
+
       /// \brief Set the absolute state of the ECM from a serialized message.
       /// Entities / components that are in the new state but not in the old
       /// one will be created.
@@ -594,6 +747,30 @@ namespace gz
                   const std::unordered_set<ComponentTypeId> &_types = {},
                   bool _full = false) const;
 
+      /// \brief Get a message with the serialized state of the given entities
+      /// and components, with the message and all of its submessages
+      /// allocated from a caller-owned protobuf arena. Callers that serialize
+      /// state repeatedly (e.g. once per publish) can reuse the arena's
+      /// memory between calls by calling Reset() on the arena, avoiding the
+      /// per-call allocation of the message tree.
+      /// \details The header of the message will not be populated, it is the
+      /// responsibility of the caller to timestamp it before use.
+      /// \param[in] _arena Arena from which the state message is allocated.
+      /// The returned message is owned by the arena and is invalidated when
+      /// the arena is reset or destroyed.
+      /// \param[in] _entities Entities to be serialized. Leave empty to get
+      /// all entities.
+      /// \param[in] _types Type ID of components to be serialized. Leave
+      /// empty to get all components.
+      /// \param[in] _full True to get all the entities and components.
+      /// False will get only components and entities that have changed.
+      /// \return The arena-allocated serialized state message.
+      public: msgs::SerializedStateMap *State(
+                  google::protobuf::Arena &_arena,
+                  const std::unordered_set<Entity> &_entities = {},
+                  const std::unordered_set<ComponentTypeId> &_types = {},
+                  bool _full = false) const;
+
       /// \brief Get a message with the serialized state of all entities and
       /// components that are changing in the current iteration
       ///
@@ -619,6 +796,29 @@ namespace gz
       /// \param[in] _stateMsg Message containing state to be set.
       public: void SetState(const msgs::SerializedStateMap &_stateMsg);
 
+      /// \brief Start deferring view updates for component additions and
+      /// removals. While the batch is open, creating or removing components
+      /// does not notify views; the affected entities are collected and all
+      /// views are reconciled in a single pass when EndComponentBatch is
+      /// called. Bracketing bursts of component churn (e.g. applying many
+      /// removals while processing a state message) with
+      /// BeginComponentBatch/EndComponentBatch replaces repeated view
+      /// membership recomputation with one pass per view.
+      /// \warning Between BeginComponentBatch and EndComponentBatch, view
+      /// based queries (Each and friends) may observe stale membership for
+      /// the entities touched in the batch, so keep the bracket tight and
+      /// don't query inside it.
+      /// \sa EndComponentBatch
+      public: void BeginComponentBatch();
+
+      /// \brief Stop deferring view updates and reconcile all views with
+      /// the entities whose components were added or removed since
+      /// BeginComponentBatch. Membership is decided by the entities' final
+      /// component sets, so a component that was removed and re-added
+      /// within the batch results in no net view change.
+      /// \sa BeginComponentBatch
+      public: void EndComponentBatch();
+
       /// \brief Set the changed state of a component.
       /// \param[in] _entity The entity.
       /// \param[in] _type Type of the component.
@@ -651,6 +851,33 @@ namespace gz
       /// \return True if there are components marked for removal.
       public: bool HasRemovedComponents() const;
 
+      /// \brief Statistics about the internal pool of recycled component
+      /// instances for one component type.
+      /// \sa ComponentPoolStats
+      public: struct PoolStats
+      {
+        /// \brief Number of instances currently sitting in the pool, ready
+        /// to be reused.
+        uint64_t available{0};
+
+        /// \brief Number of component creations that were satisfied from the
+        /// pool instead of the allocator.
+        uint64_t reused{0};
+
+        /// \brief Number of instances that were returned to the pool when
+        /// their entity was removed.
+        uint64_t recycled{0};
+      };
+
+      /// \brief Get statistics about the internal pool of recycled component
+      /// instances. Components of removed entities are parked in a per-type
+      /// pool and reused by subsequent component creations, so create/remove
+      /// cycles don't touch the global allocator. These counters can be used
+      /// to size workloads that churn many transient entities.
+      /// \return Pool statistics keyed by component type id.
+      public: std::unordered_map<ComponentTypeId, PoolStats>
+          ComponentPoolStats() const;
+
       /// \brief Clear the list of newly added entities so that a call to
       /// EachAdded after this will have no entities to iterate. This function
       /// is protected to facilitate testing.
@@ -730,6 +957,87 @@ namespace gz
                    const Entity _entity,
                    const ComponentTypeId _type);
 
+      /// \brief Untyped part of EnableComponentValueIndex: create the index
+      /// and mark every entity that already has a component of this type as
+      /// stale so existing components are indexed on the first query.
+      /// \param[in] _typeId Id of the component type to index.
+      private: void EnableComponentValueIndexImpl(
+                   const ComponentTypeId _typeId);
+
+      /// \brief Check whether a value index is enabled for a component type.
+      /// \param[in] _typeId Id of the component type.
+      /// \return True if EnableComponentValueIndex was called for _typeId.
+      private: bool ComponentValueIndexActive(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Mark an entity's entry in the value index of _typeId as
+      /// stale, if such an index exists. Cheap no-op otherwise.
+      /// \param[in] _entity The entity whose component changed.
+      /// \param[in] _typeId Id of the changed component's type.
+      private: void MarkComponentValueIndexDirty(const Entity _entity,
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Check whether the value index of _typeId has stale
+      /// entries. A false result happens-after the refresh that drained
+      /// the index last, so the index may then be probed without locking.
+      /// \param[in] _typeId Id of the indexed component type.
+      /// \return True if there are entries left to refresh.
+      private: bool ComponentValueIndexDirty(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Lock the value index of _typeId against concurrent lazy
+      /// refreshes from const queries, e.g. parallel system PostUpdates.
+      /// \param[in] _typeId Id of the indexed component type.
+      /// \return The held lock; empty when no index exists for _typeId.
+      private: std::unique_lock<std::mutex> LockComponentValueIndex(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Mark the value index of _typeId as fully refreshed.
+      /// Callers must hold the lock from LockComponentValueIndex and have
+      /// finished re-filing entries, so that threads observing a clean
+      /// index are guaranteed to see the refreshed buckets.
+      /// \param[in] _typeId Id of the indexed component type.
+      private: void ClearComponentValueIndexDirty(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Take (return and clear) the set of stale entities of the
+      /// value index of _typeId. Called by the typed refresh code, which is
+      /// the only place the component values can be hashed. Callers must
+      /// hold the lock from LockComponentValueIndex.
+      /// \param[in] _typeId Id of the indexed component type.
+      /// \return The entities whose index entries need refreshing.
+      private: std::vector<Entity> TakeComponentValueIndexDirty(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Re-file an entity in the value index of _typeId under the
+      /// hash of its current component value.
+      /// \param[in] _typeId Id of the indexed component type.
+      /// \param[in] _entity The entity to re-file.
+      /// \param[in] _hash Hash of the entity's current component value.
+      /// Ignored if _hasComponent is false.
+      /// \param[in] _hasComponent False if the entity no longer has the
+      /// component, in which case its entry is removed.
+      private: void RefreshComponentValueIndexEntry(
+                   const ComponentTypeId _typeId, const Entity _entity,
+                   const std::size_t _hash, const bool _hasComponent) const;
+
+      /// \brief Look up the value index bucket for a component value hash.
+      /// \param[in] _typeId Id of the indexed component type.
+      /// \param[in] _hash Hash of the desired component value.
+      /// \return The entities filed under _hash, or nullptr if there are
+      /// none or no index exists for _typeId. Bucket entries are candidates:
+      /// hash collisions are possible, so callers must compare the actual
+      /// component values.
+      private: const std::vector<Entity> *ComponentValueIndexBucket(
+                   const ComponentTypeId _typeId,
+                   const std::size_t _hash) const;
+
+      /// \brief Refresh all stale entries of the value index of
+      /// ComponentTypeT by hashing the entities' current component values.
+      /// \tparam ComponentTypeT The indexed component type.
+      private: template<typename ComponentTypeT>
+          void RefreshComponentValueIndex() const;
+
       /// \brief Find a View that matches the set of ComponentTypeIds. If
       /// a match is not found, then a new view is created.
       /// \tparam ComponentTypeTs All the component types that define a view.
@@ -798,17 +1106,99 @@ namespace gz
       /// otherwise.
       private: bool LockAddingEntitiesToViews() const;
 
+      /// \brief Start deferring view updates for component additions. While
+      /// a batch is open, CreateComponent does not notify views on every
+      /// insertion; the affected entities are recorded and the views are
+      /// reconciled in a single pass when EndEntityBatch is called. This
+      /// reduces the cost of spawning many entities at once.
+      /// \sa EndEntityBatch
+      private: void BeginEntityBatch();
+
+      /// \brief Stop deferring view updates and reconcile all views with
+      /// the entities whose components were added since BeginEntityBatch.
+      /// \sa BeginEntityBatch
+      private: void EndEntityBatch();
+
       // Make runners friends so that they can manage entity creation and
       // removal. This should be safe since runners are internal
       // to Gazebo.
       friend class GuiRunner;
       friend class SimulationRunner;
 
+      // Make the SDF entity creator a friend so that it can batch entity
+      // creation. Like the runners, the creator is internal.
+      friend class SdfEntityCreator;
+
       // Make network managers friends so they have control over component
       // states. Like the runners, the managers are internal.
       friend class NetworkManagerPrimary;
       friend class NetworkManagerSecondary;
+
+      // Make cached views friends so they can re-resolve their underlying
+      // view through FindView after a structural change.
+      template<typename ...ComponentTypeTs>
+      friend class detail::CachedView;
     };
+
+    namespace detail
+    {
+    /// \brief A typed handle to a cached entity view, created with
+    /// EntityComponentManager::CachedView. The handle keeps the resolved
+    /// view pointer together with the structural epoch at which it was
+    /// resolved; while the epoch is unchanged, Each() iterates the view's
+    /// packed entity/component arrays directly, skipping the per-call view
+    /// lookup done by EntityComponentManager::Each.
+    /// \tparam ComponentTypeTs All the component types that define the view.
+    template<typename ...ComponentTypeTs>
+    class CachedView
+    {
+      /// \brief Get all entities of the view, as well as their components.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired component
+      /// types, in the order they're listed on the template. The callback
+      /// function can return false to stop subsequent calls to the
+      /// callback, otherwise a true value should be returned.
+      /// \warning Like EntityComponentManager::Each, this function should
+      /// not be called outside of a System's PreUpdate, Update, or
+      /// PostUpdate callbacks.
+      public: void Each(std::function<bool(const Entity &_entity,
+                  const ComponentTypeTs *...)> _f) const;
+
+      /// \brief Get all entities of the view, as well as their mutable
+      /// components.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. The function parameters are all the desired mutable
+      /// component types, in the order they're listed on the template. The
+      /// callback function can return false to stop subsequent calls to the
+      /// callback, otherwise a true value should be returned.
+      /// \warning Like EntityComponentManager::Each, this function should
+      /// not be called outside of a System's PreUpdate, Update, or
+      /// PostUpdate callbacks.
+      public: void Each(std::function<bool(const Entity &_entity,
+                  ComponentTypeTs *...)> _f);
+
+      /// \brief Constructor. Use EntityComponentManager::CachedView.
+      /// \param[in] _ecm The manager whose view is cached.
+      private: explicit CachedView(const EntityComponentManager *_ecm);
+
+      /// \brief Get the underlying view, re-resolving it through the
+      /// manager if the structural epoch moved since the last resolution
+      /// (which also folds any pending entity additions into the view).
+      /// \return The up-to-date view.
+      private: View *Resolve() const;
+
+      /// \brief The manager whose view is cached.
+      private: const EntityComponentManager *ecm{nullptr};
+
+      /// \brief The resolved view, or nullptr if not yet resolved.
+      private: mutable View *view{nullptr};
+
+      /// \brief The manager's structural epoch at the last resolution.
+      private: mutable uint64_t epoch{0u};
+
+      friend class EntityComponentManager;
+    };
+    }
     }
   }
 }
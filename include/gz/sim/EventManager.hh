@@ -19,9 +19,11 @@
 
 #include <functional>
 #include <memory>
+#include <tuple>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Event.hh>
@@ -39,6 +41,27 @@ namespace gz
     // Forward declarations.
     class GZ_SIM_HIDDEN EventManagerPrivate;
 
+    /// \brief Traits that map an event type onto its coalesced batch
+    /// counterpart. The batch event carries one decayed argument tuple per
+    /// queued emission, in emission order, and is delivered in a single
+    /// callback at the step boundary.
+    /// \sa EventManager::QueueEmit
+    template <typename E>
+    struct EventBatch;
+
+    /// \brief Specialization extracting the argument types of an event.
+    template <typename ...Args, typename Tag>
+    struct EventBatch<common::EventT<void(Args...), Tag>>
+    {
+      /// \brief The arguments of one queued emission.
+      using ArgsTuple = std::tuple<std::decay_t<Args>...>;
+
+      /// \brief The batch event type. It shares the tag of the underlying
+      /// event but has its own signature, so connections to one don't
+      /// receive the other.
+      using Type = common::EventT<void(const std::vector<ArgsTuple> &), Tag>;
+    };
+
     /// \brief The EventManager is used to send/receive notifications of
     /// simulator events.
     ///
@@ -118,6 +141,65 @@ namespace gz
                 }
               }
 
+      /// \brief Queue an event emission instead of signaling subscribers
+      /// immediately. Queued emissions are held until the next call to
+      /// ProcessQueuedEvents, which the simulation runner makes once per
+      /// step, so bursts of high-frequency events traverse the subscriber
+      /// lists once per step instead of once per emission. Use Emit for
+      /// ordering-sensitive consumers that must observe the event at the
+      /// emission point.
+      /// \param[in] _args function arguments to be passed to the event
+      /// callbacks. Must match the signature of the event type E.
+      /// \sa ProcessQueuedEvents
+      public: template <typename E, typename ... Args>
+              void QueueEmit(Args && ... _args)
+              {
+                auto iter = this->queuedEvents.find(typeid(E));
+                if (iter == this->queuedEvents.end())
+                {
+                  iter = this->queuedEvents.emplace(typeid(E),
+                      std::make_unique<QueuedBatch<E>>()).first;
+                  this->queuedOrder.push_back(typeid(E));
+                }
+
+                auto *batch = static_cast<QueuedBatch<E> *>(iter->second.get());
+                batch->queued.emplace_back(std::forward<Args>(_args) ...);
+              }
+
+      /// \brief Connect to the coalesced batch of a queued event type. The
+      /// callback receives every emission queued since the last delivery in
+      /// one call.
+      /// \param[in] _subscriber A std::function callback function taking a
+      /// const reference to a vector of the event's argument tuples.
+      /// \return A Connection pointer, which will automatically call
+      /// Disconnect when it goes out of scope.
+      /// \sa QueueEmit
+      public: template <typename E>
+              gz::common::ConnectionPtr
+              ConnectToBatch(
+                  const typename EventBatch<E>::Type::CallbackT &_subscriber)
+              {
+                return this->Connect<typename EventBatch<E>::Type>(
+                    _subscriber);
+              }
+
+      /// \brief Deliver all queued emissions. Immediate subscribers of each
+      /// event receive one callback per queued emission, in emission order;
+      /// batch subscribers receive all of them in a single callback. Called
+      /// once per step by the simulation runner.
+      /// \sa QueueEmit
+      public: void ProcessQueuedEvents()
+              {
+                // Batches flushed here may queue further events; the index
+                // loop picks up event types appended during the flush, and a
+                // batch that re-queues its own type is delivered on the next
+                // call.
+                for (std::size_t i = 0; i < this->queuedOrder.size(); ++i)
+                {
+                  this->queuedEvents[this->queuedOrder[i]]->Flush(*this);
+                }
+              }
+
       /// \brief Get connection count for a particular event
       /// Connection count for the event
       public: template <typename E>
@@ -165,10 +247,60 @@ namespace gz
                  }
                };
 
+      /// \brief Base type for the per-event queues of coalesced emissions.
+      private: struct QueuedBatchBase
+               {
+                 /// \brief Destructor
+                 public: virtual ~QueuedBatchBase() = default;
+
+                 /// \brief Deliver the queued emissions and clear the queue.
+                 /// \param[in] _mgr Manager to deliver through.
+                 public: virtual void Flush(EventManager &_mgr) = 0;
+               };
+
+      /// \brief Queue of coalesced emissions for event type E.
+      private: template <typename E>
+               struct QueuedBatch : public QueuedBatchBase
+               {
+                 // Documentation inherited
+                 public: void Flush(EventManager &_mgr) override
+                 {
+                   if (this->queued.empty())
+                     return;
+
+                   auto batch = std::move(this->queued);
+                   this->queued.clear();
+
+                   // Immediate subscribers get one callback per emission,
+                   // in emission order.
+                   for (auto &args : batch)
+                   {
+                     std::apply([&_mgr](auto && ... _a)
+                         {
+                           _mgr.Emit<E>(_a ...);
+                         }, args);
+                   }
+
+                   // Batch subscribers get everything in a single call.
+                   _mgr.Emit<typename EventBatch<E>::Type>(batch);
+                 }
+
+                 /// \brief Emissions queued since the last flush.
+                 public: std::vector<typename EventBatch<E>::ArgsTuple> queued;
+               };
+
       /// \brief Container of used signals.
       private: std::unordered_map<TypeInfoRef,
                                   std::unique_ptr<gz::common::Event>,
                                   Hasher, EqualTo> events;
+
+      /// \brief Queued emissions, keyed by event type.
+      private: std::unordered_map<TypeInfoRef,
+                                  std::unique_ptr<QueuedBatchBase>,
+                                  Hasher, EqualTo> queuedEvents;
+
+      /// \brief Event types with queues, in first-queued order.
+      private: std::vector<TypeInfoRef> queuedOrder;
     };
     }
   }
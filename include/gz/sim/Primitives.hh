@@ -19,7 +19,11 @@
 #define GZ_SIM_PRIMITIVES_HH_
 
 #include <gz/sim/config.hh>
+#include <gz/sim/Entity.hh>
 #include <gz/sim/Export.hh>
+#include <gz/sim/SdfEntityCreator.hh>
+
+#include <sdf/Root.hh>
 
 #include <string>
 
@@ -73,6 +77,37 @@ namespace gz
     /// Empty string if the _typeName is invalid.
     std::string GZ_SIM_VISIBLE
     getPrimitive(const std::string &_typeName);
+
+    /// \brief Return the cached, already-parsed SDF DOM for a primitive
+    /// SDF string previously returned by getPrimitive, getPrimitiveShape
+    /// or getPrimitiveLight. Each template is parsed once per process, so
+    /// callers spawning many copies of the same primitive skip the
+    /// per-spawn string parse.
+    /// \param[in] _sdfString One of the primitive SDF strings.
+    /// \return Pointer to the cached DOM, or nullptr if the string is not
+    /// a primitive template. The DOM is owned by the cache and must not be
+    /// modified; copy the model or light out of it before changing names
+    /// or poses.
+    const sdf::Root * GZ_SIM_VISIBLE
+    getPrimitiveRoot(const std::string &_sdfString);
+
+    /// \brief Create a primitive shape or light directly from its cached
+    /// DOM template, with no SDF string round trip. Safe to call between
+    /// SdfEntityCreator::BeginBatch and EndBatch when stamping out many
+    /// instances.
+    /// \param[in] _creator Entity creator used to build the instance.
+    /// \param[in] _typeName Type name of the shape or light to create.
+    /// Accepts the same options as getPrimitive.
+    /// \param[in] _name Name for the new entity. The template's name is
+    /// kept if this is empty.
+    /// \param[in] _parent Parent for the new entity, typically the world.
+    /// Pass kNullEntity to skip setting a parent.
+    /// \return The created entity, or kNullEntity if the type name is
+    /// invalid.
+    Entity GZ_SIM_VISIBLE
+    createPrimitive(SdfEntityCreator &_creator,
+        const std::string &_typeName, const std::string &_name,
+        Entity _parent);
     }
   }  // namespace sim
 }  // namespace gz
@@ -162,6 +162,22 @@ namespace gz
       /// \return Projector entity.
       public: Entity CreateEntities(const sdf::Projector *_projector);
 
+      /// \brief Start a creation batch. While a batch is open, view updates
+      /// in the `EntityComponentManager` are deferred and plugin load events
+      /// are buffered, so the per-insertion bookkeeping is paid once for the
+      /// whole batch instead of once per component. Call EndBatch once all
+      /// entities have been created. This significantly reduces the cost of
+      /// spawning many entities at once.
+      /// \sa EndBatch
+      public: void BeginBatch();
+
+      /// \brief Finish a creation batch started with BeginBatch: reconcile
+      /// the `EntityComponentManager` views with all entities created during
+      /// the batch in a single pass, then emit the buffered plugin load
+      /// events in creation order.
+      /// \sa BeginBatch
+      public: void EndBatch();
+
       /// \brief Request an entity deletion. This will insert the request
       /// into a queue. The queue is processed toward the end of a simulation
       /// update step.
@@ -120,6 +120,20 @@ namespace gz
       /// \brief Destructor
       public: ~Server();
 
+      /// \brief Create a new server starting from this server's current
+      /// simulation state. The clone is built from the already-resolved SDF
+      /// DOM, so no file parsing, include resolution or resource fetching
+      /// happens, and plugin libraries stay loaded in-process; the dominant
+      /// cost is entity creation and the ECM copy. The state of systems is
+      /// carried over for systems implementing ISystemStateSerializable.
+      ///
+      /// Note that the clone serves the same topics and services as the
+      /// original, so clones in the same process should be used through the
+      /// C++ API rather than through transport.
+      /// \return The cloned server, or nullptr if this server failed to
+      /// load or the clone could not be created.
+      public: std::unique_ptr<Server> Clone() const;
+
       /// \brief Set the update period. The update period is the wall-clock time
       /// between ECS updates.
       /// Note that this is different from the simulation update rate. ECS
@@ -158,6 +172,26 @@ namespace gz
       /// not being initialized, or if the server is already running.
       public: bool RunOnce(const bool _paused = true);
 
+      /// \brief Run a fixed number of steps back to back in a single
+      /// blocking call. Unlike calling RunOnce in a loop, the whole batch
+      /// executes inside the stepping thread without a wakeup per step, and
+      /// steps are not throttled to the update period, so this is the
+      /// fastest way to drive headless workloads that step simulation
+      /// millions of times.
+      ///
+      /// Simulation is unpaused for the duration of the batch and restored
+      /// to its previous pause state afterwards. The optional callback is
+      /// invoked after every step from the stepping thread with read access
+      /// to the world state, so per-step results can be collected into one
+      /// batched response; it must not block or modify entities.
+      /// \param[in] _iterations Number of steps to perform. Must be
+      /// positive.
+      /// \param[in] _cb Optional callback invoked after every step.
+      /// \return False if the server was terminated before completing,
+      /// is not initialized, is already running, or _iterations is zero.
+      public: bool RunBatch(const uint64_t _iterations,
+                  const BatchStepCallback &_cb = nullptr);
+
       /// \brief Get whether the server is running. The server can have zero
       /// or more simulation worlds, each of which may or may not be
       /// running. See Running(const unsigned int) to get the running status
@@ -194,6 +228,17 @@ namespace gz
       public: std::optional<bool> Paused(
                   const unsigned int _worldIndex = 0) const;
 
+      /// \brief Request that a world be reset to its initial state on its
+      /// next step. The reset reuses the snapshot retained when the world
+      /// was loaded, so it is much faster than destroying the server and
+      /// reloading the world. The request is applied by the next
+      /// iteration; call RunOnce or Run afterwards if the server isn't
+      /// already running.
+      /// \param[in] _worldIndex Index of the world to reset.
+      /// \return True if the world referenced by _worldIndex exists, false
+      /// otherwise.
+      public: bool RequestReset(const unsigned int _worldIndex = 0) const;
+
       /// \brief Get the number of iterations the server has executed.
       /// \param[in] _worldIndex Index of the world to query.
       /// \return The current iteration count,
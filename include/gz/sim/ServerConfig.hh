@@ -232,6 +232,15 @@ namespace gz
       /// \param[in] _root SDF Root object to use.
       public: void SetSdfRoot(const sdf::Root &_root) const;
 
+      /// \brief Set the SDF Root DOM object by taking ownership of it,
+      /// which avoids deep-copying the DOM. Intended for programmatic
+      /// world generation, where the generated world can be handed to the
+      /// server without ever being serialized to an SDF string. The
+      /// sdf::Root object will take precedence over
+      /// ServerConfig::SdfString() and ServerConfig::SdfFile().
+      /// \param[in] _root SDF Root object to use.
+      public: void SetSdfRoot(sdf::Root &&_root) const;
+
       /// \brief Get the SDF Root DOM object.
       /// \return SDF Root object to use, or std::nullopt if the sdf::Root
       /// has not been set via ServerConfig::SetSdfRoot().
@@ -263,6 +272,117 @@ namespace gz
       /// \param[in] _levels Value to set.
       public: void SetUseLevels(const bool _levels);
 
+      /// \brief Get whether the server runs system PostUpdates pipelined
+      /// with the next simulation step.
+      /// \return True if pipelined stepping is enabled.
+      public: bool UsePipelinedStepping() const;
+
+      /// \brief Set whether the server runs system PostUpdates pipelined
+      /// with the next simulation step. When enabled, PostUpdate systems
+      /// read a snapshot of the world state while the next PreUpdate and
+      /// Update run against the live state, trading one state copy per
+      /// step for overlap between physics and sensor work. PostUpdate
+      /// output then lags the live state by one step. Disabled by default.
+      /// \param[in] _pipelined Value to set.
+      public: void SetUsePipelinedStepping(bool _pipelined);
+
+      /// \brief Get whether the server steps physics without ever blocking
+      /// on PostUpdate consumers.
+      /// \return True if asynchronous stepping is enabled.
+      public: bool UseAsyncStepping() const;
+
+      /// \brief Set whether the server steps physics without ever blocking
+      /// on PostUpdate consumers. Implies pipelined stepping. When the
+      /// previous step's PostUpdate batch is still running at snapshot
+      /// time, the step proceeds without delivering its state; consumers
+      /// such as scene broadcasting and logging then observe the latest
+      /// state once they catch up, with the intermediate states coalesced
+      /// away. Systems that must observe every step (e.g. sensors with
+      /// strict rates) should not run under this mode. Disabled by
+      /// default.
+      /// \param[in] _async Value to set.
+      public: void SetUseAsyncStepping(bool _async);
+
+      /// \brief Get whether the server runs in deterministic mode.
+      /// \return True if deterministic mode is enabled.
+      public: bool UseDeterministicMode() const;
+
+      /// \brief Set whether the server guarantees bit-identical reruns of
+      /// the same world. Staged PreUpdate/Update parallelism is kept:
+      /// task partitioning is fixed by system load order, and systems
+      /// only share a stage when their declared component usage does not
+      /// conflict, so no write merge order exists. PostUpdate systems run
+      /// on a single ordered worker so their publications keep load
+      /// order. Pipelined and async stepping and the adaptive step
+      /// governor are disabled, since they let wall-clock timing leak
+      /// into what consumers observe. Combine with SetSeed to also pin
+      /// down noise models. Disabled by default.
+      /// \param[in] _deterministic Value to set.
+      public: void SetUseDeterministicMode(bool _deterministic);
+
+      /// \brief Get the width of the spin window used by the step pacing
+      /// clock.
+      /// \return Spin window duration, zero when pacing is sleep-only.
+      public: std::chrono::steady_clock::duration SpinWindow() const;
+
+      /// \brief Set the width of the spin window used when throttling
+      /// the step rate. The runner coarse-sleeps until this long before
+      /// the step deadline and then spins on the steady clock for the
+      /// remainder, bounding wakeup jitter by the clock read instead of
+      /// the OS scheduler (1-2 ms on typical kernels) at the cost of
+      /// busy-waiting inside the window. Set it slightly above the
+      /// observed sleep overshoot; around 2 ms yields tens-of-
+      /// microseconds step timing at 1 kHz. Zero (default) keeps
+      /// sleep-only pacing. Wakeup jitter statistics are published on
+      /// the world's `performance` topic.
+      /// \param[in] _window Spin window duration.
+      public: void SetSpinWindow(
+                  const std::chrono::steady_clock::duration &_window);
+
+      /// \brief Get whether the server caches fully-resolved worlds on
+      /// disk.
+      /// \return True if the world cache is enabled.
+      public: bool UseWorldCache() const;
+
+      /// \brief Set whether the server caches fully-resolved worlds on
+      /// disk. When enabled, the first load of a world file writes the
+      /// world, with every include already resolved, to a cache keyed by
+      /// the file's content hash. Subsequent loads of an unchanged file
+      /// restore the cached copy and skip include resolution and resource
+      /// fetching. Disabled by default.
+      /// \param[in] _cache Value to set.
+      public: void SetUseWorldCache(bool _cache);
+
+      /// \brief Get the set of logical CPUs the stepping thread is
+      /// pinned to.
+      /// \return Zero-based logical CPU indices, empty if unpinned.
+      public: const std::vector<unsigned int> &SteppingThreadAffinity() const;
+
+      /// \brief Set the logical CPUs the stepping thread is pinned to.
+      /// On multi-socket machines, placing the stepping thread and the
+      /// PostUpdate worker pool on cores of the same NUMA node avoids
+      /// cross-node traffic between physics and the systems consuming its
+      /// output. An empty set, the default, leaves the thread unpinned.
+      /// Ignored on platforms without thread affinity support.
+      /// \param[in] _cpus Zero-based logical CPU indices.
+      /// \sa SetPostUpdateThreadAffinity
+      public: void SetSteppingThreadAffinity(
+                  const std::vector<unsigned int> &_cpus);
+
+      /// \brief Get the set of logical CPUs the PostUpdate worker pool
+      /// is pinned to.
+      /// \return Zero-based logical CPU indices, empty if unpinned.
+      public: const std::vector<unsigned int>
+                  &PostUpdateThreadAffinity() const;
+
+      /// \brief Set the logical CPUs the PostUpdate worker pool threads
+      /// are pinned to. The workers share the set; scheduling within it
+      /// is left to the operating system.
+      /// \param[in] _cpus Zero-based logical CPU indices.
+      /// \sa SetSteppingThreadAffinity
+      public: void SetPostUpdateThreadAffinity(
+                  const std::vector<unsigned int> &_cpus);
+
       /// \brief Get whether the server is using the distributed sim system
       /// \return True if the server is set to use the distributed simulation
       /// system
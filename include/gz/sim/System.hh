@@ -18,6 +18,8 @@
 #define GZ_SIM_SYSTEM_HH_
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 
 #include <gz/sim/config.hh>
 #include <gz/sim/EntityComponentManager.hh>
@@ -102,6 +104,45 @@ namespace gz
                   EventManager &_eventMgr) = 0;
     };
 
+    /// \class ISystemConfigureCached ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system whose Configure does heavy parameter
+    /// parsing and can snapshot the parsed result. When a system with an
+    /// identical configuration (same plugin name and SDF element) was
+    /// configured before in this process, the manager calls
+    /// ConfigureCached with the snapshot instead of Configure, skipping
+    /// the re-parse. Systems with cheap Configure calls do not need this
+    /// interface.
+    class ISystemConfigureCached {
+      /// \brief Serialize the configuration produced by the last call to
+      /// Configure. Called by the manager right after Configure, and only
+      /// when no cache entry exists yet for this configuration.
+      /// \return Opaque serialized configuration, passed unmodified to
+      /// ConfigureCached on a later identically-configured instance.
+      /// Return an empty string to skip caching this configuration.
+      public: virtual std::string SerializeConfiguration() const = 0;
+
+      /// \brief Configure from a snapshot previously produced by
+      /// SerializeConfiguration on an instance with an identical plugin
+      /// SDF. Called instead of Configure; implementations must restore
+      /// everything Configure would have set up.
+      /// \param[in] _entity The entity this plugin is attached to.
+      /// \param[in] _sdf The SDF Element associated with this system
+      /// plugin.
+      /// \param[in] _config Serialized configuration snapshot.
+      /// \param[in] _ecm The EntityComponentManager of the given
+      /// simulation instance.
+      /// \param[in] _eventMgr The EventManager of the given simulation
+      /// instance.
+      /// \return True if the snapshot was restored. On false the manager
+      /// falls back to calling Configure.
+      public: virtual bool ConfigureCached(
+                  const Entity &_entity,
+                  const std::shared_ptr<const sdf::Element> &_sdf,
+                  const std::string &_config,
+                  EntityComponentManager &_ecm,
+                  EventManager &_eventMgr) = 0;
+    };
+
     /// \class ISystemConfigureParameters ISystem.hh ignition/gazebo/System.hh
     /// \brief Interface for a system that declares parameters.
     ///
@@ -121,6 +162,24 @@ namespace gz
                                  EntityComponentManager &_ecm) = 0;
     };
 
+    /// \class ISystemStateSerializable ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system that can serialize internal state which
+    /// is not stored in the ECM, so that an equally-configured instance in a
+    /// cloned simulation can be brought to the same state. Systems whose
+    /// state lives entirely in the ECM do not need this interface.
+    /// \sa Server::Clone
+    class ISystemStateSerializable {
+      /// \brief Serialize the system's internal state.
+      /// \return Opaque serialized state, passed unmodified to
+      /// DeserializeState on the clone.
+      public: virtual std::string SerializeState() const = 0;
+
+      /// \brief Restore internal state previously produced by
+      /// SerializeState on an equally-configured instance.
+      /// \param[in] _state Serialized state.
+      public: virtual void DeserializeState(const std::string &_state) = 0;
+    };
+
     /// \class ISystemPreUpdate ISystem.hh gz/sim/System.hh
     /// \brief Interface for a system that uses the PreUpdate phase
     class ISystemPreUpdate {
@@ -141,6 +200,40 @@ namespace gz
       public: virtual void PostUpdate(const UpdateInfo &_info,
                                       const EntityComponentManager &_ecm) = 0;
     };
+
+    /// \brief Declared component usage of a system's PreUpdate and Update
+    /// phases.
+    /// \sa ISystemComponentUsage
+    struct SystemComponentUsage
+    {
+      /// \brief Component types the system reads but never modifies.
+      std::unordered_set<ComponentTypeId> reads;
+
+      /// \brief Component types whose data the system modifies.
+      std::unordered_set<ComponentTypeId> writes;
+    };
+
+    /// \class ISystemComponentUsage ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system that declares which component types its
+    /// PreUpdate and Update phases read and write.
+    ///
+    /// Systems that declare their usage may be scheduled concurrently with
+    /// other declaring systems whose usage does not conflict (i.e. neither
+    /// writes a type the other reads or writes). Systems that do not
+    /// implement this interface keep running sequentially in load order.
+    ///
+    /// \warning A system declaring usage must confine its PreUpdate/Update
+    /// ECM access to the declared types, must only modify the data of
+    /// pre-existing components, and must not create or remove entities or
+    /// components from these phases, since those operations mutate shared
+    /// ECM bookkeeping. Creation and removal must be deferred, for example
+    /// to a queued std::function executed by a later phase.
+    class ISystemComponentUsage {
+      /// \brief Get the component types read and written by this system
+      /// during the PreUpdate and Update phases.
+      /// \return The declared component usage.
+      public: virtual SystemComponentUsage ComponentUsage() const = 0;
+    };
   }
   }
 }
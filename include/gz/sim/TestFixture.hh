@@ -101,6 +101,22 @@ class GZ_SIM_VISIBLE TestFixture
   /// The `OnConfigure` callback is called immediately on finalize.
   public: TestFixture &Finalize();
 
+  /// \brief Reset the world back to its initial state using the fast
+  /// world-reset snapshot and step once so the reset takes effect. This
+  /// enables session reuse across the tests in a binary: construct one
+  /// fixture for the suite (for example in `SetUpTestSuite`), run each
+  /// test against it, and call Reset between tests for isolation instead
+  /// of paying world load and server construction per test.
+  ///
+  /// Registered `On*` callbacks stay in place across resets and can be
+  /// replaced per test. Only suites whose systems support reset should
+  /// opt in: systems must either implement `ISystemReset` or keep no
+  /// state outside the ECM. Suites that load plugins which accumulate
+  /// external state (log recording, sensors with GUI connections) should
+  /// keep using one fixture per test.
+  /// \return Reference to self.
+  public: TestFixture &Reset();
+
   /// \brief Get pointer to underlying server.
   public: std::shared_ptr<sim::Server> Server() const;
 
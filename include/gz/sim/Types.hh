@@ -77,6 +77,27 @@ namespace gz
       OneTimeChange = 2
     };
 
+    /// \brief Kinds of component change events that systems can subscribe
+    /// to on the entity component manager.
+    /// \sa EntityComponentManager::SubscribeComponentChanges
+    enum class ComponentChangeKind
+    {
+      /// \brief A newly created entity has a component of the subscribed
+      /// type. This mirrors what an EachNew scan over the type would find.
+      Created = 0,
+
+      /// \brief A component of the subscribed type was removed from an
+      /// entity during this step.
+      Removed = 1,
+
+      /// \brief A component of the subscribed type suffered a one-time
+      /// change.
+      OneTimeChanged = 2,
+
+      /// \brief A component of the subscribed type changed periodically.
+      PeriodicChanged = 3
+    };
+
     /// \brief A unique identifier for a component type. A component type
     /// must be derived from `components::BaseComponent` and can contain plain
     /// data or something more complex like `gz::math::Pose3d`.
@@ -86,6 +107,12 @@ namespace gz
     using EntityQueryCallback = std::function<void (const UpdateInfo,
         EntityComponentManager &)>;
 
+    /// \brief typedef for callbacks invoked after every step of a batch
+    /// run, with read access to the world state.
+    /// \sa Server::RunBatch
+    using BatchStepCallback = std::function<void (const UpdateInfo &,
+        const EntityComponentManager &)>;
+
     /// \brief Id that indicates an invalid component type.
     static const ComponentTypeId kComponentTypeIdInvalid = UINT64_MAX;
     }
@@ -50,6 +50,27 @@ namespace gz
     math::Pose3d GZ_SIM_VISIBLE worldPose(const Entity &_entity,
         const EntityComponentManager &_ecm);
 
+    /// \brief Create the KinematicsCache component on an entity, populated
+    /// with its current ancestor chain, unless the component already
+    /// exists. Call from a system's Configure so the first system on a
+    /// model builds the cache and later ones reuse it.
+    /// \param[in] _entity Entity to cache the kinematic topology of.
+    /// \param[in] _ecm Mutable reference to ECM.
+    /// \sa cachedWorldPose
+    void GZ_SIM_VISIBLE enableKinematicsCache(const Entity &_entity,
+        EntityComponentManager &_ecm);
+
+    /// \brief Compute the world pose of an entity using its
+    /// KinematicsCache component, composing the Pose components along the
+    /// cached ancestor chain instead of walking ParentEntity components.
+    /// Falls back to worldPose when the entity has no cache.
+    /// \param[in] _entity Entity to get the world pose for
+    /// \param[in] _ecm Immutable reference to ECM.
+    /// \return World pose of entity
+    /// \sa enableKinematicsCache
+    math::Pose3d GZ_SIM_VISIBLE cachedWorldPose(const Entity &_entity,
+        const EntityComponentManager &_ecm);
+
     /// \brief Helper function to compute world velocity of an entity
     /// \param[in] _entity Entity to get the world pose for
     /// \param[in] _ecm Immutable reference to ECM.
@@ -316,6 +337,17 @@ namespace gz
     /// \return The loaded mesh or null if the mesh can not be loaded.
     GZ_SIM_VISIBLE const common::Mesh *loadMesh(const sdf::Mesh &_meshSdf);
 
+    /// \brief Pin the calling thread to a set of logical CPUs. Used to
+    /// keep simulation threads on one NUMA node; see
+    /// ServerConfig::SetSteppingThreadAffinity.
+    /// \param[in] _cpus Zero-based logical CPU indices. Indices beyond
+    /// the machine's CPU count are ignored.
+    /// \return True if the affinity was applied. False if _cpus is empty,
+    /// holds no valid CPU, the system call failed, or the platform has no
+    /// thread affinity support.
+    bool GZ_SIM_VISIBLE setThreadAffinity(
+        const std::vector<unsigned int> &_cpus);
+
     /// \brief Environment variable holding resource paths.
     const std::string kResourcePathEnv{"GZ_SIM_RESOURCE_PATH"};
 
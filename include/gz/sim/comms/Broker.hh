@@ -129,6 +129,14 @@ namespace comms
     /// \param[in] _msg The message from the client.
     public: void OnMsg(const gz::msgs::Dataframe &_msg);
 
+    /// \brief Move the messages received from the clients since the last
+    /// call into the outbound queues, stamping them with the current time.
+    /// Incoming messages are staged in a separate buffer so that client
+    /// callbacks never contend with the comms model step for the main lock;
+    /// the comms model calls this once per step, while holding the lock, to
+    /// route all staged messages in a single pass.
+    public: void DispatchPendingMsgs();
+
     /// \brief Process all the messages in the inbound queue and deliver them
     /// to the destination clients.
     public: void DeliverMsgs();
@@ -150,6 +150,12 @@ class GZ_SIM_VISIBLE MsgManager
   /// \param[in] _newContent New content to be set.
   public: void Set(const Registry &_newContent);
 
+  /// \brief Set the data structure containing subscriptions and data queues,
+  /// taking ownership of the given content. Comms models call this once per
+  /// step, so moving avoids copying every queue and subscription again.
+  /// \param[in] _newContent New content to be set.
+  public: void Set(Registry &&_newContent);
+
   /// \brief Private data pointer.
   GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
 };
@@ -283,6 +283,22 @@ namespace components
     /// \brief Clone the component.
     /// \return A pointer to the component.
     public: virtual std::unique_ptr<BaseComponent> Clone() const = 0;
+
+    /// \brief Copy the data of another component of this same type into this
+    /// component. This is used by the EntityComponentManager to recycle
+    /// component instances without going through the allocator. Component
+    /// types that can't be copied in place can keep the default
+    /// implementation, which reports failure; a new instance is then created
+    /// through the factory instead.
+    /// \param[in] _other Component to copy from. It must have the same type
+    /// id as this component.
+    /// \return True if the data was copied, false if in-place copying is not
+    /// supported by this component type.
+    public: virtual bool CopyFrom(const BaseComponent &_other)
+            {
+              (void)_other;
+              return false;
+            }
   };
 
   /// \brief A component type that wraps any data type. The intention is for
@@ -349,6 +365,9 @@ namespace components
     // Documentation inherited
     public: std::unique_ptr<BaseComponent> Clone() const override;
 
+    // Documentation inherited
+    public: bool CopyFrom(const BaseComponent &_other) override;
+
     // Documentation inherited
     public: ComponentTypeId TypeId() const override;
 
@@ -420,6 +439,9 @@ namespace components
     // Documentation inherited
     public: std::unique_ptr<BaseComponent> Clone() const override;
 
+    // Documentation inherited
+    public: bool CopyFrom(const BaseComponent &_other) override;
+
     // Documentation inherited
     public: ComponentTypeId TypeId() const override;
 
@@ -514,6 +536,16 @@ namespace components
         clonedComp);
   }
 
+  //////////////////////////////////////////////////
+  template <typename DataType, typename Identifier, typename Serializer>
+  bool Component<DataType, Identifier, Serializer>::CopyFrom(
+      const BaseComponent &_other)
+  {
+    this->data = static_cast<
+        const Component<DataType, Identifier, Serializer> &>(_other).Data();
+    return true;
+  }
+
   //////////////////////////////////////////////////
   template <typename DataType, typename Identifier, typename Serializer>
   ComponentTypeId Component<DataType, Identifier, Serializer>::TypeId() const
@@ -545,6 +577,15 @@ namespace components
     return std::make_unique<Component<NoData, Identifier, Serializer>>();
   }
 
+  //////////////////////////////////////////////////
+  template <typename Identifier, typename Serializer>
+  bool Component<NoData, Identifier, Serializer>::CopyFrom(
+      const BaseComponent &)
+  {
+    // Tag components carry no data, so there's nothing to copy.
+    return true;
+  }
+
   //////////////////////////////////////////////////
   template <typename Identifier, typename Serializer>
   ComponentTypeId Component<NoData, Identifier, Serializer>::TypeId() const
@@ -17,6 +17,7 @@
 #ifndef GZ_SIM_COMPONENTS_FACTORY_HH_
 #define GZ_SIM_COMPONENTS_FACTORY_HH_
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <deque>
@@ -284,8 +285,16 @@ namespace components
                   << std::endl;
       }
 
-      // Keep track of all types
-      this->compsById[ComponentTypeT::typeId].Add(_regObjId, _compDesc);
+      // Keep track of all types. Registration is rare, so the dispatch
+      // table is kept sorted on insertion to allow binary searches later.
+      auto descIt = this->LowerBound(ComponentTypeT::typeId);
+      if (descIt == this->compsById.end() ||
+          descIt->first != ComponentTypeT::typeId)
+      {
+        descIt = this->compsById.insert(descIt,
+            {ComponentTypeT::typeId, ComponentDescriptorQueue()});
+      }
+      descIt->second.Add(_regObjId, _compDesc);
       namesById[ComponentTypeT::typeId] = ComponentTypeT::typeName;
       runtimeNamesById[ComponentTypeT::typeId] = runtimeName;
     }
@@ -336,8 +345,8 @@ namespace components
     public: void Unregister(ComponentTypeId _typeId,
                             RegistrationObjectId _regObjId)
     {
-      auto it = this->compsById.find(_typeId);
-      if (it != this->compsById.end())
+      auto it = this->LowerBound(_typeId);
+      if (it != this->compsById.end() && it->first == _typeId)
       {
         it->second.Remove(_regObjId);
 
@@ -368,8 +377,8 @@ namespace components
     {
       // Create a new component if a FactoryFn has been assigned to this type.
       std::unique_ptr<components::BaseComponent> comp;
-      auto it = this->compsById.find(_type);
-      if (it != this->compsById.end())
+      auto it = this->LowerBound(_type);
+      if (it != this->compsById.end() && it->first == _type)
       {
         comp = it->second.Create();
       }
@@ -399,8 +408,8 @@ namespace components
       }
       else
       {
-        auto it = this->compsById.find(_type);
-        if (it != this->compsById.end())
+        auto it = this->LowerBound(_type);
+        if (it != this->compsById.end() && it->first == _type)
         {
           comp = it->second.Create(_data);
         }
@@ -426,7 +435,8 @@ namespace components
     /// return True if registered.
     public: bool HasType(ComponentTypeId _typeId)
     {
-      return this->compsById.find(_typeId) != this->compsById.end();
+      auto it = this->LowerBound(_typeId);
+      return it != this->compsById.end() && it->first == _typeId;
     }
 
     /// \brief Get a component's type name given its type ID.
@@ -439,8 +449,32 @@ namespace components
       return "";
     }
 
+    /// \brief Type of the flat, sorted dispatch table of registered
+    /// component descriptors.
+    private: using DescriptorTable = std::vector<
+        std::pair<ComponentTypeId, ComponentDescriptorQueue>>;
+
+    /// \brief Find the dispatch table position for a component type.
+    /// \param[in] _typeId Type of component to look up.
+    /// \return Iterator pointing at the entry with the given type ID if it
+    /// is registered, otherwise at the position where it would be inserted
+    /// to keep the table sorted.
+    private: GZ_SIM_HIDDEN DescriptorTable::iterator LowerBound(
+        ComponentTypeId _typeId)
+    {
+      return std::lower_bound(this->compsById.begin(), this->compsById.end(),
+          _typeId, [](const DescriptorTable::value_type &_entry,
+                      ComponentTypeId _id)
+          {
+            return _entry.first < _id;
+          });
+    }
+
     /// \brief A list of registered components where the key is its id.
-    private: std::map<ComponentTypeId, ComponentDescriptorQueue> compsById;
+    /// Stored as a sorted flat array so the per-component lookups in state
+    /// deserialization stay on contiguous memory instead of chasing tree
+    /// nodes.
+    private: DescriptorTable compsById;
 
     /// \brief A list of IDs and their equivalent names.
     public: std::map<ComponentTypeId, std::string> namesById;
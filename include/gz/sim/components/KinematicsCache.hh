@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_COMPONENTS_KINEMATICSCACHE_HH_
+#define GZ_SIM_COMPONENTS_KINEMATICSCACHE_HH_
+
+#include <vector>
+
+#include <gz/sim/Entity.hh>
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief Cached kinematic topology of a model: the entity chain from the
+  /// model up to (and excluding) the world. The chain lets consumers
+  /// resolve the model's world pose by composing the Pose components along
+  /// it, without re-walking ParentEntity components every step. The first
+  /// system on a model that needs the chain creates the component, and all
+  /// later systems reuse it; see enableKinematicsCache and cachedWorldPose
+  /// in Util.hh. The chain is rebuilt only when the component is recreated,
+  /// so it must not be used for models that get reparented at runtime.
+  struct KinematicsCacheData
+  {
+    /// \brief Entities from the model up to the world, innermost first.
+    /// Pose components are composed along this chain in reverse order.
+    std::vector<Entity> ancestors;
+
+    public: bool operator==(const KinematicsCacheData &_data) const
+    {
+      return this->ancestors == _data.ancestors;
+    }
+
+    public: bool operator!=(const KinematicsCacheData &_data) const
+    {
+      return !(*this == _data);
+    }
+  };
+}
+
+namespace serializers
+{
+  /// \brief Serializer for KinematicsCacheData object
+  class KinematicsCacheDataSerializer
+  {
+    /// \brief Serialization for `KinematicsCacheData`.
+    /// \param[in] _out Output stream.
+    /// \param[in] _data KinematicsCacheData object to stream
+    /// \return The stream.
+    public: static std::ostream &Serialize(
+                std::ostream &_out,
+                const components::KinematicsCacheData &_data)
+    {
+      for (const auto entity : _data.ancestors)
+        _out << entity << " ";
+      return _out;
+    }
+
+    /// \brief Deserialization for `KinematicsCacheData`.
+    /// \param[in] _in Input stream.
+    /// \param[in] _data KinematicsCacheData object to populate
+    /// \return The stream.
+    public: static std::istream &Deserialize(
+                std::istream &_in, components::KinematicsCacheData &_data)
+    {
+      _data.ancestors.clear();
+      Entity entity;
+      while (_in >> entity)
+        _data.ancestors.push_back(entity);
+      return _in;
+    }
+  };
+}
+
+namespace components
+{
+  /// \brief A component holding the cached kinematic topology of a model.
+  using KinematicsCache =
+      Component<KinematicsCacheData, class KinematicsCacheTag,
+                serializers::KinematicsCacheDataSerializer>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.KinematicsCache",
+                                KinematicsCache)
+}
+}
+}
+}
+
+#endif
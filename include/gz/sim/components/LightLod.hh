@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_COMPONENTS_LIGHTLOD_HH_
+#define GZ_SIM_COMPONENTS_LIGHTLOD_HH_
+
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief Maximum distance, in meters, at which a light still
+  /// contributes to rendering. When every camera in the scene is farther
+  /// away than this, the light is deactivated so it no longer adds to
+  /// per-draw lighting cost; it is reactivated as soon as a camera moves
+  /// back within range. Has no effect on directional lights, which
+  /// illuminate the scene regardless of position.
+  using LightLod = Component<double, class LightLodTag>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.LightLod", LightLod)
+}
+}
+}
+}
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_COMPONENTS_VISUALLOD_HH_
+#define GZ_SIM_COMPONENTS_VISUALLOD_HH_
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <gz/math/Vector3.hh>
+
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief One level of detail for a visual. The visual's authored
+  /// geometry is the implicit finest level; each declared level replaces
+  /// it while the visual's projected screen size drops below the
+  /// thresholds of all finer levels.
+  struct VisualLodLevel
+  {
+    /// \brief Screen-size threshold as a fraction of the viewport height.
+    /// This level is a candidate while the visual's projected bounding
+    /// sphere covers at least this fraction of the viewport. Declare
+    /// levels from finest to coarsest with decreasing thresholds.
+    double minScreenSize{0.0};
+
+    /// \brief URI of the mesh to render at this level. An empty URI hides
+    /// the visual entirely, which can be used as a far-distance cutoff.
+    std::string meshUri;
+
+    /// \brief Name of the submesh to use, if any.
+    std::string submesh;
+
+    /// \brief Scale applied to the level mesh.
+    math::Vector3d scale{math::Vector3d::One};
+
+    public: bool operator==(const VisualLodLevel &_level) const
+    {
+      return math::equal(this->minScreenSize, _level.minScreenSize) &&
+             this->meshUri == _level.meshUri &&
+             this->submesh == _level.submesh &&
+             this->scale == _level.scale;
+    }
+
+    public: bool operator!=(const VisualLodLevel &_level) const
+    {
+      return !(*this == _level);
+    }
+  };
+}
+
+namespace serializers
+{
+  /// \brief Serializer for a vector of components::VisualLodLevel
+  class VisualLodSerializer
+  {
+    /// \brief Serialization for a vector of components::VisualLodLevel
+    /// \param[out] _out Output stream
+    /// \param[in] _levels Levels to stream
+    /// \return The stream
+    public: static std::ostream &Serialize(std::ostream &_out,
+                const std::vector<components::VisualLodLevel> &_levels)
+    {
+      _out << _levels.size();
+      for (const auto &level : _levels)
+      {
+        // URIs may contain spaces, so each field goes on its own line
+        _out << "\n" << level.minScreenSize
+             << "\n" << level.meshUri
+             << "\n" << level.submesh
+             << "\n" << level.scale;
+      }
+      return _out;
+    }
+
+    /// \brief Deserialization for a vector of components::VisualLodLevel
+    /// \param[in] _in Input stream
+    /// \param[out] _levels The levels to populate
+    /// \return The stream
+    public: static std::istream &Deserialize(std::istream &_in,
+                std::vector<components::VisualLodLevel> &_levels)
+    {
+      size_t count = 0;
+      _in >> count;
+      _in.ignore();
+      _levels.resize(count);
+      for (auto &level : _levels)
+      {
+        _in >> level.minScreenSize;
+        _in.ignore();
+        std::getline(_in, level.meshUri);
+        std::getline(_in, level.submesh);
+        _in >> level.scale;
+        _in.ignore();
+      }
+      return _in;
+    }
+  };
+}
+
+namespace components
+{
+  /// \brief A component that holds levels of detail for a visual entity.
+  /// The rendering scene swaps the visual's geometry for the declared
+  /// level meshes based on projected screen size, so distant copies of
+  /// high-poly models render with cheaper geometry without re-authoring
+  /// the original asset.
+  using VisualLod = Component<std::vector<VisualLodLevel>,
+        class VisualLodTag, serializers::VisualLodSerializer>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.VisualLod", VisualLod)
+}
+}
+}
+}
+
+#endif
@@ -17,6 +17,7 @@
 #ifndef GZ_SIM_DETAIL_BASEVIEW_HH_
 #define GZ_SIM_DETAIL_BASEVIEW_HH_
 
+#include <atomic>
 #include <cstddef>
 #include <set>
 #include <unordered_map>
@@ -181,6 +182,15 @@ class GZ_SIM_VISIBLE BaseView
   /// \sa ClearToAddEntities
   public: const std::unordered_map<Entity, bool> &ToAddEntities() const;
 
+  /// \brief Check whether entities are waiting to be added to the view.
+  /// This is an atomic read, so concurrent const queries can poll it
+  /// without a lock: a false result means every prior drain of the
+  /// toAddEntities map (see ClearToAddEntities) is visible and the view's
+  /// cached data can be read directly.
+  /// \return True if MarkEntityToAdd queued entities that have not been
+  /// drained yet.
+  public: bool HasEntitiesToAdd() const;
+
   /// \brief Clear all of the entities that are marked as to be added to the
   /// view. This should be called after all of the entities marked as to be
   /// added to the view are actually added to the view.
@@ -209,6 +219,12 @@ class GZ_SIM_VISIBLE BaseView
   /// indicates whether the entity is new to the entity component manager or not
   protected: std::unordered_map<Entity, bool> toAddEntities;
 
+  /// \brief Whether toAddEntities has undrained entries. Stored with
+  /// release ordering by MarkEntityToAdd and ClearToAddEntities so that
+  /// HasEntitiesToAdd can be polled lock-free from parallel const
+  /// queries.
+  protected: std::atomic<bool> toAddDirty{false};
+
   /// \brief The component types in the view
   protected: std::set<ComponentTypeId> componentTypes;
 };
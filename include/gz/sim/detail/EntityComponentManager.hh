@@ -17,12 +17,15 @@
 #ifndef GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 #define GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -65,6 +68,18 @@ namespace traits
 #pragma GCC diagnostic pop
 #endif
   };
+
+  /// \brief Type trait that determines if std::hash is defined for `T`.
+  template<typename T, typename = void>
+  struct IsStdHashable : std::false_type
+  {
+  };
+
+  template<typename T>
+  struct IsStdHashable<T, std::void_t<decltype(
+      std::declval<std::hash<T>>()(std::declval<T>()))>> : std::true_type
+  {
+  };
 }
 
 //////////////////////////////////////////////////
@@ -173,7 +188,59 @@ bool EntityComponentManager::SetComponentData(const Entity _entity,
     return true;
   }
 
-  return comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+  const bool changed =
+      comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+  if (changed)
+    this->MarkComponentValueIndexDirty(_entity, ComponentTypeT::typeId);
+  return changed;
+}
+
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::EnableComponentValueIndex()
+{
+  static_assert(traits::IsStdHashable<typename ComponentTypeT::Type>::value,
+      "An indexed component type must wrap data hashable with std::hash");
+  static_assert(traits::HasEqualityOperator<
+      typename ComponentTypeT::Type>::value,
+      "An indexed component type must wrap data with an equality operator");
+
+  this->EnableComponentValueIndexImpl(ComponentTypeT::typeId);
+}
+
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::RefreshComponentValueIndex() const
+{
+  // Steady-state fast path: a false dirty read happens-after the refresh
+  // that drained the index last, so the buckets are clean and the query
+  // below stays read-only. Without it, concurrent const queries (e.g.
+  // parallel system PostUpdates) could race to refresh the index.
+  if (!this->ComponentValueIndexDirty(ComponentTypeT::typeId))
+    return;
+
+  const auto lock = this->LockComponentValueIndex(ComponentTypeT::typeId);
+  for (const Entity entity :
+      this->TakeComponentValueIndexDirty(ComponentTypeT::typeId))
+  {
+    // A null component means the entity lost the component (or it's marked
+    // as removed) since the entry was filed; drop it from the index.
+    auto comp = this->Component<ComponentTypeT>(entity);
+    if (comp)
+    {
+      this->RefreshComponentValueIndexEntry(ComponentTypeT::typeId, entity,
+          std::hash<typename ComponentTypeT::Type>{}(comp->Data()), true);
+    }
+    else
+    {
+      this->RefreshComponentValueIndexEntry(ComponentTypeT::typeId, entity,
+          0u, false);
+    }
+  }
+
+  // Cleared only now, after all entries were re-filed, so that threads
+  // taking the fast path above are guaranteed to see them.
+  this->ClearComponentValueIndexDirty(ComponentTypeT::typeId);
 }
 
 //////////////////////////////////////////////////
@@ -181,6 +248,59 @@ template<typename ...ComponentTypeTs>
 Entity EntityComponentManager::EntityByComponents(
     const ComponentTypeTs &..._desiredComponents) const
 {
+  // Fast path: if the first desired component's type has a value index
+  // enabled, probe the bucket of entities holding that value instead of
+  // scanning every entity that has the component types.
+  if constexpr (sizeof...(ComponentTypeTs) > 0)
+  {
+    using FirstComponentTypeT = std::remove_cv_t<std::remove_reference_t<
+        std::tuple_element_t<0, std::tuple<ComponentTypeTs...>>>>;
+
+    if constexpr (traits::IsStdHashable<
+        typename FirstComponentTypeT::Type>::value)
+    {
+      if (this->ComponentValueIndexActive(FirstComponentTypeT::typeId))
+      {
+        this->RefreshComponentValueIndex<FirstComponentTypeT>();
+
+        const auto &firstDesired =
+            std::get<0>(std::forward_as_tuple(_desiredComponents...));
+        const auto *bucket = this->ComponentValueIndexBucket(
+            FirstComponentTypeT::typeId,
+            std::hash<typename FirstComponentTypeT::Type>{}(
+                firstDesired.Data()));
+        if (nullptr == bucket)
+          return kNullEntity;
+
+        for (const Entity entity : *bucket)
+        {
+          bool different{false};
+
+          // Bucket entries only guarantee a hash match on the first
+          // component, so compare all desired components. Unlike the view
+          // scan below, candidates aren't guaranteed to have every type.
+          ForEach([&](const auto &_desiredComponent)
+          {
+            auto entityComponent = this->Component<
+                std::remove_cv_t<std::remove_reference_t<
+                    decltype(_desiredComponent)>>>(entity);
+
+            if (nullptr == entityComponent ||
+                *entityComponent != _desiredComponent)
+            {
+              different = true;
+            }
+          }, _desiredComponents...);
+
+          if (!different)
+            return entity;
+        }
+
+        return kNullEntity;
+      }
+    }
+  }
+
   // Get all entities which have components of the desired types
   const auto &view = this->FindView<ComponentTypeTs...>();
 
@@ -219,6 +339,56 @@ template<typename ...ComponentTypeTs>
 std::vector<Entity> EntityComponentManager::EntitiesByComponents(
     const ComponentTypeTs &..._desiredComponents) const
 {
+  // Fast path through the value index of the first desired component's
+  // type, if one is enabled. See EntityByComponents.
+  if constexpr (sizeof...(ComponentTypeTs) > 0)
+  {
+    using FirstComponentTypeT = std::remove_cv_t<std::remove_reference_t<
+        std::tuple_element_t<0, std::tuple<ComponentTypeTs...>>>>;
+
+    if constexpr (traits::IsStdHashable<
+        typename FirstComponentTypeT::Type>::value)
+    {
+      if (this->ComponentValueIndexActive(FirstComponentTypeT::typeId))
+      {
+        this->RefreshComponentValueIndex<FirstComponentTypeT>();
+
+        std::vector<Entity> result;
+        const auto &firstDesired =
+            std::get<0>(std::forward_as_tuple(_desiredComponents...));
+        const auto *bucket = this->ComponentValueIndexBucket(
+            FirstComponentTypeT::typeId,
+            std::hash<typename FirstComponentTypeT::Type>{}(
+                firstDesired.Data()));
+        if (nullptr == bucket)
+          return result;
+
+        for (const Entity entity : *bucket)
+        {
+          bool different{false};
+
+          ForEach([&](const auto &_desiredComponent)
+          {
+            auto entityComponent = this->Component<
+                std::remove_cv_t<std::remove_reference_t<
+                    decltype(_desiredComponent)>>>(entity);
+
+            if (nullptr == entityComponent ||
+                *entityComponent != _desiredComponent)
+            {
+              different = true;
+            }
+          }, _desiredComponents...);
+
+          if (!different)
+            result.push_back(entity);
+        }
+
+        return result;
+      }
+    }
+  }
+
   // Get all entities which have components of the desired types
   const auto &view = this->FindView<ComponentTypeTs...>();
 
@@ -386,6 +556,43 @@ constexpr bool applyFunction(const FuncT &_f, const Entity &_entity,
   return applyFunctionImpl<ComponentTypeTs...>(
       _f, _entity, _data, std::index_sequence_for<ComponentTypeTs...>{});
 }
+
+/// \brief Helper template to call a callback function with a row of component
+/// pointers from a view's packed component data array.
+/// \tparam ComponentTypeTs The actual types of each of the components.
+/// \tparam FuncT The type of the callback function.
+/// \tparam Is Index sequence used to expand the row of component pointers.
+/// \param[in] _f The callback function
+/// \param[in] _entity The entity associated with the components.
+/// \param[in] _data Pointer to the first component pointer of the entity's
+/// row in the packed component data array.
+/// \return The value returned by the function _f.
+template <typename... ComponentTypeTs, typename FuncT, std::size_t... Is>
+constexpr decltype(auto) applyFunctionPackedImpl(
+                       const FuncT &_f, const Entity &_entity,
+                       components::BaseComponent *const *_data,
+                       std::index_sequence<Is...>)
+{
+  return _f(_entity, static_cast<ComponentTypeTs *>(_data[Is])...);
+}
+
+/// \brief Helper template to call a callback function with a row of component
+/// pointers from a view's packed component data array.
+/// \tparam ComponentTypeTs The actual types of each of the components.
+/// \tparam FuncT The type of the callback function.
+/// \param[in] _f The callback function
+/// \param[in] _entity The entity associated with the components.
+/// \param[in] _data Pointer to the first component pointer of the entity's
+/// row in the packed component data array.
+/// \return The value returned by the function _f.
+template <typename... ComponentTypeTs, typename FuncT>
+constexpr decltype(auto) applyFunctionPacked(
+                   const FuncT &_f, const Entity &_entity,
+                   components::BaseComponent *const *_data)
+{
+  return applyFunctionPackedImpl<ComponentTypeTs...>(
+      _f, _entity, _data, std::index_sequence_for<ComponentTypeTs...>{});
+}
 }  // namespace detail
 
 //////////////////////////////////////////////////
@@ -397,12 +604,15 @@ void EntityComponentManager::Each(typename identity<std::function<
   // exist.
   auto view = this->FindView<ComponentTypeTs...>();
 
-  // Iterate over the entities in the view, and invoke the callback
-  // function.
-  for (const Entity entity : view->Entities())
+  // Do a linear sweep over the view's packed entity/component arrays, and
+  // invoke the callback function.
+  const auto &entities = view->PackedEntities();
+  const auto &data = view->PackedComponentData();
+  constexpr std::size_t stride = sizeof...(ComponentTypeTs);
+  for (std::size_t i = 0; i < entities.size(); ++i)
   {
-    const auto &data = view->EntityComponentData(entity);
-    if (!detail::applyFunction<const ComponentTypeTs...>(_f, entity, data))
+    if (!detail::applyFunctionPacked<const ComponentTypeTs...>(_f,
+        entities[i], data.data() + i * stride))
     {
       break;
     }
@@ -418,18 +628,176 @@ void EntityComponentManager::Each(typename identity<std::function<
   // exist.
   auto view = this->FindView<ComponentTypeTs...>();
 
-  // Iterate over the entities in the view, and invoke the callback
-  // function.
-  for (const Entity entity : view->Entities())
+  // Do a linear sweep over the view's packed entity/component arrays, and
+  // invoke the callback function.
+  const auto &entities = view->PackedEntities();
+  const auto &data = view->PackedComponentData();
+  constexpr std::size_t stride = sizeof...(ComponentTypeTs);
+  for (std::size_t i = 0; i < entities.size(); ++i)
   {
-    const auto &data = view->EntityComponentData(entity);
-    if (!detail::applyFunction<ComponentTypeTs...>(_f, entity, data))
+    if (!detail::applyFunctionPacked<ComponentTypeTs...>(_f,
+        entities[i], data.data() + i * stride))
     {
       break;
     }
   }
 }
 
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+detail::CachedView<ComponentTypeTs...>
+    EntityComponentManager::CachedView() const
+{
+  return detail::CachedView<ComponentTypeTs...>(this);
+}
+
+//////////////////////////////////////////////////
+namespace detail
+{
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+CachedView<ComponentTypeTs...>::CachedView(
+    const EntityComponentManager *_ecm)
+  : ecm(_ecm)
+{
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+View *CachedView<ComponentTypeTs...>::Resolve() const
+{
+  // Any pending entity additions to the view, as well as any invalidation
+  // of the view itself, are the result of a structural change, so the
+  // cached pointer can be reused as long as the epoch is unchanged.
+  const uint64_t currentEpoch = this->ecm->StructuralEpoch();
+  if (nullptr == this->view || this->epoch != currentEpoch)
+  {
+    this->view = this->ecm->FindView<ComponentTypeTs...>();
+    this->epoch = currentEpoch;
+  }
+  return this->view;
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void CachedView<ComponentTypeTs...>::Each(
+    std::function<bool(const Entity &_entity,
+        const ComponentTypeTs *...)> _f) const
+{
+  auto resolvedView = this->Resolve();
+
+  const auto &entities = resolvedView->PackedEntities();
+  const auto &data = resolvedView->PackedComponentData();
+  constexpr std::size_t stride = sizeof...(ComponentTypeTs);
+  for (std::size_t i = 0; i < entities.size(); ++i)
+  {
+    if (!applyFunctionPacked<const ComponentTypeTs...>(_f,
+        entities[i], data.data() + i * stride))
+    {
+      break;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void CachedView<ComponentTypeTs...>::Each(
+    std::function<bool(const Entity &_entity, ComponentTypeTs *...)> _f)
+{
+  auto resolvedView = this->Resolve();
+
+  const auto &entities = resolvedView->PackedEntities();
+  const auto &data = resolvedView->PackedComponentData();
+  constexpr std::size_t stride = sizeof...(ComponentTypeTs);
+  for (std::size_t i = 0; i < entities.size(); ++i)
+  {
+    if (!applyFunctionPacked<ComponentTypeTs...>(_f,
+        entities[i], data.data() + i * stride))
+    {
+      break;
+    }
+  }
+}
+}  // namespace detail
+
+//////////////////////////////////////////////////
+namespace detail
+{
+/// \brief Helper for EachParallel: invoke a callback for a contiguous range
+/// of a view's packed entity/component arrays, splitting the range across
+/// worker threads when there's enough work to go around.
+/// \tparam ComponentTypeTs The actual types of each of the components.
+/// \tparam FuncT The type of the callback function.
+/// \param[in] _f The callback function.
+/// \param[in] _entities The view's packed entity array.
+/// \param[in] _data The view's packed component data array, with a stride of
+/// sizeof...(ComponentTypeTs) pointers per entity.
+template <typename... ComponentTypeTs, typename FuncT>
+void eachParallelImpl(const FuncT &_f, const std::vector<Entity> &_entities,
+    const std::vector<components::BaseComponent *> &_data)
+{
+  constexpr std::size_t stride = sizeof...(ComponentTypeTs);
+  const std::size_t numEntities = _entities.size();
+  if (0 == numEntities)
+    return;
+
+  auto rangeFunctor = [&](std::size_t _begin, std::size_t _end)
+  {
+    for (std::size_t i = _begin; i < _end; ++i)
+    {
+      applyFunctionPacked<ComponentTypeTs...>(_f, _entities[i],
+          _data.data() + i * stride);
+    }
+  };
+
+  std::size_t numThreads = std::min<std::size_t>(
+      std::max(1u, std::thread::hardware_concurrency()), numEntities);
+  if (numThreads <= 1)
+  {
+    rangeFunctor(0, numEntities);
+    return;
+  }
+
+  const std::size_t perThread = (numEntities + numThreads - 1) / numThreads;
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads);
+  for (std::size_t begin = 0; begin < numEntities; begin += perThread)
+  {
+    const std::size_t end = std::min(begin + perThread, numEntities);
+    workers.push_back(std::thread(rangeFunctor, begin, end));
+  }
+
+  for (auto &worker : workers)
+    worker.join();
+}
+}  // namespace detail
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    void(const Entity &_entity, const ComponentTypeTs *...)>>::type _f) const
+{
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  detail::eachParallelImpl<const ComponentTypeTs...>(_f,
+      view->PackedEntities(), view->PackedComponentData());
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    void(const Entity &_entity, ComponentTypeTs *...)>>::type _f)
+{
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  detail::eachParallelImpl<ComponentTypeTs...>(_f,
+      view->PackedEntities(), view->PackedComponentData());
+}
+
 //////////////////////////////////////////////////
 template <class Function, class... ComponentTypeTs>
 void EntityComponentManager::ForEach(Function _f,
@@ -516,6 +884,13 @@ detail::View *EntityComponentManager::FindView() const
   {
     auto view = static_cast<detail::View*>(baseViewPtr);
 
+    // Steady-state fast path: nothing is pending for this view, so skip
+    // both the per-view lock and the drain loop. The atomic flag is
+    // released by the thread that drained last, so a false read here
+    // guarantees the view's cached data is fully published.
+    if (!view->HasEntitiesToAdd())
+      return view;
+
     std::unique_ptr<std::lock_guard<std::mutex>> viewLock;
     if (this->LockAddingEntitiesToViews())
     {
@@ -547,28 +922,29 @@ detail::View *EntityComponentManager::FindView() const
     return view;
   }
 
-  // create a new view if one wasn't found
-  detail::View view(std::set<ComponentTypeId>{ComponentTypeTs::typeId...});
+  // create a new view if one wasn't found. The view is built in place
+  // because views aren't movable (BaseView carries an atomic flag).
+  auto view = std::make_unique<detail::View>(
+      std::set<ComponentTypeId>{ComponentTypeTs::typeId...});
 
   for (const auto &vertex : this->Entities().Vertices())
   {
     Entity entity = vertex.first;
 
     // only add entities to the view that have all of the components in viewKey
-    if (!this->EntityMatches(entity, view.ComponentTypes()))
+    if (!this->EntityMatches(entity, view->ComponentTypes()))
       continue;
 
-    view.AddEntityWithConstComps(entity, this->IsNewEntity(entity),
+    view->AddEntityWithConstComps(entity, this->IsNewEntity(entity),
         this->Component<ComponentTypeTs>(entity)...);
-    view.AddEntityWithComps(entity, this->IsNewEntity(entity),
+    view->AddEntityWithComps(entity, this->IsNewEntity(entity),
         const_cast<EntityComponentManager*>(this)->Component<ComponentTypeTs>(
             entity)...);
     if (this->IsMarkedForRemoval(entity))
-      view.MarkEntityToRemove(entity);
+      view->MarkEntityToRemove(entity);
   }
 
-  baseViewPtr = this->AddView(viewKey,
-      std::make_unique<detail::View>(std::move(view)));
+  baseViewPtr = this->AddView(viewKey, std::move(view));
   return static_cast<detail::View *>(baseViewPtr);
 }
 
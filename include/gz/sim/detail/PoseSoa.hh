@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_DETAIL_POSESOA_HH_
+#define GZ_SIM_DETAIL_POSESOA_HH_
+
+#include <cstddef>
+#include <vector>
+
+#include <gz/math/Pose3.hh>
+
+#include "gz/sim/Entity.hh"
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/components/Pose.hh"
+#include "gz/sim/config.hh"
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace detail
+{
+/// \brief A structure-of-arrays pose buffer for bulk pose consumers.
+///
+/// math::Pose3d stores each pose as a quaternion plus a vector, so code
+/// that transforms or exports many poses per step touches them one object
+/// at a time. This buffer keeps the seven scalar channels (position x/y/z,
+/// rotation w/x/y/z) in separate contiguous arrays, and its kernels are
+/// plain index loops over those arrays so compilers can vectorize them.
+/// Gather once per step, run the bulk kernel, scatter or serialize the
+/// result.
+class PoseSoa
+{
+  /// \brief Number of poses in the buffer.
+  /// \return The pose count.
+  public: std::size_t Size() const
+  {
+    return this->x.size();
+  }
+
+  /// \brief Remove all poses, keeping the array capacity for reuse.
+  public: void Clear()
+  {
+    this->x.clear();
+    this->y.clear();
+    this->z.clear();
+    this->qw.clear();
+    this->qx.clear();
+    this->qy.clear();
+    this->qz.clear();
+  }
+
+  /// \brief Reserve capacity for a number of poses.
+  /// \param[in] _capacity Number of poses to reserve room for.
+  public: void Reserve(const std::size_t _capacity)
+  {
+    this->x.reserve(_capacity);
+    this->y.reserve(_capacity);
+    this->z.reserve(_capacity);
+    this->qw.reserve(_capacity);
+    this->qx.reserve(_capacity);
+    this->qy.reserve(_capacity);
+    this->qz.reserve(_capacity);
+  }
+
+  /// \brief Resize the buffer to a number of poses. New entries are
+  /// identity poses.
+  /// \param[in] _size The new pose count.
+  public: void Resize(const std::size_t _size)
+  {
+    this->x.resize(_size, 0.0);
+    this->y.resize(_size, 0.0);
+    this->z.resize(_size, 0.0);
+    this->qw.resize(_size, 1.0);
+    this->qx.resize(_size, 0.0);
+    this->qy.resize(_size, 0.0);
+    this->qz.resize(_size, 0.0);
+  }
+
+  /// \brief Append a pose to the buffer.
+  /// \param[in] _pose The pose to append.
+  public: void PushBack(const math::Pose3d &_pose)
+  {
+    this->x.push_back(_pose.Pos().X());
+    this->y.push_back(_pose.Pos().Y());
+    this->z.push_back(_pose.Pos().Z());
+    this->qw.push_back(_pose.Rot().W());
+    this->qx.push_back(_pose.Rot().X());
+    this->qy.push_back(_pose.Rot().Y());
+    this->qz.push_back(_pose.Rot().Z());
+  }
+
+  /// \brief Overwrite the pose at an index.
+  /// \param[in] _index Index of the pose to overwrite.
+  /// \param[in] _pose The new pose.
+  public: void Set(const std::size_t _index, const math::Pose3d &_pose)
+  {
+    this->x[_index] = _pose.Pos().X();
+    this->y[_index] = _pose.Pos().Y();
+    this->z[_index] = _pose.Pos().Z();
+    this->qw[_index] = _pose.Rot().W();
+    this->qx[_index] = _pose.Rot().X();
+    this->qy[_index] = _pose.Rot().Y();
+    this->qz[_index] = _pose.Rot().Z();
+  }
+
+  /// \brief Reassemble the pose at an index.
+  /// \param[in] _index Index of the pose to read.
+  /// \return The pose at that index.
+  public: math::Pose3d Pose(const std::size_t _index) const
+  {
+    return math::Pose3d(this->x[_index], this->y[_index], this->z[_index],
+        this->qw[_index], this->qx[_index], this->qy[_index],
+        this->qz[_index]);
+  }
+
+  /// \brief Compose two pose buffers element-wise: out[i] = a[i] * b[i],
+  /// with the same frame semantics as math::Pose3d::operator*, where a
+  /// holds the parent poses and b the local poses.
+  ///
+  /// The output buffer is resized to match and may alias neither input.
+  /// \param[in] _a Parent poses.
+  /// \param[in] _b Local poses; must have the same size as _a.
+  /// \param[out] _out Receives the composed poses.
+  public: static void Compose(const PoseSoa &_a, const PoseSoa &_b,
+              PoseSoa &_out)
+  {
+    const std::size_t count = _a.Size();
+    _out.Resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const double aw = _a.qw[i], ax = _a.qx[i], ay = _a.qy[i],
+          az = _a.qz[i];
+      const double bw = _b.qw[i], bx = _b.qx[i], by = _b.qy[i],
+          bz = _b.qz[i];
+
+      // Rotate b's position by a's rotation: v' = q * v * q^-1, expanded
+      // to the two-cross-product form to stay branch and division free.
+      const double vx = _b.x[i], vy = _b.y[i], vz = _b.z[i];
+      const double tx = 2.0 * (ay * vz - az * vy);
+      const double ty = 2.0 * (az * vx - ax * vz);
+      const double tz = 2.0 * (ax * vy - ay * vx);
+      _out.x[i] = _a.x[i] + vx + aw * tx + (ay * tz - az * ty);
+      _out.y[i] = _a.y[i] + vy + aw * ty + (az * tx - ax * tz);
+      _out.z[i] = _a.z[i] + vz + aw * tz + (ax * ty - ay * tx);
+
+      // Hamilton product a * b.
+      _out.qw[i] = aw * bw - ax * bx - ay * by - az * bz;
+      _out.qx[i] = aw * bx + ax * bw + ay * bz - az * by;
+      _out.qy[i] = aw * by - ax * bz + ay * bw + az * bx;
+      _out.qz[i] = aw * bz + ax * by - ay * bx + az * bw;
+    }
+  }
+
+  /// \brief Copy the buffer into an interleaved single-precision layout,
+  /// seven floats per pose in x, y, z, qw, qx, qy, qz order. This is the
+  /// layout bulk rendering and message consumers upload, so the narrowing
+  /// conversion happens in one sweep instead of per entity.
+  /// \param[out] _dst Destination buffer; must hold at least
+  /// 7 * Size() floats.
+  public: void CopyInterleavedFloat(float *_dst) const
+  {
+    const std::size_t count = this->Size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      _dst[7 * i + 0] = static_cast<float>(this->x[i]);
+      _dst[7 * i + 1] = static_cast<float>(this->y[i]);
+      _dst[7 * i + 2] = static_cast<float>(this->z[i]);
+      _dst[7 * i + 3] = static_cast<float>(this->qw[i]);
+      _dst[7 * i + 4] = static_cast<float>(this->qx[i]);
+      _dst[7 * i + 5] = static_cast<float>(this->qy[i]);
+      _dst[7 * i + 6] = static_cast<float>(this->qz[i]);
+    }
+  }
+
+  /// \brief Position x channel.
+  public: std::vector<double> x;
+
+  /// \brief Position y channel.
+  public: std::vector<double> y;
+
+  /// \brief Position z channel.
+  public: std::vector<double> z;
+
+  /// \brief Rotation w channel.
+  public: std::vector<double> qw;
+
+  /// \brief Rotation x channel.
+  public: std::vector<double> qx;
+
+  /// \brief Rotation y channel.
+  public: std::vector<double> qy;
+
+  /// \brief Rotation z channel.
+  public: std::vector<double> qz;
+};
+
+/// \brief Gather the poses of all entities that have a Pose component
+/// plus the given tag components into a PoseSoa buffer, in the packed
+/// iteration order of the matching view.
+/// \param[in] _ecm The entity component manager to gather from.
+/// \param[out] _poses Receives one pose per matching entity; cleared
+/// first, capacity is kept across calls.
+/// \param[out] _entities If non-null, receives the matching entities in
+/// the same order as the poses; cleared first.
+/// \tparam ComponentTypeTs Additional component types the entities must
+/// have.
+template<typename ...ComponentTypeTs>
+void GatherPoses(const EntityComponentManager &_ecm, PoseSoa &_poses,
+    std::vector<Entity> *_entities = nullptr)
+{
+  _poses.Clear();
+  if (_entities)
+    _entities->clear();
+
+  _ecm.Each<components::Pose, ComponentTypeTs...>(
+      [&](const Entity &_entity, const components::Pose *_pose,
+          const ComponentTypeTs *...) -> bool
+      {
+        _poses.PushBack(_pose->Data());
+        if (_entities)
+          _entities->push_back(_entity);
+        return true;
+      });
+}
+}  // namespace detail
+}  // namespace GZ_SIM_VERSION_NAMESPACE
+}  // namespace sim
+}  // namespace gz
+#endif
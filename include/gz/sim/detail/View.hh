@@ -17,6 +17,8 @@
 #ifndef GZ_SIM_DETAIL_VIEW_HH_
 #define GZ_SIM_DETAIL_VIEW_HH_
 
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <tuple>
 #include <unordered_map>
@@ -79,6 +81,26 @@ class GZ_SIM_VISIBLE View : public BaseView
   /// component data are returned.
   public: const ComponentData &EntityComponentData(const Entity _entity) const;
 
+  /// \brief Get all of the view's entities, packed into a contiguous array.
+  /// The order of the entities in this array matches the order of the
+  /// component data returned by PackedComponentData. If entities were added
+  /// to or removed from the view since the last call to this method, the
+  /// packed arrays are rebuilt before being returned.
+  /// \return The view's entities, in ascending entity order.
+  /// \sa PackedComponentData
+  public: const std::vector<Entity> &PackedEntities() const;
+
+  /// \brief Get the component data of all of the view's entities, packed into
+  /// one contiguous array. The array holds one row of component pointers per
+  /// entity in PackedEntities, in the same order, with a stride equal to the
+  /// number of component types in the view. Sweeping over this array avoids
+  /// the per-entity map lookup that EntityComponentData performs, which keeps
+  /// Each() iteration linear over cache-resident data.
+  /// \return The packed component data.
+  /// \sa PackedEntities
+  public: const std::vector<components::BaseComponent *>
+              &PackedComponentData() const;
+
   /// \brief Add an entity with its component data to the view. It is assumed
   /// that the entity to be added does not already exist in the view.
   /// \tparam ComponentTypeTs The component type(s) that are stored in this
@@ -158,6 +180,33 @@ class GZ_SIM_VISIBLE View : public BaseView
   /// \sa invalidData
   private: std::unordered_map<Entity, std::unordered_set<ComponentTypeId>>
              missingCompTracker;
+
+  /// \brief Rebuild the packed entity/component arrays from validData.
+  /// \sa PackedEntities, PackedComponentData
+  private: void RebuildPackedData() const;
+
+  /// \brief The view's entities, packed into a contiguous array. This is
+  /// rebuilt lazily whenever the view's membership changes.
+  /// \sa PackedEntities
+  private: mutable std::vector<Entity> packedEntities;
+
+  /// \brief The component data of the view's entities, packed into one
+  /// contiguous array with a stride of componentTypes.size() pointers per
+  /// entity. This is rebuilt lazily whenever the view's membership changes.
+  /// \sa PackedComponentData
+  private: mutable std::vector<components::BaseComponent *> packedData;
+
+  /// \brief Whether the packed arrays are out of date with respect to
+  /// validData and need to be rebuilt before their next use. A false
+  /// read happens-after the rebuild that cleared it, so the packed
+  /// arrays may then be read without locking.
+  private: mutable std::atomic<bool> packedDataDirty{true};
+
+  /// \brief Serializes the lazy rebuild of the packed arrays between
+  /// concurrent const accessors, e.g. parallel system PostUpdates
+  /// calling Each with the same view signature. Not taken in the steady
+  /// state, when packedDataDirty is false.
+  private: mutable std::mutex packedDataMutex;
 };
 
 //////////////////////////////////////////////////
@@ -168,6 +217,7 @@ void View::AddEntityWithConstComps(const Entity &_entity, const bool _new,
   this->validConstData[_entity] =
       std::vector<const components::BaseComponent *>{_compPtrs...};
   this->entities.insert(_entity);
+  this->packedDataDirty = true;
   if (_new)
     this->newEntities.insert(_entity);
 }
@@ -180,6 +230,7 @@ void View::AddEntityWithComps(const Entity &_entity, const bool _new,
   this->validData[_entity] =
       std::vector<components::BaseComponent *>{_compPtrs...};
   this->entities.insert(_entity);
+  this->packedDataDirty = true;
   if (_new)
     this->newEntities.insert(_entity);
 }
@@ -141,6 +141,25 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     /// \param[in] _winID Window ID
     public: void SetWinID(const std::string &_winID);
 
+    /// \brief Set the directory where the render engine persists compiled
+    /// shaders and pipeline state across runs. The directory is shared
+    /// between processes, so concurrent headless simulations on one
+    /// machine reuse each other's compiled shaders. When unset, a
+    /// per-user default under the home directory is used, keyed by the
+    /// engine name; engines add their own driver-specific sub-keys.
+    /// Engines without shader cache support ignore the parameter.
+    /// \param[in] _path Shader cache directory.
+    public: void SetShaderCachePath(const std::string &_path);
+
+    /// \brief Set whether to interpolate entity poses at render time. When
+    /// enabled, the last two received poses of each entity are blended so
+    /// the display stays smooth when frames are rendered faster than state
+    /// updates arrive; large jumps snap instead of animating. Keep disabled
+    /// when rendering sensors, which need the exact pose at the current sim
+    /// time.
+    /// \param[in] _enable True to interpolate poses
+    public: void SetPoseInterpolation(bool _enable);
+
     /// \brief Set whether to create rendering sensors
     /// \param[in] _enable True to create rendering sensors
     /// \param[in] _createSensorCb Callback function for creating the sensors
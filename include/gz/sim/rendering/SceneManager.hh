@@ -49,6 +49,7 @@
 #include <gz/rendering/RenderTypes.hh>
 
 #include <gz/sim/config.hh>
+#include <gz/sim/components/VisualLod.hh>
 #include <gz/sim/Entity.hh>
 #include <gz/sim/rendering/Export.hh>
 
@@ -174,6 +175,44 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     public: rendering::VisualPtr CreateVisual(Entity _id,
         const sdf::Visual &_visual, Entity _parentId = 0);
 
+    /// \brief Register levels of detail for an existing visual. The
+    /// visual's authored geometry becomes the implicit finest level and
+    /// each declared level is loaded into a hidden child visual, ready to
+    /// be swapped in by UpdateVisualLods.
+    /// \param[in] _id Visual entity id
+    /// \param[in] _levels Levels of detail, ordered finest to coarsest
+    /// with decreasing screen-size thresholds
+    public: void SetVisualLod(Entity _id,
+        const std::vector<components::VisualLodLevel> &_levels);
+
+    /// \brief Select the active level of detail for every visual
+    /// registered through SetVisualLod, based on the projected screen
+    /// size of the visual's bounding sphere. All cameras in the scene are
+    /// considered and the finest level required by any of them wins, so
+    /// a shared sensor scene never renders a coarser mesh than its most
+    /// demanding camera needs. Intended to be called once per render
+    /// frame.
+    public: void UpdateVisualLods();
+
+    /// \brief Register a maximum visible distance for an existing light.
+    /// The light stays active while any camera in the scene is within
+    /// this distance and is deactivated otherwise, see UpdateLightLods.
+    /// Directional lights are ignored since their position does not
+    /// determine their contribution.
+    /// \param[in] _id Light entity id
+    /// \param[in] _maxDistance Maximum distance in meters from the
+    /// closest camera at which the light remains active
+    public: void SetLightLod(Entity _id, double _maxDistance);
+
+    /// \brief Activate or deactivate every light registered through
+    /// SetLightLod based on its distance to the closest camera in the
+    /// scene. The scene is shared by all cameras, so a light within
+    /// range of any camera stays active. Deactivation zeroes the light's
+    /// intensity and restores it on reactivation, so lights out of range
+    /// of every camera stop contributing to per-draw lighting cost.
+    /// Intended to be called once per render frame.
+    public: void UpdateLightLods();
+
     /// \brief Create a center of mass visual
     /// \param[in] _id Unique visual id
     /// \param[in] _inertial Inertial component of the link
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_VIDEOCAPTURE_HH_
+#define GZ_SIM_VIDEOCAPTURE_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gz/sim/rendering/Export.hh>
+
+#include "gz/rendering/Image.hh"
+
+namespace gz
+{
+namespace sim
+{
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+// Forward declare private data class.
+class VideoCapturePrivate;
+
+/// \brief Encodes rendered camera frames into a video file on a worker
+/// thread, so video recording does not stall the thread doing the
+/// rendering. Frames queued with AddFrame are copied into recycled
+/// buffers and handed to the encoder through a bounded queue; when the
+/// encoder falls behind, frames are either dropped or, optionally, the
+/// caller is blocked until the queue drains. Used by both the GUI video
+/// recorder and the camera video recorder system.
+class GZ_SIM_RENDERING_VISIBLE VideoCapture
+{
+  /// \brief Constructor
+  public: VideoCapture();
+
+  /// \brief Destructor. Shuts down the encoder thread without
+  /// finalizing the video file; call Stop for a usable recording.
+  public: ~VideoCapture();
+
+  /// \brief Set the topic on which per-frame recording statistics are
+  /// published. Each successfully encoded frame publishes the elapsed
+  /// recording time as a msgs::Time.
+  /// \param[in] _topic Statistics topic name. An empty name disables
+  /// the statistics publication.
+  public: void SetStatsTopic(const std::string &_topic);
+
+  /// \brief Set what happens when frames arrive faster than the encoder
+  /// consumes them. By default new frames are dropped so the rendering
+  /// thread never stalls; when recording in lockstep, set this to false
+  /// so AddFrame blocks until the encoder catches up and every frame is
+  /// kept.
+  /// \param[in] _drop True to drop frames when the queue is full, false
+  /// to block the caller instead
+  public: void SetDropOnOverflow(bool _drop);
+
+  /// \brief Start encoding to a file and spawn the encoder thread.
+  /// \param[in] _format Video encoding format, e.g. "mp4"
+  /// \param[in] _filename Path of the file to write
+  /// \param[in] _width Frame width in pixels
+  /// \param[in] _height Frame height in pixels
+  /// \param[in] _fps Frames per second
+  /// \param[in] _bitrate Bitrate in bps
+  /// \return True if the encoder started
+  public: bool Start(const std::string &_format,
+      const std::string &_filename, unsigned int _width,
+      unsigned int _height, unsigned int _fps, unsigned int _bitrate);
+
+  /// \brief Get whether a recording is in progress.
+  /// \return True between a successful Start and the matching Stop
+  public: bool Encoding() const;
+
+  /// \brief Queue one rendered frame for encoding. The image data is
+  /// copied, so the caller may reuse the image immediately.
+  /// \param[in] _image Image copied from the camera
+  /// \param[in] _stamp Capture timestamp passed to the encoder
+  public: void AddFrame(const rendering::Image &_image,
+      const std::chrono::steady_clock::time_point &_stamp);
+
+  /// \brief Drain the pending frames, join the encoder thread and
+  /// finalize the video file.
+  /// \return True if encoding was stopped successfully
+  public: bool Stop();
+
+  /// \brief Get the number of frames dropped since Start because the
+  /// encoder fell behind.
+  /// \return Dropped frame count
+  public: uint64_t DroppedFrames() const;
+
+  /// \internal
+  /// \brief Private data pointer
+  private: std::unique_ptr<VideoCapturePrivate> dataPtr;
+};
+}
+}
+}
+
+#endif
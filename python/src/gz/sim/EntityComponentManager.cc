@@ -13,7 +13,16 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <limits>
+#include <vector>
+
+#include "gz/sim/components/AngularVelocity.hh"
+#include "gz/sim/components/LinearVelocity.hh"
+#include "gz/sim/components/Pose.hh"
 
 #include "EntityComponentManager.hh"
 
@@ -23,12 +32,160 @@ namespace sim
 {
 namespace python
 {
+namespace
+{
+/// \brief Fill one N x 3 row-major array from a vector component type,
+/// with the GIL released during the copy. Entities missing the component
+/// get NaN rows.
+template <typename ComponentTypeT>
+pybind11::array_t<double> BatchedVectors(
+    const gz::sim::EntityComponentManager &_ecm,
+    const std::vector<gz::sim::Entity> &_entities)
+{
+  pybind11::array_t<double> result(
+      {static_cast<pybind11::ssize_t>(_entities.size()),
+       static_cast<pybind11::ssize_t>(3)});
+  auto buffer = result.template mutable_unchecked<2>();
+
+  pybind11::gil_scoped_release release;
+  for (size_t i = 0; i < _entities.size(); ++i)
+  {
+    auto *comp = _ecm.Component<ComponentTypeT>(_entities[i]);
+    if (nullptr != comp)
+    {
+      buffer(i, 0) = comp->Data().X();
+      buffer(i, 1) = comp->Data().Y();
+      buffer(i, 2) = comp->Data().Z();
+    }
+    else
+    {
+      for (int j = 0; j < 3; ++j)
+        buffer(i, j) = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  return result;
+}
+
+/// \brief Apply one N x 3 row-major array to a vector component type,
+/// with the GIL released during the copy. Missing components are created.
+template <typename ComponentTypeT>
+void SetBatchedVectors(gz::sim::EntityComponentManager &_ecm,
+    const std::vector<gz::sim::Entity> &_entities,
+    const pybind11::array_t<double,
+        pybind11::array::c_style | pybind11::array::forcecast> &_data)
+{
+  if (_data.ndim() != 2 ||
+      _data.shape(0) != static_cast<pybind11::ssize_t>(_entities.size()) ||
+      _data.shape(1) != 3)
+  {
+    throw pybind11::value_error(
+        "Expected an array of shape (len(entities), 3)");
+  }
+  auto buffer = _data.template unchecked<2>();
+
+  pybind11::gil_scoped_release release;
+  for (size_t i = 0; i < _entities.size(); ++i)
+  {
+    _ecm.SetComponentData<ComponentTypeT>(_entities[i],
+        gz::math::Vector3d(buffer(i, 0), buffer(i, 1), buffer(i, 2)));
+  }
+}
+}  // namespace
+
 /////////////////////////////////////////////////
 void defineSimEntityComponentManager(pybind11::object module)
 {
   pybind11::class_<gz::sim::EntityComponentManager>(
       module, "EntityComponentManager")
-  .def(pybind11::init<>());
+  .def(pybind11::init<>())
+  .def(
+    "batched_poses",
+    [](const gz::sim::EntityComponentManager &_ecm,
+       const std::vector<gz::sim::Entity> &_entities)
+    {
+      pybind11::array_t<double> result(
+          {static_cast<pybind11::ssize_t>(_entities.size()),
+           static_cast<pybind11::ssize_t>(7)});
+      auto buffer = result.mutable_unchecked<2>();
+
+      pybind11::gil_scoped_release release;
+      for (size_t i = 0; i < _entities.size(); ++i)
+      {
+        auto *comp = _ecm.Component<gz::sim::components::Pose>(_entities[i]);
+        if (nullptr != comp)
+        {
+          const auto &pose = comp->Data();
+          buffer(i, 0) = pose.Pos().X();
+          buffer(i, 1) = pose.Pos().Y();
+          buffer(i, 2) = pose.Pos().Z();
+          buffer(i, 3) = pose.Rot().W();
+          buffer(i, 4) = pose.Rot().X();
+          buffer(i, 5) = pose.Rot().Y();
+          buffer(i, 6) = pose.Rot().Z();
+        }
+        else
+        {
+          for (int j = 0; j < 7; ++j)
+            buffer(i, j) = std::numeric_limits<double>::quiet_NaN();
+        }
+      }
+      return result;
+    },
+    "Get the Pose component of each entity as an N x 7 float64 array "
+    "of [x, y, z, qw, qx, qy, qz] rows, in one call with the GIL "
+    "released during the copy. Entities without a Pose get NaN rows.")
+  .def(
+    "set_batched_poses",
+    [](gz::sim::EntityComponentManager &_ecm,
+       const std::vector<gz::sim::Entity> &_entities,
+       const pybind11::array_t<double,
+           pybind11::array::c_style | pybind11::array::forcecast> &_data)
+    {
+      if (_data.ndim() != 2 ||
+          _data.shape(0) !=
+          static_cast<pybind11::ssize_t>(_entities.size()) ||
+          _data.shape(1) != 7)
+      {
+        throw pybind11::value_error(
+            "Expected an array of shape (len(entities), 7)");
+      }
+      auto buffer = _data.unchecked<2>();
+
+      pybind11::gil_scoped_release release;
+      for (size_t i = 0; i < _entities.size(); ++i)
+      {
+        _ecm.SetComponentData<gz::sim::components::Pose>(_entities[i],
+            gz::math::Pose3d(buffer(i, 0), buffer(i, 1), buffer(i, 2),
+                buffer(i, 3), buffer(i, 4), buffer(i, 5), buffer(i, 6)));
+      }
+    },
+    "Set the Pose component of each entity from an N x 7 float64 array "
+    "of [x, y, z, qw, qx, qy, qz] rows, in one call with the GIL "
+    "released during the copy. Missing components are created.")
+  .def(
+    "batched_linear_velocities",
+    &BatchedVectors<gz::sim::components::LinearVelocity>,
+    "Get the LinearVelocity component of each entity as an N x 3 "
+    "float64 array, in one call with the GIL released during the copy. "
+    "Entities without the component get NaN rows.")
+  .def(
+    "set_batched_linear_velocities",
+    &SetBatchedVectors<gz::sim::components::LinearVelocity>,
+    "Set the LinearVelocity component of each entity from an N x 3 "
+    "float64 array, in one call with the GIL released during the copy. "
+    "Missing components are created.")
+  .def(
+    "batched_angular_velocities",
+    &BatchedVectors<gz::sim::components::AngularVelocity>,
+    "Get the AngularVelocity component of each entity as an N x 3 "
+    "float64 array, in one call with the GIL released during the copy. "
+    "Entities without the component get NaN rows.")
+  .def(
+    "set_batched_angular_velocities",
+    &SetBatchedVectors<gz::sim::components::AngularVelocity>,
+    "Set the AngularVelocity component of each entity from an N x 3 "
+    "float64 array, in one call with the GIL released during the copy. "
+    "Missing components are created.");
 }
 }  // namespace python
 }  // namespace sim
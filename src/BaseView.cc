@@ -45,6 +45,7 @@ bool BaseView::MarkEntityToAdd(const Entity _entity, bool _new)
     return false;
 
   this->toAddEntities[_entity] = _new;
+  this->toAddDirty.store(true, std::memory_order_release);
   return true;
 }
 
@@ -109,4 +110,11 @@ const std::unordered_map<Entity, bool> &BaseView::ToAddEntities() const
 void BaseView::ClearToAddEntities()
 {
   this->toAddEntities.clear();
+  this->toAddDirty.store(false, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+bool BaseView::HasEntitiesToAdd() const
+{
+  return this->toAddDirty.load(std::memory_order_acquire);
 }
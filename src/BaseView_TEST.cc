@@ -225,6 +225,27 @@ TEST_F(BaseViewTest, RemoveEntities)
   EXPECT_EQ(0u, view.ToRemoveEntities().size());
 }
 
+/////////////////////////////////////////////////
+TEST_F(BaseViewTest, HasEntitiesToAdd)
+{
+  auto view = detail::View({components::Model::typeId});
+
+  // a freshly built view has nothing pending
+  EXPECT_FALSE(view.HasEntitiesToAdd());
+
+  // marking an entity raises the pending flag, draining lowers it
+  EXPECT_TRUE(view.MarkEntityToAdd(1));
+  EXPECT_TRUE(view.HasEntitiesToAdd());
+  view.ClearToAddEntities();
+  EXPECT_FALSE(view.HasEntitiesToAdd());
+
+  // resetting the view also lowers the pending flag
+  EXPECT_TRUE(view.MarkEntityToAdd(1));
+  EXPECT_TRUE(view.HasEntitiesToAdd());
+  view.Reset();
+  EXPECT_FALSE(view.HasEntitiesToAdd());
+}
+
 /////////////////////////////////////////////////
 TEST_F(BaseViewTest, Reset)
 {
@@ -141,7 +141,7 @@ msgs::Collision gz::sim::convert(const sdf::Collision &_in)
   msgs::Collision out;
   out.set_name(_in.Name());
   msgs::Set(out.mutable_pose(), _in.RawPose());
-  out.mutable_geometry()->CopyFrom(convert<msgs::Geometry>(*_in.Geom()));
+  set(out.mutable_geometry(), *_in.Geom());
 
   return out;
 }
@@ -159,11 +159,9 @@ sdf::Collision gz::sim::convert(const msgs::Collision &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
+void gz::sim::set(msgs::Geometry *_msg, const sdf::Geometry &_in)
 {
-  msgs::Geometry out;
+  auto &out = *_msg;
   if (_in.Type() == sdf::GeometryType::BOX && _in.BoxShape())
   {
     out.set_type(msgs::Geometry::BOX);
@@ -264,6 +262,15 @@ msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
     gzerr << "Geometry type [" << static_cast<int>(_in.Type())
            << "] not supported" << std::endl;
   }
+}
+
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Geometry gz::sim::convert(const sdf::Geometry &_in)
+{
+  msgs::Geometry out;
+  set(&out, _in);
   return out;
 }
 
@@ -405,11 +412,9 @@ sdf::Geometry gz::sim::convert(const msgs::Geometry &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Material gz::sim::convert(const sdf::Material &_in)
+void gz::sim::set(msgs::Material *_msg, const sdf::Material &_in)
 {
-  msgs::Material out;
+  auto &out = *_msg;
   msgs::Set(out.mutable_ambient(), _in.Ambient());
   msgs::Set(out.mutable_diffuse(), _in.Diffuse());
   msgs::Set(out.mutable_specular(), _in.Specular());
@@ -461,6 +466,15 @@ msgs::Material gz::sim::convert(const sdf::Material &_in)
       pbrMsg->set_light_map_texcoord_set(workflow->LightMapTexCoordSet());
     }
   }
+}
+
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Material gz::sim::convert(const sdf::Material &_in)
+{
+  msgs::Material out;
+  set(&out, _in);
   return out;
 }
 
@@ -771,11 +785,9 @@ sdf::JointAxis gz::sim::convert(const msgs::Axis &_in)
 }
 
 //////////////////////////////////////////////////
-template<>
-GZ_SIM_VISIBLE
-msgs::Scene gz::sim::convert(const sdf::Scene &_in)
+void gz::sim::set(msgs::Scene *_msg, const sdf::Scene &_in)
 {
-  msgs::Scene out;
+  auto &out = *_msg;
   // todo(anyone) add Name to sdf::Scene?
   // out.set_name(_in.Name());
   msgs::Set(out.mutable_ambient(), _in.Ambient());
@@ -804,7 +816,15 @@ msgs::Scene gz::sim::convert(const sdf::Scene &_in)
       header->add_value(_in.Sky()->CubemapUri());
     }
   }
+}
 
+//////////////////////////////////////////////////
+template<>
+GZ_SIM_VISIBLE
+msgs::Scene gz::sim::convert(const sdf::Scene &_in)
+{
+  msgs::Scene out;
+  set(&out, _in);
   return out;
 }
 
@@ -1639,7 +1659,7 @@ msgs::ParticleEmitter gz::sim::convert(const sdf::ParticleEmitter &_in)
   out.mutable_lifetime()->set_data(_in.Lifetime());
   if (_in.Material())
   {
-    out.mutable_material()->CopyFrom(convert<msgs::Material>(*_in.Material()));
+    set(out.mutable_material(), *_in.Material());
   }
   out.mutable_min_velocity()->set_data(_in.MinVelocity());
   out.mutable_max_velocity()->set_data(_in.MaxVelocity());
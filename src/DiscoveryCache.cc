@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "DiscoveryCache.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Util.hh>
+
+using namespace gz;
+using namespace sim;
+
+//////////////////////////////////////////////////
+DiscoveryCache::DiscoveryCache(const std::string &_name,
+    const std::string &_environment)
+{
+  this->envHash = std::to_string(std::hash<std::string>{}(_environment));
+
+  std::string homePath;
+  common::env(GZ_HOMEDIR, homePath);
+  if (homePath.empty())
+    return;
+
+  const std::string cacheDir = common::joinPaths(
+      homePath, ".gz", "sim", "discovery");
+  if (!common::exists(cacheDir) && !common::createDirectories(cacheDir))
+  {
+    gzwarn << "Failed to create discovery cache directory [" << cacheDir
+           << "]." << std::endl;
+    return;
+  }
+  this->cachePath = common::joinPaths(cacheDir, _name + ".cache");
+
+  std::ifstream cacheFile(this->cachePath);
+  std::string line;
+  // The first line holds the environment hash; a mismatch discards the
+  // whole file.
+  if (!std::getline(cacheFile, line) || line != this->envHash)
+    return;
+
+  // Entries are tab-separated since keys may hold colons (URLs).
+  while (std::getline(cacheFile, line))
+  {
+    auto sep = line.find('\t');
+    if (sep == std::string::npos || 0 == sep)
+      continue;
+    this->entries[line.substr(0, sep)] = line.substr(sep + 1);
+  }
+}
+
+//////////////////////////////////////////////////
+std::string DiscoveryCache::Lookup(const std::string &_key) const
+{
+  auto it = this->entries.find(_key);
+  if (it == this->entries.end())
+    return std::string();
+
+  // Entries whose target disappeared fall back to the regular scan.
+  return common::exists(it->second) ? it->second : std::string();
+}
+
+//////////////////////////////////////////////////
+void DiscoveryCache::Store(const std::string &_key, const std::string &_path)
+{
+  if (this->cachePath.empty() || _path.empty())
+    return;
+
+  this->entries[_key] = _path;
+
+  // Rewrite through a temporary file so concurrent readers never see a
+  // partial cache.
+  const std::string tmpPath = this->cachePath + ".tmp";
+  {
+    std::ofstream cacheFile(tmpPath, std::ios::trunc);
+    if (!cacheFile.is_open())
+      return;
+    cacheFile << this->envHash << "\n";
+    for (const auto &[key, path] : this->entries)
+      cacheFile << key << "\t" << path << "\n";
+  }
+  std::rename(tmpPath.c_str(), this->cachePath.c_str());
+}
+
+//////////////////////////////////////////////////
+std::string DiscoveryCache::DirectorySignature(
+    const std::list<std::string> &_paths)
+{
+  std::string signature;
+  for (const std::string &path : _paths)
+  {
+    signature += path;
+    signature += ';';
+    if (!common::isDirectory(path))
+      continue;
+    for (common::DirIter file(path); file != common::DirIter(); ++file)
+    {
+      signature += common::basename(*file);
+      signature += ',';
+    }
+  }
+  return signature;
+}
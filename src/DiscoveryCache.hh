@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_SIM_DISCOVERYCACHE_HH_
+#define GZ_SIM_DISCOVERYCACHE_HH_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/Export.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+
+    /// \class DiscoveryCache DiscoveryCache.hh
+    /// \brief A per-user cache of discovery results, shared across
+    /// processes through a file under `$HOME/.gz/sim/`.
+    ///
+    /// Path lookups that scan directories on every invocation, like
+    /// resolving plugin library names or world files, store their results
+    /// here so that short-lived processes skip the scans on subsequent
+    /// runs. The cache file carries a hash of everything the lookups
+    /// depend on and is discarded wholesale when that hash changes;
+    /// individual entries are additionally validated against the
+    /// filesystem on lookup, so a stale entry degrades into the regular
+    /// scan rather than a wrong answer. Concurrent writers race benignly:
+    /// the file is replaced atomically and a lost update only costs a
+    /// rescan.
+    class GZ_SIM_VISIBLE DiscoveryCache
+    {
+      /// \brief Constructor. Reads the cache file if its environment hash
+      /// matches.
+      /// \param[in] _name Base name of the cache file, e.g.
+      /// "plugin_paths".
+      /// \param[in] _environment Concatenation of everything the cached
+      /// lookups depend on: search path variables, install directories,
+      /// directory signatures. Any change discards the cached entries.
+      public: DiscoveryCache(const std::string &_name,
+                  const std::string &_environment);
+
+      /// \brief Look up a cached path.
+      /// \param[in] _key Lookup key, e.g. a library or world file name.
+      /// \return The cached path, or an empty string when the key is
+      /// absent or the path no longer exists on disk.
+      public: std::string Lookup(const std::string &_key) const;
+
+      /// \brief Store a resolved path and rewrite the cache file.
+      /// \param[in] _key Lookup key.
+      /// \param[in] _path Resolved path; empty paths are not stored.
+      public: void Store(const std::string &_key, const std::string &_path);
+
+      /// \brief Build a signature of the entries of a set of directories,
+      /// for inclusion in the constructor's environment string. Catches
+      /// files being added to or removed from search directories, the
+      /// cases an unchanged search path wouldn't.
+      /// \param[in] _paths Directories to sign; missing ones are skipped.
+      /// \return Signature string.
+      public: static std::string DirectorySignature(
+                  const std::list<std::string> &_paths);
+
+      /// \brief Full path of the cache file.
+      private: std::string cachePath;
+
+      /// \brief Hash of the environment string, written as the file's
+      /// first line.
+      private: std::string envHash;
+
+      /// \brief Cached entries, keyed by lookup key.
+      private: std::unordered_map<std::string, std::string> entries;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/common/Util.hh>
+
+#include "DiscoveryCache.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+class DiscoveryCacheTest : public ::testing::Test
+{
+  /// \brief Point the cache at a scratch home directory.
+  protected: void SetUp() override
+  {
+    this->tempDir = common::createTempDirectory("discovery_cache",
+        common::tempDirectoryPath());
+    common::env(GZ_HOMEDIR, this->prevHome);
+    common::setenv(GZ_HOMEDIR, this->tempDir);
+
+    // A real file for entries to resolve to.
+    this->targetPath = common::joinPaths(this->tempDir, "target.so");
+    std::ofstream(this->targetPath) << "stub";
+  }
+
+  protected: void TearDown() override
+  {
+    common::setenv(GZ_HOMEDIR, this->prevHome);
+    common::removeAll(this->tempDir);
+  }
+
+  protected: std::string tempDir;
+  protected: std::string prevHome;
+  protected: std::string targetPath;
+};
+
+/////////////////////////////////////////////////
+TEST_F(DiscoveryCacheTest, StoreAndLookupAcrossInstances)
+{
+  {
+    DiscoveryCache cache("test", "env-a");
+    EXPECT_TRUE(cache.Lookup("libA").empty());
+    cache.Store("libA", this->targetPath);
+    EXPECT_EQ(this->targetPath, cache.Lookup("libA"));
+  }
+
+  // A new instance with the same environment reads the file back.
+  DiscoveryCache cache("test", "env-a");
+  EXPECT_EQ(this->targetPath, cache.Lookup("libA"));
+}
+
+/////////////////////////////////////////////////
+TEST_F(DiscoveryCacheTest, EnvironmentChangeDiscardsEntries)
+{
+  {
+    DiscoveryCache cache("test", "env-a");
+    cache.Store("libA", this->targetPath);
+  }
+
+  DiscoveryCache cache("test", "env-b");
+  EXPECT_TRUE(cache.Lookup("libA").empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(DiscoveryCacheTest, MissingTargetFallsThrough)
+{
+  DiscoveryCache cache("test", "env-a");
+  cache.Store("libA", this->targetPath);
+  common::removeFile(this->targetPath);
+  EXPECT_TRUE(cache.Lookup("libA").empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(DiscoveryCacheTest, DirectorySignatureTracksEntries)
+{
+  const auto before = DiscoveryCache::DirectorySignature({this->tempDir});
+  std::ofstream(common::joinPaths(this->tempDir, "extra.so")) << "stub";
+  const auto after = DiscoveryCache::DirectorySignature({this->tempDir});
+  EXPECT_NE(before, after);
+}
@@ -18,8 +18,11 @@
 #include "gz/sim/EntityComponentManager.hh"
 #include "EntityComponentManagerDiff.hh"
 
+#include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -46,6 +49,110 @@
 using namespace gz;
 using namespace sim;
 
+namespace gz::sim
+{
+/// \brief A dense set of entity storage slots backed by a bitset, with one
+/// bit per slot. Slots are allocated densely by the entity component
+/// manager and recycled when entities are removed, so membership tests and
+/// updates are O(1) array accesses, iterating the set is a word-scan that
+/// skips 64 empty slots at a time, and memory stays proportional to the
+/// number of live entities regardless of how many entity ids have ever
+/// been handed out. This is used for the per-component-type change
+/// tracking that feeds ChangedState() and the serializers.
+class EntityIdSet
+{
+  /// \brief Add a slot to the set.
+  /// \param[in] _slot The slot to add.
+  public: void Insert(const uint64_t _slot)
+  {
+    const auto idx = static_cast<std::size_t>(_slot);
+    const std::size_t word = idx / kBitsPerWord;
+    if (word >= this->words.size())
+      this->words.resize(word + 1, 0u);
+    const uint64_t mask = 1ull << (idx % kBitsPerWord);
+    if (!(this->words[word] & mask))
+    {
+      this->words[word] |= mask;
+      ++this->count;
+    }
+  }
+
+  /// \brief Remove a slot from the set.
+  /// \param[in] _slot The slot to remove.
+  public: void Erase(const uint64_t _slot)
+  {
+    const auto idx = static_cast<std::size_t>(_slot);
+    const std::size_t word = idx / kBitsPerWord;
+    if (word >= this->words.size())
+      return;
+    const uint64_t mask = 1ull << (idx % kBitsPerWord);
+    if (this->words[word] & mask)
+    {
+      this->words[word] &= ~mask;
+      --this->count;
+    }
+  }
+
+  /// \brief Check whether a slot is in the set.
+  /// \param[in] _slot The slot to check.
+  /// \return True if the slot is in the set.
+  public: bool Contains(const uint64_t _slot) const
+  {
+    const auto idx = static_cast<std::size_t>(_slot);
+    const std::size_t word = idx / kBitsPerWord;
+    return word < this->words.size() &&
+        (this->words[word] & (1ull << (idx % kBitsPerWord)));
+  }
+
+  /// \brief Get whether the set is empty.
+  /// \return True if no slots are in the set.
+  public: bool Empty() const
+  {
+    return 0 == this->count;
+  }
+
+  /// \brief Get the number of entity ids in the set.
+  /// \return The set size.
+  public: std::size_t Size() const
+  {
+    return this->count;
+  }
+
+  /// \brief Remove all slots from the set.
+  public: void Clear()
+  {
+    this->words.clear();
+    this->count = 0;
+  }
+
+  /// \brief Invoke a callback for each slot in the set, in ascending slot
+  /// order. Words with no bits set are skipped without inspecting
+  /// individual slots.
+  /// \param[in] _f Callback invoked with each slot.
+  public: template<typename FuncT> void ForEach(FuncT _f) const
+  {
+    for (std::size_t w = 0; w < this->words.size(); ++w)
+    {
+      uint64_t word = this->words[w];
+      for (std::size_t bit = 0; word != 0; ++bit, word >>= 1)
+      {
+        if (word & 1ull)
+          _f(static_cast<uint64_t>(w * kBitsPerWord + bit));
+      }
+    }
+  }
+
+  /// \brief Number of slots per bitset word.
+  private: static constexpr std::size_t kBitsPerWord{64};
+
+  /// \brief The bitset words.
+  private: std::vector<uint64_t> words;
+
+  /// \brief Number of bits currently set.
+  private: std::size_t count{0};
+};
+}  // namespace gz::sim
+
 class gz::sim::EntityComponentManagerPrivate
 {
   /// \brief Implementation of the CreateEntity function, which takes a specific
@@ -68,6 +175,14 @@ class gz::sim::EntityComponentManagerPrivate
   public: void EraseEntityRecursive(Entity _entity,
       std::unordered_set<Entity> &_set);
 
+  /// \brief Invalidate the cached descendant sets affected by re-parenting
+  /// an entity. Only cached sets that contain the re-parented entity (its
+  /// old ancestors) or the new parent (whose subtree grows) are dropped;
+  /// unrelated subtrees stay cached.
+  /// \param[in] _child Entity being re-parented.
+  /// \param[in] _parent New parent of _child, or kNullEntity.
+  public: void InvalidateDescendantCache(Entity _child, Entity _parent);
+
   /// \brief Allots the work for multiple threads prior to running
   /// `AddEntityToMessage`.
   public: void CalculateStateThreadLoad();
@@ -136,18 +251,81 @@ class gz::sim::EntityComponentManagerPrivate
   /// parenting.
   public: EntityGraph entities;
 
+  /// \brief Assign a dense storage slot to a newly created entity,
+  /// reusing a slot released by a removed entity when one is available.
+  /// \param[in] _entity The entity to assign a slot to.
+  /// \return The assigned slot.
+  public: uint64_t AssignEntitySlot(const Entity _entity);
+
+  /// \brief Release the storage slot of a removed entity so it can be
+  /// reused. Any change-tracking bits left for the slot are dropped so its
+  /// next occupant doesn't inherit them.
+  /// \param[in] _entity The entity whose slot should be released.
+  public: void ReleaseEntitySlot(const Entity _entity);
+
+  /// \brief Get the storage slot assigned to an entity.
+  /// \param[in] _entity The entity to look up.
+  /// \return The entity's slot, or kInvalidEntitySlot if the entity doesn't
+  /// exist.
+  public: uint64_t EntitySlot(const Entity _entity) const;
+
+  /// \brief Attach a slot to a parent slot in the adjacency arrays. The
+  /// child is pushed at the front of the parent's child list.
+  /// \param[in] _childSlot Slot of the child entity.
+  /// \param[in] _parentSlot Slot of the parent entity.
+  public: void LinkEntitySlot(const uint64_t _childSlot,
+              const uint64_t _parentSlot);
+
+  /// \brief Detach a slot from its parent's child list in the adjacency
+  /// arrays. No-op if the slot has no parent.
+  /// \param[in] _childSlot Slot of the child entity.
+  public: void UnlinkEntitySlot(const uint64_t _childSlot);
+
+  /// \brief Slot value returned for entities that don't exist.
+  public: static constexpr uint64_t kInvalidEntitySlot{
+            std::numeric_limits<uint64_t>::max()};
+
   /// \brief Components that have been changed through a periodic change.
-  /// The key is the type of component which has changed, and the value is the
-  /// entities that had this type of component changed.
-  public: std::unordered_map<ComponentTypeId, std::unordered_set<Entity>>
+  /// The key is the type of component which has changed, and the value is a
+  /// dirty bitset of the slots of the entities that had this type of
+  /// component changed.
+  public: std::unordered_map<ComponentTypeId, EntityIdSet>
             periodicChangedComponents;
 
   /// \brief Components that have been changed through a one-time change.
-  /// The key is the type of component which has changed, and the value is the
-  /// entities that had this type of component changed.
-  public: std::unordered_map<ComponentTypeId, std::unordered_set<Entity>>
+  /// The key is the type of component which has changed, and the value is a
+  /// dirty bitset of the slots of the entities that had this type of
+  /// component changed.
+  public: std::unordered_map<ComponentTypeId, EntityIdSet>
             oneTimeChangedComponents;
 
+  /// \brief Map from entity id to the dense storage slot used for change
+  /// tracking. Entity ids grow monotonically for the lifetime of the
+  /// manager, so slot-indexed containers use this indirection to keep their
+  /// footprint proportional to the number of live entities.
+  public: std::unordered_map<Entity, uint64_t> entitySlots;
+
+  /// \brief The entity occupying each slot; kNullEntity for free slots.
+  public: std::vector<Entity> slotEntities;
+
+  /// \brief Slots released by removed entities, reused LIFO.
+  public: std::vector<uint64_t> freeEntitySlots;
+
+  /// \brief Parent slot of each slot's occupant; kInvalidEntitySlot for
+  /// parent-less entities and free slots. Together with slotFirstChild and
+  /// slotNextSibling this mirrors the entity graph's parent/child edges in
+  /// flat arrays, so traversal-heavy queries (ParentEntity, Descendants)
+  /// walk contiguous memory instead of chasing the graph's per-node maps.
+  public: std::vector<uint64_t> slotParent;
+
+  /// \brief First child slot of each slot's occupant; kInvalidEntitySlot
+  /// for childless entities and free slots.
+  public: std::vector<uint64_t> slotFirstChild;
+
+  /// \brief Next sibling slot in the parent's child list;
+  /// kInvalidEntitySlot at the end of the list and for free slots.
+  public: std::vector<uint64_t> slotNextSibling;
+
   /// \brief Entities that have just been created
   public: std::unordered_set<Entity> newlyCreatedEntities;
 
@@ -182,19 +360,96 @@ class gz::sim::EntityComponentManagerPrivate
           std::pair<std::unique_ptr<detail::BaseView>,
             std::unique_ptr<std::mutex>>, detail::ComponentTypeHasher> views;
 
+  /// \brief Read-only lookup table from view key to the view and its
+  /// mutex, mirroring the views map.
+  public: using ViewLookup = std::unordered_map<detail::ComponentTypeKey,
+          std::pair<detail::BaseView *, std::mutex *>,
+          detail::ComponentTypeHasher>;
+
+  /// \brief Immutable snapshot of the view lookup table, swapped
+  /// atomically whenever the views map gains or loses views. Const
+  /// queries resolve their view through this snapshot without taking
+  /// viewsMutex, so parallel PostUpdate systems don't serialize on a
+  /// global lock; viewsMutex only orders the (rare) writers.
+  public: mutable std::shared_ptr<const ViewLookup> viewLookup{
+            std::make_shared<const ViewLookup>()};
+
+  /// \brief Rebuild and atomically publish the view lookup snapshot from
+  /// the views map. Callers must hold viewsMutex or otherwise be the only
+  /// thread touching the views map.
+  public: void PublishViewLookup();
+
   /// \brief A flag that indicates whether views should be locked while adding
   /// new entities to them or not.
   public: bool lockAddEntitiesToViews{false};
 
+  /// \brief Index from a component type to the views whose component
+  /// signature includes that type. Adding or removing a component of a given
+  /// type can only change view membership for the views listed under that
+  /// type, so this index lets component updates skip all other views instead
+  /// of re-testing the entity against every view. The pointers index into
+  /// the views map, which owns the views.
+  public: mutable std::unordered_map<ComponentTypeId,
+          std::vector<detail::BaseView *>> viewsByComponentType;
+
+  /// \brief A flag that indicates whether view updates are being deferred
+  /// by BeginEntityBatch. While set, component additions do not notify
+  /// views; the affected entities are collected in batchedEntities instead.
+  public: bool batchingEntities{false};
+
+  /// \brief Entities whose components were added while a batch was open.
+  /// These are reconciled against all views in EndEntityBatch.
+  public: std::unordered_set<Entity> batchedEntities;
+
+  /// \brief A flag that indicates whether view updates are being deferred
+  /// by BeginComponentBatch. While set, component additions and removals
+  /// do not notify views; the affected entities are collected in
+  /// batchedComponentEntities instead.
+  public: bool batchingComponents{false};
+
+  /// \brief Entities whose components were added or removed while a
+  /// component batch was open. These are reconciled against all views in
+  /// EndComponentBatch.
+  public: std::unordered_set<Entity> batchedComponentEntities;
+
   /// \brief Cache of previously queried descendants. The key is the parent
   /// entity for which descendants were queried, and the value are all its
   /// descendants.
   public: mutable std::unordered_map<Entity, std::unordered_set<Entity>>
           descendantCache;
 
+  /// \brief A component change subscription: the watched component type
+  /// and change kind, plus the packed list of entities affected during
+  /// the last processed step.
+  public: struct ComponentChangeSubscription
+  {
+    /// \brief The component type being watched.
+    ComponentTypeId typeId{kComponentTypeIdInvalid};
+
+    /// \brief The kind of change being watched.
+    ComponentChangeKind kind{ComponentChangeKind::OneTimeChanged};
+
+    /// \brief Entities affected during the last processed step. Cleared
+    /// and refilled in place so the capacity is reused across steps.
+    std::vector<Entity> entities;
+  };
+
+  /// \brief Registered component change subscriptions, keyed by the id
+  /// returned from SubscribeComponentChanges.
+  public: std::unordered_map<uint64_t, ComponentChangeSubscription>
+            componentChangeSubscriptions;
+
+  /// \brief Id handed to the next component change subscription.
+  public: uint64_t nextComponentChangeSubscriptionId{1};
+
   /// \brief Keep track of entities already used to ensure uniqueness.
   public: uint64_t entityCount{0};
 
+  /// \brief Structural change counter. Incremented whenever a component is
+  /// created or removed or entity removal requests are processed, so
+  /// callers holding cached component pointers know when to revalidate.
+  public: uint64_t structuralEpoch{0};
+
   /// \brief Unordered map of removed components. The key is the entity to
   /// which belongs the component, and the value is a set of the component types
   /// being removed.
@@ -276,6 +531,13 @@ class gz::sim::EntityComponentManagerPrivate
   /// having to explicitly search/track for the cloned links.
   public: std::unordered_map<Entity, Entity> originalToClonedLink;
 
+  /// \brief Map of every entity in the most recently cloned subtree to
+  /// its clone, refilled by each Clone call. Systems that mirror entities
+  /// in external structures (physics engine objects, render scene nodes)
+  /// can read it through ClonedEntityMap to duplicate from the template
+  /// instead of rebuilding from scratch.
+  public: std::unordered_map<Entity, Entity> originalToClonedEntity;
+
   /// \brief See above
   /// The key is the cloned joint entity, and the value is a pair where the
   /// first element is the original joint's parent link, and the second element
@@ -285,6 +547,77 @@ class gz::sim::EntityComponentManagerPrivate
 
   /// \brief Set of entities that are prevented from removal.
   public: std::unordered_set<Entity> pinnedEntities;
+
+  /// \brief State of one reverse component-value index.
+  /// \sa EntityComponentManager::EnableComponentValueIndex
+  public: struct ComponentValueIndex
+  {
+    /// \brief Entities bucketed by the hash of their component value.
+    public: std::unordered_map<std::size_t, std::vector<Entity>> buckets;
+
+    /// \brief The hash each indexed entity is currently filed under, so an
+    /// entity can be removed from its bucket without recomputing the hash
+    /// (the value may already be gone by then).
+    public: std::unordered_map<Entity, std::size_t> entityHashes;
+
+    /// \brief Entities whose component of the indexed type was created,
+    /// modified or removed since the index was last refreshed. Drained
+    /// lazily by the typed query code, which is the only place the
+    /// component value can be hashed.
+    public: std::unordered_set<Entity> dirtyEntities;
+
+    /// \brief Whether dirtyEntities may be non-empty. A false read
+    /// happens-after the refresh that drained the index last, so the
+    /// buckets may then be probed without locking.
+    public: std::atomic<bool> hasDirtyEntities{false};
+
+    /// \brief Serializes the lazy refresh of this index between
+    /// concurrent const queries, e.g. parallel system PostUpdates. Not
+    /// taken in the steady state, when hasDirtyEntities is false.
+    public: std::mutex refreshMutex;
+  };
+
+  /// \brief Reverse value indexes, keyed by the component type they index.
+  /// Only holds entries for types opted in via EnableComponentValueIndex.
+  public: std::unordered_map<ComponentTypeId, ComponentValueIndex>
+          componentValueIndexes;
+
+  /// \brief Remove an entity's entry, if any, from the value index of the
+  /// given component type.
+  /// \param[in] _typeId Id of the indexed component type.
+  /// \param[in] _entity The entity to remove from the index.
+  public: void RemoveComponentValueIndexEntry(const ComponentTypeId _typeId,
+              const Entity _entity);
+
+  /// \brief Reset every value index so it is rebuilt lazily against the
+  /// current componentTypeIndex contents: entries are dropped and all
+  /// entities that hold a component of an indexed type are marked dirty.
+  public: void RebuildComponentValueIndexes();
+
+  /// \brief Maximum number of instances kept per component type in
+  /// componentPool. Bounds the memory retained for workloads that remove a
+  /// large number of entities at once.
+  public: static constexpr std::size_t kComponentPoolMaxSize{1024};
+
+  /// \brief Pool of recycled component instances, keyed by component type.
+  /// Components of removed entities are parked here and reused by subsequent
+  /// component creations of the same type, so create/remove cycles recycle
+  /// instances instead of going through the global allocator.
+  /// \sa RecycleComponents
+  public: std::unordered_map<ComponentTypeId,
+          std::vector<std::unique_ptr<components::BaseComponent>>>
+            componentPool;
+
+  /// \brief Counters of pool activity, keyed by component type.
+  /// \sa componentPool
+  public: std::unordered_map<ComponentTypeId,
+          EntityComponentManager::PoolStats> componentPoolStats;
+
+  /// \brief Move the component instances of an entity that's being removed
+  /// into the component pool.
+  /// \param[in] _entity The entity whose components should be recycled. The
+  /// entity is expected to still be in componentStorage.
+  public: void RecycleComponents(const Entity _entity);
 };
 
 //////////////////////////////////////////////////
@@ -304,33 +637,74 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->entities = _from.entities;
   this->periodicChangedComponents = _from.periodicChangedComponents;
   this->oneTimeChangedComponents = _from.oneTimeChangedComponents;
+  this->entitySlots = _from.entitySlots;
+  this->slotEntities = _from.slotEntities;
+  this->freeEntitySlots = _from.freeEntitySlots;
+  this->slotParent = _from.slotParent;
+  this->slotFirstChild = _from.slotFirstChild;
+  this->slotNextSibling = _from.slotNextSibling;
   this->newlyCreatedEntities = _from.newlyCreatedEntities;
   this->toRemoveEntities = _from.toRemoveEntities;
   this->modifiedComponents = _from.modifiedComponents;
   this->removeAllEntities = _from.removeAllEntities;
   this->views.clear();
+  this->viewsByComponentType.clear();
+  this->PublishViewLookup();
   this->lockAddEntitiesToViews = _from.lockAddEntitiesToViews;
   this->descendantCache.clear();
   this->entityCount = _from.entityCount;
   this->removedComponents = _from.removedComponents;
   this->componentsMarkedAsRemoved = _from.componentsMarkedAsRemoved;
 
+  // Refresh component storage in place. Reusing the destination's component
+  // instances keeps a repeated snapshot of a structurally stable world free
+  // of allocations: only the component data is assigned, and instances are
+  // cloned just for entities or component slots that don't line up with the
+  // source anymore.
+  for (auto iter = this->componentStorage.begin();
+       iter != this->componentStorage.end();)
+  {
+    if (_from.componentStorage.find(iter->first) ==
+        _from.componentStorage.end())
+    {
+      iter = this->componentStorage.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
   for (const auto &[entity, comps] : _from.componentStorage)
   {
-    this->componentStorage[entity].clear();
-    for (const auto &comp : comps)
+    auto &destComps = this->componentStorage[entity];
+    destComps.resize(comps.size());
+    for (std::size_t i = 0; i < comps.size(); ++i)
     {
-      this->componentStorage[entity].emplace_back(comp->Clone());
+      if (nullptr == destComps[i] ||
+          destComps[i]->TypeId() != comps[i]->TypeId() ||
+          !destComps[i]->CopyFrom(*comps[i]))
+      {
+        destComps[i] = comps[i]->Clone();
+      }
     }
   }
   this->componentTypeIndex = _from.componentTypeIndex;
   this->componentTypeIndexIterators.clear();
   this->componentTypeIndexDirty = true;
 
+  // Value indexes aren't copied from the source; the destination keeps its
+  // own enabled set and rebuilds it lazily against the refreshed storage.
+  this->RebuildComponentValueIndexes();
+
   // Not copying maps related to cloning since they are transient variables
   // that are used as return values of some member functions.
 
   this->pinnedEntities = _from.pinnedEntities;
+
+  // The views were cleared above, so holders of epoch-tagged view pointers
+  // must not reuse them.
+  ++this->structuralEpoch;
 }
 
 //////////////////////////////////////////////////
@@ -360,14 +734,17 @@ Entity EntityComponentManagerPrivate::CreateEntityImplementation(Entity _entity)
   GZ_PROFILE("EntityComponentManager::CreateEntityImplementation");
   this->entities.AddVertex(std::to_string(_entity), _entity, _entity);
 
+  this->AssignEntitySlot(_entity);
+
   // Add entity to the list of newly created entities
   {
     std::lock_guard<std::mutex> lock(this->entityCreatedMutex);
     this->newlyCreatedEntities.insert(_entity);
   }
 
-  // Reset descendants cache
-  this->descendantCache.clear();
+  // A newly created entity has no edges, so it can't change any cached
+  // descendant set; the cache is invalidated when the entity is parented
+  // (SetParentEntity) or removed.
 
   const auto result = this->componentStorage.insert({_entity,
       std::vector<std::unique_ptr<components::BaseComponent>>()});
@@ -399,9 +776,21 @@ Entity EntityComponentManager::Clone(Entity _entity, Entity _parent,
   this->dataPtr->oldModelCanonicalLink.clear();
   this->dataPtr->originalToClonedLink.clear();
   this->dataPtr->clonedToOriginalJointLinks.clear();
+  this->dataPtr->originalToClonedEntity.clear();
+
+  // Batch the clone so views are reconciled once per cloned entity at the
+  // end instead of once per cloned component. The queries CloneImpl runs
+  // along the way only look at entities that existed before the clone
+  // started, so they're unaffected by the deferred view updates.
+  const bool ownBatch = !this->dataPtr->batchingEntities;
+  if (ownBatch)
+    this->BeginEntityBatch();
 
   auto clonedEntity = this->CloneImpl(_entity, _parent, _name, _allowRename);
 
+  if (ownBatch)
+    this->EndEntityBatch();
+
   if (kNullEntity != clonedEntity)
   {
     // make sure that cloned models have their canonical link updated to the
@@ -451,6 +840,13 @@ Entity EntityComponentManager::Clone(Entity _entity, Entity _parent,
   return clonedEntity;
 }
 
+/////////////////////////////////////////////////
+const std::unordered_map<Entity, Entity> &
+EntityComponentManager::ClonedEntityMap() const
+{
+  return this->dataPtr->originalToClonedEntity;
+}
+
 /////////////////////////////////////////////////
 Entity EntityComponentManager::CloneImpl(Entity _entity, Entity _parent,
     const std::string &_name, bool _allowRename)
@@ -502,6 +898,7 @@ Entity EntityComponentManager::CloneImpl(Entity _entity, Entity _parent,
   }
 
   auto clonedEntity = this->CreateEntity();
+  this->dataPtr->originalToClonedEntity[_entity] = clonedEntity;
 
   if (_parent != kNullEntity)
   {
@@ -697,6 +1094,162 @@ void EntityComponentManagerPrivate::EraseEntityRecursive(Entity _entity,
   _set.erase(_entity);
 }
 
+/////////////////////////////////////////////////
+uint64_t EntityComponentManagerPrivate::AssignEntitySlot(const Entity _entity)
+{
+  auto iter = this->entitySlots.find(_entity);
+  if (iter != this->entitySlots.end())
+    return iter->second;
+
+  uint64_t slot;
+  if (!this->freeEntitySlots.empty())
+  {
+    slot = this->freeEntitySlots.back();
+    this->freeEntitySlots.pop_back();
+    this->slotEntities[slot] = _entity;
+  }
+  else
+  {
+    slot = this->slotEntities.size();
+    this->slotEntities.push_back(_entity);
+    this->slotParent.push_back(kInvalidEntitySlot);
+    this->slotFirstChild.push_back(kInvalidEntitySlot);
+    this->slotNextSibling.push_back(kInvalidEntitySlot);
+  }
+  this->entitySlots[_entity] = slot;
+  return slot;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ReleaseEntitySlot(const Entity _entity)
+{
+  auto iter = this->entitySlots.find(_entity);
+  if (iter == this->entitySlots.end())
+    return;
+
+  const uint64_t slot = iter->second;
+
+  // Drop change-tracking bits left for the slot so its next occupant
+  // doesn't show up as changed, and drop dirty sets that become empty so
+  // the Has*ComponentChanges checks stay accurate.
+  auto dropSlot = [slot](std::unordered_map<ComponentTypeId,
+      EntityIdSet> &_sets)
+  {
+    for (auto setIter = _sets.begin(); setIter != _sets.end();)
+    {
+      setIter->second.Erase(slot);
+      if (setIter->second.Empty())
+        setIter = _sets.erase(setIter);
+      else
+        ++setIter;
+    }
+  };
+  dropSlot(this->periodicChangedComponents);
+  dropSlot(this->oneTimeChangedComponents);
+
+  // Take the slot out of the adjacency arrays. Remaining children become
+  // parent-less; if they're also being removed, releasing them is then a
+  // no-op regardless of the order the removal set is iterated in.
+  this->UnlinkEntitySlot(slot);
+  for (uint64_t child = this->slotFirstChild[slot];
+       child != kInvalidEntitySlot;)
+  {
+    const uint64_t next = this->slotNextSibling[child];
+    this->slotParent[child] = kInvalidEntitySlot;
+    this->slotNextSibling[child] = kInvalidEntitySlot;
+    child = next;
+  }
+  this->slotFirstChild[slot] = kInvalidEntitySlot;
+
+  this->slotEntities[slot] = kNullEntity;
+  this->freeEntitySlots.push_back(slot);
+  this->entitySlots.erase(iter);
+}
+
+/////////////////////////////////////////////////
+uint64_t EntityComponentManagerPrivate::EntitySlot(const Entity _entity) const
+{
+  auto iter = this->entitySlots.find(_entity);
+  if (iter == this->entitySlots.end())
+    return kInvalidEntitySlot;
+  return iter->second;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::LinkEntitySlot(const uint64_t _childSlot,
+    const uint64_t _parentSlot)
+{
+  this->slotParent[_childSlot] = _parentSlot;
+  this->slotNextSibling[_childSlot] = this->slotFirstChild[_parentSlot];
+  this->slotFirstChild[_parentSlot] = _childSlot;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::UnlinkEntitySlot(const uint64_t _childSlot)
+{
+  const uint64_t parentSlot = this->slotParent[_childSlot];
+  if (kInvalidEntitySlot != parentSlot)
+  {
+    uint64_t *link = &this->slotFirstChild[parentSlot];
+    while (kInvalidEntitySlot != *link)
+    {
+      if (_childSlot == *link)
+      {
+        *link = this->slotNextSibling[_childSlot];
+        break;
+      }
+      link = &this->slotNextSibling[*link];
+    }
+  }
+  this->slotParent[_childSlot] = kInvalidEntitySlot;
+  this->slotNextSibling[_childSlot] = kInvalidEntitySlot;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::RemoveComponentValueIndexEntry(
+    const ComponentTypeId _typeId, const Entity _entity)
+{
+  auto indexIter = this->componentValueIndexes.find(_typeId);
+  if (indexIter == this->componentValueIndexes.end())
+    return;
+
+  auto &index = indexIter->second;
+  index.dirtyEntities.erase(_entity);
+
+  auto hashIter = index.entityHashes.find(_entity);
+  if (hashIter == index.entityHashes.end())
+    return;
+
+  auto bucketIter = index.buckets.find(hashIter->second);
+  if (bucketIter != index.buckets.end())
+  {
+    auto &bucket = bucketIter->second;
+    bucket.erase(std::remove(bucket.begin(), bucket.end(), _entity),
+        bucket.end());
+    if (bucket.empty())
+      index.buckets.erase(bucketIter);
+  }
+  index.entityHashes.erase(hashIter);
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::RebuildComponentValueIndexes()
+{
+  for (auto &[typeId, index] : this->componentValueIndexes)
+  {
+    index.buckets.clear();
+    index.entityHashes.clear();
+    index.dirtyEntities.clear();
+    for (const auto &[entity, typeMap] : this->componentTypeIndex)
+    {
+      if (typeMap.find(typeId) != typeMap.end())
+        index.dirtyEntities.insert(entity);
+    }
+    index.hasDirtyEntities.store(!index.dirtyEntities.empty(),
+        std::memory_order_release);
+  }
+}
+
 /////////////////////////////////////////////////
 void EntityComponentManager::RequestRemoveEntity(Entity _entity,
     bool _recursive)
@@ -802,6 +1355,13 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
     this->dataPtr->toRemoveEntities.clear();
     this->dataPtr->componentsMarkedAsRemoved.clear();
 
+    this->dataPtr->entitySlots.clear();
+    this->dataPtr->slotEntities.clear();
+    this->dataPtr->freeEntitySlots.clear();
+    this->dataPtr->slotParent.clear();
+    this->dataPtr->slotFirstChild.clear();
+    this->dataPtr->slotNextSibling.clear();
+
     // reset the entity component storage
     this->dataPtr->componentStorage.clear();
     this->dataPtr->componentTypeIndex.clear();
@@ -809,6 +1369,13 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
 
     // All views are now invalid.
     this->dataPtr->views.clear();
+    this->dataPtr->viewsByComponentType.clear();
+    this->dataPtr->PublishViewLookup();
+
+    // Nothing remains to index: this empties every value index.
+    this->dataPtr->RebuildComponentValueIndexes();
+
+    ++this->dataPtr->structuralEpoch;
   }
   else
   {
@@ -824,15 +1391,25 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
       this->dataPtr->entities.RemoveVertex(entity);
 
       this->dataPtr->componentsMarkedAsRemoved.erase(entity);
+      this->dataPtr->ReleaseEntitySlot(entity);
+      this->dataPtr->RecycleComponents(entity);
       this->dataPtr->componentStorage.erase(entity);
       this->dataPtr->componentTypeIndex.erase(entity);
       this->dataPtr->componentTypeIndexDirty = true;
 
+      for (const auto &valueIndex : this->dataPtr->componentValueIndexes)
+      {
+        this->dataPtr->RemoveComponentValueIndexEntry(valueIndex.first,
+            entity);
+      }
+
       // Remove the entity from views.
       for (auto &view : this->dataPtr->views)
       {
         view.second.first->RemoveEntity(entity);
       }
+
+      ++this->dataPtr->structuralEpoch;
     }
     // Clear the set of entities to remove.
     this->dataPtr->toRemoveEntities.clear();
@@ -851,19 +1428,21 @@ bool EntityComponentManager::RemoveComponent(
   if (!this->EntityHasComponentType(_entity, _typeId))
     return false;
 
+  const uint64_t slot = this->dataPtr->EntitySlot(_entity);
+
   auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_typeId);
   if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
   {
-    oneTimeIter->second.erase(_entity);
-    if (oneTimeIter->second.empty())
+    oneTimeIter->second.Erase(slot);
+    if (oneTimeIter->second.Empty())
       this->dataPtr->oneTimeChangedComponents.erase(oneTimeIter);
   }
 
   auto periodicIter = this->dataPtr->periodicChangedComponents.find(_typeId);
   if (periodicIter != this->dataPtr->periodicChangedComponents.end())
   {
-    periodicIter->second.erase(_entity);
-    if (periodicIter->second.empty())
+    periodicIter->second.Erase(slot);
+    if (periodicIter->second.Empty())
       this->dataPtr->periodicChangedComponents.erase(periodicIter);
   }
 
@@ -871,13 +1450,30 @@ bool EntityComponentManager::RemoveComponent(
   if (compPtr)
   {
     this->dataPtr->componentsMarkedAsRemoved[_entity].insert(_typeId);
+    ++this->dataPtr->structuralEpoch;
 
-    // update views to reflect the component removal
-    for (auto &viewPair : this->dataPtr->views)
-      viewPair.second.first->NotifyComponentRemoval(_entity, _typeId);
+    if (this->dataPtr->batchingComponents)
+    {
+      // Defer view updates until the batch ends; EndComponentBatch
+      // reconciles all batched entities against the views in one pass.
+      this->dataPtr->batchedComponentEntities.insert(_entity);
+    }
+    else
+    {
+      // update views to reflect the component removal. Only views whose
+      // signature includes the removed type can be affected.
+      auto interestedViewsIter = this->dataPtr->viewsByComponentType.find(
+          _typeId);
+      if (interestedViewsIter != this->dataPtr->viewsByComponentType.end())
+      {
+        for (auto &view : interestedViewsIter->second)
+          view->NotifyComponentRemoval(_entity, _typeId);
+      }
+    }
   }
 
   this->dataPtr->AddModifiedComponent(_entity);
+  this->dataPtr->RemoveComponentValueIndexEntry(_typeId, _entity);
 
   // Add component to map of removed components
   {
@@ -888,6 +1484,138 @@ bool EntityComponentManager::RemoveComponent(
   return true;
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManager::EnableComponentValueIndexImpl(
+    const ComponentTypeId _typeId)
+{
+  // Built in place: the index isn't movable (it carries a mutex).
+  auto result = this->dataPtr->componentValueIndexes.try_emplace(_typeId);
+  if (!result.second)
+    return;
+
+  // Components of this type that already exist are indexed lazily: mark
+  // every entity holding one as dirty so the first indexed query files them.
+  for (const auto &[entity, typeMap] : this->dataPtr->componentTypeIndex)
+  {
+    if (typeMap.find(_typeId) != typeMap.end())
+      result.first->second.dirtyEntities.insert(entity);
+  }
+  result.first->second.hasDirtyEntities.store(
+      !result.first->second.dirtyEntities.empty(), std::memory_order_release);
+}
+
+/////////////////////////////////////////////////
+bool EntityComponentManager::ComponentValueIndexActive(
+    const ComponentTypeId _typeId) const
+{
+  return this->dataPtr->componentValueIndexes.find(_typeId) !=
+         this->dataPtr->componentValueIndexes.end();
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::MarkComponentValueIndexDirty(
+    const Entity _entity, const ComponentTypeId _typeId) const
+{
+  if (this->dataPtr->componentValueIndexes.empty())
+    return;
+
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter != this->dataPtr->componentValueIndexes.end())
+  {
+    indexIter->second.dirtyEntities.insert(_entity);
+    indexIter->second.hasDirtyEntities.store(true, std::memory_order_release);
+  }
+}
+
+/////////////////////////////////////////////////
+bool EntityComponentManager::ComponentValueIndexDirty(
+    const ComponentTypeId _typeId) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  return indexIter != this->dataPtr->componentValueIndexes.end() &&
+         indexIter->second.hasDirtyEntities.load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////
+std::unique_lock<std::mutex> EntityComponentManager::LockComponentValueIndex(
+    const ComponentTypeId _typeId) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter == this->dataPtr->componentValueIndexes.end())
+    return {};
+  return std::unique_lock<std::mutex>(indexIter->second.refreshMutex);
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::ClearComponentValueIndexDirty(
+    const ComponentTypeId _typeId) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter != this->dataPtr->componentValueIndexes.end())
+  {
+    // Release so that threads which skip the refresh mutex on a false
+    // dirty read are guaranteed to see the re-filed buckets.
+    indexIter->second.hasDirtyEntities.store(false,
+        std::memory_order_release);
+  }
+}
+
+/////////////////////////////////////////////////
+std::vector<Entity> EntityComponentManager::TakeComponentValueIndexDirty(
+    const ComponentTypeId _typeId) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter == this->dataPtr->componentValueIndexes.end() ||
+      indexIter->second.dirtyEntities.empty())
+    return {};
+
+  std::vector<Entity> result(indexIter->second.dirtyEntities.begin(),
+      indexIter->second.dirtyEntities.end());
+  indexIter->second.dirtyEntities.clear();
+  return result;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::RefreshComponentValueIndexEntry(
+    const ComponentTypeId _typeId, const Entity _entity,
+    const std::size_t _hash, const bool _hasComponent) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter == this->dataPtr->componentValueIndexes.end())
+    return;
+
+  auto &index = indexIter->second;
+  auto hashIter = index.entityHashes.find(_entity);
+  if (hashIter != index.entityHashes.end())
+  {
+    // The value hashes to the same bucket it's already filed under.
+    if (_hasComponent && hashIter->second == _hash)
+      return;
+    this->dataPtr->RemoveComponentValueIndexEntry(_typeId, _entity);
+  }
+
+  if (_hasComponent)
+  {
+    index.buckets[_hash].push_back(_entity);
+    index.entityHashes[_entity] = _hash;
+  }
+}
+
+/////////////////////////////////////////////////
+const std::vector<Entity> *EntityComponentManager::ComponentValueIndexBucket(
+    const ComponentTypeId _typeId, const std::size_t _hash) const
+{
+  auto indexIter = this->dataPtr->componentValueIndexes.find(_typeId);
+  if (indexIter == this->dataPtr->componentValueIndexes.end())
+    return nullptr;
+
+  auto bucketIter = indexIter->second.buckets.find(_hash);
+  if (bucketIter == indexIter->second.buckets.end())
+    return nullptr;
+
+  return &bucketIter->second;
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManager::EntityHasComponentType(const Entity _entity,
     const ComponentTypeId &_typeId) const
@@ -938,9 +1666,11 @@ ComponentState EntityComponentManager::ComponentState(const Entity _entity,
 
   auto typeId = typeIter->first;
 
+  const uint64_t slot = this->dataPtr->EntitySlot(_entity);
+
   auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(typeId);
   if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end() &&
-      oneTimeIter->second.find(_entity) != oneTimeIter->second.end())
+      oneTimeIter->second.Contains(slot))
   {
     result = ComponentState::OneTimeChange;
   }
@@ -949,7 +1679,7 @@ ComponentState EntityComponentManager::ComponentState(const Entity _entity,
     auto periodicIter =
       this->dataPtr->periodicChangedComponents.find(typeId);
     if (periodicIter != this->dataPtr->periodicChangedComponents.end() &&
-        periodicIter->second.find(_entity) != periodicIter->second.end())
+        periodicIter->second.Contains(slot))
       result = ComponentState::PeriodicChange;
   }
 
@@ -995,6 +1725,122 @@ std::unordered_set<ComponentTypeId>
   return periodicComponents;
 }
 
+/////////////////////////////////////////////////
+uint64_t EntityComponentManager::SubscribeComponentChanges(
+    const ComponentTypeId _typeId, const ComponentChangeKind _kind)
+{
+  const uint64_t id = this->dataPtr->nextComponentChangeSubscriptionId++;
+  auto &subscription = this->dataPtr->componentChangeSubscriptions[id];
+  subscription.typeId = _typeId;
+  subscription.kind = _kind;
+  return id;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::UnsubscribeComponentChanges(
+    const uint64_t _subscriptionId)
+{
+  this->dataPtr->componentChangeSubscriptions.erase(_subscriptionId);
+}
+
+/////////////////////////////////////////////////
+const std::vector<Entity> &EntityComponentManager::ComponentChangeList(
+    const uint64_t _subscriptionId) const
+{
+  static const std::vector<Entity> kEmpty;
+  auto iter = this->dataPtr->componentChangeSubscriptions.find(
+      _subscriptionId);
+  if (iter == this->dataPtr->componentChangeSubscriptions.end())
+    return kEmpty;
+  return iter->second.entities;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::UpdateComponentChangeSubscriptions()
+{
+  if (this->dataPtr->componentChangeSubscriptions.empty())
+    return;
+
+  GZ_PROFILE("EntityComponentManager::UpdateComponentChangeSubscriptions");
+
+  // The changed kinds read straight from the per-type dirty bitsets, so
+  // they cost one word-scan per subscription. The created and removed
+  // kinds share one pass over the respective per-step tracking for all
+  // subscribers of that kind.
+  std::vector<EntityComponentManagerPrivate::ComponentChangeSubscription *>
+      createdSubscriptions, removedSubscriptions;
+
+  for (auto &idSubscriptionPair : this->dataPtr->componentChangeSubscriptions)
+  {
+    auto &subscription = idSubscriptionPair.second;
+    subscription.entities.clear();
+
+    if (ComponentChangeKind::Created == subscription.kind)
+    {
+      createdSubscriptions.push_back(&subscription);
+      continue;
+    }
+    if (ComponentChangeKind::Removed == subscription.kind)
+    {
+      removedSubscriptions.push_back(&subscription);
+      continue;
+    }
+
+    const auto &changedSets =
+        ComponentChangeKind::PeriodicChanged == subscription.kind ?
+        this->dataPtr->periodicChangedComponents :
+        this->dataPtr->oneTimeChangedComponents;
+    auto setIter = changedSets.find(subscription.typeId);
+    if (setIter == changedSets.end())
+      continue;
+
+    subscription.entities.reserve(setIter->second.Size());
+    setIter->second.ForEach([&](const uint64_t _slot)
+        {
+          subscription.entities.push_back(
+              this->dataPtr->slotEntities[_slot]);
+        });
+  }
+
+  if (!createdSubscriptions.empty())
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->entityCreatedMutex);
+    for (const Entity entity : this->dataPtr->newlyCreatedEntities)
+    {
+      auto typeIter = this->dataPtr->componentTypeIndex.find(entity);
+      if (typeIter == this->dataPtr->componentTypeIndex.end())
+        continue;
+
+      for (auto subscription : createdSubscriptions)
+      {
+        if (typeIter->second.find(subscription->typeId) !=
+            typeIter->second.end() &&
+            !this->dataPtr->ComponentMarkedAsRemoved(entity,
+              subscription->typeId))
+        {
+          subscription->entities.push_back(entity);
+        }
+      }
+    }
+  }
+
+  if (!removedSubscriptions.empty())
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->removedComponentsMutex);
+    for (const auto &entityTypesPair : this->dataPtr->removedComponents)
+    {
+      for (auto subscription : removedSubscriptions)
+      {
+        if (entityTypesPair.second.find(subscription->typeId) !=
+            entityTypesPair.second.end())
+        {
+          subscription->entities.push_back(entityTypesPair.first);
+        }
+      }
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManager::HasEntity(const Entity _entity) const
 {
@@ -1005,18 +1851,43 @@ bool EntityComponentManager::HasEntity(const Entity _entity) const
 /////////////////////////////////////////////////
 Entity EntityComponentManager::ParentEntity(const Entity _entity) const
 {
-  auto parents = this->Entities().AdjacentsTo(_entity);
-  if (parents.empty())
+  const uint64_t slot = this->dataPtr->EntitySlot(_entity);
+  if (EntityComponentManagerPrivate::kInvalidEntitySlot == slot)
     return kNullEntity;
 
-  // TODO(louise) Do we want to support multiple parents?
-  return parents.begin()->first;
+  const uint64_t parentSlot = this->dataPtr->slotParent[slot];
+  if (EntityComponentManagerPrivate::kInvalidEntitySlot == parentSlot)
+    return kNullEntity;
+
+  return this->dataPtr->slotEntities[parentSlot];
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::InvalidateDescendantCache(Entity _child,
+    Entity _parent)
+{
+  for (auto iter = this->descendantCache.begin();
+       iter != this->descendantCache.end();)
+  {
+    if (iter->second.find(_child) != iter->second.end() ||
+        (kNullEntity != _parent &&
+         iter->second.find(_parent) != iter->second.end()))
+    {
+      iter = this->descendantCache.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
 }
 
 /////////////////////////////////////////////////
 bool EntityComponentManager::SetParentEntity(const Entity _child,
     const Entity _parent)
 {
+  this->dataPtr->InvalidateDescendantCache(_child, _parent);
+
   // Remove current parent(s)
   auto parents = this->Entities().AdjacentsTo(_child);
   for (const auto &parent : parents)
@@ -1025,6 +1896,10 @@ bool EntityComponentManager::SetParentEntity(const Entity _child,
     this->dataPtr->entities.RemoveEdge(edge);
   }
 
+  const uint64_t childSlot = this->dataPtr->EntitySlot(_child);
+  if (EntityComponentManagerPrivate::kInvalidEntitySlot != childSlot)
+    this->dataPtr->UnlinkEntitySlot(childSlot);
+
   // Leave parent-less
   if (_parent == kNullEntity)
   {
@@ -1033,7 +1908,13 @@ bool EntityComponentManager::SetParentEntity(const Entity _child,
 
   // Add edge
   auto edge = this->dataPtr->entities.AddEdge({_parent, _child}, true);
-  return (math::graph::kNullId != edge.Id());
+  if (math::graph::kNullId == edge.Id())
+    return false;
+
+  // Both vertices exist if the edge was added, so both have slots.
+  this->dataPtr->LinkEntitySlot(childSlot,
+      this->dataPtr->EntitySlot(_parent));
+  return true;
 }
 
 /////////////////////////////////////////////////
@@ -1066,7 +1947,8 @@ bool EntityComponentManager::CreateComponentImplementation(
   bool updateData = true;
 
   this->dataPtr->AddModifiedComponent(_entity);
-  this->dataPtr->oneTimeChangedComponents[_componentTypeId].insert(_entity);
+  this->dataPtr->oneTimeChangedComponents[_componentTypeId].Insert(
+      this->dataPtr->AssignEntitySlot(_entity));
 
   // make sure the entity exists
   auto typeMapIter = this->dataPtr->componentTypeIndex.find(_entity);
@@ -1087,24 +1969,59 @@ bool EntityComponentManager::CreateComponentImplementation(
     return false;
   }
 
-  // Instantiate the new component.
-  auto newComp = components::Factory::Instance()->New(_componentTypeId, _data);
-
   const auto compIdxIter = typeMapIter->second.find(_componentTypeId);
   // If entity has never had a component of this type
   if (compIdxIter == typeMapIter->second.end())
   {
+    // Instantiate the new component, preferably by recycling an instance
+    // from the component pool instead of going through the factory.
+    std::unique_ptr<components::BaseComponent> newComp;
+    auto poolIter = this->dataPtr->componentPool.find(_componentTypeId);
+    if (nullptr != _data && poolIter != this->dataPtr->componentPool.end() &&
+        !poolIter->second.empty() && poolIter->second.back()->CopyFrom(*_data))
+    {
+      newComp = std::move(poolIter->second.back());
+      poolIter->second.pop_back();
+      ++this->dataPtr->componentPoolStats[_componentTypeId].reused;
+    }
+    else
+    {
+      newComp = components::Factory::Instance()->New(_componentTypeId, _data);
+    }
+
     const auto vectorIdx = entityCompIter->second.size();
     entityCompIter->second.push_back(std::move(newComp));
     this->dataPtr->componentTypeIndex[_entity][_componentTypeId] = vectorIdx;
     this->dataPtr->componentTypeIndexDirty = true;
+    ++this->dataPtr->structuralEpoch;
 
     updateData = false;
-    for (auto &viewPair : this->dataPtr->views)
+
+    if (this->dataPtr->batchingEntities)
+    {
+      // Defer view updates until the batch ends; EndEntityBatch reconciles
+      // all batched entities against the views in one pass.
+      this->dataPtr->batchedEntities.insert(_entity);
+    }
+    else if (this->dataPtr->batchingComponents)
     {
-      auto &view = viewPair.second.first;
-      if (this->EntityMatches(_entity, view->ComponentTypes()))
-        view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+      // Same, but reconciled in EndComponentBatch.
+      this->dataPtr->batchedComponentEntities.insert(_entity);
+    }
+    else
+    {
+      // Only views that require the added component type can newly match this
+      // entity, so the per-component-type index is enough here.
+      auto interestedViewsIter =
+          this->dataPtr->viewsByComponentType.find(_componentTypeId);
+      if (interestedViewsIter != this->dataPtr->viewsByComponentType.end())
+      {
+        for (auto &view : interestedViewsIter->second)
+        {
+          if (this->EntityMatches(_entity, view->ComponentTypes()))
+            view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+        }
+      }
     }
   }
   else
@@ -1130,16 +2047,30 @@ bool EntityComponentManager::CreateComponentImplementation(
     else if (this->dataPtr->ComponentMarkedAsRemoved(_entity, _componentTypeId))
     {
       this->dataPtr->componentsMarkedAsRemoved[_entity].erase(_componentTypeId);
+      ++this->dataPtr->structuralEpoch;
 
-      for (auto &viewPair : this->dataPtr->views)
+      if (this->dataPtr->batchingComponents)
       {
-        viewPair.second.first->NotifyComponentAddition(_entity,
-            this->IsNewEntity(_entity), _componentTypeId);
+        this->dataPtr->batchedComponentEntities.insert(_entity);
+      }
+      else
+      {
+        auto interestedViewsIter =
+            this->dataPtr->viewsByComponentType.find(_componentTypeId);
+        if (interestedViewsIter != this->dataPtr->viewsByComponentType.end())
+        {
+          for (auto &view : interestedViewsIter->second)
+          {
+            view->NotifyComponentAddition(_entity,
+                this->IsNewEntity(_entity), _componentTypeId);
+          }
+        }
       }
     }
   }
 
   this->dataPtr->createdCompTypes.insert(_componentTypeId);
+  this->MarkComponentValueIndexDirty(_entity, _componentTypeId);
 
   // If the component is a components::ParentEntity, then make sure to
   // update the entities graph.
@@ -1242,6 +2173,12 @@ bool EntityComponentManager::HasComponentType(
     this->dataPtr->createdCompTypes.end();
 }
 
+/////////////////////////////////////////////////
+uint64_t EntityComponentManager::StructuralEpoch() const
+{
+  return this->dataPtr->structuralEpoch;
+}
+
 //////////////////////////////////////////////////
 const EntityGraph &EntityComponentManager::Entities() const
 {
@@ -1252,15 +2189,17 @@ const EntityGraph &EntityComponentManager::Entities() const
 std::pair<detail::BaseView *, std::mutex *> EntityComponentManager::FindView(
     const std::vector<ComponentTypeId> &_types) const
 {
-  std::lock_guard<std::mutex> lockViews(this->dataPtr->viewsMutex);
-  std::pair<detail::BaseView *, std::mutex *> viewMutexPair(nullptr, nullptr);
-  auto iter = this->dataPtr->views.find(_types);
-  if (iter != this->dataPtr->views.end())
-  {
-    viewMutexPair.first = iter->second.first.get();
-    viewMutexPair.second = iter->second.second.get();
-  }
-  return viewMutexPair;
+  // Probe the immutable lookup snapshot instead of the views map so this
+  // wait-free path never contends with other const queries. A reader
+  // holding a snapshot that predates a concurrent AddView just misses the
+  // new view and rebuilds it; AddView then resolves the race by returning
+  // the already-inserted instance.
+  const auto lookup = std::atomic_load_explicit(&this->dataPtr->viewLookup,
+      std::memory_order_acquire);
+  auto iter = lookup->find(_types);
+  if (iter != lookup->end())
+    return iter->second;
+  return {nullptr, nullptr};
 }
 
 //////////////////////////////////////////////////
@@ -1271,10 +2210,37 @@ detail::BaseView *EntityComponentManager::AddView(
   // If the view already exists, then the map will return the iterator to
   // the location that prevented the insertion.
   std::lock_guard<std::mutex> lockViews(this->dataPtr->viewsMutex);
-  auto iter = this->dataPtr->views.insert(std::make_pair(_types,
+  auto result = this->dataPtr->views.insert(std::make_pair(_types,
         std::make_pair(std::move(_view),
-          std::make_unique<std::mutex>()))).first;
-  return iter->second.first.get();
+          std::make_unique<std::mutex>())));
+  auto viewPtr = result.first->second.first.get();
+
+  // Register the newly inserted view with the per-component-type index so
+  // that component additions/removals of the view's types can find it.
+  if (result.second)
+  {
+    for (const auto &typeId : viewPtr->ComponentTypes())
+      this->dataPtr->viewsByComponentType[typeId].push_back(viewPtr);
+
+    this->dataPtr->PublishViewLookup();
+  }
+
+  return viewPtr;
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::PublishViewLookup()
+{
+  auto lookup = std::make_shared<ViewLookup>();
+  lookup->reserve(this->views.size());
+  for (const auto &viewPair : this->views)
+  {
+    (*lookup)[viewPair.first] = std::make_pair(
+        viewPair.second.first.get(), viewPair.second.second.get());
+  }
+  std::atomic_store_explicit(&this->viewLookup,
+      std::shared_ptr<const ViewLookup>(std::move(lookup)),
+      std::memory_order_release);
 }
 
 //////////////////////////////////////////////////
@@ -1393,16 +2359,21 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedState &_msg,
 
   // Insert all of the entity's components if the passed in types
   // set is empty
+  // Use the iterator found above so concurrent serialization workers never
+  // touch the index through the non-const operator[].
   auto types = _types;
   if (types.empty())
   {
-    for (auto &type : this->dataPtr->componentTypeIndex[_entity])
+    for (auto &type : iter->second)
     {
       if (!this->dataPtr->ComponentMarkedAsRemoved(_entity, type.first))
         types.insert(type.first);
     }
   }
 
+  // A single stream is reused for every component of the entity so that the
+  // stream's buffer is only allocated once instead of per component.
+  std::ostringstream ostr;
   for (const ComponentTypeId type : types)
   {
     // If the entity does not have the component, continue
@@ -1418,7 +2389,8 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedState &_msg,
     auto compMsg = entityMsg->add_components();
     compMsg->set_type(compBase->TypeId());
 
-    std::ostringstream ostr;
+    ostr.str(std::string());
+    ostr.clear();
     compBase->Serialize(ostr);
 
     compMsg->set_component(ostr.str());
@@ -1461,16 +2433,22 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
 
   // Insert all of the entity's components if the passed in types
   // set is empty
+  // Use the iterator found above so concurrent serialization workers never
+  // touch the index through the non-const operator[].
   auto types = _types;
   if (types.empty())
   {
-    for (auto &type : this->dataPtr->componentTypeIndex[_entity])
+    for (auto &type : iter->second)
     {
       if (!this->dataPtr->ComponentMarkedAsRemoved(_entity, type.first))
         types.insert(type.first);
     }
   }
 
+  // A single stream is reused for every component of the entity so that the
+  // stream's buffer is only allocated once instead of per component.
+  std::ostringstream ostr;
+
   // Empty means all types
   for (const ComponentTypeId type : types)
   {
@@ -1490,9 +2468,10 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
 
       // see if the entity has a component of this particular type marked as a
       // one time change
+      const uint64_t slot = this->dataPtr->EntitySlot(_entity);
       auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(type);
       if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end() &&
-          oneTimeIter->second.find(_entity) != oneTimeIter->second.end())
+          oneTimeIter->second.Contains(slot))
         noChange = false;
 
       if (noChange)
@@ -1501,7 +2480,7 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
         // periodic change
         auto periodicIter = this->dataPtr->periodicChangedComponents.find(type);
         if (periodicIter != this->dataPtr->periodicChangedComponents.end() &&
-            periodicIter->second.find(_entity) != periodicIter->second.end())
+            periodicIter->second.Contains(slot))
           noChange = false;
       }
 
@@ -1536,7 +2515,8 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
     }
 
     // Serialize and store the message
-    std::ostringstream ostr;
+    ostr.str(std::string());
+    ostr.clear();
     compBase->Serialize(ostr);
     compIter->second.set_component(ostr.str());
   }
@@ -1647,15 +2627,53 @@ msgs::SerializedState EntityComponentManager::State(
     const std::unordered_set<ComponentTypeId> &_types) const
 {
   msgs::SerializedState stateMsg;
-  for (const auto &it : this->dataPtr->componentTypeIndex)
+
+  this->dataPtr->CalculateStateThreadLoad();
+
+  // Per-entity serialization is independent, so partition the entities
+  // across workers that fill per-worker submessages, then splice the
+  // results. Full-state snapshots of large worlds are otherwise dominated
+  // by single-threaded serialization time.
+  const uint64_t numThreads =
+      this->dataPtr->componentTypeIndexIterators.size() - 1;
+  std::vector<msgs::SerializedState> threadMsgs(numThreads);
+
+  auto functor = [&](auto itStart, auto itEnd, uint64_t _index)
   {
-    auto entity = it.first;
-    if (!_entities.empty() && _entities.find(entity) == _entities.end())
+    while (itStart != itEnd)
     {
-      continue;
+      auto entity = (*itStart).first;
+      if (_entities.empty() || _entities.find(entity) != _entities.end())
+      {
+        this->AddEntityToMessage(threadMsgs[_index], entity, _types);
+      }
+      itStart++;
     }
+  };
+
+  // Spawn workers
+  std::vector<std::thread> workers;
+  for (uint64_t i = 0; i < numThreads; i++)
+  {
+    workers.push_back(std::thread(functor,
+        this->dataPtr->componentTypeIndexIterators[i],
+        this->dataPtr->componentTypeIndexIterators[i+1], i));
+  }
+
+  // Wait for each thread to finish processing its entities
+  std::for_each(workers.begin(), workers.end(), [](std::thread &_t)
+  {
+    _t.join();
+  });
 
-    this->AddEntityToMessage(stateMsg, entity, _types);
+  // Splice the per-worker messages in partition order, swapping the entity
+  // submessages into place instead of copying them.
+  for (auto &threadMsg : threadMsgs)
+  {
+    for (auto &entity : *threadMsg.mutable_entities())
+    {
+      stateMsg.mutable_entities()->Add()->Swap(&entity);
+    }
   }
 
   return stateMsg;
@@ -1710,11 +2728,44 @@ void EntityComponentManager::State(
   });
 }
 
+//////////////////////////////////////////////////
+msgs::SerializedStateMap *EntityComponentManager::State(
+    google::protobuf::Arena &_arena,
+    const std::unordered_set<Entity> &_entities,
+    const std::unordered_set<ComponentTypeId> &_types,
+    bool _full) const
+{
+  auto *state =
+      google::protobuf::Arena::CreateMessage<msgs::SerializedStateMap>(
+        &_arena);
+
+  // Fill the message sequentially: the submessages created while filling are
+  // allocated from the arena because their parent lives on the arena, so a
+  // caller that resets the arena between calls reuses the same memory for
+  // every serialization pass.
+  for (const auto &it : this->dataPtr->componentTypeIndex)
+  {
+    auto entity = it.first;
+    if (!_entities.empty() && _entities.find(entity) == _entities.end())
+      continue;
+
+    this->AddEntityToMessage(*state, entity, _types, _full);
+  }
+
+  return state;
+}
+
 //////////////////////////////////////////////////
 void EntityComponentManager::SetState(
     const msgs::SerializedState &_stateMsg)
 {
   GZ_PROFILE("EntityComponentManager::SetState Non-map");
+  auto *factory = components::Factory::Instance();
+
+  // Batch the component churn so views are reconciled once per state
+  // message instead of once per component addition or removal.
+  this->BeginComponentBatch();
+
   // Create / remove / update entities
   for (int e = 0; e < _stateMsg.entities_size(); ++e)
   {
@@ -1749,21 +2800,6 @@ void EntityComponentManager::SetState(
 
       auto type = compMsg.type();
 
-      // Components which haven't been registered in this process, such as 3rd
-      // party components streamed to other secondaries and the GUI.
-      if (!components::Factory::Instance()->HasType(type))
-      {
-        static std::unordered_set<unsigned int> printedComps;
-        if (printedComps.find(type) == printedComps.end())
-        {
-          printedComps.insert(type);
-          gzwarn << "Component type [" << type << "] has not been "
-                  << "registered in this process, so it can't be deserialized."
-                  << std::endl;
-        }
-        continue;
-      }
-
       // Remove component
       if (compMsg.remove())
       {
@@ -1777,9 +2813,26 @@ void EntityComponentManager::SetState(
       // Create if new
       if (nullptr == comp)
       {
+        // Components which haven't been registered in this process, such as
+        // 3rd party components streamed to other secondaries and the GUI.
+        // Only types that don't exist on the entity yet can be unregistered,
+        // so the common update path skips this factory probe.
+        if (!factory->HasType(type))
+        {
+          static std::unordered_set<unsigned int> printedComps;
+          if (printedComps.find(type) == printedComps.end())
+          {
+            printedComps.insert(type);
+            gzwarn << "Component type [" << type << "] has not been "
+                    << "registered in this process, so it can't be "
+                    << "deserialized." << std::endl;
+          }
+          continue;
+        }
+
         std::istringstream istr(compMsg.component());
 
-        auto newComp = components::Factory::Instance()->New(type);
+        auto newComp = factory->New(type);
         if (nullptr == newComp)
         {
           gzerr << "Failed to create component type ["
@@ -1803,9 +2856,12 @@ void EntityComponentManager::SetState(
         std::istringstream istr(compMsg.component());
         comp->Deserialize(istr);
         this->dataPtr->AddModifiedComponent(entity);
+        this->MarkComponentValueIndexDirty(entity, type);
       }
     }
   }
+
+  this->EndComponentBatch();
 }
 
 //////////////////////////////////////////////////
@@ -1813,6 +2869,12 @@ void EntityComponentManager::SetState(
     const msgs::SerializedStateMap &_stateMsg)
 {
   GZ_PROFILE("EntityComponentManager::SetState Map");
+  auto *factory = components::Factory::Instance();
+
+  // Batch the component churn so views are reconciled once per state
+  // message instead of once per component addition or removal.
+  this->BeginComponentBatch();
+
   // Create / remove / update entities
   for (const auto &iter : _stateMsg.entities())
   {
@@ -1840,21 +2902,6 @@ void EntityComponentManager::SetState(
 
       uint64_t type = compMsg.type();
 
-      // Components which haven't been registered in this process, such as 3rd
-      // party components streamed to other secondaries and the GUI.
-      if (!components::Factory::Instance()->HasType(type))
-      {
-        static std::unordered_set<unsigned int> printedComps;
-        if (printedComps.find(type) == printedComps.end())
-        {
-          printedComps.insert(type);
-          gzwarn << "Component type [" << type << "] has not been "
-                  << "registered in this process, so it can't be deserialized."
-                  << std::endl;
-        }
-        continue;
-      }
-
       // Remove component
       if (compMsg.remove())
       {
@@ -1869,10 +2916,27 @@ void EntityComponentManager::SetState(
       // Create if new
       if (nullptr == comp)
       {
+        // Components which haven't been registered in this process, such as
+        // 3rd party components streamed to other secondaries and the GUI.
+        // Only types that don't exist on the entity yet can be unregistered,
+        // so the common update path skips this factory probe.
+        if (!factory->HasType(type))
+        {
+          static std::unordered_set<unsigned int> printedComps;
+          if (printedComps.find(type) == printedComps.end())
+          {
+            printedComps.insert(type);
+            gzwarn << "Component type [" << type << "] has not been "
+                    << "registered in this process, so it can't be "
+                    << "deserialized." << std::endl;
+          }
+          continue;
+        }
+
         std::istringstream istr(compMsg.component());
 
         // Create component
-        auto newComp = components::Factory::Instance()->New(compMsg.type());
+        auto newComp = factory->New(compMsg.type());
         if (nullptr == newComp)
         {
           gzerr << "Failed to create component of type [" << compMsg.type()
@@ -1902,6 +2966,8 @@ void EntityComponentManager::SetState(
       }
     }
   }
+
+  this->EndComponentBatch();
 }
 
 //////////////////////////////////////////////////
@@ -1920,10 +2986,23 @@ std::unordered_set<Entity> EntityComponentManager::Descendants(Entity _entity)
   if (!this->HasEntity(_entity))
     return descendants;
 
-  auto descVector = math::graph::BreadthFirstSort(this->dataPtr->entities,
-      _entity);
-  std::move(descVector.begin(), descVector.end(), std::inserter(descendants,
-      descendants.end()));
+  // Walk the first-child/next-sibling adjacency arrays instead of the
+  // entity graph: deep hierarchies traverse flat slot indices rather than
+  // per-node edge maps.
+  descendants.insert(_entity);
+  std::vector<uint64_t> pending{this->dataPtr->EntitySlot(_entity)};
+  while (!pending.empty())
+  {
+    const uint64_t slot = pending.back();
+    pending.pop_back();
+    for (uint64_t child = this->dataPtr->slotFirstChild[slot];
+         child != EntityComponentManagerPrivate::kInvalidEntitySlot;
+         child = this->dataPtr->slotNextSibling[child])
+    {
+      descendants.insert(this->dataPtr->slotEntities[child]);
+      pending.push_back(child);
+    }
+  }
 
   this->dataPtr->descendantCache[_entity] = descendants;
   return descendants;
@@ -1952,28 +3031,30 @@ void EntityComponentManager::SetChanged(
       this->dataPtr->ComponentMarkedAsRemoved(_entity, _type))
     return;
 
+  const uint64_t slot = this->dataPtr->AssignEntitySlot(_entity);
+
   if (_c == ComponentState::PeriodicChange)
   {
-    this->dataPtr->periodicChangedComponents[_type].insert(_entity);
+    this->dataPtr->periodicChangedComponents[_type].Insert(slot);
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
-      oneTimeIter->second.erase(_entity);
+      oneTimeIter->second.Erase(slot);
   }
   else if (_c == ComponentState::OneTimeChange)
   {
     auto periodicIter = this->dataPtr->periodicChangedComponents.find(_type);
     if (periodicIter != this->dataPtr->periodicChangedComponents.end())
-      periodicIter->second.erase(_entity);
-    this->dataPtr->oneTimeChangedComponents[_type].insert(_entity);
+      periodicIter->second.Erase(slot);
+    this->dataPtr->oneTimeChangedComponents[_type].Insert(slot);
   }
   else
   {
     auto periodicIter = this->dataPtr->periodicChangedComponents.find(_type);
     if (periodicIter != this->dataPtr->periodicChangedComponents.end())
-      periodicIter->second.erase(_entity);
+      periodicIter->second.Erase(slot);
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
-      oneTimeIter->second.erase(_entity);
+      oneTimeIter->second.Erase(slot);
 
     // the component state is flagged as no change, so don't mark the
     // corresponding entity as one with a modified component
@@ -1981,6 +3062,7 @@ void EntityComponentManager::SetChanged(
   }
 
   this->dataPtr->AddModifiedComponent(_entity);
+  this->MarkComponentValueIndexDirty(_entity, _type);
 }
 
 /////////////////////////////////////////////////
@@ -2026,6 +3108,69 @@ bool EntityComponentManager::LockAddingEntitiesToViews() const
   return this->dataPtr->lockAddEntitiesToViews;
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManager::BeginEntityBatch()
+{
+  this->dataPtr->batchingEntities = true;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::EndEntityBatch()
+{
+  GZ_PROFILE("EntityComponentManager::EndEntityBatch");
+
+  this->dataPtr->batchingEntities = false;
+  if (this->dataPtr->batchedEntities.empty())
+    return;
+
+  // Reconcile every view with the batched entities in a single pass. At this
+  // point all of an entity's components exist, so one EntityMatches test per
+  // view replaces the per-component notifications skipped during the batch.
+  for (auto &viewPair : this->dataPtr->views)
+  {
+    auto &view = viewPair.second.first;
+    for (const Entity entity : this->dataPtr->batchedEntities)
+    {
+      if (this->EntityMatches(entity, view->ComponentTypes()))
+        view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+    }
+  }
+  this->dataPtr->batchedEntities.clear();
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::BeginComponentBatch()
+{
+  this->dataPtr->batchingComponents = true;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::EndComponentBatch()
+{
+  GZ_PROFILE("EntityComponentManager::EndComponentBatch");
+
+  this->dataPtr->batchingComponents = false;
+  if (this->dataPtr->batchedComponentEntities.empty())
+    return;
+
+  // Reconcile every view with the batched entities in a single pass. The
+  // entities' final component sets decide view membership, replacing the
+  // per-call addition and removal notifications skipped during the batch.
+  // Re-adding through MarkEntityToAdd also refreshes the views' component
+  // pointers on the next query.
+  for (auto &viewPair : this->dataPtr->views)
+  {
+    auto &view = viewPair.second.first;
+    for (const Entity entity : this->dataPtr->batchedComponentEntities)
+    {
+      view->RemoveEntity(entity);
+      if (this->EntityMatches(entity, view->ComponentTypes()))
+        view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+    }
+  }
+  this->dataPtr->batchedComponentEntities.clear();
+}
+
 /////////////////////////////////////////////////
 void EntityComponentManagerPrivate::AddModifiedComponent(const Entity &_entity)
 {
@@ -2042,6 +3187,37 @@ void EntityComponentManagerPrivate::AddModifiedComponent(const Entity &_entity)
   this->modifiedComponents.insert(_entity);
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManagerPrivate::RecycleComponents(const Entity _entity)
+{
+  auto storageIter = this->componentStorage.find(_entity);
+  if (storageIter == this->componentStorage.end())
+    return;
+
+  for (auto &comp : storageIter->second)
+  {
+    if (nullptr == comp)
+      continue;
+
+    auto &pool = this->componentPool[comp->TypeId()];
+    if (pool.size() >= kComponentPoolMaxSize)
+      continue;
+
+    ++this->componentPoolStats[comp->TypeId()].recycled;
+    pool.push_back(std::move(comp));
+  }
+}
+
+/////////////////////////////////////////////////
+std::unordered_map<ComponentTypeId, EntityComponentManager::PoolStats>
+EntityComponentManager::ComponentPoolStats() const
+{
+  auto stats = this->dataPtr->componentPoolStats;
+  for (const auto &[typeId, pool] : this->dataPtr->componentPool)
+    stats[typeId].available = pool.size();
+  return stats;
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManagerPrivate::ComponentMarkedAsRemoved(
     const Entity _entity, const ComponentTypeId _typeId) const
@@ -2231,8 +3407,61 @@ void EntityComponentManager::ApplyEntityDiff(
 void EntityComponentManager::ResetTo(const EntityComponentManager &_other)
 {
   auto ecmDiff = this->ComputeEntityDiff(_other);
-  EntityComponentManager tmpCopy;
-  tmpCopy.CopyFrom(_other);
-  tmpCopy.ApplyEntityDiff(*this, ecmDiff);
-  this->CopyFrom(tmpCopy);
+
+  // Entities spawned since the snapshot must survive the copy below as
+  // marked-for-removal so systems can match them with EachRemoved. Their
+  // component data only lives in this ECM, so stash a clone of it before
+  // the snapshot state overwrites everything. This stash is the only
+  // per-reset allocation that scales with the episode: the snapshot
+  // itself is applied in place, so resetting a structurally stable world
+  // stays free of deep copies.
+  struct SpawnedEntity
+  {
+    Entity entity;
+    Entity parent;
+    std::vector<std::pair<ComponentTypeId,
+        std::unique_ptr<components::BaseComponent>>> components;
+  };
+  std::vector<SpawnedEntity> spawned;
+  spawned.reserve(ecmDiff.RemovedEntities().size());
+  for (const auto &entity : ecmDiff.RemovedEntities())
+  {
+    SpawnedEntity stash;
+    stash.entity = entity;
+    stash.parent = this->ParentEntity(entity);
+    for (const auto compTypeId : this->ComponentTypes(entity))
+    {
+      const components::BaseComponent *data =
+          this->ComponentImplementation(entity, compTypeId);
+      stash.components.emplace_back(compTypeId, data->Clone());
+    }
+    spawned.push_back(std::move(stash));
+  }
+
+  this->CopyFrom(_other);
+
+  // Re-create the spawned entities as marked for removal, with their
+  // components restored so EachRemoved matches correctly.
+  for (auto &stash : spawned)
+  {
+    this->dataPtr->CreateEntityImplementation(stash.entity);
+    // We want to set this entity as "removed", but
+    // CreateEntityImplementation sets it as "newlyCreated",
+    // so remove it from that list.
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->entityCreatedMutex);
+      this->dataPtr->newlyCreatedEntities.erase(stash.entity);
+    }
+    if (stash.entity >= this->dataPtr->entityCount)
+    {
+      this->dataPtr->entityCount = stash.entity;
+    }
+    for (const auto &[typeId, component] : stash.components)
+    {
+      this->CreateComponentImplementation(stash.entity, typeId,
+          component.get());
+    }
+    this->SetParentEntity(stash.entity, stash.parent);
+    this->RequestRemoveEntity(stash.entity, false);
+  }
 }
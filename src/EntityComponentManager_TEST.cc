@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
 #include <gz/math/Pose3.hh>
@@ -1304,6 +1306,85 @@ TEST_P(EntityComponentManagerFixture,
   EXPECT_EQ(0, removedCount<IntComponent>(manager));
 }
 
+////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ComponentPool))
+{
+  // Create and remove an entity so its components land in the pool
+  Entity e1 = manager.CreateEntity();
+  ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e1,
+      IntComponent(123)));
+  manager.RequestRemoveEntity(e1);
+  manager.ProcessEntityRemovals();
+
+  auto stats = manager.ComponentPoolStats();
+  EXPECT_EQ(1u, stats[IntComponent::typeId].available);
+  EXPECT_EQ(1u, stats[IntComponent::typeId].recycled);
+  EXPECT_EQ(0u, stats[IntComponent::typeId].reused);
+
+  // A new component of the same type should reuse the pooled instance and
+  // carry the new data
+  Entity e2 = manager.CreateEntity();
+  auto comp = manager.CreateComponent<IntComponent>(e2, IntComponent(456));
+  ASSERT_NE(nullptr, comp);
+  EXPECT_EQ(456, comp->Data());
+
+  stats = manager.ComponentPoolStats();
+  EXPECT_EQ(0u, stats[IntComponent::typeId].available);
+  EXPECT_EQ(1u, stats[IntComponent::typeId].reused);
+}
+
+////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EachParallel))
+{
+  const int count = 50;
+  for (int i = 0; i < count; ++i)
+  {
+    Entity e = manager.CreateEntity();
+    ASSERT_NE(nullptr, manager.CreateComponent<IntComponent>(e,
+        IntComponent(i)));
+    if (i % 2 == 0)
+    {
+      ASSERT_NE(nullptr, manager.CreateComponent<DoubleComponent>(e,
+          DoubleComponent(i)));
+    }
+  }
+
+  // Only entities with both components should be matched, and each matching
+  // entity should be visited exactly once across all worker threads.
+  std::atomic<int> matched{0};
+  manager.EachParallel<IntComponent, DoubleComponent>(
+      [&](const Entity &, const IntComponent *_int,
+          const DoubleComponent *_double)
+      {
+        EXPECT_NE(nullptr, _int);
+        EXPECT_NE(nullptr, _double);
+        matched++;
+      });
+  EXPECT_EQ(count / 2, matched);
+
+  // The mutable version can write to the visited entity's own components.
+  std::atomic<int> mutableMatched{0};
+  manager.EachParallel<IntComponent>(
+      [&](const Entity &, IntComponent *_int)
+      {
+        _int->Data() += 1;
+        mutableMatched++;
+      });
+  EXPECT_EQ(count, mutableMatched);
+
+  int sum = 0;
+  manager.Each<IntComponent>(
+      [&](const Entity &, const IntComponent *_int)->bool
+      {
+        sum += _int->Data();
+        return true;
+      });
+  // Each original value was incremented once: sum = (1 + 2 + ... + count)
+  EXPECT_EQ(count * (count + 1) / 2, sum);
+}
+
 ////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
        GZ_UTILS_TEST_DISABLED_ON_WIN32(EachNewEachRemove))
@@ -1513,6 +1594,302 @@ TEST_P(EntityComponentManagerFixture,
   EXPECT_EQ(1u, entities.size());
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityByComponentsValueIndex))
+{
+  // Components created before the index is enabled must still be found
+  Entity e1 = manager.CreateEntity();
+  auto comp1 = manager.CreateComponent<StringComponent>(e1,
+      StringComponent("one"));
+  ASSERT_NE(nullptr, comp1);
+
+  manager.EnableComponentValueIndex<StringComponent>();
+  // Enabling twice is a no-op
+  manager.EnableComponentValueIndex<StringComponent>();
+
+  EXPECT_EQ(e1, manager.EntityByComponents(StringComponent("one")));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("two")));
+
+  // Components created after the index is enabled
+  Entity e2 = manager.CreateEntity();
+  auto comp2 = manager.CreateComponent<StringComponent>(e2,
+      StringComponent("two"));
+  ASSERT_NE(nullptr, comp2);
+  auto comp3 = manager.CreateComponent<IntComponent>(e2, IntComponent(2));
+  ASSERT_NE(nullptr, comp3);
+
+  EXPECT_EQ(e2, manager.EntityByComponents(StringComponent("two")));
+
+  // Indexed queries still compare the other desired components
+  EXPECT_EQ(e2, manager.EntityByComponents(StringComponent("two"),
+      IntComponent(2)));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("two"),
+      IntComponent(3)));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("one"),
+      IntComponent(2)));
+
+  // Multiple entities sharing the same value
+  Entity e3 = manager.CreateEntity();
+  auto comp4 = manager.CreateComponent<StringComponent>(e3,
+      StringComponent("two"));
+  ASSERT_NE(nullptr, comp4);
+
+  auto entities = manager.EntitiesByComponents(StringComponent("two"));
+  EXPECT_EQ(2u, entities.size());
+
+  // Value modifications through the ECM re-file the entity
+  EXPECT_TRUE(manager.SetComponentData<StringComponent>(e3, "three"));
+  EXPECT_EQ(e3, manager.EntityByComponents(StringComponent("three")));
+  entities = manager.EntitiesByComponents(StringComponent("two"));
+  EXPECT_EQ(1u, entities.size());
+
+  // In-place modifications announced with SetChanged re-file the entity
+  comp2->Data() = "four";
+  manager.SetChanged(e2, StringComponent::typeId,
+      ComponentState::OneTimeChange);
+  EXPECT_EQ(e2, manager.EntityByComponents(StringComponent("four")));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("two")));
+
+  // Removed components drop out of the index
+  EXPECT_TRUE(manager.RemoveComponent(e2, StringComponent::typeId));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("four")));
+
+  // Removed entities drop out of the index
+  manager.RequestRemoveEntity(e3);
+  manager.ProcessEntityRemovals();
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(StringComponent("three")));
+  EXPECT_EQ(e1, manager.EntityByComponents(StringComponent("one")));
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(CachedViewEach))
+{
+  // Create entities
+  Entity e1 = manager.CreateEntity();
+  auto comp1 = manager.CreateComponent<IntComponent>(e1, IntComponent(1));
+  ASSERT_NE(nullptr, comp1);
+  auto comp2 = manager.CreateComponent<DoubleComponent>(e1,
+      DoubleComponent(1.0));
+  ASSERT_NE(nullptr, comp2);
+
+  auto view = manager.CachedView<IntComponent, DoubleComponent>();
+
+  int count = 0;
+  view.Each([&](const Entity &_entity, const IntComponent *_int,
+      const DoubleComponent *_double) -> bool
+      {
+        EXPECT_EQ(e1, _entity);
+        EXPECT_EQ(1, _int->Data());
+        EXPECT_DOUBLE_EQ(1.0, _double->Data());
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+
+  // Entities created after the handle was resolved are picked up
+  Entity e2 = manager.CreateEntity();
+  auto comp3 = manager.CreateComponent<IntComponent>(e2, IntComponent(2));
+  ASSERT_NE(nullptr, comp3);
+  auto comp4 = manager.CreateComponent<DoubleComponent>(e2,
+      DoubleComponent(2.0));
+  ASSERT_NE(nullptr, comp4);
+
+  count = 0;
+  view.Each([&](const Entity &, const IntComponent *,
+      const DoubleComponent *) -> bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(2, count);
+
+  // Mutable iteration writes through to the components
+  view.Each([](const Entity &, IntComponent *_int,
+      DoubleComponent *) -> bool
+      {
+        _int->Data() *= 10;
+        return true;
+      });
+  EXPECT_EQ(10, comp1->Data());
+  EXPECT_EQ(20, comp3->Data());
+
+  // Removing a required component drops the entity from the view
+  EXPECT_TRUE(manager.RemoveComponent(e1, DoubleComponent::typeId));
+  count = 0;
+  view.Each([&](const Entity &_entity, const IntComponent *,
+      const DoubleComponent *) -> bool
+      {
+        EXPECT_EQ(e2, _entity);
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+
+  // Removing the entity drops it as well
+  manager.RequestRemoveEntity(e2);
+  manager.ProcessEntityRemovals();
+  count = 0;
+  view.Each([&](const Entity &, const IntComponent *,
+      const DoubleComponent *) -> bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(0, count);
+
+  // A handle created before any matching entity exists resolves too
+  auto boolView = manager.CachedView<BoolComponent>();
+  count = 0;
+  boolView.Each([&](const Entity &, const BoolComponent *) -> bool
+      {
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(0, count);
+
+  Entity e3 = manager.CreateEntity();
+  auto comp5 = manager.CreateComponent<BoolComponent>(e3,
+      BoolComponent(true));
+  ASSERT_NE(nullptr, comp5);
+  count = 0;
+  boolView.Each([&](const Entity &_entity, const BoolComponent *) -> bool
+      {
+        EXPECT_EQ(e3, _entity);
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ComponentBatch))
+{
+  // Create entities
+  Entity e1 = manager.CreateEntity();
+  auto comp1 = manager.CreateComponent<IntComponent>(e1, IntComponent(1));
+  ASSERT_NE(nullptr, comp1);
+  auto comp2 = manager.CreateComponent<DoubleComponent>(e1,
+      DoubleComponent(1.0));
+  ASSERT_NE(nullptr, comp2);
+
+  Entity e2 = manager.CreateEntity();
+  auto comp3 = manager.CreateComponent<IntComponent>(e2, IntComponent(2));
+  ASSERT_NE(nullptr, comp3);
+
+  // Create the view before batching
+  EXPECT_EQ(1, (eachCount<IntComponent, DoubleComponent>(manager)));
+
+  // Batch a removal and an addition; the views reflect the entities' final
+  // component sets once the batch ends
+  manager.BeginComponentBatch();
+  EXPECT_TRUE(manager.RemoveComponent(e1, DoubleComponent::typeId));
+  auto comp4 = manager.CreateComponent<DoubleComponent>(e2,
+      DoubleComponent(2.0));
+  ASSERT_NE(nullptr, comp4);
+  manager.EndComponentBatch();
+
+  int count = 0;
+  manager.Each<IntComponent, DoubleComponent>(
+      [&](const Entity &_entity, const IntComponent *_int,
+          const DoubleComponent *_double) -> bool
+      {
+        EXPECT_EQ(e2, _entity);
+        EXPECT_EQ(2, _int->Data());
+        EXPECT_DOUBLE_EQ(2.0, _double->Data());
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+
+  // A component removed and re-added within a batch stays in the view
+  manager.BeginComponentBatch();
+  EXPECT_TRUE(manager.RemoveComponent(e2, DoubleComponent::typeId));
+  auto comp5 = manager.CreateComponent<DoubleComponent>(e2,
+      DoubleComponent(3.0));
+  ASSERT_NE(nullptr, comp5);
+  manager.EndComponentBatch();
+
+  count = 0;
+  manager.Each<IntComponent, DoubleComponent>(
+      [&](const Entity &_entity, const IntComponent *,
+          const DoubleComponent *_double) -> bool
+      {
+        EXPECT_EQ(e2, _entity);
+        EXPECT_DOUBLE_EQ(3.0, _double->Data());
+        ++count;
+        return true;
+      });
+  EXPECT_EQ(1, count);
+
+  // An empty batch is a no-op
+  manager.BeginComponentBatch();
+  manager.EndComponentBatch();
+  EXPECT_EQ(1, (eachCount<IntComponent, DoubleComponent>(manager)));
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ComponentChangeSubscriptions))
+{
+  const auto createdSub = manager.SubscribeComponentChanges(
+      IntComponent::typeId, ComponentChangeKind::Created);
+  const auto oneTimeSub = manager.SubscribeComponentChanges(
+      IntComponent::typeId, ComponentChangeKind::OneTimeChanged);
+  const auto periodicSub = manager.SubscribeComponentChanges(
+      DoubleComponent::typeId, ComponentChangeKind::PeriodicChanged);
+  const auto removedSub = manager.SubscribeComponentChanges(
+      DoubleComponent::typeId, ComponentChangeKind::Removed);
+
+  // Before any update, all lists are empty, as is an unknown id
+  EXPECT_TRUE(manager.ComponentChangeList(createdSub).empty());
+  EXPECT_TRUE(manager.ComponentChangeList(12345u).empty());
+
+  // Component creation shows up as created (for new entities) and as a
+  // one-time change
+  Entity e1 = manager.CreateEntity();
+  manager.CreateComponent<IntComponent>(e1, IntComponent(1));
+  manager.CreateComponent<DoubleComponent>(e1, DoubleComponent(1.0));
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent<DoubleComponent>(e2, DoubleComponent(2.0));
+
+  manager.UpdateComponentChangeSubscriptions();
+  EXPECT_EQ(std::vector<Entity>{e1}, manager.ComponentChangeList(createdSub));
+  EXPECT_EQ(std::vector<Entity>{e1}, manager.ComponentChangeList(oneTimeSub));
+  EXPECT_TRUE(manager.ComponentChangeList(periodicSub).empty());
+  EXPECT_TRUE(manager.ComponentChangeList(removedSub).empty());
+
+  // End the "step" the way the simulation runner does
+  manager.ClearNewlyCreatedEntities();
+  manager.ClearRemovedComponents();
+  manager.RunSetAllComponentsUnchanged();
+
+  // A periodic change lands in the periodic subscription only
+  manager.SetChanged(e2, DoubleComponent::typeId,
+      ComponentState::PeriodicChange);
+  manager.UpdateComponentChangeSubscriptions();
+  EXPECT_TRUE(manager.ComponentChangeList(createdSub).empty());
+  EXPECT_TRUE(manager.ComponentChangeList(oneTimeSub).empty());
+  EXPECT_EQ(std::vector<Entity>{e2},
+      manager.ComponentChangeList(periodicSub));
+
+  manager.ClearRemovedComponents();
+  manager.RunSetAllComponentsUnchanged();
+
+  // Removing a component lands in the removed subscription
+  EXPECT_TRUE(manager.RemoveComponent(e1, DoubleComponent::typeId));
+  manager.UpdateComponentChangeSubscriptions();
+  EXPECT_EQ(std::vector<Entity>{e1},
+      manager.ComponentChangeList(removedSub));
+
+  // After unsubscribing, the id resolves to an empty list and updates no
+  // longer touch it
+  manager.UnsubscribeComponentChanges(removedSub);
+  EXPECT_TRUE(manager.ComponentChangeList(removedSub).empty());
+}
+
 /////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
        GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityGraph))
@@ -2755,6 +3132,18 @@ TEST_P(EntityComponentManagerFixture,
   clonedEntities.insert(clonedTopLevelEntity);
   validateTopLevelClone(clonedTopLevelEntity);
 
+  // the cloned-from map covers the whole subtree of the last clone
+  const auto &clonedMap = manager.ClonedEntityMap();
+  EXPECT_EQ(4u, clonedMap.size());
+  ASSERT_NE(clonedMap.end(), clonedMap.find(topLevelEntity));
+  EXPECT_EQ(clonedTopLevelEntity, clonedMap.at(topLevelEntity));
+  for (const auto &[original, cloned] : clonedMap)
+  {
+    EXPECT_TRUE(manager.HasEntity(original));
+    EXPECT_TRUE(manager.HasEntity(cloned));
+    EXPECT_NE(original, cloned);
+  }
+
   auto validateChildClone =
     [&](const Entity _clonedChild, const Entity _originalChild)
     {
@@ -3355,6 +3744,94 @@ TEST_P(EntityComponentManagerFixture,
   EXPECT_EQ(321, comp->Data());
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(CopyFromRefreshesInPlace))
+{
+  auto e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  manager.CreateComponent(e1, DoubleComponent(0.5));
+  auto e2 = manager.CreateEntity();
+  manager.CreateComponent(e2, StringComponent("e2"));
+
+  EntityComponentManager snapshot;
+  snapshot.CopyFrom(manager);
+  EXPECT_EQ(2u, snapshot.EntityCount());
+  ASSERT_NE(nullptr, snapshot.Component<IntComponent>(e1));
+  EXPECT_EQ(1, snapshot.Component<IntComponent>(e1)->Data());
+
+  // Mutate the live manager, then refresh the snapshot. The component
+  // instances already in the snapshot are reused, so only the data changes.
+  const auto *intCompBefore = snapshot.Component<IntComponent>(e1);
+  const auto *strCompBefore = snapshot.Component<StringComponent>(e2);
+  manager.SetComponentData<IntComponent>(e1, 2);
+  manager.SetComponentData<StringComponent>(e2, "e2-updated");
+
+  snapshot.CopyFrom(manager);
+  EXPECT_EQ(2u, snapshot.EntityCount());
+  EXPECT_EQ(intCompBefore, snapshot.Component<IntComponent>(e1));
+  EXPECT_EQ(2, intCompBefore->Data());
+  EXPECT_EQ(strCompBefore, snapshot.Component<StringComponent>(e2));
+  EXPECT_EQ("e2-updated", strCompBefore->Data());
+
+  // Structural changes still come across: new entities and components are
+  // cloned, entities gone from the source disappear from the copy.
+  auto e3 = manager.CreateEntity();
+  manager.CreateComponent(e3, IntComponent(3));
+  manager.RequestRemoveEntity(e2);
+  manager.ProcessEntityRemovals();
+
+  snapshot.CopyFrom(manager);
+  EXPECT_EQ(2u, snapshot.EntityCount());
+  EXPECT_FALSE(snapshot.HasEntity(e2));
+  ASSERT_NE(nullptr, snapshot.Component<IntComponent>(e3));
+  EXPECT_EQ(3, snapshot.Component<IntComponent>(e3)->Data());
+}
+
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ChangeTrackingAcrossEntityRecycling))
+{
+  // Mark a component changed, then remove its entity. The change tracking
+  // for the removed entity must be dropped with it.
+  auto e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  manager.RunClearNewlyCreatedEntities();
+  manager.RunSetAllComponentsUnchanged();
+
+  manager.SetChanged(e1, IntComponent::typeId,
+      ComponentState::PeriodicChange);
+  EXPECT_TRUE(manager.HasPeriodicComponentChanges());
+
+  manager.RequestRemoveEntity(e1);
+  manager.ProcessEntityRemovals();
+  EXPECT_FALSE(manager.HasPeriodicComponentChanges());
+  EXPECT_FALSE(manager.HasEntity(e1));
+
+  // A new entity reuses the removed entity's internal storage but keeps a
+  // fresh id, so the stale handle stays detectable and the new entity
+  // doesn't inherit any change state.
+  auto e2 = manager.CreateEntity();
+  EXPECT_NE(e1, e2);
+  manager.CreateComponent(e2, IntComponent(2));
+  EXPECT_EQ(ComponentState::OneTimeChange,
+      manager.ComponentState(e2, IntComponent::typeId));
+
+  manager.RunClearNewlyCreatedEntities();
+  manager.RunSetAllComponentsUnchanged();
+  EXPECT_EQ(ComponentState::NoChange,
+      manager.ComponentState(e2, IntComponent::typeId));
+  EXPECT_FALSE(manager.HasPeriodicComponentChanges());
+  EXPECT_FALSE(manager.HasOneTimeComponentChanges());
+
+  manager.SetChanged(e2, IntComponent::typeId,
+      ComponentState::OneTimeChange);
+  EXPECT_EQ(ComponentState::OneTimeChange,
+      manager.ComponentState(e2, IntComponent::typeId));
+  EXPECT_EQ(ComponentState::NoChange,
+      manager.ComponentState(e1, IntComponent::typeId));
+}
+
 // Run multiple times. We want to make sure that static globals don't cause
 // problems.
 INSTANTIATE_TEST_SUITE_P(EntityComponentManagerRepeat,
@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include "gz/sim/Events.hh"
 #include "gz/sim/EventManager.hh"
@@ -127,3 +130,57 @@ TEST(EventManager, Disambiguate)
   eventManager.Emit<TestEvent2>();
   EXPECT_EQ(1, calls);
 }
+
+/////////////////////////////////////////////////
+TEST(EventManager, QueuedEmit)
+{
+  EventManager eventManager;
+  using TestEvent =
+      gz::common::EventT<void(int, std::string), struct QueuedTag>;
+
+  std::vector<std::pair<int, std::string>> immediate;
+  auto connection = eventManager.Connect<TestEvent>(
+      [&](int _num, std::string _label)
+      {
+        immediate.push_back({_num, _label});
+      });
+
+  int batchCalls = 0;
+  std::vector<std::tuple<int, std::string>> batched;
+  auto batchConnection = eventManager.ConnectToBatch<TestEvent>(
+      [&](const std::vector<std::tuple<int, std::string>> &_batch)
+      {
+        batchCalls++;
+        batched = _batch;
+      });
+
+  // Queued emissions are held until processed.
+  eventManager.QueueEmit<TestEvent>(1, "one");
+  eventManager.QueueEmit<TestEvent>(2, "two");
+  eventManager.QueueEmit<TestEvent>(3, "three");
+  EXPECT_TRUE(immediate.empty());
+  EXPECT_EQ(0, batchCalls);
+
+  // Immediate subscribers get one callback per emission, in order; batch
+  // subscribers get all of them in a single callback.
+  eventManager.ProcessQueuedEvents();
+  ASSERT_EQ(3u, immediate.size());
+  EXPECT_EQ(1, immediate[0].first);
+  EXPECT_EQ("one", immediate[0].second);
+  EXPECT_EQ(3, immediate[2].first);
+  EXPECT_EQ("three", immediate[2].second);
+  EXPECT_EQ(1, batchCalls);
+  ASSERT_EQ(3u, batched.size());
+  EXPECT_EQ(2, std::get<0>(batched[1]));
+  EXPECT_EQ("two", std::get<1>(batched[1]));
+
+  // An empty queue delivers nothing.
+  eventManager.ProcessQueuedEvents();
+  EXPECT_EQ(3u, immediate.size());
+  EXPECT_EQ(1, batchCalls);
+
+  // Emit still delivers immediately and doesn't touch the batch.
+  eventManager.Emit<TestEvent>(4, "four");
+  EXPECT_EQ(4u, immediate.size());
+  EXPECT_EQ(1, batchCalls);
+}
@@ -18,12 +18,18 @@
 #include "LevelManager.hh"
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
 
 #include <sdf/Actor.hh>
 #include <sdf/Atmosphere.hh>
+#include <sdf/Collision.hh>
 #include <sdf/Joint.hh>
 #include <sdf/Light.hh>
+#include <sdf/Link.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Model.hh>
+#include <sdf/Visual.hh>
 #include <sdf/World.hh>
 
 #include <gz/math/SphericalCoordinates.hh>
@@ -31,6 +37,7 @@
 
 #include "gz/sim/Events.hh"
 #include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Util.hh"
 
 #include "gz/sim/components/Actor.hh"
 #include "gz/sim/components/Atmosphere.hh"
@@ -65,6 +72,19 @@
 using namespace gz;
 using namespace sim;
 
+namespace
+{
+/// \brief Pack integer grid cell coordinates into a single map key. Key
+/// collisions are harmless: they only add a candidate that the exact
+/// intersection tests reject.
+uint64_t CellKey(int _x, int _y, int _z)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(_x)) << 42) ^
+         (static_cast<uint64_t>(static_cast<uint32_t>(_y)) << 21) ^
+          static_cast<uint64_t>(static_cast<uint32_t>(_z));
+}
+}
+
 /////////////////////////////////////////////////
 LevelManager::LevelManager(SimulationRunner *_runner, const bool _useLevels)
     : runner(_runner), useLevels(_useLevels)
@@ -82,6 +102,15 @@ LevelManager::LevelManager(SimulationRunner *_runner, const bool _useLevels)
   this->ReadLevelPerformerInfo();
   this->CreatePerformers();
 
+  // Level loads triggered mid-run are prepared on a background thread so
+  // the step loop is not blocked on disk I/O when a performer crosses a
+  // level boundary.
+  if (this->useLevels)
+  {
+    this->loaderRunning = true;
+    this->loaderThread = std::thread(&LevelManager::PrepareLoadsLoop, this);
+  }
+
   std::string service = transport::TopicUtils::AsValidTopic("/world/" +
       this->runner->sdfWorld->Name() + "/level/set_performer");
   if (service.empty())
@@ -93,6 +122,18 @@ LevelManager::LevelManager(SimulationRunner *_runner, const bool _useLevels)
   this->node.Advertise(service, &LevelManager::OnSetPerformer, this);
 }
 
+/////////////////////////////////////////////////
+LevelManager::~LevelManager()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->loadMutex);
+    this->loaderRunning = false;
+  }
+  this->loadCv.notify_all();
+  if (this->loaderThread.joinable())
+    this->loaderThread.join();
+}
+
 /////////////////////////////////////////////////
 void LevelManager::ReadLevelPerformerInfo()
 {
@@ -225,7 +266,16 @@ void LevelManager::ReadLevelPerformerInfo()
   {
     this->ReadPerformers(pluginElem);
     if (this->useLevels)
+    {
+      // Optional horizon, in seconds, for velocity-extrapolated level
+      // prefetching.
+      if (pluginElem->HasElement("level_prefetch_horizon"))
+      {
+        this->prefetchHorizon =
+            pluginElem->Get<double>("level_prefetch_horizon");
+      }
       this->ReadLevels(pluginElem);
+    }
   }
 
   this->ConfigureDefaultLevel();
@@ -605,6 +655,10 @@ void LevelManager::UpdateLevelsState()
     }
   }
 
+  // Splice in any level loads the background loader thread has finished
+  // preparing.
+  this->SplicePreparedLoads();
+
   {
     GZ_PROFILE("DefaultLevel");
     // Handle default level
@@ -623,6 +677,14 @@ void LevelManager::UpdateLevelsState()
   // If levels are not being used, we only process the default level.
   if (this->useLevels)
   {
+    // Levels are static, so their volumes and the grid over them only need
+    // to be built once.
+    if (this->levelGridDirty)
+    {
+      this->BuildLevelGrid();
+      this->levelGridDirty = false;
+    }
+
     this->runner->entityCompMgr.Each<
       components::Performer,
       components::PerformerLevels,
@@ -652,61 +714,82 @@ void LevelManager::UpdateLevelsState()
             pose->Data().Pos() - perfBox->Size() / 2,
               pose->Data().Pos() + perfBox->Size() / 2};
 
+          // Sweep the performer volume along its predicted travel over the
+          // prefetch horizon so that levels ahead of fast performers start
+          // loading early. Unload decisions below keep using the unswept
+          // volume plus the level buffer.
+          math::AxisAlignedBox predictedVolume = performerVolume;
+          if (this->prefetchHorizon > 0)
+          {
+            auto worldVel = this->runner->entityCompMgr
+                .Component<components::WorldLinearVelocity>(_parent->Data());
+            if (worldVel)
+            {
+              const math::Vector3d offset =
+                  worldVel->Data() * this->prefetchHorizon;
+              predictedVolume += math::AxisAlignedBox{
+                  performerVolume.Min() + offset,
+                  performerVolume.Max() + offset};
+            }
+          }
+
           std::set<Entity> newPerfLevels;
 
-          // loop through levels and check for intersections
-          // Add all levels with intersections to the levelsToLoad even if they
+          // Check the levels near this performer for intersections. Add
+          // all levels with intersections to the levelsToLoad even if they
           // are currently active.
-          this->runner->entityCompMgr.Each<components::Level, components::Pose,
-            components::Geometry,
-            components::LevelBuffer >(
-                [&](const Entity &_entity, const components::Level *,
-                  const components::Pose *_pose,
-                  const components::Geometry *_levelGeometry,
-                  const components::LevelBuffer *_levelBuffer) -> bool
-                {
-                GZ_PROFILE("CheckPerformerAgainstLevel");
-                // Check if the performer is in this level
-                // assume a box for now
-                auto box = _levelGeometry->Data().BoxShape();
-                if (nullptr == box)
-                {
-                gzerr << "Level [" << _entity
-                << "]'s geometry is not a box." << std::endl;
-                return true;
-                }
-                auto buffer = _levelBuffer->Data();
-                auto center = _pose->Data().Pos();
-                math::AxisAlignedBox region{center - box->Size() / 2,
-                center + box->Size() / 2};
-
-                math::AxisAlignedBox outerRegion{
-                  center - (box->Size() / 2 + buffer),
-                         center + (box->Size() / 2 + buffer)};
+          const auto &candidates =
+              this->LevelCandidates(_perfEntity, predictedVolume);
+
+          // Active levels must always be tested, even when they are no
+          // longer among the performer's grid candidates, so that leaving
+          // a level's buffer can still trigger its unload.
+          std::vector<Entity> levelsToCheck = candidates;
+          for (const auto &active : this->activeLevels)
+          {
+            if (this->levelVolumes.find(active) != this->levelVolumes.end() &&
+                std::find(levelsToCheck.begin(), levelsToCheck.end(),
+                    active) == levelsToCheck.end())
+            {
+              levelsToCheck.push_back(active);
+            }
+          }
 
-                if (region.Intersects(performerVolume))
-                {
-                  newPerfLevels.insert(_entity);
-                  levelsToLoad.push_back(_entity);
-                }
-                else
+          for (const Entity levelEntity : levelsToCheck)
+          {
+            GZ_PROFILE("CheckPerformerAgainstLevel");
+            const auto &volumes = this->levelVolumes[levelEntity];
+
+            if (volumes.region.Intersects(performerVolume))
+            {
+              newPerfLevels.insert(levelEntity);
+              levelsToLoad.push_back(levelEntity);
+            }
+            else if (volumes.region.Intersects(predictedVolume))
+            {
+              // The performer is predicted to enter this level within
+              // the prefetch horizon, so start loading it early. The
+              // performer is not registered with the level until it
+              // actually intersects it.
+              levelsToLoad.push_back(levelEntity);
+            }
+            else
+            {
+              // If the level is active, check if the performer is
+              // outside of the buffer of this level
+              if (this->IsLevelActive(levelEntity))
+              {
+                if (volumes.outerRegion.Intersects(performerVolume))
                 {
-                  // If the level is active, check if the performer is
-                  // outside of the buffer of this level
-                  if (this->IsLevelActive(_entity))
-                  {
-                    if (outerRegion.Intersects(performerVolume))
-                    {
-                      newPerfLevels.insert(_entity);
-                      levelsToLoad.push_back(_entity);
-                      return true;
-                    }
-                    // Otherwise, mark the level to be unloaded
-                    levelsToUnload.push_back(_entity);
-                  }
+                  newPerfLevels.insert(levelEntity);
+                  levelsToLoad.push_back(levelEntity);
+                  continue;
                 }
-                return true;
-                });
+                // Otherwise, mark the level to be unloaded
+                levelsToUnload.push_back(levelEntity);
+              }
+            }
+          }
 
           *_perfLevels = components::PerformerLevels(newPerfLevels);
 
@@ -741,12 +824,14 @@ void LevelManager::UpdateLevelsState()
     }
   }
 
-  // Filter out currently active entities from the marked entities and create a
-  // new set of entities. These entities will be the ones that are loaded
+  // Filter out currently active and already requested entities from the
+  // marked entities and create a new set of entities. These entities will be
+  // the ones that are loaded
   std::set<std::string> entityNamesToLoad;
   for (const auto &name : entityNamesMarked)
   {
-    if (this->activeEntityNames.find(name) == this->activeEntityNames.end())
+    if (this->activeEntityNames.find(name) == this->activeEntityNames.end() &&
+        this->pendingEntityNames.find(name) == this->pendingEntityNames.end())
     {
       entityNamesToLoad.insert(name);
     }
@@ -783,8 +868,20 @@ void LevelManager::UpdateLevelsState()
   // Load and unload the entities
   if (entityNamesToLoad.size() > 0)
   {
-    this->LoadActiveEntities(entityNamesToLoad);
+    // The initial load runs synchronously so the world content is part of
+    // the initial ECM state. Later loads, triggered by performers crossing
+    // level boundaries mid-run, are prepared on the background loader
+    // thread and spliced in once ready.
+    if (this->initialLoad || !this->loaderRunning)
+    {
+      this->LoadActiveEntities(entityNamesToLoad);
+    }
+    else
+    {
+      this->RequestLoadEntities(entityNamesToLoad);
+    }
   }
+  this->initialLoad = false;
   if (entityNamesToUnload.size() > 0)
   {
     this->UnloadInactiveEntities(entityNamesToUnload);
@@ -881,10 +978,258 @@ void LevelManager::LoadActiveEntities(const std::set<std::string> &_namesToLoad)
   this->activeEntityNames.insert(_namesToLoad.begin(), _namesToLoad.end());
 }
 
+/////////////////////////////////////////////////
+void LevelManager::RequestLoadEntities(
+    const std::set<std::string> &_namesToLoad)
+{
+  this->pendingEntityNames.insert(_namesToLoad.begin(), _namesToLoad.end());
+  {
+    std::lock_guard<std::mutex> lock(this->loadMutex);
+    this->loadsToPrepare.push_back(_namesToLoad);
+  }
+  this->loadCv.notify_one();
+}
+
+/////////////////////////////////////////////////
+void LevelManager::SplicePreparedLoads()
+{
+  std::list<PreparedLevelLoad> loads;
+  {
+    std::unique_lock<std::mutex> lock(this->loadMutex);
+    // Wait for requests from previous steps to finish preparing, so that a
+    // requested load is spliced in no later than the following step. The
+    // preparation overlaps a full simulation step, which hides the disk
+    // I/O; this wait only orders the hand-off.
+    this->loadCv.wait(lock, [this]
+        {
+          return this->loadsToPrepare.empty() && !this->preparing;
+        });
+    loads.swap(this->preparedLoads);
+  }
+
+  if (loads.empty())
+    return;
+
+  GZ_PROFILE("LevelManager::SplicePreparedLoads");
+
+  // Entities that were unloaded again while their load was being prepared
+  // must not be spawned.
+  auto stillWanted = [this](const std::string &_name)
+      {
+        return this->pendingEntityNames.find(_name) !=
+               this->pendingEntityNames.end();
+      };
+
+  this->entityCreator->BeginBatch();
+  for (const auto &load : loads)
+  {
+    for (const auto *model : load.models)
+    {
+      if (!stillWanted(model->Name()))
+        continue;
+      Entity modelEntity = this->entityCreator->CreateEntities(model);
+      this->entityCreator->SetParent(modelEntity, this->worldEntity);
+    }
+
+    for (const auto *actor : load.actors)
+    {
+      if (!stillWanted(actor->Name()))
+        continue;
+      Entity actorEntity = this->entityCreator->CreateEntities(actor);
+      this->entityCreator->SetParent(actorEntity, this->worldEntity);
+    }
+
+    for (const auto *light : load.lights)
+    {
+      if (!stillWanted(light->Name()))
+        continue;
+      Entity lightEntity = this->entityCreator->CreateEntities(light);
+      this->entityCreator->SetParent(lightEntity, this->worldEntity);
+    }
+
+    for (const auto *joint : load.joints)
+    {
+      if (!stillWanted(joint->Name()))
+        continue;
+      Entity jointEntity = this->entityCreator->CreateEntities(joint);
+      this->entityCreator->SetParent(jointEntity, this->worldEntity);
+    }
+
+    for (const auto &name : load.names)
+    {
+      if (this->pendingEntityNames.erase(name) > 0)
+      {
+        this->activeEntityNames.insert(name);
+      }
+    }
+  }
+  this->entityCreator->EndBatch();
+}
+
+/////////////////////////////////////////////////
+void LevelManager::PrepareLoadsLoop()
+{
+  // Walk a model's geometries and load any meshes into the MeshManager
+  // cache, so that consumers of the entities created on the main thread
+  // find their meshes already loaded.
+  std::function<void(const sdf::Model *)> preloadMeshes =
+      [&](const sdf::Model *_model)
+      {
+        for (uint64_t linkIndex = 0; linkIndex < _model->LinkCount();
+             ++linkIndex)
+        {
+          auto link = _model->LinkByIndex(linkIndex);
+          for (uint64_t colIndex = 0; colIndex < link->CollisionCount();
+               ++colIndex)
+          {
+            auto mesh = link->CollisionByIndex(colIndex)->Geom()->MeshShape();
+            if (nullptr != mesh)
+              loadMesh(*mesh);
+          }
+          for (uint64_t visIndex = 0; visIndex < link->VisualCount();
+               ++visIndex)
+          {
+            auto mesh = link->VisualByIndex(visIndex)->Geom()->MeshShape();
+            if (nullptr != mesh)
+              loadMesh(*mesh);
+          }
+        }
+        for (uint64_t modelIndex = 0; modelIndex < _model->ModelCount();
+             ++modelIndex)
+        {
+          preloadMeshes(_model->ModelByIndex(modelIndex));
+        }
+      };
+
+  // Per-name resolution caches, only touched by the loader thread. Levels
+  // that performers cross repeatedly pay the DOM scan and the mesh warm-up
+  // on their first load only; reload cycles become map lookups. Names that
+  // a scan does not find are cached too, matching the synchronous path's
+  // behavior of silently skipping unknown names.
+  std::unordered_map<std::string, const sdf::Model *> modelByName;
+  std::unordered_map<std::string, const sdf::Actor *> actorByName;
+  std::unordered_map<std::string, const sdf::Light *> lightByName;
+  std::unordered_map<std::string, const sdf::Joint *> jointByName;
+  std::set<std::string> resolvedNames;
+  std::set<std::string> meshesWarmed;
+
+  while (true)
+  {
+    std::set<std::string> names;
+    {
+      std::unique_lock<std::mutex> lock(this->loadMutex);
+      this->loadCv.wait(lock, [this]
+          {
+            return !this->loaderRunning || !this->loadsToPrepare.empty();
+          });
+      if (!this->loaderRunning)
+        return;
+      names = std::move(this->loadsToPrepare.front());
+      this->loadsToPrepare.pop_front();
+      this->preparing = true;
+    }
+
+    GZ_PROFILE("LevelManager::PrepareLoad");
+
+    std::set<std::string> unresolved;
+    for (const auto &name : names)
+    {
+      if (resolvedNames.find(name) == resolvedNames.end())
+        unresolved.insert(name);
+    }
+
+    // The sdf::World DOM is not modified once simulation starts, so it is
+    // safe to scan it here without synchronizing with the main thread.
+    if (!unresolved.empty())
+    {
+      for (uint64_t modelIndex = 0;
+           modelIndex < this->runner->sdfWorld->ModelCount(); ++modelIndex)
+      {
+        auto model = this->runner->sdfWorld->ModelByIndex(modelIndex);
+        if (unresolved.find(model->Name()) != unresolved.end())
+          modelByName[model->Name()] = model;
+      }
+
+      for (uint64_t actorIndex = 0;
+           actorIndex < this->runner->sdfWorld->ActorCount(); ++actorIndex)
+      {
+        auto actor = this->runner->sdfWorld->ActorByIndex(actorIndex);
+        if (unresolved.find(actor->Name()) != unresolved.end())
+          actorByName[actor->Name()] = actor;
+      }
+
+      for (uint64_t lightIndex = 0;
+           lightIndex < this->runner->sdfWorld->LightCount(); ++lightIndex)
+      {
+        auto light = this->runner->sdfWorld->LightByIndex(lightIndex);
+        if (unresolved.find(light->Name()) != unresolved.end())
+          lightByName[light->Name()] = light;
+      }
+
+      for (uint64_t jointIndex = 0;
+           jointIndex < this->runner->sdfWorld->JointCount(); ++jointIndex)
+      {
+        auto joint = this->runner->sdfWorld->JointByIndex(jointIndex);
+        if (unresolved.find(joint->Name()) != unresolved.end())
+          jointByName[joint->Name()] = joint;
+      }
+
+      resolvedNames.insert(unresolved.begin(), unresolved.end());
+    }
+
+    PreparedLevelLoad load;
+    load.names = names;
+
+    for (const auto &name : names)
+    {
+      auto modelIter = modelByName.find(name);
+      if (modelIter != modelByName.end())
+      {
+        if (meshesWarmed.insert(name).second)
+          preloadMeshes(modelIter->second);
+        load.models.push_back(modelIter->second);
+        continue;
+      }
+
+      auto actorIter = actorByName.find(name);
+      if (actorIter != actorByName.end())
+      {
+        load.actors.push_back(actorIter->second);
+        continue;
+      }
+
+      auto lightIter = lightByName.find(name);
+      if (lightIter != lightByName.end())
+      {
+        load.lights.push_back(lightIter->second);
+        continue;
+      }
+
+      auto jointIter = jointByName.find(name);
+      if (jointIter != jointByName.end())
+        load.joints.push_back(jointIter->second);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->loadMutex);
+      this->preparedLoads.push_back(std::move(load));
+      this->preparing = false;
+    }
+    this->loadCv.notify_all();
+  }
+}
+
 /////////////////////////////////////////////////
 void LevelManager::UnloadInactiveEntities(
     const std::set<std::string> &_namesToUnload)
 {
+  // Drop requested-but-not-yet-spliced entities so that a level left before
+  // its load finished preparing does not spawn stale entities later.
+  for (const auto &name : _namesToUnload)
+  {
+    this->pendingEntityNames.erase(name);
+  }
+
   this->runner->entityCompMgr.Each<components::Model, components::Name>(
       [&](const Entity &_entity, const components::Model *,
           const components::Name *_name) -> bool
@@ -942,6 +1287,143 @@ bool LevelManager::IsLevelActive(const Entity _entity) const
                    _entity) != this->activeLevels.end();
 }
 
+/////////////////////////////////////////////////
+void LevelManager::BuildLevelGrid()
+{
+  GZ_PROFILE("LevelManager::BuildLevelGrid");
+
+  this->levelVolumes.clear();
+  this->levelGrid.clear();
+  this->performerCellCache.clear();
+
+  // Cache the volumes of all levels.
+  double totalExtent = 0.0;
+  this->runner->entityCompMgr.Each<components::Level, components::Pose,
+    components::Geometry,
+    components::LevelBuffer>(
+        [&](const Entity &_entity, const components::Level *,
+          const components::Pose *_pose,
+          const components::Geometry *_levelGeometry,
+          const components::LevelBuffer *_levelBuffer) -> bool
+        {
+          // assume a box for now
+          auto box = _levelGeometry->Data().BoxShape();
+          if (nullptr == box)
+          {
+            gzerr << "Level [" << _entity
+                  << "]'s geometry is not a box." << std::endl;
+            return true;
+          }
+          auto buffer = _levelBuffer->Data();
+          auto center = _pose->Data().Pos();
+
+          LevelVolumes volumes;
+          volumes.region = math::AxisAlignedBox{center - box->Size() / 2,
+              center + box->Size() / 2};
+          volumes.outerRegion = math::AxisAlignedBox{
+              center - (box->Size() / 2 + buffer),
+              center + (box->Size() / 2 + buffer)};
+
+          totalExtent += volumes.outerRegion.Size().Max();
+          this->levelVolumes[_entity] = volumes;
+          return true;
+        });
+
+  if (this->levelVolumes.empty())
+    return;
+
+  // Size cells to the average level extent so most levels span only a few
+  // cells.
+  this->levelGridCellSize = std::max(1.0,
+      totalExtent / static_cast<double>(this->levelVolumes.size()));
+
+  for (const auto &[entity, volumes] : this->levelVolumes)
+  {
+    const auto &outer = volumes.outerRegion;
+    const int minX = static_cast<int>(
+        std::floor(outer.Min().X() / this->levelGridCellSize));
+    const int minY = static_cast<int>(
+        std::floor(outer.Min().Y() / this->levelGridCellSize));
+    const int minZ = static_cast<int>(
+        std::floor(outer.Min().Z() / this->levelGridCellSize));
+    const int maxX = static_cast<int>(
+        std::floor(outer.Max().X() / this->levelGridCellSize));
+    const int maxY = static_cast<int>(
+        std::floor(outer.Max().Y() / this->levelGridCellSize));
+    const int maxZ = static_cast<int>(
+        std::floor(outer.Max().Z() / this->levelGridCellSize));
+
+    for (int x = minX; x <= maxX; ++x)
+    {
+      for (int y = minY; y <= maxY; ++y)
+      {
+        for (int z = minZ; z <= maxZ; ++z)
+        {
+          this->levelGrid[CellKey(x, y, z)].push_back(entity);
+        }
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+const std::vector<Entity> &LevelManager::LevelCandidates(
+    const Entity _performer, const math::AxisAlignedBox &_volume)
+{
+  const math::Vector3i minCell(
+      static_cast<int>(std::floor(_volume.Min().X() /
+          this->levelGridCellSize)),
+      static_cast<int>(std::floor(_volume.Min().Y() /
+          this->levelGridCellSize)),
+      static_cast<int>(std::floor(_volume.Min().Z() /
+          this->levelGridCellSize)));
+  const math::Vector3i maxCell(
+      static_cast<int>(std::floor(_volume.Max().X() /
+          this->levelGridCellSize)),
+      static_cast<int>(std::floor(_volume.Max().Y() /
+          this->levelGridCellSize)),
+      static_cast<int>(std::floor(_volume.Max().Z() /
+          this->levelGridCellSize)));
+
+  // Performers move a fraction of a cell per step, so most updates cover
+  // the same cell range as the previous one and can reuse its candidates.
+  auto cacheIter = this->performerCellCache.find(_performer);
+  if (cacheIter != this->performerCellCache.end() &&
+      cacheIter->second.minCell == minCell &&
+      cacheIter->second.maxCell == maxCell)
+  {
+    return cacheIter->second.candidates;
+  }
+
+  auto &cache = this->performerCellCache[_performer];
+  cache.minCell = minCell;
+  cache.maxCell = maxCell;
+  cache.candidates.clear();
+
+  for (int x = minCell.X(); x <= maxCell.X(); ++x)
+  {
+    for (int y = minCell.Y(); y <= maxCell.Y(); ++y)
+    {
+      for (int z = minCell.Z(); z <= maxCell.Z(); ++z)
+      {
+        auto cellIter = this->levelGrid.find(CellKey(x, y, z));
+        if (cellIter == this->levelGrid.end())
+          continue;
+        for (const Entity level : cellIter->second)
+        {
+          if (std::find(cache.candidates.begin(), cache.candidates.end(),
+              level) == cache.candidates.end())
+          {
+            cache.candidates.push_back(level);
+          }
+        }
+      }
+    }
+  }
+
+  return cache.candidates;
+}
+
 /////////////////////////////////////////////////
 int LevelManager::CreatePerformerEntity(const std::string &_name,
     const sdf::Geometry &_geom)
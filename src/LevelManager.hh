@@ -21,16 +21,26 @@
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <sdf/Actor.hh>
 #include <sdf/Element.hh>
 #include <sdf/Geometry.hh>
+#include <sdf/Joint.hh>
+#include <sdf/Light.hh>
+#include <sdf/Model.hh>
+
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Vector3.hh>
 #include <gz/transport/Node.hh>
 
 #include "gz/sim/config.hh"
@@ -82,6 +92,9 @@ namespace gz
       /// will only be loaded for active performers.
       public: LevelManager(SimulationRunner *_runner, bool _useLevels = false);
 
+      /// \brief Destructor. Stops the background loader thread.
+      public: ~LevelManager();
+
       /// \brief Load and unload levels
       /// This is where we compute intersections and determine if a performer is
       /// in a level or not. This needs to be called by the simulation runner at
@@ -93,6 +106,24 @@ namespace gz
       private: void LoadActiveEntities(
           const std::set<std::string> &_namesToLoad);
 
+      /// \brief Queue entities to be prepared by the background loader
+      /// thread. The prepared entities are spliced into simulation by a
+      /// later call to SplicePreparedLoads.
+      /// \param[in] _namesToLoad List of entity names to load
+      private: void RequestLoadEntities(
+          const std::set<std::string> &_namesToLoad);
+
+      /// \brief Splice level loads that the background loader thread has
+      /// finished preparing into simulation. All entities of a prepared
+      /// load are created within one call, so a level appears over a
+      /// single step.
+      private: void SplicePreparedLoads();
+
+      /// \brief Loop run by the background loader thread. Resolves the
+      /// SDF DOM objects of each requested load and warms the mesh cache
+      /// so that entity creation on the main thread does no disk I/O.
+      private: void PrepareLoadsLoop();
+
       /// \brief Unload entities that have been marked for unloading.
       /// \param[in] _namesToUnload List of entity names to unload
       private: void UnloadInactiveEntities(
@@ -125,6 +156,21 @@ namespace gz
       /// \return True of the level is currently active
       private: bool IsLevelActive(const Entity _entity) const;
 
+      /// \brief Cache the volumes of all levels and build a uniform grid
+      /// over them, so performers only test the levels near them instead
+      /// of every level in the world.
+      private: void BuildLevelGrid();
+
+      /// \brief Get the levels whose outer region may overlap a volume.
+      /// The result is cached per performer and reused while the volume
+      /// stays within the same grid cells.
+      /// \param[in] _performer Performer entity the query is for.
+      /// \param[in] _volume Volume to query the level grid with.
+      /// \return Candidate level entities. The exact intersection tests
+      /// still need to be run against the candidates.
+      private: const std::vector<Entity> &LevelCandidates(
+          const Entity _performer, const math::AxisAlignedBox &_volume);
+
       /// \brief Service callback to create a new performer.
       /// \param[in] _req Message that contains perfomer information.
       /// \param[out] _rep Reply message, which is set to true when the
@@ -167,6 +213,56 @@ namespace gz
       /// \brief Flag whether to use levels or not.
       private: bool useLevels{false};
 
+      /// \brief Horizon, in seconds, used to extrapolate performer motion
+      /// when deciding which levels to load. Levels that a performer is
+      /// predicted to enter within the horizon are loaded early, so fast
+      /// performers do not outrun the loader. Zero disables prefetching.
+      private: double prefetchHorizon{0.0};
+
+      /// \brief Axis-aligned volumes of a level, cached so they are not
+      /// recomputed for every performer on every update.
+      private: struct LevelVolumes
+      {
+        /// \brief The level region.
+        math::AxisAlignedBox region;
+
+        /// \brief The level region grown by the level buffer.
+        math::AxisAlignedBox outerRegion;
+      };
+
+      /// \brief Cached volumes of each level, keyed by level entity.
+      private: std::unordered_map<Entity, LevelVolumes> levelVolumes;
+
+      /// \brief Uniform grid over the level outer regions. Each cell
+      /// lists the levels whose outer region overlaps it.
+      private: std::unordered_map<uint64_t, std::vector<Entity>> levelGrid;
+
+      /// \brief Edge length of a level grid cell. Computed from the
+      /// average level extent when the grid is built.
+      private: double levelGridCellSize{100.0};
+
+      /// \brief Whether the level grid still needs to be built.
+      private: bool levelGridDirty{true};
+
+      /// \brief Grid cell range a performer covered last update, and the
+      /// candidate levels found for it.
+      private: struct PerformerCellCache
+      {
+        /// \brief Lowest covered cell coordinates.
+        math::Vector3i minCell;
+
+        /// \brief Highest covered cell coordinates.
+        math::Vector3i maxCell;
+
+        /// \brief Candidate levels for the covered cells.
+        std::vector<Entity> candidates;
+      };
+
+      /// \brief Per-performer candidate cache, reused while a performer
+      /// stays within the same grid cells.
+      private: std::unordered_map<Entity, PerformerCellCache>
+          performerCellCache;
+
       /// \brief Entity Creator API.
       private: std::unique_ptr<SdfEntityCreator> entityCreator{nullptr};
 
@@ -178,6 +274,57 @@ namespace gz
 
       /// \brief Mutex to protect performersToAdd list.
       private: std::mutex performerToAddMutex;
+
+      /// \brief A level load prepared by the background loader thread,
+      /// ready to be spliced into simulation.
+      private: struct PreparedLevelLoad
+      {
+        /// \brief Names of the entities in this load.
+        std::set<std::string> names;
+
+        /// \brief Models to create.
+        std::vector<const sdf::Model *> models;
+
+        /// \brief Actors to create.
+        std::vector<const sdf::Actor *> actors;
+
+        /// \brief Lights to create.
+        std::vector<const sdf::Light *> lights;
+
+        /// \brief Joints to create.
+        std::vector<const sdf::Joint *> joints;
+      };
+
+      /// \brief Whether the initial level load is still pending. The
+      /// initial load runs synchronously so that the world content is
+      /// captured in the initial ECM state; later loads are prepared in
+      /// the background.
+      private: bool initialLoad{true};
+
+      /// \brief Names of entities that have been requested but not yet
+      /// spliced into simulation. Only accessed from the main thread.
+      private: std::set<std::string> pendingEntityNames;
+
+      /// \brief Loads waiting to be prepared by the loader thread.
+      private: std::list<std::set<std::string>> loadsToPrepare;
+
+      /// \brief Loads prepared by the loader thread, ready to splice.
+      private: std::list<PreparedLevelLoad> preparedLoads;
+
+      /// \brief True while the loader thread is preparing a load.
+      private: bool preparing{false};
+
+      /// \brief Protects loadsToPrepare, preparedLoads and loaderRunning.
+      private: std::mutex loadMutex;
+
+      /// \brief Signals the loader thread that work is available.
+      private: std::condition_variable loadCv;
+
+      /// \brief True while the loader thread should keep running.
+      private: bool loaderRunning{false};
+
+      /// \brief Background thread that prepares level loads.
+      private: std::thread loaderThread;
     };
     }
   }
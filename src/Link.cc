@@ -46,8 +46,46 @@
 
 class gz::sim::LinkPrivate
 {
+  /// \brief Revalidate the cached component pointers below. The lookups
+  /// are repeated only when the ECM reports a structural change since
+  /// they were last resolved, so repeated accessor calls within a step
+  /// reduce to pointer dereferences.
+  public: void UpdateCache(const EntityComponentManager &_ecm)
+  {
+    const uint64_t epoch = _ecm.StructuralEpoch();
+    if (&_ecm == this->cacheEcm && epoch == this->cacheEpoch)
+      return;
+
+    this->worldPoseComp = _ecm.Component<components::WorldPose>(this->id);
+    this->worldLinVelComp =
+        _ecm.Component<components::WorldLinearVelocity>(this->id);
+    this->worldAngVelComp =
+        _ecm.Component<components::WorldAngularVelocity>(this->id);
+    this->inertialComp = _ecm.Component<components::Inertial>(this->id);
+    this->cacheEcm = &_ecm;
+    this->cacheEpoch = epoch;
+  }
+
   /// \brief Id of link entity.
   public: Entity id{kNullEntity};
+
+  /// \brief ECM against which the cached pointers were resolved.
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief ECM structural epoch at which the pointers were resolved.
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached WorldPose component of the link.
+  public: const components::WorldPose *worldPoseComp{nullptr};
+
+  /// \brief Cached WorldLinearVelocity component of the link.
+  public: const components::WorldLinearVelocity *worldLinVelComp{nullptr};
+
+  /// \brief Cached WorldAngularVelocity component of the link.
+  public: const components::WorldAngularVelocity *worldAngVelComp{nullptr};
+
+  /// \brief Cached Inertial component of the link.
+  public: const components::Inertial *inertialComp{nullptr};
 };
 
 using namespace gz;
@@ -92,6 +130,8 @@ Entity Link::Entity() const
 void Link::ResetEntity(sim::Entity _newEntity)
 {
   this->dataPtr->id = _newEntity;
+  // Force the cached component pointers to be resolved again.
+  this->dataPtr->cacheEcm = nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -186,15 +226,19 @@ bool Link::WindMode(const EntityComponentManager &_ecm) const
 std::optional<math::Pose3d> Link::WorldPose(
     const EntityComponentManager &_ecm) const
 {
-  return _ecm.ComponentData<components::WorldPose>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  if (!this->dataPtr->worldPoseComp)
+    return std::nullopt;
+  return std::make_optional(this->dataPtr->worldPoseComp->Data());
 }
 
 //////////////////////////////////////////////////
 std::optional<math::Pose3d> Link::WorldInertialPose(
     const EntityComponentManager &_ecm) const
 {
-  auto inertial = _ecm.Component<components::Inertial>(this->dataPtr->id);
-  auto worldPose = _ecm.Component<components::WorldPose>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto inertial = this->dataPtr->inertialComp;
+  auto worldPose = this->dataPtr->worldPoseComp;
 
   if (!worldPose || !inertial)
     return std::nullopt;
@@ -206,7 +250,10 @@ std::optional<math::Pose3d> Link::WorldInertialPose(
 std::optional<math::Vector3d> Link::WorldLinearVelocity(
     const EntityComponentManager &_ecm) const
 {
-  return _ecm.ComponentData<components::WorldLinearVelocity>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  if (!this->dataPtr->worldLinVelComp)
+    return std::nullopt;
+  return std::make_optional(this->dataPtr->worldLinVelComp->Data());
 }
 
 //////////////////////////////////////////////////
@@ -214,12 +261,10 @@ std::optional<math::Vector3d> Link::WorldLinearVelocity(
     const EntityComponentManager &_ecm,
     const math::Vector3d &_offset) const
 {
-  auto worldLinVel =
-      _ecm.Component<components::WorldLinearVelocity>(this->dataPtr->id);
-  auto worldPose =
-      _ecm.Component<components::WorldPose>(this->dataPtr->id);
-  auto worldAngVel =
-      _ecm.Component<components::WorldAngularVelocity>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto worldLinVel = this->dataPtr->worldLinVelComp;
+  auto worldPose = this->dataPtr->worldPoseComp;
+  auto worldAngVel = this->dataPtr->worldAngVelComp;
 
   if (!worldLinVel || !worldPose || !worldAngVel)
     return std::nullopt;
@@ -233,8 +278,10 @@ std::optional<math::Vector3d> Link::WorldLinearVelocity(
 std::optional<math::Vector3d> Link::WorldAngularVelocity(
     const EntityComponentManager &_ecm) const
 {
-  return _ecm.ComponentData<components::WorldAngularVelocity>(
-      this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  if (!this->dataPtr->worldAngVelComp)
+    return std::nullopt;
+  return std::make_optional(this->dataPtr->worldAngVelComp->Data());
 }
 
 //////////////////////////////////////////////////
@@ -325,8 +372,9 @@ void Link::EnableAccelerationChecks(EntityComponentManager &_ecm, bool _enable)
 std::optional<math::Matrix3d> Link::WorldInertiaMatrix(
     const EntityComponentManager &_ecm) const
 {
-  auto inertial = _ecm.Component<components::Inertial>(this->dataPtr->id);
-  auto worldPose = _ecm.Component<components::WorldPose>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto inertial = this->dataPtr->inertialComp;
+  auto worldPose = this->dataPtr->worldPoseComp;
 
   if (!worldPose || !inertial)
     return std::nullopt;
@@ -341,9 +389,9 @@ std::optional<math::Matrix3d> Link::WorldInertiaMatrix(
 std::optional<double> Link::WorldKineticEnergy(
     const EntityComponentManager &_ecm) const
 {
-  auto inertial = _ecm.Component<components::Inertial>(this->dataPtr->id);
-  auto worldAngVel =
-      _ecm.Component<components::WorldAngularVelocity>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto inertial = this->dataPtr->inertialComp;
+  auto worldAngVel = this->dataPtr->worldAngVelComp;
 
   if (!worldAngVel || !inertial)
     return std::nullopt;
@@ -366,8 +414,9 @@ std::optional<double> Link::WorldKineticEnergy(
 void Link::AddWorldForce(EntityComponentManager &_ecm,
                          const math::Vector3d &_force) const
 {
-  auto inertial = _ecm.Component<components::Inertial>(this->dataPtr->id);
-  auto worldPose = _ecm.Component<components::WorldPose>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto inertial = this->dataPtr->inertialComp;
+  auto worldPose = this->dataPtr->worldPoseComp;
 
   // Can't apply force if the inertial's pose is not found
   if (!inertial || !worldPose)
@@ -389,8 +438,9 @@ void Link::AddWorldForce(EntityComponentManager &_ecm,
                          const math::Vector3d &_force,
                          const math::Vector3d &_position) const
 {
-  auto inertial = _ecm.Component<components::Inertial>(this->dataPtr->id);
-  auto worldPose = _ecm.Component<components::WorldPose>(this->dataPtr->id);
+  this->dataPtr->UpdateCache(_ecm);
+  auto inertial = this->dataPtr->inertialComp;
+  auto worldPose = this->dataPtr->worldPoseComp;
 
   // Can't apply force if the inertial's pose is not found
   if (!inertial || !worldPose)
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "MemoryProbe.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace gz;
+using namespace sim;
+
+namespace
+{
+  /// \brief Whether allocations are currently counted.
+  std::atomic<bool> g_probeEnabled{false};
+
+  /// \brief Bytes requested on this thread while counting was enabled.
+  thread_local uint64_t t_probeBytes{0};
+
+  /// \brief Allocations made on this thread while counting was enabled.
+  thread_local uint64_t t_probeAllocs{0};
+
+  /// \brief Account one allocation on the calling thread.
+  /// \param[in] _size Requested size in bytes.
+  inline void RecordAllocation(std::size_t _size)
+  {
+    if (!g_probeEnabled.load(std::memory_order_relaxed))
+      return;
+    t_probeBytes += _size;
+    ++t_probeAllocs;
+  }
+}
+
+/////////////////////////////////////////////////
+void memory_probe::SetEnabled(bool _enabled)
+{
+  g_probeEnabled.store(_enabled, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////
+bool memory_probe::Enabled()
+{
+  return g_probeEnabled.load(std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////
+memory_probe::AllocationCounters memory_probe::ThreadCounters()
+{
+  return {t_probeBytes, t_probeAllocs};
+}
+
+/////////////////////////////////////////////////
+memory_probe::ScopedAllocationCounter::ScopedAllocationCounter()
+  : start(ThreadCounters())
+{
+}
+
+/////////////////////////////////////////////////
+memory_probe::AllocationCounters
+memory_probe::ScopedAllocationCounter::Delta() const
+{
+  return {t_probeBytes - this->start.bytes,
+          t_probeAllocs - this->start.allocs};
+}
+
+// Replacement global allocation functions. They forward to malloc/free and
+// only add the counting hook above. Interposition through symbol lookup
+// does not work across DLLs, so the replacements are not built on Windows.
+#ifndef _WIN32
+
+namespace
+{
+  /// \brief Shared malloc path for the throwing operator new variants.
+  /// \param[in] _size Requested size in bytes.
+  /// \return Pointer to the allocated memory.
+  inline void *ProbeAllocate(std::size_t _size)
+  {
+    // Zero-sized news must return a unique pointer.
+    void *ptr = std::malloc(_size > 0 ? _size : 1);
+    if (nullptr == ptr)
+      throw std::bad_alloc();
+    RecordAllocation(_size);
+    return ptr;
+  }
+
+  /// \brief Shared aligned path for the throwing operator new variants.
+  /// \param[in] _size Requested size in bytes.
+  /// \param[in] _align Requested alignment.
+  /// \return Pointer to the allocated memory.
+  inline void *ProbeAllocateAligned(std::size_t _size, std::size_t _align)
+  {
+    void *ptr = nullptr;
+    if (0 != posix_memalign(&ptr, _align, _size > 0 ? _size : _align))
+      throw std::bad_alloc();
+    RecordAllocation(_size);
+    return ptr;
+  }
+}
+
+/////////////////////////////////////////////////
+void *operator new(std::size_t _size)
+{
+  return ProbeAllocate(_size);
+}
+
+/////////////////////////////////////////////////
+void *operator new[](std::size_t _size)
+{
+  return ProbeAllocate(_size);
+}
+
+/////////////////////////////////////////////////
+void *operator new(std::size_t _size, const std::nothrow_t &) noexcept
+{
+  void *ptr = std::malloc(_size > 0 ? _size : 1);
+  if (nullptr != ptr)
+    RecordAllocation(_size);
+  return ptr;
+}
+
+/////////////////////////////////////////////////
+void *operator new[](std::size_t _size, const std::nothrow_t &) noexcept
+{
+  void *ptr = std::malloc(_size > 0 ? _size : 1);
+  if (nullptr != ptr)
+    RecordAllocation(_size);
+  return ptr;
+}
+
+/////////////////////////////////////////////////
+void *operator new(std::size_t _size, std::align_val_t _align)
+{
+  return ProbeAllocateAligned(_size, static_cast<std::size_t>(_align));
+}
+
+/////////////////////////////////////////////////
+void *operator new[](std::size_t _size, std::align_val_t _align)
+{
+  return ProbeAllocateAligned(_size, static_cast<std::size_t>(_align));
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete[](void *_ptr) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr, std::size_t) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete[](void *_ptr, std::size_t) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr, const std::nothrow_t &) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete[](void *_ptr, const std::nothrow_t &) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr, std::align_val_t) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete[](void *_ptr, std::align_val_t) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void *_ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(_ptr);
+}
+
+/////////////////////////////////////////////////
+void operator delete[](void *_ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(_ptr);
+}
+
+#endif  // !_WIN32
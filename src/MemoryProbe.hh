@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_SIM_MEMORYPROBE_HH_
+#define GZ_SIM_MEMORYPROBE_HH_
+
+#include <cstdint>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/Export.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    /// \brief Lightweight per-thread heap allocation counters.
+    ///
+    /// When enabled, replacement global operator new/delete implementations
+    /// count the number and size of allocations made on each thread, so a
+    /// caller can measure how much a scoped piece of work allocated by
+    /// taking the counters before and after. Counting is disabled by
+    /// default; while disabled the replacements add a single relaxed
+    /// atomic load per allocation. The replacements interpose through
+    /// symbol lookup and are not available on Windows, where the counters
+    /// stay at zero.
+    namespace memory_probe
+    {
+      /// \brief Allocation totals for one thread.
+      struct AllocationCounters
+      {
+        /// \brief Total bytes requested from operator new.
+        uint64_t bytes{0};
+
+        /// \brief Number of calls to operator new.
+        uint64_t allocs{0};
+      };
+
+      /// \brief Enable or disable allocation counting process-wide.
+      /// \param[in] _enabled True to count allocations.
+      GZ_SIM_VISIBLE void SetEnabled(bool _enabled);
+
+      /// \brief Get whether allocation counting is enabled.
+      /// \return True if allocations are being counted.
+      GZ_SIM_VISIBLE bool Enabled();
+
+      /// \brief Get the running totals of the calling thread.
+      /// \return Allocation totals accumulated on this thread since
+      /// counting was enabled.
+      GZ_SIM_VISIBLE AllocationCounters ThreadCounters();
+
+      /// \brief Measures the allocations made on the current thread within
+      /// a scope. Construct before the work and call Delta() after it.
+      class GZ_SIM_VISIBLE ScopedAllocationCounter
+      {
+        /// \brief Constructor. Captures the current thread totals.
+        public: ScopedAllocationCounter();
+
+        /// \brief Get the allocations made on this thread since
+        /// construction.
+        /// \return Allocation deltas.
+        public: AllocationCounters Delta() const;
+
+        /// \brief Thread totals at construction time.
+        private: AllocationCounters start;
+      };
+    }
+    }
+  }
+}
+#endif
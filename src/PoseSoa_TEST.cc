@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <gz/math/Pose3.hh>
+
+#include "gz/sim/Entity.hh"
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/components/Model.hh"
+#include "gz/sim/components/Pose.hh"
+#include "gz/sim/detail/PoseSoa.hh"
+
+#include "../test/helpers/EnvTestFixture.hh"
+
+using namespace gz;
+using namespace sim;
+
+class PoseSoaTest : public InternalFixture<::testing::Test>
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(PoseSoaTest, PushBackAndReadBack)
+{
+  detail::PoseSoa poses;
+  EXPECT_EQ(0u, poses.Size());
+
+  const math::Pose3d pose1(1, 2, 3, 0.1, 0.2, 0.3);
+  const math::Pose3d pose2(-4, 5, -6, 0.4, -0.5, 0.6);
+  poses.PushBack(pose1);
+  poses.PushBack(pose2);
+  ASSERT_EQ(2u, poses.Size());
+  EXPECT_EQ(pose1, poses.Pose(0));
+  EXPECT_EQ(pose2, poses.Pose(1));
+
+  poses.Set(0, pose2);
+  EXPECT_EQ(pose2, poses.Pose(0));
+
+  poses.Clear();
+  EXPECT_EQ(0u, poses.Size());
+
+  poses.Resize(3);
+  ASSERT_EQ(3u, poses.Size());
+  EXPECT_EQ(math::Pose3d::Zero, poses.Pose(2));
+}
+
+/////////////////////////////////////////////////
+TEST_F(PoseSoaTest, ComposeMatchesPose3d)
+{
+  const std::vector<math::Pose3d> parents
+  {
+    {0, 0, 0, 0, 0, 0},
+    {1, 2, 3, 0.1, 0.2, 0.3},
+    {-5, 0.5, 10, GZ_PI_2, 0, 0},
+    {0.1, -0.2, 0.3, 0, GZ_PI_4, GZ_PI_2},
+  };
+  const std::vector<math::Pose3d> locals
+  {
+    {1, 1, 1, 0, 0, GZ_PI},
+    {0, 0, 0, 0, 0, 0},
+    {2, -3, 4, 0.5, -0.6, 0.7},
+    {-0.4, 0.5, -0.6, GZ_PI_4, 0, 0},
+  };
+
+  detail::PoseSoa parentBuf, localBuf, outBuf;
+  for (std::size_t i = 0; i < parents.size(); ++i)
+  {
+    parentBuf.PushBack(parents[i]);
+    localBuf.PushBack(locals[i]);
+  }
+
+  detail::PoseSoa::Compose(parentBuf, localBuf, outBuf);
+  ASSERT_EQ(parents.size(), outBuf.Size());
+  for (std::size_t i = 0; i < parents.size(); ++i)
+  {
+    const math::Pose3d expected = parents[i] * locals[i];
+    const math::Pose3d actual = outBuf.Pose(i);
+    EXPECT_TRUE(expected.Pos().Equal(actual.Pos(), 1e-9))
+        << "i=" << i << " expected " << expected << " actual " << actual;
+    EXPECT_TRUE(expected.Rot().Equal(actual.Rot(), 1e-9))
+        << "i=" << i << " expected " << expected << " actual " << actual;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(PoseSoaTest, CopyInterleavedFloat)
+{
+  detail::PoseSoa poses;
+  poses.PushBack(math::Pose3d(1, 2, 3, 0, 0, 0));
+  poses.PushBack(math::Pose3d(4, 5, 6, GZ_PI_2, 0, 0));
+
+  std::vector<float> dst(7 * poses.Size(), 0.0f);
+  poses.CopyInterleavedFloat(dst.data());
+
+  for (std::size_t i = 0; i < poses.Size(); ++i)
+  {
+    const math::Pose3d pose = poses.Pose(i);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Pos().X()), dst[7 * i + 0]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Pos().Y()), dst[7 * i + 1]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Pos().Z()), dst[7 * i + 2]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Rot().W()), dst[7 * i + 3]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Rot().X()), dst[7 * i + 4]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Rot().Y()), dst[7 * i + 5]);
+    EXPECT_FLOAT_EQ(static_cast<float>(pose.Rot().Z()), dst[7 * i + 6]);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(PoseSoaTest, GatherPoses)
+{
+  EntityComponentManager ecm;
+
+  // Two model entities with poses, and one posed entity without the
+  // Model tag that the gather must skip.
+  Entity model1 = ecm.CreateEntity();
+  ecm.CreateComponent(model1, components::Model());
+  ecm.CreateComponent(model1, components::Pose({1, 2, 3, 0, 0, 0}));
+
+  Entity model2 = ecm.CreateEntity();
+  ecm.CreateComponent(model2, components::Model());
+  ecm.CreateComponent(model2, components::Pose({4, 5, 6, 0, 0, 0}));
+
+  Entity other = ecm.CreateEntity();
+  ecm.CreateComponent(other, components::Pose({7, 8, 9, 0, 0, 0}));
+
+  detail::PoseSoa poses;
+  std::vector<Entity> entities;
+  detail::GatherPoses<components::Model>(ecm, poses, &entities);
+
+  ASSERT_EQ(2u, poses.Size());
+  ASSERT_EQ(2u, entities.size());
+  for (std::size_t i = 0; i < entities.size(); ++i)
+  {
+    auto poseComp = ecm.Component<components::Pose>(entities[i]);
+    ASSERT_NE(nullptr, poseComp);
+    EXPECT_EQ(poseComp->Data(), poses.Pose(i));
+  }
+
+  // Without the tag filter every posed entity is gathered, and the
+  // buffers are refilled rather than appended to.
+  detail::GatherPoses<>(ecm, poses, &entities);
+  EXPECT_EQ(3u, poses.Size());
+  EXPECT_EQ(3u, entities.size());
+}
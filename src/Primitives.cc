@@ -15,6 +15,11 @@
  *
 */
 
+#include <unordered_map>
+
+#include <sdf/Light.hh>
+#include <sdf/Model.hh>
+
 #include <gz/common/Util.hh>
 #include <gz/common/Console.hh>
 #include "gz/sim/Primitives.hh"
@@ -362,3 +367,71 @@ std::string gz::sim::getPrimitive(const std::string &_typeName)
   gzwarn << " - spot\n";
   return "";
 }
+
+/////////////////////////////////////////////////
+const sdf::Root *gz::sim::getPrimitiveRoot(const std::string &_sdfString)
+{
+  // One parsed DOM per template, keyed by the exact strings the accessors
+  // above return. The magic static makes the one-time parse thread safe.
+  static const std::unordered_map<std::string, sdf::Root> kTemplates = []()
+  {
+    std::unordered_map<std::string, sdf::Root> parsed;
+    for (const char *sdfString : {kBoxSdf, kSphereSdf, kCylinderSdf,
+        kCapsuleSdf, kEllipsoidSdf, kDirectionalSdf, kPointSdf, kSpotSdf})
+    {
+      sdf::Root root;
+      sdf::Errors errors = root.LoadSdfString(sdfString);
+      if (errors.empty())
+      {
+        parsed[sdfString] = std::move(root);
+      }
+      else
+      {
+        gzerr << "Failed to parse primitive template:\n"
+               << sdfString << std::endl;
+      }
+    }
+    return parsed;
+  }();
+
+  auto iter = kTemplates.find(_sdfString);
+  if (iter == kTemplates.end())
+    return nullptr;
+  return &iter->second;
+}
+
+/////////////////////////////////////////////////
+Entity gz::sim::createPrimitive(SdfEntityCreator &_creator,
+    const std::string &_typeName, const std::string &_name,
+    Entity _parent)
+{
+  const std::string sdfString = getPrimitive(_typeName);
+  if (sdfString.empty())
+    return kNullEntity;
+
+  const sdf::Root *root = getPrimitiveRoot(sdfString);
+  if (nullptr == root)
+    return kNullEntity;
+
+  Entity entity{kNullEntity};
+  if (nullptr != root->Model())
+  {
+    // Copy the model so the cached template is never mutated.
+    sdf::Model model = *root->Model();
+    if (!_name.empty())
+      model.SetName(_name);
+    entity = _creator.CreateEntities(&model);
+  }
+  else if (nullptr != root->Light())
+  {
+    sdf::Light light = *root->Light();
+    if (!_name.empty())
+      light.SetName(_name);
+    entity = _creator.CreateEntities(&light);
+  }
+
+  if (kNullEntity != entity && kNullEntity != _parent)
+    _creator.SetParent(entity, _parent);
+
+  return entity;
+}
@@ -17,7 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <gz/sim/EntityComponentManager.hh>
+#include <gz/sim/EventManager.hh>
 #include <gz/sim/Primitives.hh>
+#include <gz/sim/SdfEntityCreator.hh>
+#include <gz/sim/components/Name.hh>
+#include <gz/sim/components/ParentEntity.hh>
 #include <sdf/Root.hh>
 
 using PrimitiveShape = gz::sim::PrimitiveShape;
@@ -93,3 +98,55 @@ TEST(Primitives, strings)
     EXPECT_TRUE(errors.empty()) << sdfString;
   }
 }
+
+/////////////////////////////////////////////////
+TEST(Primitives, cachedRoots)
+{
+  auto primitives = {
+    "box", "sphere", "cylinder", "capsule", "ellipsoid",
+    "point", "directional", "spot"
+  };
+
+  for (auto prim : primitives)
+  {
+    auto sdfString = gz::sim::getPrimitive(prim);
+    auto root = gz::sim::getPrimitiveRoot(sdfString);
+    ASSERT_NE(nullptr, root) << prim;
+
+    /// Repeated lookups return the same cached DOM, not a fresh parse
+    EXPECT_EQ(root, gz::sim::getPrimitiveRoot(sdfString));
+    EXPECT_TRUE(nullptr != root->Model() || nullptr != root->Light());
+  }
+
+  EXPECT_EQ(nullptr, gz::sim::getPrimitiveRoot("not a primitive"));
+  EXPECT_EQ(nullptr, gz::sim::getPrimitiveRoot(""));
+}
+
+/////////////////////////////////////////////////
+TEST(Primitives, createPrimitive)
+{
+  gz::sim::EntityComponentManager ecm;
+  gz::sim::EventManager eventMgr;
+  gz::sim::SdfEntityCreator creator(ecm, eventMgr);
+
+  auto parent = ecm.CreateEntity();
+
+  auto box = gz::sim::createPrimitive(creator, "box", "box_1", parent);
+  ASSERT_NE(gz::sim::kNullEntity, box);
+  auto nameComp = ecm.Component<gz::sim::components::Name>(box);
+  ASSERT_NE(nullptr, nameComp);
+  EXPECT_EQ("box_1", nameComp->Data());
+  auto parentComp = ecm.Component<gz::sim::components::ParentEntity>(box);
+  ASSERT_NE(nullptr, parentComp);
+  EXPECT_EQ(parent, parentComp->Data());
+
+  /// An empty name keeps the template's name
+  auto light = gz::sim::createPrimitive(creator, "spot", "", parent);
+  ASSERT_NE(gz::sim::kNullEntity, light);
+  nameComp = ecm.Component<gz::sim::components::Name>(light);
+  ASSERT_NE(nullptr, nameComp);
+  EXPECT_EQ("spotlight", nameComp->Data());
+
+  EXPECT_EQ(gz::sim::kNullEntity,
+      gz::sim::createPrimitive(creator, "foobar", "foo", parent));
+}
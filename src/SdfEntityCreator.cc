@@ -114,6 +114,20 @@ class gz::sim::SdfEntityCreatorPrivate
   /// \brief Keep track of new visuals being added, so we load their plugins
   /// only after we have their scoped name.
   public: std::map<Entity, sdf::Plugins> newVisuals;
+
+  /// \brief True while a creation batch is open. Plugin load events are
+  /// buffered into batchedPlugins instead of being emitted immediately.
+  public: bool batching{false};
+
+  /// \brief Plugin load events buffered while a batch is open, emitted in
+  /// creation order when the batch ends.
+  public: std::vector<std::pair<Entity, sdf::Plugins>> batchedPlugins;
+
+  /// \brief Emit the plugin load events for an entity, or buffer them if a
+  /// creation batch is open.
+  /// \param[in] _entity Entity the plugins are attached to.
+  /// \param[in] _plugins Plugins to be loaded.
+  public: void LoadPlugins(Entity _entity, const sdf::Plugins &_plugins);
 };
 
 using namespace gz;
@@ -197,6 +211,25 @@ static Entity FindDescendentLinkEntityByName(const std::string &_name,
   }
 }
 
+//////////////////////////////////////////////////
+void SdfEntityCreatorPrivate::LoadPlugins(Entity _entity,
+    const sdf::Plugins &_plugins)
+{
+  if (this->batching)
+  {
+    this->batchedPlugins.emplace_back(_entity, _plugins);
+    return;
+  }
+
+  this->eventManager->Emit<events::LoadSdfPlugins>(_entity, _plugins);
+  for (const sdf::Plugin &p : _plugins)
+  {
+    GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
+    this->eventManager->Emit<events::LoadPlugins>(_entity, p.ToElement());
+    GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
+  }
+}
+
 //////////////////////////////////////////////////
 SdfEntityCreator::SdfEntityCreator(EntityComponentManager &_ecm,
           EventManager &_eventManager)
@@ -337,15 +370,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::World *_world)
   this->dataPtr->ecm->CreateComponent(worldEntity,
       components::MagneticField(_world->MagneticField()));
 
-  this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(worldEntity,
-      _world->Plugins());
-  for (const sdf::Plugin &p : _world->Plugins())
-  {
-    GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
-    this->dataPtr->eventManager->Emit<events::LoadPlugins>(worldEntity,
-        p.ToElement());
-    GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
-  }
+  this->dataPtr->LoadPlugins(worldEntity, _world->Plugins());
 
   // Store the world's SDF DOM to be used when saving the world to file
   this->dataPtr->ecm->CreateComponent(
@@ -364,48 +389,67 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Model *_model)
   // Load all model plugins afterwards, so we get scoped name for nested models.
   for (const auto &[entity, plugins] : this->dataPtr->newModels)
   {
-    this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(entity, plugins);
-    for (const sdf::Plugin &p : plugins)
-    {
-      GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
-      this->dataPtr->eventManager->Emit<events::LoadPlugins>(entity,
-          p.ToElement());
-      GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
-    }
+    this->dataPtr->LoadPlugins(entity, plugins);
   }
   this->dataPtr->newModels.clear();
 
   // Load sensor plugins after model, so we get scoped name.
   for (const auto &[entity, plugins] : this->dataPtr->newSensors)
   {
-    this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(entity, plugins);
-    for (const sdf::Plugin &p : plugins)
-    {
-      GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
-      this->dataPtr->eventManager->Emit<events::LoadPlugins>(entity,
-          p.ToElement());
-      GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
-    }
+    this->dataPtr->LoadPlugins(entity, plugins);
   }
   this->dataPtr->newSensors.clear();
 
   // Load visual plugins after model, so we get scoped name.
   for (const auto &[entity, plugins] : this->dataPtr->newVisuals)
   {
-    this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(entity, plugins);
-    for (const sdf::Plugin &p : plugins)
-    {
-      GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
-      this->dataPtr->eventManager->Emit<events::LoadPlugins>(entity,
-          p.ToElement());
-      GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
-    }
+    this->dataPtr->LoadPlugins(entity, plugins);
   }
   this->dataPtr->newVisuals.clear();
 
   return ent;
 }
 
+//////////////////////////////////////////////////
+void SdfEntityCreator::BeginBatch()
+{
+  if (this->dataPtr->batching)
+  {
+    gzwarn << "SdfEntityCreator::BeginBatch called while a batch is already "
+           << "open. Ignoring." << std::endl;
+    return;
+  }
+
+  this->dataPtr->batching = true;
+  this->dataPtr->ecm->BeginEntityBatch();
+}
+
+//////////////////////////////////////////////////
+void SdfEntityCreator::EndBatch()
+{
+  GZ_PROFILE("SdfEntityCreator::EndBatch");
+
+  if (!this->dataPtr->batching)
+  {
+    gzwarn << "SdfEntityCreator::EndBatch called without a matching "
+           << "BeginBatch. Ignoring." << std::endl;
+    return;
+  }
+
+  this->dataPtr->batching = false;
+
+  // Reconcile the views with all of the batched entities in one pass.
+  this->dataPtr->ecm->EndEntityBatch();
+
+  // Emit the buffered plugin load events in creation order, now that all of
+  // the batched entities and their components exist.
+  for (const auto &[entity, plugins] : this->dataPtr->batchedPlugins)
+  {
+    this->dataPtr->LoadPlugins(entity, plugins);
+  }
+  this->dataPtr->batchedPlugins.clear();
+}
+
 //////////////////////////////////////////////////
 Entity SdfEntityCreator::CreateEntities(const sdf::Model *_model,
                                         bool _staticParent)
@@ -541,15 +585,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Actor *_actor)
   }
 
   // Actor plugins
-  this->dataPtr->eventManager->Emit<events::LoadSdfPlugins>(actorEntity,
-        _actor->Plugins());
-  for (const sdf::Plugin &p : _actor->Plugins())
-  {
-    GZ_UTILS_WARN_IGNORE__DEPRECATED_DECLARATION
-    this->dataPtr->eventManager->Emit<events::LoadPlugins>(actorEntity,
-        p.ToElement());
-    GZ_UTILS_WARN_RESUME__DEPRECATED_DECLARATION
-  }
+  this->dataPtr->LoadPlugins(actorEntity, _actor->Plugins());
 
   return actorEntity;
 }
@@ -667,6 +667,66 @@ TEST_F(SdfEntityCreatorTest, CreateEntities)
   EXPECT_EQ(1u, lightCount);
 }
 
+/////////////////////////////////////////////////
+TEST_F(SdfEntityCreatorTest, BatchCreateEntities)
+{
+  EXPECT_EQ(0u, this->ecm.EntityCount());
+
+  // SdfEntityCreator
+  SdfEntityCreator creator(this->ecm, evm);
+
+  // Load SDF file
+  sdf::Root root;
+  root.Load(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create a view before the batch so that it has to be reconciled with the
+  // batched entities.
+  unsigned int modelCount{0};
+  this->ecm.Each<components::Model>(
+    [&](const Entity &, const components::Model *) -> bool
+    {
+      ++modelCount;
+      return true;
+    });
+  EXPECT_EQ(0u, modelCount);
+
+  // Create all entities within a batch
+  creator.BeginBatch();
+  creator.CreateEntities(root.WorldByIndex(0));
+  creator.EndBatch();
+
+  // Check entities
+  // 1 x world + 5 x model + 5 x link + 5 x collision + 5 x visual +
+  // 1 x light (light + visual)
+  EXPECT_EQ(23u, this->ecm.EntityCount());
+
+  // The pre-existing view picks up all of the batched models
+  this->ecm.Each<components::Model>(
+    [&](const Entity &, const components::Model *) -> bool
+    {
+      ++modelCount;
+      return true;
+    });
+  EXPECT_EQ(5u, modelCount);
+
+  // Views created after the batch also see the new entities
+  unsigned int linkCount{0};
+  this->ecm.Each<components::Link, components::Name>(
+    [&](const Entity &, const components::Link *,
+        const components::Name *) -> bool
+    {
+      ++linkCount;
+      return true;
+    });
+  EXPECT_EQ(5u, linkCount);
+
+  // An unmatched EndBatch is a no-op
+  creator.EndBatch();
+  EXPECT_EQ(23u, this->ecm.EntityCount());
+}
+
 /////////////////////////////////////////////////
 TEST_F(SdfEntityCreatorTest, CreateLights)
 {
@@ -18,7 +18,12 @@
 #include "SdfGenerator.hh"
 
 #include <ctype.h>
+#include <algorithm>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <sdf/sdf.hh>
@@ -270,6 +275,49 @@ namespace sdf_generator
     }
   }
 
+  /////////////////////////////////////////////////
+  /// \brief Compute a signature of the components that the generator
+  /// reflects into the output for an entity and all of its descendants.
+  /// Two calls produce the same signature iff regenerating the entity's
+  /// element would produce the same output, which lets the incremental
+  /// overload of generateWorld() reuse cached elements.
+  /// \param[in] _ecm Immutable reference to the Entity Component Manager
+  /// \param[in] _entity Entity whose subtree is summarized
+  /// \returns The signature string.
+  static std::string entitySignature(const EntityComponentManager &_ecm,
+                                     const Entity &_entity)
+  {
+    std::ostringstream out;
+
+    auto addSignature = [&out](const components::BaseComponent *_comp)
+    {
+      if (nullptr != _comp)
+        _comp->Serialize(out);
+      out << '|';
+    };
+
+    // Descendants() iterates in unordered_set order, so sort the entities
+    // to keep the signature stable across calls.
+    auto descendantsSet = _ecm.Descendants(_entity);
+    std::vector<Entity> descendants(descendantsSet.begin(),
+                                    descendantsSet.end());
+    std::sort(descendants.begin(), descendants.end());
+
+    for (const auto &entity : descendants)
+    {
+      out << entity << '{';
+      addSignature(_ecm.Component<components::Name>(entity));
+      addSignature(_ecm.Component<components::Pose>(entity));
+      addSignature(_ecm.Component<components::Static>(entity));
+      addSignature(_ecm.Component<components::SelfCollide>(entity));
+      addSignature(_ecm.Component<components::Inertial>(entity));
+      addSignature(_ecm.Component<components::WindMode>(entity));
+      addSignature(_ecm.Component<components::Light>(entity));
+      out << '}';
+    }
+    return out.str();
+  }
+
   /////////////////////////////////////////////////
   std::optional<std::string> generateWorld(
       const EntityComponentManager &_ecm, const Entity &_entity,
@@ -285,12 +333,41 @@ namespace sdf_generator
     return elem->ToString("");
   }
 
+  /////////////////////////////////////////////////
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      ModelElementCache &_cache,
+      const IncludeUriMap &_includeUriMap,
+      const msgs::SdfGeneratorConfig &_config)
+  {
+    sdf::ElementPtr elem = std::make_shared<sdf::Element>();
+    sdf::initFile("root.sdf", elem);
+    auto worldElem = elem->AddElement("world");
+    if (!updateWorldElement(
+            worldElem, _ecm, _entity, &_cache, _includeUriMap, _config))
+      return std::nullopt;
+
+    return elem->ToString("");
+  }
+
   /////////////////////////////////////////////////
   bool updateWorldElement(sdf::ElementPtr _elem,
                           const EntityComponentManager &_ecm,
                           const Entity &_entity,
                           const IncludeUriMap &_includeUriMap,
                           const msgs::SdfGeneratorConfig &_config)
+  {
+    return updateWorldElement(
+        _elem, _ecm, _entity, nullptr, _includeUriMap, _config);
+  }
+
+  /////////////////////////////////////////////////
+  bool updateWorldElement(sdf::ElementPtr _elem,
+                          const EntityComponentManager &_ecm,
+                          const Entity &_entity,
+                          ModelElementCache *_cache,
+                          const IncludeUriMap &_includeUriMap,
+                          const msgs::SdfGeneratorConfig &_config)
   {
     const auto *worldSdf = _ecm.Component<components::WorldSdf>(_entity);
 
@@ -329,6 +406,10 @@ namespace sdf_generator
 
     auto worldDir = common::parentPath(worldSdf->Data().Element()->FilePath());
 
+    // Entities seen on this pass, used to prune cache entries of removed
+    // models.
+    std::unordered_set<Entity> liveEntities;
+
     // models
     _ecm.Each<components::Model, components::ModelSdf>(
         [&](const Entity &_modelEntity, const components::Model *,
@@ -360,6 +441,33 @@ namespace sdf_generator
 
           if (modelConfig.expand_include_tags().data() || !modelFromInclude)
           {
+            if (nullptr != _cache)
+            {
+              liveEntities.insert(_modelEntity);
+              std::string signature = entitySignature(_ecm, _modelEntity);
+              auto entryIt = _cache->entries.find(_modelEntity);
+              if (entryIt != _cache->entries.end() &&
+                  entryIt->second.signature == signature)
+              {
+                // Unchanged since the cached generation, reuse verbatim.
+                _elem->InsertElement(entryIt->second.elem);
+                return true;
+              }
+
+              auto modelElem = _elem->AddElement("model");
+              updateModelElement(modelElem, _ecm, _modelEntity);
+
+              // Check & update possible //model/include(s)
+              if (!modelConfig.expand_include_tags().data())
+              {
+                updateModelElementWithNestedInclude(modelElem,
+                      modelConfig.save_fuel_version().data(), _includeUriMap);
+              }
+
+              _cache->entries[_modelEntity] = {std::move(signature), modelElem};
+              return true;
+            }
+
             auto modelElem = _elem->AddElement("model");
             updateModelElement(modelElem, _ecm, _modelEntity);
 
@@ -437,6 +545,19 @@ namespace sdf_generator
           return true;
         });
 
+    // Prune cache entries of models removed from the world.
+    if (nullptr != _cache)
+    {
+      for (auto entryIt = _cache->entries.begin();
+           entryIt != _cache->entries.end();)
+      {
+        if (liveEntities.find(entryIt->first) == liveEntities.end())
+          entryIt = _cache->entries.erase(entryIt);
+        else
+          ++entryIt;
+      }
+    }
+
     return true;
   }
 
@@ -37,6 +37,30 @@ namespace sdf_generator
 {
   using IncludeUriMap = std::unordered_map<std::string, std::string>;
 
+  /// \brief Cache of generated model elements used by the incremental
+  /// overload of generateWorld(). For every model, the cache stores the
+  /// element generated on the previous call together with a signature of
+  /// the components the generator reflects. Models whose signature is
+  /// unchanged reuse the cached element verbatim instead of being
+  /// regenerated from the ECM. The cache assumes the same generator
+  /// configuration is used on every call.
+  struct ModelElementCache
+  {
+    /// \brief A cached model element.
+    struct Entry
+    {
+      /// \brief Signature of the components the element was generated from.
+      std::string signature;
+
+      /// \brief The generated element.
+      sdf::ElementPtr elem;
+    };
+
+    /// \brief Cached entries, keyed by model entity. Entries of removed
+    /// entities are pruned during generation.
+    std::unordered_map<Entity, Entry> entries;
+  };
+
   /// \brief Generate the SDFormat representation of a world
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
   /// \input[in] _entity World entity
@@ -51,6 +75,26 @@ namespace sdf_generator
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
       const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
 
+  /// \brief Generate the SDFormat representation of a world incrementally:
+  /// models whose reflected components have not changed since the cache
+  /// was last filled reuse their cached element instead of being
+  /// regenerated. Intended for callers that regenerate the same world
+  /// periodically, such as autosave.
+  /// \input[in] _ecm Immutable reference to the Entity Component Manager
+  /// \input[in] _entity World entity
+  /// \input[in, out] _cache Cache of model elements from previous calls
+  /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
+  /// included Fuel models
+  /// \input[in] _config Configuration for the world generator
+  /// \returns Generated world string if generation succeeded.
+  /// Otherwise, nullopt
+  GZ_SIM_VISIBLE
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      ModelElementCache &_cache,
+      const IncludeUriMap &_includeUriMap = IncludeUriMap(),
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+
   /// \brief Update a sdf::Element of a world. Intended for internal use.
   /// \input[in, out] _elem sdf::Element to update
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
@@ -65,6 +109,24 @@ namespace sdf_generator
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
       const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
 
+  /// \brief Update a sdf::Element of a world, reusing cached model elements
+  /// where possible. Intended for internal use.
+  /// \input[in, out] _elem sdf::Element to update
+  /// \input[in] _ecm Immutable reference to the Entity Component Manager
+  /// \input[in] _entity World entity
+  /// \input[in, out] _cache Cache of model elements, or nullptr to
+  /// regenerate everything
+  /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
+  /// included Fuel models
+  /// \input[in] _config Configuration for the world generator
+  GZ_SIM_VISIBLE
+  bool updateWorldElement(
+      sdf::ElementPtr _elem,
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      ModelElementCache *_cache,
+      const IncludeUriMap &_includeUriMap = IncludeUriMap(),
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+
   /// \brief Update a sdf::Element of an inlined model.
   /// Intended for internal use.
   /// \input[in, out] _elem sdf::Element to update
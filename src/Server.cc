@@ -113,6 +113,16 @@ Server::Server(const ServerConfig &_config)
 
       gzmsg << "Loading SDF world file[" << filePath << "].\n";
 
+      // Try the world cache first: a hit restores the fully-resolved world
+      // and skips include resolution and resource fetching.
+      if (_config.UseWorldCache() && this->dataPtr->LoadCachedWorld(filePath))
+        break;
+
+      // Download the remote resources referenced by the world file
+      // concurrently up front, so the serial include resolution below hits
+      // the local cache instead of the network.
+      this->dataPtr->PrefetchResources(filePath);
+
       sdf::Root sdfRoot;
       // \todo(nkoenig) Async resource download.
       // This call can block for a long period of time while
@@ -123,6 +133,8 @@ Server::Server(const ServerConfig &_config)
       if (errors.empty()) {
         if (sdfRoot.Model() == nullptr) {
           this->dataPtr->sdfRoot = std::move(sdfRoot);
+          if (_config.UseWorldCache())
+            this->dataPtr->SaveCachedWorld(filePath);
         }
         else
         {
@@ -182,6 +194,46 @@ Server::Server(const ServerConfig &_config)
 /////////////////////////////////////////////////
 Server::~Server() = default;
 
+/////////////////////////////////////////////////
+std::unique_ptr<Server> Server::Clone() const
+{
+  if (this->dataPtr->simRunners.empty())
+  {
+    gzerr << "Cannot clone a server that failed to load." << std::endl;
+    return nullptr;
+  }
+
+  if (this->dataPtr->running)
+  {
+    gzerr << "Cannot clone a running server. Stop it first." << std::endl;
+    return nullptr;
+  }
+
+  // Construct the clone from the already-resolved SDF DOM so that no file
+  // parsing, include resolution or resource fetching happens again. Plugin
+  // libraries are already loaded in-process, so instantiating the clone's
+  // systems is cheap.
+  ServerConfig config = this->dataPtr->config;
+  config.SetSdfRoot(this->dataPtr->sdfRoot);
+  auto clone = std::make_unique<Server>(config);
+
+  if (clone->dataPtr->simRunners.size() != this->dataPtr->simRunners.size())
+  {
+    gzerr << "Failed to create runners while cloning the server."
+          << std::endl;
+    return nullptr;
+  }
+
+  // Bring each runner to the source runner's current state.
+  for (size_t i = 0; i < this->dataPtr->simRunners.size(); ++i)
+  {
+    clone->dataPtr->simRunners[i]->CopyStateFrom(
+        *this->dataPtr->simRunners[i]);
+  }
+
+  return clone;
+}
+
 /////////////////////////////////////////////////
 bool Server::Run(const bool _blocking, const uint64_t _iterations,
     const bool _paused)
@@ -241,6 +293,35 @@ bool Server::RunOnce(const bool _paused)
   return this->Run(true, 1, _paused);
 }
 
+/////////////////////////////////////////////////
+bool Server::RunBatch(const uint64_t _iterations, const BatchStepCallback &_cb)
+{
+  if (0 == _iterations)
+  {
+    gzerr << "RunBatch requires a positive number of iterations.\n";
+    return false;
+  }
+
+  // Check the current state, and return early if preconditions are not met.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->runMutex);
+    if (!this->dataPtr->sigHandler.Initialized())
+    {
+      gzerr << "Signal handlers were not created. The server won't run.\n";
+      return false;
+    }
+
+    // Do not allow running more than once.
+    if (this->dataPtr->running)
+    {
+      gzwarn << "The server is already runnnng.\n";
+      return false;
+    }
+  }
+
+  return this->dataPtr->RunBatch(_iterations, _cb);
+}
+
 /////////////////////////////////////////////////
 void Server::SetUpdatePeriod(
     const std::chrono::steady_clock::duration &_updatePeriod,
@@ -277,6 +358,18 @@ bool Server::SetPaused(const bool _paused,
   return false;
 }
 
+//////////////////////////////////////////////////
+bool Server::RequestReset(const unsigned int _worldIndex) const
+{
+  if (_worldIndex < this->dataPtr->simRunners.size())
+  {
+    this->dataPtr->simRunners[_worldIndex]->RequestRewind();
+    return true;
+  }
+
+  return false;
+}
+
 //////////////////////////////////////////////////
 std::optional<bool> Server::Paused(const unsigned int _worldIndex) const
 {
@@ -251,6 +251,13 @@ class gz::sim::ServerConfigPrivate
             updateRate(_cfg->updateRate),
             initialSimTime(_cfg->initialSimTime),
             useLevels(_cfg->useLevels),
+            usePipelinedStepping(_cfg->usePipelinedStepping),
+            useAsyncStepping(_cfg->useAsyncStepping),
+            useDeterministicMode(_cfg->useDeterministicMode),
+            spinWindow(_cfg->spinWindow),
+            useWorldCache(_cfg->useWorldCache),
+            steppingThreadAffinity(_cfg->steppingThreadAffinity),
+            postUpdateThreadAffinity(_cfg->postUpdateThreadAffinity),
             useLogRecord(_cfg->useLogRecord),
             logRecordPath(_cfg->logRecordPath),
             logRecordPeriod(_cfg->logRecordPeriod),
@@ -284,6 +291,29 @@ class gz::sim::ServerConfigPrivate
   /// \brief Use the level system
   public: bool useLevels{false};
 
+  /// \brief Run system PostUpdates pipelined with the next step
+  public: bool usePipelinedStepping{false};
+
+  /// \brief Never block physics on PostUpdate consumers
+  public: bool useAsyncStepping{false};
+
+  /// \brief Guarantee bit-identical reruns of the same world
+  public: bool useDeterministicMode{false};
+
+  /// \brief Spin window of the step pacing clock, zero for sleep-only
+  public: std::chrono::steady_clock::duration spinWindow{0};
+
+  /// \brief Cache fully-resolved worlds on disk
+  public: bool useWorldCache{false};
+
+  /// \brief Logical CPUs the stepping thread is pinned to, empty for
+  /// unpinned.
+  public: std::vector<unsigned int> steppingThreadAffinity;
+
+  /// \brief Logical CPUs the PostUpdate worker pool is pinned to, empty
+  /// for unpinned.
+  public: std::vector<unsigned int> postUpdateThreadAffinity;
+
   /// \brief Use the logging system to record states
   public: bool useLogRecord{false};
 
@@ -446,6 +476,93 @@ void ServerConfig::SetUseLevels(const bool _levels)
   this->dataPtr->useLevels = _levels;
 }
 
+/////////////////////////////////////////////////
+bool ServerConfig::UsePipelinedStepping() const
+{
+  return this->dataPtr->usePipelinedStepping;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUsePipelinedStepping(bool _pipelined)
+{
+  this->dataPtr->usePipelinedStepping = _pipelined;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseAsyncStepping() const
+{
+  return this->dataPtr->useAsyncStepping;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseAsyncStepping(bool _async)
+{
+  this->dataPtr->useAsyncStepping = _async;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseDeterministicMode() const
+{
+  return this->dataPtr->useDeterministicMode;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseDeterministicMode(bool _deterministic)
+{
+  this->dataPtr->useDeterministicMode = _deterministic;
+}
+
+/////////////////////////////////////////////////
+std::chrono::steady_clock::duration ServerConfig::SpinWindow() const
+{
+  return this->dataPtr->spinWindow;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetSpinWindow(
+    const std::chrono::steady_clock::duration &_window)
+{
+  this->dataPtr->spinWindow = _window;
+}
+
+/////////////////////////////////////////////////
+bool ServerConfig::UseWorldCache() const
+{
+  return this->dataPtr->useWorldCache;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetUseWorldCache(bool _cache)
+{
+  this->dataPtr->useWorldCache = _cache;
+}
+
+/////////////////////////////////////////////////
+const std::vector<unsigned int> &ServerConfig::SteppingThreadAffinity() const
+{
+  return this->dataPtr->steppingThreadAffinity;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetSteppingThreadAffinity(
+    const std::vector<unsigned int> &_cpus)
+{
+  this->dataPtr->steppingThreadAffinity = _cpus;
+}
+
+/////////////////////////////////////////////////
+const std::vector<unsigned int> &ServerConfig::PostUpdateThreadAffinity() const
+{
+  return this->dataPtr->postUpdateThreadAffinity;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetPostUpdateThreadAffinity(
+    const std::vector<unsigned int> &_cpus)
+{
+  this->dataPtr->postUpdateThreadAffinity = _cpus;
+}
+
 /////////////////////////////////////////////////
 void ServerConfig::SetNetworkSecondaries(unsigned int _secondaries)
 {
@@ -800,6 +917,16 @@ void ServerConfig::SetSdfRoot(const sdf::Root &_root) const
   this->dataPtr->sdfString = "";
 }
 
+/////////////////////////////////////////////////
+void ServerConfig::SetSdfRoot(sdf::Root &&_root) const
+{
+  this->dataPtr->source = ServerConfig::SourceType::kSdfRoot;
+  this->dataPtr->sdfRoot = std::move(_root);
+
+  this->dataPtr->sdfFile = "";
+  this->dataPtr->sdfString = "";
+}
+
 /////////////////////////////////////////////////
 std::optional<sdf::Root> &ServerConfig::SdfRoot() const
 {
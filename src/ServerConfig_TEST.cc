@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
 #include <gz/common/Console.hh>
 #include <gz/sim/ServerConfig.hh>
 #include <gz/sim/Util.hh>
@@ -261,3 +264,23 @@ TEST(ServerConfig, SdfRoot)
   EXPECT_TRUE(config.SdfString().empty());
   EXPECT_EQ(ServerConfig::SourceType::kSdfRoot, config.Source());
 }
+
+//////////////////////////////////////////////////
+TEST(ServerConfig, SdfRootMove)
+{
+  ServerConfig config;
+
+  sdf::Root root;
+  EXPECT_TRUE(root.LoadSdfString(
+      "<?xml version='1.0'?><sdf version='1.6'>"
+      "<world name='moved'/></sdf>").empty());
+  config.SetSdfRoot(std::move(root));
+
+  EXPECT_TRUE(config.SdfRoot());
+  ASSERT_EQ(1u, config.SdfRoot()->WorldCount());
+  ASSERT_NE(nullptr, config.SdfRoot()->WorldByIndex(0));
+  EXPECT_EQ("moved", config.SdfRoot()->WorldByIndex(0)->Name());
+  EXPECT_TRUE(config.SdfFile().empty());
+  EXPECT_TRUE(config.SdfString().empty());
+  EXPECT_EQ(ServerConfig::SourceType::kSdfRoot, config.Source());
+}
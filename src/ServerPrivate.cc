@@ -18,21 +18,31 @@
 
 #include <tinyxml2.h>
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/server_control.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/stringmsg_v.pb.h>
+#include <gz/msgs/world_stats.pb.h>
 
+#include <sdf/Element.hh>
 #include <sdf/Root.hh>
 #include <sdf/World.hh>
 
 #include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
 
 #include <gz/fuel_tools/Interface.hh>
 
+#include "gz/sim/Conversions.hh"
 #include "gz/sim/Util.hh"
 #include "SimulationRunner.hh"
+#include "TaskPool.hh"
 
 using namespace gz;
 using namespace sim;
@@ -173,6 +183,22 @@ bool ServerPrivate::Run(const uint64_t _iterations,
   }
   else
   {
+    // Split the machine's cores across the runners so the worlds'
+    // worker pools don't oversubscribe each other.
+    unsigned int coreBudget = std::max(1u,
+        std::thread::hardware_concurrency() /
+        static_cast<unsigned int>(this->simRunners.size()));
+    for (std::unique_ptr<SimulationRunner> &runner : this->simRunners)
+    {
+      runner->SetCoreBudget(coreBudget);
+    }
+
+    if (this->combinedStatsPub.Valid())
+    {
+      this->telemetryThread =
+          std::thread(&ServerPrivate::TelemetryLoop, this);
+    }
+
     for (std::unique_ptr<SimulationRunner> &runner : this->simRunners)
     {
       this->workerPool.AddWork([&runner, &_iterations] ()
@@ -185,6 +211,55 @@ bool ServerPrivate::Run(const uint64_t _iterations,
     result = this->workerPool.WaitForResults();
   }
 
+  this->running = false;
+  if (this->telemetryThread.joinable())
+  {
+    this->telemetryThread.join();
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+void ServerPrivate::TelemetryLoop()
+{
+  // The names are fixed once the entities have been created.
+  std::vector<std::string> names;
+  {
+    std::lock_guard<std::mutex> lock(this->worldsMutex);
+    names = this->worldNames;
+  }
+
+  while (this->running)
+  {
+    for (size_t i = 0; i < this->simRunners.size() && i < names.size(); ++i)
+    {
+      // The info is read without synchronization; these values are only
+      // telemetry and a torn read costs at most one odd sample.
+      auto msg =
+          convert<msgs::WorldStatistics>(this->simRunners[i]->CurrentInfo());
+      auto *headerData = msg.mutable_header()->add_data();
+      headerData->set_key("world");
+      headerData->add_value(names[i]);
+      this->combinedStatsPub.Publish(msg);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  }
+}
+
+/////////////////////////////////////////////////
+bool ServerPrivate::RunBatch(const uint64_t _iterations,
+    const BatchStepCallback &_cb)
+{
+  this->runMutex.lock();
+  this->running = true;
+  this->runMutex.unlock();
+
+  // The whole batch executes on the calling thread. With multiple worlds,
+  // the runners step their batches sequentially.
+  bool result = true;
+  for (std::unique_ptr<SimulationRunner> &runner : this->simRunners)
+    result = runner->RunBatch(_iterations, _cb) && result;
+
   this->running = false;
   return result;
 }
@@ -314,6 +389,17 @@ void ServerPrivate::SetupTransport()
            << "]" << std::endl;
   }
 
+  // With several worlds in one process, also publish their statistics on
+  // a combined topic so a sweep can be monitored from one subscription.
+  if (this->simRunners.size() > 1)
+  {
+    std::string statsTopic{"/gazebo/stats"};
+    this->combinedStatsPub =
+        this->node.Advertise<msgs::WorldStatistics>(statsTopic);
+    gzmsg << "Serving combined world statistics on [" << statsTopic << "]"
+           << std::endl;
+  }
+
   // Resource path management
   std::string addPathService{"/gazebo/resource_paths/add"};
   if (this->node.Advertise(addPathService,
@@ -546,9 +632,23 @@ bool ServerPrivate::ResourcePathsResolveService(
 //////////////////////////////////////////////////
 std::string ServerPrivate::FetchResource(const std::string &_uri)
 {
+  {
+    std::lock_guard<std::mutex> lock(this->fetchMutex);
+    auto fetched = this->fetchedUriPaths.find(_uri);
+    if (fetched != this->fetchedUriPaths.end())
+      return fetched->second;
+
+    // Negative lookup cache: a URI that failed once is not retried, so
+    // worlds with many references to a missing resource only pay for one
+    // network round trip.
+    if (this->failedFetchUris.find(_uri) != this->failedFetchUris.end())
+      return std::string();
+  }
+
   auto path =
       fuel_tools::fetchResourceWithClient(_uri, *this->fuelClient.get());
 
+  std::lock_guard<std::mutex> lock(this->fetchMutex);
   if (!path.empty())
   {
     for (auto &runner : this->simRunners)
@@ -556,12 +656,177 @@ std::string ServerPrivate::FetchResource(const std::string &_uri)
       runner->AddToFuelUriMap(path, _uri);
     }
     fuelUriMap[path] = _uri;
+    this->fetchedUriPaths[_uri] = path;
+  }
+  else
+  {
+    this->failedFetchUris.insert(_uri);
   }
   return path;
 }
 
+//////////////////////////////////////////////////
+void ServerPrivate::PrefetchResources(const std::string &_path)
+{
+  std::ifstream worldFile(_path);
+  if (!worldFile)
+    return;
+
+  std::stringstream content;
+  content << worldFile.rdbuf();
+  const std::string world = content.str();
+
+  // Collect the unique remote URIs referenced by the top-level file. A
+  // plain text scan for <uri> elements is enough here: the goal is only to
+  // warm the local cache, and anything missed is still fetched on demand
+  // by the find callbacks during parsing.
+  std::vector<std::string> uris;
+  std::unordered_set<std::string> seen;
+  const std::string openTag = "<uri>";
+  const std::string closeTag = "</uri>";
+  for (std::size_t pos = world.find(openTag); pos != std::string::npos;
+       pos = world.find(openTag, pos))
+  {
+    pos += openTag.size();
+    std::size_t end = world.find(closeTag, pos);
+    if (end == std::string::npos)
+      break;
+
+    std::string uri = world.substr(pos, end - pos);
+    std::size_t first = uri.find_first_not_of(" \t\r\n");
+    std::size_t last = uri.find_last_not_of(" \t\r\n");
+    if (first == std::string::npos)
+      continue;
+    uri = uri.substr(first, last - first + 1);
+
+    // Only remote resources need prefetching; everything else resolves
+    // locally without touching the network.
+    if (uri.compare(0, 8, "https://") != 0 &&
+        uri.compare(0, 7, "http://") != 0)
+      continue;
+
+    if (seen.insert(uri).second)
+      uris.push_back(uri);
+  }
+
+  if (uris.empty())
+    return;
+
+  gzmsg << "Prefetching " << uris.size() << " remote resource"
+         << (uris.size() == 1 ? "" : "s") << " from [" << _path << "]"
+         << std::endl;
+
+  // Fetch concurrently with a small bounded pool. FetchResource records
+  // successes and failures in the caches, so the serial include resolution
+  // that follows never downloads these URIs again.
+  TaskPool pool(static_cast<unsigned int>(
+      std::min<std::size_t>(4u, uris.size())));
+  for (const std::string &uri : uris)
+  {
+    pool.Post([this, uri]()
+    {
+      this->FetchResource(uri);
+    });
+  }
+  pool.Wait();
+}
+
 //////////////////////////////////////////////////
 std::string ServerPrivate::FetchResourceUri(const common::URI &_uri)
 {
   return this->FetchResource(_uri.Str());
 }
+
+//////////////////////////////////////////////////
+std::string ServerPrivate::WorldCacheEntry(const std::string &_path)
+{
+  std::ifstream worldFile(_path);
+  if (!worldFile)
+  {
+    gzwarn << "Unable to read world file [" << _path
+            << "], skipping world cache." << std::endl;
+    return std::string();
+  }
+
+  std::stringstream content;
+  content << worldFile.rdbuf();
+
+  std::string home;
+  if (!common::env(GZ_HOMEDIR, home))
+  {
+    gzwarn << "Unable to find home directory, skipping world cache."
+            << std::endl;
+    return std::string();
+  }
+
+  std::string cacheDir = common::joinPaths(home, ".gz", "sim", "worldcache");
+  if (!common::exists(cacheDir) && !common::createDirectories(cacheDir))
+  {
+    gzwarn << "Unable to create world cache directory [" << cacheDir
+            << "]." << std::endl;
+    return std::string();
+  }
+
+  // Key the entry by the content hash so that edits to the world file
+  // invalidate the cache. Includes resolved from the file are baked into
+  // the cached copy, so changes to included models require either editing
+  // the top-level file or clearing the cache.
+  std::ostringstream key;
+  key << std::hex << std::hash<std::string>{}(content.str());
+  return common::joinPaths(cacheDir, key.str() + ".sdf");
+}
+
+//////////////////////////////////////////////////
+bool ServerPrivate::LoadCachedWorld(const std::string &_path)
+{
+  std::string entry = this->WorldCacheEntry(_path);
+  if (entry.empty() || !common::exists(entry))
+    return false;
+
+  std::ifstream cacheFile(entry);
+  if (!cacheFile)
+  {
+    gzwarn << "Unable to read world cache entry [" << entry << "]."
+            << std::endl;
+    return false;
+  }
+
+  std::stringstream content;
+  content << cacheFile.rdbuf();
+
+  // The cached world is fully resolved, so parsing it doesn't touch the
+  // resource path or Fuel find callbacks.
+  sdf::Root cachedRoot;
+  sdf::Errors errors = cachedRoot.LoadSdfString(content.str());
+  if (!errors.empty())
+  {
+    gzwarn << "World cache entry [" << entry
+            << "] failed to parse, ignoring it." << std::endl;
+    for (auto &err : errors)
+      gzdbg << err << "\n";
+    return false;
+  }
+
+  gzmsg << "Loaded world from cache entry [" << entry << "]." << std::endl;
+  this->sdfRoot = std::move(cachedRoot);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void ServerPrivate::SaveCachedWorld(const std::string &_path)
+{
+  std::string entry = this->WorldCacheEntry(_path);
+  if (entry.empty())
+    return;
+
+  std::ofstream cacheFile(entry, std::ios::out | std::ios::trunc);
+  if (!cacheFile)
+  {
+    gzwarn << "Unable to write world cache entry [" << entry << "]."
+            << std::endl;
+    return;
+  }
+
+  cacheFile << this->sdfRoot.Element()->ToString("");
+  gzmsg << "Saved world to cache entry [" << entry << "]." << std::endl;
+}
@@ -27,6 +27,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -48,6 +49,7 @@
 #include "gz/sim/Export.hh"
 #include "gz/sim/ServerConfig.hh"
 #include "gz/sim/SystemLoader.hh"
+#include "gz/sim/Types.hh"
 
 using namespace std::chrono_literals;
 
@@ -75,6 +77,14 @@ namespace gz
       public: bool Run(const uint64_t _iterations,
                  std::optional<std::condition_variable *> _cond = std::nullopt);
 
+      /// \brief Run all simulation runners for a fixed number of steps back
+      /// to back on the calling thread.
+      /// \param[in] _iterations Number of steps to perform.
+      /// \param[in] _cb Optional callback invoked after every step.
+      /// \return True if every runner completed the batch.
+      public: bool RunBatch(const uint64_t _iterations,
+                 const BatchStepCallback &_cb);
+
       /// \brief Add logging record plugin.
       /// \param[in] _config Server configuration parameters.
       public: void AddRecordPlugin(const ServerConfig &_config);
@@ -90,16 +100,51 @@ namespace gz
       /// this function.
       public: void SetupTransport();
 
-      /// \brief Fetch a resource from Fuel using fuel-tools.
+      /// \brief Fetch a resource from Fuel using fuel-tools. Results are
+      /// cached, including failures: a URI that could not be fetched once
+      /// is not retried, so worlds with many references to a missing
+      /// resource only hit the network for it once.
       /// \param[in] _uri The resource URI to fetch.
       /// \return Path to the downloaded resource, empty on error.
       public: std::string FetchResource(const std::string &_uri);
 
+      /// \brief Scan a world file for remote resource URIs and fetch them
+      /// concurrently with a small bounded worker pool, so the serial
+      /// include resolution that follows finds everything in the local
+      /// cache. Only the top-level file is scanned; URIs that first appear
+      /// inside included models are still fetched on demand while parsing.
+      /// \param[in] _path Path to the world file to scan.
+      public: void PrefetchResources(const std::string &_path);
+
       /// \brief Fetch a resource from Fuel using fuel-tools.
       /// \param[in] _uri The resource URI to fetch.
       /// \return Path to the downloaded resource, empty on error.
       public: std::string FetchResourceUri(const common::URI &_uri);
 
+      /// \brief Try to restore a fully-resolved world from the on-disk
+      /// world cache.
+      /// \param[in] _path Path to the top-level world file.
+      /// \return True if the cache had an entry matching the file's current
+      /// content and sdfRoot was populated from it.
+      public: bool LoadCachedWorld(const std::string &_path);
+
+      /// \brief Write the fully-resolved world in sdfRoot to the on-disk
+      /// world cache, keyed by the content hash of the world file.
+      /// \param[in] _path Path to the top-level world file.
+      public: void SaveCachedWorld(const std::string &_path);
+
+      /// \brief Compute the cache entry path for a world file based on its
+      /// content hash.
+      /// \param[in] _path Path to the top-level world file.
+      /// \return Full path of the cache entry, or an empty string if the
+      /// world file can't be read or the cache directory can't be created.
+      private: std::string WorldCacheEntry(const std::string &_path);
+
+      /// \brief Periodically publish one statistics message per world on
+      /// the combined telemetry topic while the worlds run in parallel.
+      /// The header of each message names the world it belongs to.
+      private: void TelemetryLoop();
+
       /// \brief Signal handler callback
       /// \param[in] _sig The signal number
       private: void OnSignal(int _sig);
@@ -188,6 +233,17 @@ namespace gz
       /// Server. It is used in the SDFormat world generator when saving worlds
       public: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Protects the fetch caches below. FetchResource can be
+      /// called concurrently by the prefetch workers.
+      private: std::mutex fetchMutex;
+
+      /// \brief Cache of successfully fetched URIs to their local paths.
+      private: std::unordered_map<std::string, std::string> fetchedUriPaths;
+
+      /// \brief Negative lookup cache: URIs that failed to fetch, kept so
+      /// repeated references don't re-hit the network.
+      private: std::unordered_set<std::string> failedFetchUris;
+
       /// \brief List of names for all worlds loaded in this server.
       private: std::vector<std::string> worldNames;
 
@@ -199,6 +255,13 @@ namespace gz
 
       /// \brief Publisher of resrouce paths.
       private: transport::Node::Publisher pathPub;
+
+      /// \brief Publisher for the combined multi-world statistics topic.
+      private: transport::Node::Publisher combinedStatsPub;
+
+      /// \brief Thread publishing combined statistics while several
+      /// worlds run in parallel.
+      private: std::thread telemetryThread;
     };
     }
   }
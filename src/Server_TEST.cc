@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include <csignal>
 #include <vector>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/StringUtils.hh>
 #include <gz/common/Util.hh>
 #include <gz/math/Rand.hh>
@@ -425,6 +426,56 @@ TEST_P(ServerFixture, GZ_UTILS_TEST_DISABLED_ON_WIN32(SdfRootServerConfig))
   EXPECT_FALSE(server.HasEntity("bad", 1));
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, GZ_UTILS_TEST_DISABLED_ON_WIN32(WorldCache))
+{
+  // Point the home directory at a scratch space so the cache starts empty
+  // and doesn't leak into the user's home.
+  std::string oldHome;
+  common::env(GZ_HOMEDIR, oldHome);
+  auto fakeHome = common::joinPaths(PROJECT_BINARY_PATH, "test_world_cache");
+  common::removeAll(fakeHome);
+  ASSERT_TRUE(common::createDirectories(fakeHome));
+  ASSERT_TRUE(common::setenv(GZ_HOMEDIR, fakeHome));
+
+  gz::sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+  serverConfig.SetUseWorldCache(true);
+
+  auto cacheDir = common::joinPaths(fakeHome, ".gz", "sim", "worldcache");
+
+  // First load parses the world file and writes a cache entry.
+  {
+    sim::Server server(serverConfig);
+    EXPECT_EQ(25u, *server.EntityCount());
+  }
+
+  int entryCount = 0;
+  for (common::DirIter file(cacheDir); file != common::DirIter(); ++file)
+    ++entryCount;
+  EXPECT_EQ(1, entryCount);
+
+  // Second load restores the world from the cache entry.
+  {
+    sim::Server server(serverConfig);
+    EXPECT_EQ(25u, *server.EntityCount());
+    EXPECT_TRUE(server.HasEntity("box"));
+    EXPECT_TRUE(server.HasEntity("sphere"));
+    EXPECT_TRUE(server.HasEntity("cylinder"));
+    EXPECT_TRUE(server.HasEntity("capsule"));
+    EXPECT_TRUE(server.HasEntity("ellipsoid"));
+  }
+
+  // No extra entry was written for the unchanged world file.
+  entryCount = 0;
+  for (common::DirIter file(cacheDir); file != common::DirIter(); ++file)
+    ++entryCount;
+  EXPECT_EQ(1, entryCount);
+
+  ASSERT_TRUE(common::setenv(GZ_HOMEDIR, oldHome));
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, GZ_UTILS_TEST_DISABLED_ON_WIN32(ServerConfigLogRecord))
 {
@@ -545,6 +596,62 @@ TEST_P(ServerFixture, RunBlocking)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, RunBatch)
+{
+  sim::Server server;
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+  EXPECT_TRUE(*server.Paused());
+  EXPECT_EQ(0u, *server.IterationCount());
+
+  // Zero iterations is rejected.
+  EXPECT_FALSE(server.RunBatch(0));
+
+  // A batch without a callback just steps.
+  EXPECT_TRUE(server.RunBatch(100));
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(100u, *server.IterationCount());
+
+  // The previous pause state is restored after the batch.
+  EXPECT_TRUE(*server.Paused());
+
+  // The callback runs once per step on the stepping thread, with access to
+  // the world state.
+  uint64_t steps = 0;
+  uint64_t lastIteration = 0;
+  EXPECT_TRUE(server.RunBatch(50,
+      [&](const UpdateInfo &_info, const EntityComponentManager &_ecm)
+      {
+        ++steps;
+        lastIteration = _info.iterations;
+        EXPECT_LT(0u, _ecm.EntityCount());
+      }));
+  EXPECT_EQ(50u, steps);
+  EXPECT_EQ(150u, lastIteration);
+  EXPECT_EQ(150u, *server.IterationCount());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, Clone)
+{
+  sim::Server server;
+  server.SetUpdatePeriod(1ns);
+  server.Run(true, 100, false);
+  EXPECT_EQ(100u, *server.IterationCount());
+
+  auto clone = server.Clone();
+  ASSERT_NE(nullptr, clone);
+  EXPECT_FALSE(clone->Running());
+  EXPECT_EQ(*server.EntityCount(), *clone->EntityCount());
+  EXPECT_EQ(*server.SystemCount(), *clone->SystemCount());
+
+  // The clone steps independently of the original.
+  clone->SetUpdatePeriod(1ns);
+  clone->Run(true, 10, false);
+  EXPECT_EQ(100u, *server.IterationCount());
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, RunNonBlockingPaused)
 {
@@ -18,6 +18,10 @@
 #include "SimulationRunner.hh"
 
 #include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
 
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/clock.pb.h>
@@ -32,6 +36,8 @@
 #include <sdf/Root.hh>
 
 #include "gz/common/Profiler.hh"
+#include "gz/common/Util.hh"
+#include "gz/sim/components/Factory.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/Sensor.hh"
@@ -45,6 +51,7 @@
 #include "gz/sim/SdfEntityCreator.hh"
 #include "gz/sim/Util.hh"
 
+#include "msgs/performance_metrics.pb.h"
 #include "network/NetworkManagerPrimary.hh"
 #include "SdfGenerator.hh"
 
@@ -126,6 +133,36 @@ SimulationRunner::SimulationRunner(const sdf::World *_world,
         static_cast<int>(this->stepSize.count() / this->desiredRtf));
   }
 
+  // Adaptive step governor: when the real time factor is unconstrained,
+  // an <adaptive_step> child of <physics> lets the runner raise the step
+  // size up to <adaptive_step><max_step_size> to maximize simulated
+  // seconds per wall second. The bound is the user's declared stability
+  // limit; within it the governor backs off whenever a larger step stops
+  // paying for itself.
+  if (this->desiredRtf < 1e-9 && physics->Element() &&
+      physics->Element()->HasElement("adaptive_step"))
+  {
+    auto adaptiveElem = physics->Element()->GetElement("adaptive_step");
+    const double maxStep = adaptiveElem->Get<double>("max_step_size",
+        physics->MaxStepSize()).first;
+    if (maxStep >= physics->MaxStepSize())
+    {
+      this->adaptiveStepEnabled = true;
+      this->adaptiveStepMin = this->stepSize;
+      this->adaptiveStepMax =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(maxStep));
+      gzmsg << "Adaptive step enabled, step size bounds ["
+            << physics->MaxStepSize() << ", " << maxStep << "] s."
+            << std::endl;
+    }
+    else
+    {
+      gzwarn << "<adaptive_step><max_step_size> [" << maxStep
+             << "] is smaller than <max_step_size>, ignoring." << std::endl;
+    }
+  }
+
   // Epoch
   this->simTimeEpoch = std::chrono::round<std::chrono::nanoseconds>(
     std::chrono::duration<double>{_config.InitialSimTime()}
@@ -166,9 +203,53 @@ SimulationRunner::SimulationRunner(const sdf::World *_world,
       std::bind(&SimulationRunner::LoadPlugins, this, std::placeholders::_1,
       std::placeholders::_2));
 
+  // Name and parent based lookups dominate entity spawning and scoped name
+  // resolution, so keep reverse value indexes for them.
+  this->entityCompMgr.EnableComponentValueIndex<components::Name>();
+  this->entityCompMgr.EnableComponentValueIndex<components::ParentEntity>();
+
   // Create the level manager
   this->levelMgr = std::make_unique<LevelManager>(this, _config.UseLevels());
 
+  this->usePipelinedStepping = _config.UsePipelinedStepping();
+  this->useAsyncStepping = _config.UseAsyncStepping();
+  if (this->useAsyncStepping)
+  {
+    // Async stepping builds on the pipelined snapshot; it only changes
+    // what happens when the previous batch is still running.
+    this->usePipelinedStepping = true;
+    gzdbg << "Async stepping enabled: physics will not block on PostUpdate "
+           << "consumers, coalescing states they are too slow to drain."
+           << std::endl;
+  }
+  else if (this->usePipelinedStepping)
+  {
+    gzdbg << "Pipelined stepping enabled: PostUpdate will run on a state "
+           << "snapshot while the next step proceeds." << std::endl;
+  }
+
+  this->deterministicMode = _config.UseDeterministicMode();
+  if (this->deterministicMode)
+  {
+    // Both modes let wall-clock timing decide which states consumers
+    // observe, which breaks run-to-run reproducibility.
+    if (this->usePipelinedStepping || this->useAsyncStepping)
+    {
+      gzwarn << "Deterministic mode disables pipelined and async stepping."
+             << std::endl;
+      this->usePipelinedStepping = false;
+      this->useAsyncStepping = false;
+    }
+    if (this->adaptiveStepEnabled)
+    {
+      gzwarn << "Deterministic mode disables the adaptive step governor."
+             << std::endl;
+      this->adaptiveStepEnabled = false;
+    }
+  }
+
+  this->spinWindow = _config.SpinWindow();
+
   // Check if this is going to be a distributed runner
   // Attempt to create the manager based on environment variables.
   // If the configuration is invalid, then networkMgr will be `nullptr`.
@@ -261,12 +342,36 @@ SimulationRunner::SimulationRunner(const sdf::World *_world,
 
   gzmsg << "Serving world SDF generation service on [" << opts.NameSpace()
          << "/" << genWorldSdfService << "]" << std::endl;
+
+  std::string memoryReportService{"memory_report"};
+  this->node->Advertise(
+      memoryReportService, &SimulationRunner::MemoryReport, this);
+
+  gzmsg << "Serving memory report service on [" << opts.NameSpace()
+         << "/" << memoryReportService << "]" << std::endl;
+
+  // A non-empty profile report prefix turns on per-system timing
+  // collection for the whole run and dumps the report on shutdown.
+  common::env("GZ_SIM_PROFILE_REPORT", this->profileReportPath);
+
+  // Setting GZ_SIM_ALLOC_TELEMETRY turns on the per-system allocation
+  // counters reported on the performance topic and by the memory report
+  // service.
+  std::string allocTelemetry;
+  if (common::env("GZ_SIM_ALLOC_TELEMETRY", allocTelemetry) &&
+      allocTelemetry != "0")
+  {
+    memory_probe::SetEnabled(true);
+  }
 }
 
 //////////////////////////////////////////////////
 SimulationRunner::~SimulationRunner()
 {
   this->StopWorkerThreads();
+
+  if (!this->profileReportPath.empty())
+    this->WriteProfileReport();
 }
 
 /////////////////////////////////////////////////
@@ -388,6 +493,10 @@ void SimulationRunner::UpdatePhysicsParams()
     }
     if (updated)
     {
+      // Explicitly commanded physics parameters override the adaptive
+      // step governor.
+      this->adaptiveStepEnabled = false;
+
       // Set as OneTimeChange to make sure the update is not missed
       this->entityCompMgr.SetChanged(worldEntity, components::Physics::typeId,
           ComponentState::OneTimeChange);
@@ -396,6 +505,60 @@ void SimulationRunner::UpdatePhysicsParams()
   this->entityCompMgr.RemoveComponent<components::PhysicsCmd>(worldEntity);
 }
 
+/////////////////////////////////////////////////
+void SimulationRunner::UpdateAdaptiveStep(
+    const std::chrono::steady_clock::duration &_stepCost)
+{
+  if (this->currentInfo.paused)
+    return;
+
+  this->adaptiveWindowCost += _stepCost;
+  if (++this->adaptiveWindowSteps < 200u)
+    return;
+
+  // Wall seconds spent per simulated second over the window; lower is
+  // faster.
+  const double stepSeconds =
+      std::chrono::duration<double>(this->stepSize).count();
+  const double cost =
+      std::chrono::duration<double>(this->adaptiveWindowCost).count() /
+      (this->adaptiveWindowSteps * stepSeconds);
+  this->adaptiveWindowCost = std::chrono::steady_clock::duration::zero();
+  this->adaptiveWindowSteps = 0;
+
+  // Hill climb: keep moving the step size in the current direction while
+  // the measured cost improves, otherwise turn around. A larger step that
+  // makes the solver work harder shows up as a cost regression, so the
+  // governor retreats from it on the next window.
+  if (this->adaptivePrevCost > 0.0 && cost >= this->adaptivePrevCost * 0.97)
+  {
+    this->adaptiveStepDirection = -this->adaptiveStepDirection;
+  }
+  this->adaptivePrevCost = cost;
+
+  auto newStep = std::clamp(this->adaptiveStepDirection > 0 ?
+      this->stepSize * 2 : this->stepSize / 2,
+      this->adaptiveStepMin, this->adaptiveStepMax);
+  if (newStep == this->stepSize)
+    return;
+
+  this->SetStepSize(newStep);
+
+  // Keep the world's Physics component consistent with the step the
+  // runner is actually taking.
+  auto worldEntity =
+      this->entityCompMgr.EntityByComponents(components::World());
+  auto physicsComp =
+      this->entityCompMgr.Component<components::Physics>(worldEntity);
+  if (physicsComp)
+  {
+    physicsComp->Data().SetMaxStepSize(
+        std::chrono::duration<double>(newStep).count());
+    this->entityCompMgr.SetChanged(worldEntity, components::Physics::typeId,
+        ComponentState::OneTimeChange);
+  }
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::PublishStats()
 {
@@ -453,6 +616,218 @@ void SimulationRunner::PublishStats()
     this->rootClockPub.Publish(clockMsg);
 }
 
+//////////////////////////////////////////////////
+void SimulationRunner::PhaseTimingWindow::Record(double _nanos)
+{
+  this->samples[this->next] = _nanos;
+  this->next = (this->next + 1) % kWindowSize;
+  this->count = std::min(this->count + 1, kWindowSize);
+
+  this->totalNanos += _nanos;
+  ++this->totalCount;
+  this->minNanos = std::min(this->minNanos, _nanos);
+  this->maxNanos = std::max(this->maxNanos, _nanos);
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::RebuildSystemTimings()
+{
+  std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+
+  this->systemTimings.clear();
+  this->preUpdateTimingIndex.clear();
+  this->updateTimingIndex.clear();
+  this->postUpdateTimingIndex.clear();
+
+  for (const auto &system : this->systemMgr->ActiveSystems())
+  {
+    if (!system.preupdate && !system.update && !system.postupdate)
+      continue;
+
+    const size_t index = this->systemTimings.size();
+    if (system.preupdate)
+      this->preUpdateTimingIndex[system.preupdate] = index;
+    if (system.update)
+      this->updateTimingIndex[system.update] = index;
+    if (system.postupdate)
+      this->postUpdateTimingIndex[system.postupdate] = index;
+
+    SystemTimingWindows windows;
+    windows.name = system.name.empty() ?
+        "system_" + std::to_string(index) : system.name;
+    this->systemTimings.push_back(std::move(windows));
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::RecordSystemTiming(PhaseTimingWindow &_window,
+    PhaseAllocationTotals &_alloc,
+    const std::chrono::steady_clock::time_point &_start,
+    const memory_probe::AllocationCounters &_allocDelta)
+{
+  const double nanos = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - _start).count());
+
+  std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+  _window.Record(nanos);
+  _alloc.bytes += _allocDelta.bytes;
+  _alloc.allocs += _allocDelta.allocs;
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::PublishPerformanceMetrics()
+{
+  GZ_PROFILE("SimulationRunner::PublishPerformanceMetrics");
+
+  private_msgs::PerformanceMetrics msg;
+
+  auto simTimeSecNsec = math::durationToSecNsec(this->currentInfo.simTime);
+  msg.mutable_sim_time()->set_sec(simTimeSecNsec.first);
+  msg.mutable_sim_time()->set_nsec(simTimeSecNsec.second);
+  msg.set_iterations(this->currentInfo.iterations);
+  msg.set_real_time_factor(this->realTimeFactor);
+
+  // Report thread placement when pinning is configured, so operators can
+  // confirm that the requested affinity actually took effect.
+  if (this->steppingThreadPinned)
+  {
+    for (const auto cpu : this->serverConfig.SteppingThreadAffinity())
+      msg.add_stepping_thread_cpu(cpu);
+  }
+  for (const auto cpu : this->serverConfig.PostUpdateThreadAffinity())
+    msg.add_post_update_thread_cpu(cpu);
+
+  msg.set_entity_count(this->entityCompMgr.EntityCount());
+  uint64_t componentCount = 0u;
+  for (const auto &vertex : this->entityCompMgr.Entities().Vertices())
+    componentCount += this->entityCompMgr.ComponentTypes(vertex.first).size();
+  msg.set_component_count(componentCount);
+
+  auto fillPhase = [](const PhaseTimingWindow &_window,
+      private_msgs::PhaseTiming *_phase)
+  {
+    std::vector<double> samples(_window.samples.begin(),
+        _window.samples.begin() + _window.count);
+
+    double sum = 0.0;
+    double min = samples.front();
+    double max = samples.front();
+    for (const double sample : samples)
+    {
+      sum += sample;
+      min = std::min(min, sample);
+      max = std::max(max, sample);
+    }
+
+    const size_t p99Index = (samples.size() - 1) * 99 / 100;
+    std::nth_element(samples.begin(), samples.begin() + p99Index,
+        samples.end());
+
+    _phase->set_min(min);
+    _phase->set_mean(sum / static_cast<double>(samples.size()));
+    _phase->set_max(max);
+    _phase->set_p99(samples[p99Index]);
+    _phase->set_sample_count(samples.size());
+  };
+
+  auto fillAlloc = [](const PhaseAllocationTotals &_totals,
+      private_msgs::PhaseAllocation *_alloc)
+  {
+    _alloc->set_bytes(_totals.bytes);
+    _alloc->set_allocs(_totals.allocs);
+  };
+
+  const bool allocTelemetry = memory_probe::Enabled();
+
+  {
+    std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+    for (const auto &timing : this->systemTimings)
+    {
+      auto *systemMsg = msg.add_system();
+      systemMsg->set_name(timing.name);
+      if (timing.preUpdate.count > 0)
+        fillPhase(timing.preUpdate, systemMsg->mutable_pre_update());
+      if (timing.update.count > 0)
+        fillPhase(timing.update, systemMsg->mutable_update());
+      if (timing.postUpdate.count > 0)
+        fillPhase(timing.postUpdate, systemMsg->mutable_post_update());
+      if (allocTelemetry)
+      {
+        fillAlloc(timing.preUpdateAlloc, systemMsg->mutable_pre_update_alloc());
+        fillAlloc(timing.updateAlloc, systemMsg->mutable_update_alloc());
+        fillAlloc(timing.postUpdateAlloc,
+            systemMsg->mutable_post_update_alloc());
+      }
+    }
+
+    if (this->pacingWindow.count > 0)
+      fillPhase(this->pacingWindow, msg.mutable_pacing_error());
+  }
+
+  msg.set_spin_window(static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+      this->spinWindow).count()));
+
+  // The publisher throttles the actual rate.
+  this->perfPub.Publish(msg);
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::WriteProfileReport()
+{
+  std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+
+  const std::string csvPath = this->profileReportPath + ".csv";
+  std::ofstream csv(csvPath);
+  if (!csv)
+  {
+    gzerr << "Failed to open [" << csvPath << "] for the profile report."
+          << std::endl;
+    return;
+  }
+
+  const std::string foldedPath = this->profileReportPath + ".folded";
+  std::ofstream folded(foldedPath);
+  if (!folded)
+  {
+    gzerr << "Failed to open [" << foldedPath << "] for the profile report."
+          << std::endl;
+    return;
+  }
+
+  csv << "system,phase,samples,total_ms,mean_ms,min_ms,max_ms\n";
+
+  auto writePhase = [&csv, &folded, this](const std::string &_system,
+      const std::string &_phase, const PhaseTimingWindow &_window)
+  {
+    if (_window.totalCount == 0)
+      return;
+
+    csv << _system << ',' << _phase << ',' << _window.totalCount << ','
+        << _window.totalNanos * 1e-6 << ','
+        << _window.totalNanos * 1e-6 /
+           static_cast<double>(_window.totalCount) << ','
+        << _window.minNanos * 1e-6 << ','
+        << _window.maxNanos * 1e-6 << '\n';
+
+    // One collapsed stack per system and phase, weighted by the total time
+    // in nanoseconds, in the format consumed by flamegraph tools.
+    folded << this->worldName << ';' << _phase << ';' << _system << ' '
+           << static_cast<uint64_t>(_window.totalNanos) << '\n';
+  };
+
+  for (const auto &timing : this->systemTimings)
+  {
+    writePhase(timing.name, "PreUpdate", timing.preUpdate);
+    writePhase(timing.name, "Update", timing.update);
+    writePhase(timing.name, "PostUpdate", timing.postUpdate);
+  }
+
+  gzmsg << "Wrote profile report to [" << csvPath << "] and ["
+        << foldedPath << "]" << std::endl;
+}
+
 //////////////////////////////////////////////////
 void SimulationRunner::AddSystem(const SystemPluginPtr &_system,
       std::optional<Entity> _entity,
@@ -482,46 +857,35 @@ void SimulationRunner::ProcessSystemQueue()
   if (0 == pending)
     return;
 
-  // If additional systems are to be added, stop the existing threads.
+  // If additional systems are to be added, stop the existing workers.
   this->StopWorkerThreads();
 
   this->systemMgr->ActivatePendingSystems();
 
-  unsigned int threadCount =
-    static_cast<unsigned int>(this->systemMgr->SystemsPostUpdate().size() + 1u);
+  this->RebuildSystemTimings();
 
-  gzdbg << "Creating PostUpdate worker threads: "
-    << threadCount << std::endl;
+  auto systemCount = this->systemMgr->SystemsPostUpdate().size();
+  if (0 == systemCount)
+    return;
 
-  this->postUpdateStartBarrier = std::make_unique<Barrier>(threadCount);
-  this->postUpdateStopBarrier = std::make_unique<Barrier>(threadCount);
+  // One worker per PostUpdate system, bounded by the core budget. Short
+  // systems pack onto whichever worker frees up first, so fewer threads
+  // than systems doesn't serialize the long ones.
+  unsigned int coreCount = this->coreBudget != 0 ? this->coreBudget :
+      std::max(1u, std::thread::hardware_concurrency());
+  unsigned int threadCount = static_cast<unsigned int>(std::min(
+      systemCount, static_cast<size_t>(coreCount)));
 
-  this->postUpdateThreadsRunning = true;
-  int id = 0;
+  // Deterministic mode keeps a single ordered worker so PostUpdate
+  // systems publish in load order on every run.
+  if (this->deterministicMode)
+    threadCount = 1u;
 
-  for (auto &system : this->systemMgr->SystemsPostUpdate())
-  {
-    gzdbg << "Creating postupdate worker thread (" << id << ")" << std::endl;
+  gzdbg << "Creating PostUpdate worker pool with " << threadCount
+    << " threads" << std::endl;
 
-    this->postUpdateThreads.push_back(std::thread([&, id]()
-    {
-      std::stringstream ss;
-      ss << "PostUpdateThread: " << id;
-      GZ_PROFILE_THREAD_NAME(ss.str().c_str());
-      while (this->postUpdateThreadsRunning)
-      {
-        this->postUpdateStartBarrier->Wait();
-        if (this->postUpdateThreadsRunning)
-        {
-          system->PostUpdate(this->currentInfo, this->entityCompMgr);
-        }
-        this->postUpdateStopBarrier->Wait();
-      }
-      gzdbg << "Exiting postupdate worker thread ("
-        << id << ")" << std::endl;
-    }));
-    id++;
-  }
+  this->postUpdatePool = std::make_unique<TaskPool>(threadCount,
+      this->serverConfig.PostUpdateThreadAffinity());
 }
 
 /////////////////////////////////////////////////
@@ -537,33 +901,176 @@ void SimulationRunner::UpdateSystems()
   if (this->resetInitiated)
   {
     GZ_PROFILE("Reset");
+    // Make sure no pipelined PostUpdate batch is still reading the snapshot
+    // before systems are reset underneath it.
+    if (this->postUpdatePool)
+      this->postUpdatePool->Wait();
     this->systemMgr->Reset(this->currentInfo, this->entityCompMgr);
     return;
   }
 
+  // Sampling wall-clock durations costs a couple of clock reads and a brief
+  // lock per system, so only do it while the performance topic has
+  // subscribers or a profile report was requested for this run.
+  this->collectSystemTimings = !this->profileReportPath.empty() ||
+      (this->perfPub.Valid() && this->perfPub.HasConnections());
+
+  // Run one scheduled stage: a single-system stage runs inline, while the
+  // systems of a larger stage declared non-conflicting component usage and
+  // run concurrently.
+  auto runStage = [this](const auto &_stage, auto _updateFunc)
+  {
+    if (_stage.size() == 1u)
+    {
+      _updateFunc(_stage.front());
+      return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(_stage.size());
+    for (auto &system : _stage)
+    {
+      workers.push_back(std::thread([system, &_updateFunc]()
+          {
+            _updateFunc(system);
+          }));
+    }
+    for (auto &worker : workers)
+      worker.join();
+  };
+
   {
     GZ_PROFILE("PreUpdate");
-    for (auto& system : this->systemMgr->SystemsPreUpdate())
-      system->PreUpdate(this->currentInfo, this->entityCompMgr);
+    for (const auto &stage : this->systemMgr->PreUpdateStages())
+    {
+      runStage(stage, [this](ISystemPreUpdate *_system)
+          {
+            if (!this->collectSystemTimings)
+            {
+              _system->PreUpdate(this->currentInfo, this->entityCompMgr);
+              return;
+            }
+            const memory_probe::ScopedAllocationCounter probe;
+            const auto start = std::chrono::steady_clock::now();
+            _system->PreUpdate(this->currentInfo, this->entityCompMgr);
+            auto it = this->preUpdateTimingIndex.find(_system);
+            if (it != this->preUpdateTimingIndex.end())
+            {
+              this->RecordSystemTiming(
+                  this->systemTimings[it->second].preUpdate,
+                  this->systemTimings[it->second].preUpdateAlloc,
+                  start, probe.Delta());
+            }
+          });
+    }
   }
 
   {
     GZ_PROFILE("Update");
-    for (auto& system : this->systemMgr->SystemsUpdate())
-      system->Update(this->currentInfo, this->entityCompMgr);
+    for (const auto &stage : this->systemMgr->UpdateStages())
+    {
+      runStage(stage, [this](ISystemUpdate *_system)
+          {
+            if (!this->collectSystemTimings)
+            {
+              _system->Update(this->currentInfo, this->entityCompMgr);
+              return;
+            }
+            const memory_probe::ScopedAllocationCounter probe;
+            const auto start = std::chrono::steady_clock::now();
+            _system->Update(this->currentInfo, this->entityCompMgr);
+            auto it = this->updateTimingIndex.find(_system);
+            if (it != this->updateTimingIndex.end())
+            {
+              this->RecordSystemTiming(
+                  this->systemTimings[it->second].update,
+                  this->systemTimings[it->second].updateAlloc,
+                  start, probe.Delta());
+            }
+          });
+    }
   }
 
   {
     GZ_PROFILE("PostUpdate");
-    this->entityCompMgr.LockAddingEntitiesToViews(true);
     // If no systems implementing PostUpdate have been added, then
-    // the barriers will be uninitialized, so guard against that condition.
-    if (this->postUpdateStartBarrier && this->postUpdateStopBarrier)
+    // the pool will be uninitialized, so guard against that condition.
+    if (this->postUpdatePool && this->usePipelinedStepping)
+    {
+      // Under async stepping physics never blocks on consumers: if the
+      // previous batch is still draining, skip delivery for this step and
+      // let the states coalesce into the next snapshot the consumers get.
+      if (this->useAsyncStepping && !this->postUpdatePool->Idle())
+        return;
+
+      // Finish the previous step's PostUpdate batch before replacing the
+      // snapshot it reads from.
+      this->postUpdatePool->Wait();
+
+      {
+        GZ_PROFILE("PostUpdate snapshot");
+        this->postUpdateSnapshot.CopyFrom(this->entityCompMgr);
+      }
+      this->postUpdateSnapshot.LockAddingEntitiesToViews(true);
+
+      // Capture the update info and sampling flag by value: the main thread
+      // advances currentInfo and may toggle sampling while this batch is
+      // still running.
+      UpdateInfo info = this->currentInfo;
+      const bool sample = this->collectSystemTimings;
+      for (auto &system : this->systemMgr->SystemsPostUpdate())
+      {
+        this->postUpdatePool->Post([this, system, info, sample]()
+            {
+              if (!sample)
+              {
+                system->PostUpdate(info, this->postUpdateSnapshot);
+                return;
+              }
+              const memory_probe::ScopedAllocationCounter probe;
+              const auto start = std::chrono::steady_clock::now();
+              system->PostUpdate(info, this->postUpdateSnapshot);
+              auto it = this->postUpdateTimingIndex.find(system);
+              if (it != this->postUpdateTimingIndex.end())
+              {
+                this->RecordSystemTiming(
+                    this->systemTimings[it->second].postUpdate,
+                    this->systemTimings[it->second].postUpdateAlloc,
+                    start, probe.Delta());
+              }
+            });
+      }
+      // Deliberately do not wait here: the batch overlaps the next step's
+      // PreUpdate and Update, which only touch the live ECM.
+    }
+    else if (this->postUpdatePool)
     {
-      this->postUpdateStartBarrier->Wait();
-      this->postUpdateStopBarrier->Wait();
+      this->entityCompMgr.LockAddingEntitiesToViews(true);
+      for (auto &system : this->systemMgr->SystemsPostUpdate())
+      {
+        this->postUpdatePool->Post([this, system]()
+            {
+              if (!this->collectSystemTimings)
+              {
+                system->PostUpdate(this->currentInfo, this->entityCompMgr);
+                return;
+              }
+              const memory_probe::ScopedAllocationCounter probe;
+              const auto start = std::chrono::steady_clock::now();
+              system->PostUpdate(this->currentInfo, this->entityCompMgr);
+              auto it = this->postUpdateTimingIndex.find(system);
+              if (it != this->postUpdateTimingIndex.end())
+              {
+                this->RecordSystemTiming(
+                    this->systemTimings[it->second].postUpdate,
+                    this->systemTimings[it->second].postUpdateAlloc,
+                    start, probe.Delta());
+              }
+            });
+      }
+      this->postUpdatePool->Wait();
+      this->entityCompMgr.LockAddingEntitiesToViews(false);
     }
-    this->entityCompMgr.LockAddingEntitiesToViews(false);
   }
 }
 
@@ -578,25 +1085,14 @@ void SimulationRunner::OnStop()
 {
   this->stopReceived = true;
   this->running = false;
+  this->pauseCv.notify_all();
 }
 
 /////////////////////////////////////////////////
 void SimulationRunner::StopWorkerThreads()
 {
-  this->postUpdateThreadsRunning = false;
-  if (this->postUpdateStartBarrier)
-  {
-    this->postUpdateStartBarrier->Cancel();
-  }
-  if (this->postUpdateStopBarrier)
-  {
-    this->postUpdateStopBarrier->Cancel();
-  }
-  for (auto &thread : this->postUpdateThreads)
-  {
-    thread.join();
-  }
-  this->postUpdateThreads.clear();
+  // The pool destructor waits for pending tasks and joins the workers.
+  this->postUpdatePool.reset();
 }
 
 /////////////////////////////////////////////////
@@ -609,6 +1105,19 @@ bool SimulationRunner::Run(const uint64_t _iterations)
   // in the design.
   GZ_PROFILE_THREAD_NAME("SimulationRunner");
 
+  // Pin the stepping thread before any simulation work runs on it, so
+  // that physics and the PostUpdate pool can be kept on one NUMA node.
+  const auto &steppingCpus = this->serverConfig.SteppingThreadAffinity();
+  if (!steppingCpus.empty() && !this->steppingThreadPinned)
+  {
+    this->steppingThreadPinned = setThreadAffinity(steppingCpus);
+    if (!this->steppingThreadPinned)
+    {
+      gzwarn << "Failed to pin the stepping thread to the configured CPUs"
+             << std::endl;
+    }
+  }
+
   // Initialize network communications.
   if (this->networkMgr)
   {
@@ -655,6 +1164,16 @@ bool SimulationRunner::Run(const uint64_t _iterations)
         "stats", advertOpts);
   }
 
+  // Create the performance metrics publisher. Timings are only sampled and
+  // published while this topic has subscribers.
+  if (!this->perfPub.Valid())
+  {
+    transport::AdvertiseMessageOptions perfOpts;
+    perfOpts.SetMsgsPerSec(1);
+    this->perfPub = this->node->Advertise<private_msgs::PerformanceMetrics>(
+        "performance", perfOpts);
+  }
+
   if (!this->rootStatsPub.Valid())
   {
     // Check for the existence of other publishers on `/stats`
@@ -729,24 +1248,70 @@ bool SimulationRunner::Run(const uint64_t _iterations)
     // Update the step size and desired rtf
     this->UpdatePhysicsParams();
 
+    // While paused on a free-running server, block instead of stepping
+    // at the full update rate: each paused step runs every system just to
+    // conclude nothing changed. Control messages, unpause, stop and
+    // blocking paused steps wake the loop immediately; the timeout keeps
+    // the periodic paused work alive - world statistics and the scene
+    // broadcaster's paused state publishing - at a fraction of the update
+    // rate. Finite runs keep stepping at full rate, since the caller
+    // asked for that many iterations.
+    if (0u == _iterations && this->currentInfo.paused &&
+        !this->blockingPausedStepPending && !this->stepping)
+    {
+      GZ_PROFILE("PausedWait");
+      std::unique_lock<std::mutex> lock(this->msgBufferMutex);
+      if (this->worldControls.empty() &&
+          nullptr == this->newWorldControlState)
+      {
+        this->pauseCv.wait_for(lock, std::chrono::milliseconds(10));
+      }
+    }
+
     // Compute the time to sleep in order to match, as closely as possible,
-    // the update period.
+    // the update period. Batches run unthrottled.
     sleepTime = 0ns;
     actualSleep = 0ns;
 
-    sleepTime = std::max(0ns, this->prevUpdateRealTime +
-        this->updatePeriod - std::chrono::steady_clock::now() -
-        this->sleepOffset);
+    if (!this->batchStepping)
+    {
+      sleepTime = std::max(0ns, this->prevUpdateRealTime +
+          this->updatePeriod - std::chrono::steady_clock::now() -
+          this->sleepOffset);
+    }
 
     // Only sleep if needed.
     if (sleepTime > 0ns)
     {
       GZ_PROFILE("Sleep");
-      // Get the current time, sleep for the duration needed to match the
-      // updatePeriod, and then record the actual time slept.
+      // Get the current time, wait for the duration needed to match the
+      // updatePeriod, and then record the actual time waited.
       startTime = std::chrono::steady_clock::now();
-      std::this_thread::sleep_for(sleepTime);
+      if (this->spinWindow > 0ns)
+      {
+        // Hybrid pacing: a coarse sleep absorbs most of the wait without
+        // burning CPU, then a spin on the steady clock hits the deadline
+        // with sub-scheduler jitter.
+        const auto deadline = startTime + sleepTime;
+        if (sleepTime > this->spinWindow)
+          std::this_thread::sleep_for(sleepTime - this->spinWindow);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+        }
+      }
+      else
+      {
+        std::this_thread::sleep_for(sleepTime);
+      }
       actualSleep = std::chrono::steady_clock::now() - startTime;
+
+      if (this->collectSystemTimings)
+      {
+        std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+        this->pacingWindow.Record(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+            actualSleep - sleepTime).count()));
+      }
     }
 
     // Exponentially average out the difference between expected sleep time
@@ -775,6 +1340,12 @@ bool SimulationRunner::Run(const uint64_t _iterations)
           dynamic_cast<NetworkManagerPrimary *>(this->networkMgr.get());
       netPrimary->Step(this->currentInfo);
     }
+    else if (this->adaptiveStepEnabled)
+    {
+      startTime = std::chrono::steady_clock::now();
+      this->Step(this->currentInfo);
+      this->UpdateAdaptiveStep(std::chrono::steady_clock::now() - startTime);
+    }
     else
     {
       this->Step(this->currentInfo);
@@ -788,6 +1359,11 @@ bool SimulationRunner::Run(const uint64_t _iterations)
       this->blockingPausedStepPending = false;
     }
 
+    // Deliver the step results to the batch callback without leaving the
+    // stepping thread.
+    if (this->batchStepping && this->batchCallback)
+      this->batchCallback(this->currentInfo, this->entityCompMgr);
+
     this->resetInitiated = false;
   }
 
@@ -796,6 +1372,32 @@ bool SimulationRunner::Run(const uint64_t _iterations)
   return true;
 }
 
+/////////////////////////////////////////////////
+bool SimulationRunner::RunBatch(const uint64_t _iterations,
+    const BatchStepCallback &_cb)
+{
+  if (this->running)
+  {
+    gzwarn << "Unable to run a batch while the runner is already running."
+            << std::endl;
+    return false;
+  }
+
+  this->batchStepping = true;
+  this->batchCallback = _cb;
+
+  const bool wasPaused = this->currentInfo.paused;
+  this->SetPaused(false);
+
+  const bool result = this->Run(_iterations);
+
+  this->SetPaused(wasPaused);
+  this->batchCallback = nullptr;
+  this->batchStepping = false;
+
+  return result;
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::Step(const UpdateInfo &_info)
 {
@@ -829,6 +1431,14 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   // Update all the systems.
   this->UpdateSystems();
 
+  // Deliver events that were queued for coalesced delivery during the step.
+  this->eventMgr.ProcessQueuedEvents();
+
+  // Publish per-system timing telemetry. The publisher throttles the rate,
+  // and nothing is sampled without subscribers.
+  if (this->collectSystemTimings)
+    this->PublishPerformanceMetrics();
+
   if (!this->Paused() && this->requestedRunToSimTime &&
        this->requestedRunToSimTime.value() > this->simTimeEpoch &&
        this->currentInfo.simTime >= this->requestedRunToSimTime.value())
@@ -852,6 +1462,10 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   // Process world control messages.
   this->ProcessMessages();
 
+  // Build the packed lists for component change subscriptions from this
+  // step's change tracking, before it is cleared below.
+  this->entityCompMgr.UpdateComponentChangeSubscriptions();
+
   // Clear all new entities
   this->entityCompMgr.ClearNewlyCreatedEntities();
 
@@ -1051,6 +1665,12 @@ void SimulationRunner::SetUpdatePeriod(
   this->updatePeriod = _updatePeriod;
 }
 
+/////////////////////////////////////////////////
+void SimulationRunner::SetCoreBudget(unsigned int _cores)
+{
+  this->coreBudget = _cores;
+}
+
 /////////////////////////////////////////////////
 void SimulationRunner::SetPaused(const bool _paused)
 {
@@ -1070,6 +1690,15 @@ void SimulationRunner::SetPaused(const bool _paused)
 
   // Store the pause state
   this->currentInfo.paused = _paused;
+
+  if (!_paused)
+    this->pauseCv.notify_all();
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::RequestRewind()
+{
+  this->requestedRewind = true;
 }
 
 /////////////////////////////////////////////////
@@ -1154,6 +1783,7 @@ bool SimulationRunner::OnWorldControlState(const msgs::WorldControlState &_req,
   }
 
   this->worldControls.push_back(control);
+  this->pauseCv.notify_all();
 
   _res.set_data(true);
   return true;
@@ -1197,6 +1827,7 @@ bool SimulationRunner::OnPlaybackControl(const msgs::LogPlaybackControl &_req,
   }
 
   this->worldControls.push_back(control);
+  this->pauseCv.notify_all();
 
   _res.set_data(true);
   return true;
@@ -1452,8 +2083,19 @@ bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
   // TODO(addisu) This is not thread-safe. Wait until it is safe to access the
   // ECM.
   Entity world = this->entityCompMgr.EntityByComponents(components::World());
+
+  // The element cache is only valid for a fixed generator configuration, so
+  // drop it whenever the requested configuration changes.
+  std::string reqStr;
+  _req.SerializeToString(&reqStr);
+  if (reqStr != this->sdfGenCacheConfig)
+  {
+    this->sdfGenCache.entries.clear();
+    this->sdfGenCacheConfig = std::move(reqStr);
+  }
+
   std::optional<std::string> genString = sdf_generator::generateWorld(
-      this->entityCompMgr, world, this->fuelUriMap, _req);
+      this->entityCompMgr, world, this->sdfGenCache, this->fuelUriMap, _req);
   if (genString.has_value())
   {
     _res.set_data(*genString);
@@ -1462,6 +2104,97 @@ bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
   return false;
 }
 
+//////////////////////////////////////////////////
+void SimulationRunner::CopyStateFrom(const SimulationRunner &_other)
+{
+  this->entityCompMgr.CopyFrom(_other.entityCompMgr);
+  this->currentInfo = _other.currentInfo;
+
+  // Transfer the internal state of systems that opted into serialization.
+  // Both runners were created from the same world, so active systems pair
+  // up by position; skip the transfer if they don't.
+  const auto &srcSystems = _other.systemMgr->ActiveSystems();
+  const auto &dstSystems = this->systemMgr->ActiveSystems();
+  if (srcSystems.size() != dstSystems.size())
+  {
+    gzwarn << "Cannot copy system states: the runners have ["
+           << srcSystems.size() << "] and [" << dstSystems.size()
+           << "] active systems." << std::endl;
+    return;
+  }
+
+  for (size_t i = 0; i < srcSystems.size(); ++i)
+  {
+    if (nullptr == srcSystems[i].stateSerializable ||
+        nullptr == dstSystems[i].stateSerializable ||
+        srcSystems[i].name != dstSystems[i].name)
+    {
+      continue;
+    }
+    dstSystems[i].stateSerializable->DeserializeState(
+        srcSystems[i].stateSerializable->SerializeState());
+  }
+}
+
+//////////////////////////////////////////////////
+bool SimulationRunner::MemoryReport(msgs::StringMsg &_res)
+{
+  std::ostringstream report;
+
+  report << "Allocation totals per system and phase (bytes / allocs):\n";
+  if (!memory_probe::Enabled())
+  {
+    report << "  Allocation telemetry is disabled. Set "
+           << "GZ_SIM_ALLOC_TELEMETRY=1 to enable it.\n";
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lock(this->systemTimingsMutex);
+    for (const auto &timing : this->systemTimings)
+    {
+      report << "  " << timing.name << '\n';
+      if (timing.preUpdate.totalCount > 0)
+      {
+        report << "    PreUpdate: " << timing.preUpdateAlloc.bytes << " / "
+               << timing.preUpdateAlloc.allocs << '\n';
+      }
+      if (timing.update.totalCount > 0)
+      {
+        report << "    Update: " << timing.updateAlloc.bytes << " / "
+               << timing.updateAlloc.allocs << '\n';
+      }
+      if (timing.postUpdate.totalCount > 0)
+      {
+        report << "    PostUpdate: " << timing.postUpdateAlloc.bytes << " / "
+               << timing.postUpdateAlloc.allocs << '\n';
+      }
+    }
+  }
+
+  // Component counts per type across all entities. The ECM stores one
+  // instance per entity and type, so counts track storage growth.
+  // TODO(addisu) This is not thread-safe. Wait until it is safe to access
+  // the ECM.
+  std::map<ComponentTypeId, uint64_t> componentCounts;
+  for (const auto &vertex : this->entityCompMgr.Entities().Vertices())
+  {
+    for (const auto typeId : this->entityCompMgr.ComponentTypes(vertex.first))
+      ++componentCounts[typeId];
+  }
+
+  report << "Component instances per type:\n";
+  for (const auto &[typeId, count] : componentCounts)
+  {
+    std::string name = components::Factory::Instance()->Name(typeId);
+    if (name.empty())
+      name = std::to_string(typeId);
+    report << "  " << name << ": " << count << '\n';
+  }
+
+  _res.set_data(report.str());
+  return true;
+}
+
 //////////////////////////////////////////////////
 void SimulationRunner::SetFuelUriMap(
     const std::unordered_map<std::string, std::string> &_map)
@@ -1486,4 +2219,6 @@ bool SimulationRunner::NextStepIsBlockingPaused() const
 void SimulationRunner::SetNextStepAsBlockingPaused(const bool value)
 {
   this->blockingPausedStepPending = value;
+  if (value)
+    this->pauseCv.notify_all();
 }
@@ -25,11 +25,15 @@
 #include <gz/msgs/world_control.pb.h>
 #include <gz/msgs/world_control_state.pb.h>
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -56,8 +60,10 @@
 
 #include "network/NetworkManager.hh"
 #include "LevelManager.hh"
+#include "MemoryProbe.hh"
+#include "SdfGenerator.hh"
 #include "SystemManager.hh"
-#include "Barrier.hh"
+#include "TaskPool.hh"
 #include "WorldControl.hh"
 
 using namespace std::chrono_literals;
@@ -98,6 +104,17 @@ namespace gz
       /// \return True if the operation completed successfully.
       public: bool Run(const uint64_t _iterations);
 
+      /// \brief Run a fixed number of steps back to back on the calling
+      /// thread, without throttling to the update period. Simulation is
+      /// unpaused for the duration of the batch and restored to its
+      /// previous pause state afterwards.
+      /// \param[in] _iterations Number of iterations.
+      /// \param[in] _cb Optional callback invoked after every step with
+      /// read access to the entity component manager.
+      /// \return True if the operation completed successfully.
+      public: bool RunBatch(const uint64_t _iterations,
+                  const BatchStepCallback &_cb);
+
       /// \brief Perform a simulation step:
       /// * Publish stats and process control messages
       /// * Update levels and systems
@@ -139,6 +156,11 @@ namespace gz
       /// \brief Publish current world statistics.
       public: void PublishStats();
 
+      /// \brief Publish per-system timing statistics, entity and component
+      /// counts, and the real time factor on the `performance` topic. Only
+      /// called while the topic has subscribers.
+      public: void PublishPerformanceMetrics();
+
       /// \brief Load system plugin for a given entity.
       /// \param[in] _entity The plugins will be associated with this Entity
       /// \param[in] _plugin SDF Plugin to load
@@ -192,6 +214,13 @@ namespace gz
       public: void SetUpdatePeriod(
                   const std::chrono::steady_clock::duration &_updatePeriod);
 
+      /// \brief Set the number of cores this runner may use for its worker
+      /// threads. When several worlds run in one process, the server
+      /// splits the machine's cores across the runners so they don't
+      /// oversubscribe each other.
+      /// \param[in] _cores Core budget, zero to use all available cores.
+      public: void SetCoreBudget(unsigned int _cores);
+
       /// \brief Get the simulation epoch.
       /// \return The simulation epoch.
       public: const std::chrono::steady_clock::duration &SimTimeEpoch() const;
@@ -208,6 +237,11 @@ namespace gz
       /// \return True if the simulation runner is paused, false otherwise.
       public: bool Paused() const;
 
+      /// \brief Request that the world be rewound to its initial state on
+      /// the next step, using the snapshot retained at load time. This is
+      /// the same mechanism the world control reset service uses.
+      public: void RequestRewind();
+
       /// \brief Set if the simulation runner is stepping based on WorldControl
       /// info
       /// \param[in] _step True if stepping based on WorldControl info, false
@@ -350,6 +384,23 @@ namespace gz
       public: bool GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
                                     msgs::StringMsg &_res);
 
+      /// \brief Copy the simulation state of another runner into this one:
+      /// the full ECM, the current update info, and the internal state of
+      /// systems implementing ISystemStateSerializable. Both runners must
+      /// have been created from the same world so that their systems pair
+      /// up one to one.
+      /// \param[in] _other Runner to copy from.
+      public: void CopyStateFrom(const SimulationRunner &_other);
+
+      /// \brief Generate a plain-text memory report with per-system
+      /// allocation totals and per-component-type storage counts. Service
+      /// callback for `/world/<name>/memory_report`. Allocation totals are
+      /// all zero unless allocation telemetry is enabled; see
+      /// GZ_SIM_ALLOC_TELEMETRY.
+      /// \param[out] _res Report text.
+      /// \return True if successful.
+      public: bool MemoryReport(msgs::StringMsg &_res);
+
       /// \brief Sets the file path to fuel URI map.
       /// \param[in] _map A populated map of file paths to fuel URIs.
       public: void SetFuelUriMap(
@@ -373,6 +424,15 @@ namespace gz
       /// Physics component of the world, if any.
       public: void UpdatePhysicsParams();
 
+      /// \brief Feed one step's measured wall cost to the adaptive step
+      /// governor, which hill-climbs the step size within the configured
+      /// bounds to minimize wall time per simulated second. Only called
+      /// when the governor is enabled.
+      /// \param[in] _stepCost Wall time spent on the step that just ran.
+      /// \sa adaptiveStepEnabled
+      private: void UpdateAdaptiveStep(
+                  const std::chrono::steady_clock::duration &_stepCost);
+
       /// \brief Process entities with the components::Recreate component.
       /// Put in a request to make them as removed
       private: void ProcessRecreateEntitiesRemove();
@@ -416,6 +476,27 @@ namespace gz
       /// initial entity creation/world load.
       private: EntityComponentManager initialEntityCompMgr;
 
+      /// \brief Whether PostUpdate runs pipelined with the next step.
+      /// \sa ServerConfig::SetUsePipelinedStepping
+      private: bool usePipelinedStepping{false};
+
+      /// \brief Whether stepping never blocks on PostUpdate consumers,
+      /// coalescing states they are too slow to drain. Implies
+      /// usePipelinedStepping.
+      /// \sa ServerConfig::SetUseAsyncStepping
+      private: bool useAsyncStepping{false};
+
+      /// \brief Whether reruns of the same world must be bit-identical.
+      /// Forces a single ordered PostUpdate worker and disables the
+      /// timing-sensitive stepping modes.
+      /// \sa ServerConfig::SetUseDeterministicMode
+      private: bool deterministicMode{false};
+
+      /// \brief Snapshot of the world state PostUpdate systems read while
+      /// the next step's PreUpdate/Update run against the live state. Only
+      /// used when usePipelinedStepping is true.
+      private: EntityComponentManager postUpdateSnapshot;
+
       /// \brief Manager of all levels.
       private: std::unique_ptr<LevelManager> levelMgr;
 
@@ -468,6 +549,37 @@ namespace gz
       /// \brief Desired real time factor
       private: double desiredRtf{1.0};
 
+      /// \brief True when the adaptive step governor is active. Enabled
+      /// from an <adaptive_step> child of the world's <physics> element
+      /// when the desired real time factor is unconstrained (0), and
+      /// disabled again as soon as the user commands explicit physics
+      /// parameters at runtime.
+      private: bool adaptiveStepEnabled{false};
+
+      /// \brief Lower bound for the adaptive step size: the step size the
+      /// world configured in <max_step_size>.
+      private: std::chrono::steady_clock::duration adaptiveStepMin{1ms};
+
+      /// \brief Upper bound for the adaptive step size, from
+      /// <adaptive_step><max_step_size>. This is the user's declared
+      /// stability limit; the governor never steps past it.
+      private: std::chrono::steady_clock::duration adaptiveStepMax{1ms};
+
+      /// \brief Accumulated wall cost of the steps in the current
+      /// measurement window.
+      private: std::chrono::steady_clock::duration adaptiveWindowCost{0};
+
+      /// \brief Number of steps accumulated in the current window.
+      private: unsigned int adaptiveWindowSteps{0};
+
+      /// \brief Wall seconds per simulated second measured over the
+      /// previous window. Zero until the first window completes.
+      private: double adaptivePrevCost{0.0};
+
+      /// \brief Direction of the next step-size adjustment: positive
+      /// grows the step, negative shrinks it.
+      private: int adaptiveStepDirection{1};
+
       /// \brief Connection to the pause event.
       private: gz::common::ConnectionPtr pauseConn;
 
@@ -508,30 +620,193 @@ namespace gz
       /// \brief Mutex to protect message buffers.
       private: std::mutex msgBufferMutex;
 
+      /// \brief Wakes the run loop out of its paused wait. Notified when
+      /// a world control message arrives, the runner is unpaused or
+      /// stopped, or a blocking paused step is requested. Used with
+      /// msgBufferMutex.
+      private: std::condition_variable pauseCv;
+
       /// \brief Keep the latest GUI message.
       public: msgs::GUI guiMsg;
 
       /// \brief Copy of the server configuration.
       public: ServerConfig serverConfig;
 
-      /// \brief Collection of threads running system PostUpdates
-      private: std::vector<std::thread> postUpdateThreads;
-
-      /// \brief Flag to indicate running status of PostUpdate threads
-      private: std::atomic<bool> postUpdateThreadsRunning{false};
-
-      /// \brief Barrier to signal beginning of PostUpdate thread execution
-      private: std::unique_ptr<Barrier> postUpdateStartBarrier;
-
-      /// \brief Barrier to signal end of PostUpdate thread execution
-      private: std::unique_ptr<Barrier> postUpdateStopBarrier;
+      /// \brief Worker pool running system PostUpdates. One task is posted
+      /// per PostUpdate system each step, so the thread count is bounded by
+      /// the core count instead of the system count and short systems pack
+      /// onto whichever worker frees up first.
+      private: std::unique_ptr<TaskPool> postUpdatePool;
+
+      /// \brief Number of cores this runner may use for its worker
+      /// threads, zero for all available ones. See SetCoreBudget.
+      private: unsigned int coreBudget{0};
+
+      /// \brief Whether the stepping thread was successfully pinned to
+      /// the CPUs configured through
+      /// ServerConfig::SetSteppingThreadAffinity. Reported on the
+      /// performance topic.
+      private: bool steppingThreadPinned{false};
+
+      /// \brief Rolling window of wall-clock durations, in nanoseconds, for
+      /// one system update phase.
+      private: struct PhaseTimingWindow
+      {
+        /// \brief Record one duration sample, overwriting the oldest sample
+        /// once the window is full.
+        /// \param[in] _nanos Duration in nanoseconds.
+        public: void Record(double _nanos);
+
+        /// \brief Number of samples kept per phase.
+        public: static constexpr size_t kWindowSize{256};
+
+        /// \brief Sample storage, used as a circular buffer.
+        public: std::array<double, kWindowSize> samples;
+
+        /// \brief Number of valid samples in the window.
+        public: size_t count{0};
+
+        /// \brief Index the next sample will be written to.
+        public: size_t next{0};
+
+        /// \brief Sum of all samples ever recorded, in nanoseconds. Unlike
+        /// the window, the running totals cover the whole run and feed the
+        /// profile report.
+        public: double totalNanos{0.0};
+
+        /// \brief Number of samples ever recorded.
+        public: uint64_t totalCount{0};
+
+        /// \brief Smallest sample ever recorded, in nanoseconds.
+        public: double minNanos{std::numeric_limits<double>::max()};
+
+        /// \brief Largest sample ever recorded, in nanoseconds.
+        public: double maxNanos{0.0};
+      };
+
+      /// \brief Run-cumulative heap allocation counters for one system
+      /// update phase. Only grows while allocation telemetry is enabled.
+      private: struct PhaseAllocationTotals
+      {
+        /// \brief Total bytes requested from operator new.
+        public: uint64_t bytes{0};
+
+        /// \brief Number of calls to operator new.
+        public: uint64_t allocs{0};
+      };
+
+      /// \brief Timing windows for one system across all update phases.
+      private: struct SystemTimingWindows
+      {
+        /// \brief Plugin name of the system, or a generated placeholder for
+        /// systems added in-memory without a plugin.
+        public: std::string name;
+
+        /// \brief PreUpdate phase window.
+        public: PhaseTimingWindow preUpdate;
+
+        /// \brief Update phase window.
+        public: PhaseTimingWindow update;
+
+        /// \brief PostUpdate phase window.
+        public: PhaseTimingWindow postUpdate;
+
+        /// \brief PreUpdate phase allocation totals.
+        public: PhaseAllocationTotals preUpdateAlloc;
+
+        /// \brief Update phase allocation totals.
+        public: PhaseAllocationTotals updateAlloc;
+
+        /// \brief PostUpdate phase allocation totals.
+        public: PhaseAllocationTotals postUpdateAlloc;
+      };
+
+      /// \brief Rebuild the timing windows after the set of active systems
+      /// changed.
+      private: void RebuildSystemTimings();
+
+      /// \brief Record a wall-clock sample and the allocation delta for one
+      /// system update phase.
+      /// \param[in] _window Window to record into.
+      /// \param[in] _alloc Allocation totals to add to.
+      /// \param[in] _start Time point taken just before the system ran.
+      /// \param[in] _allocDelta Allocations the system made; all zero
+      /// unless allocation telemetry is enabled.
+      private: void RecordSystemTiming(PhaseTimingWindow &_window,
+                   PhaseAllocationTotals &_alloc,
+                   const std::chrono::steady_clock::time_point &_start,
+                   const memory_probe::AllocationCounters &_allocDelta);
+
+      /// \brief Timing windows for all systems with at least one update
+      /// phase, in the order systems were activated.
+      private: std::vector<SystemTimingWindows> systemTimings;
+
+      /// \brief Index into systemTimings keyed by PreUpdate interface.
+      private: std::unordered_map<ISystemPreUpdate *, size_t>
+          preUpdateTimingIndex;
+
+      /// \brief Index into systemTimings keyed by Update interface.
+      private: std::unordered_map<ISystemUpdate *, size_t> updateTimingIndex;
+
+      /// \brief Index into systemTimings keyed by PostUpdate interface.
+      private: std::unordered_map<ISystemPostUpdate *, size_t>
+          postUpdateTimingIndex;
+
+      /// \brief Protects the timing windows. Systems of a concurrent stage
+      /// and pipelined PostUpdate batches record samples from worker
+      /// threads, and the windows are only touched while the performance
+      /// topic has subscribers, so contention is negligible.
+      private: std::mutex systemTimingsMutex;
+
+      /// \brief Whether the current step samples system timings. Set at the
+      /// start of UpdateSystems based on performance topic subscribers.
+      private: bool collectSystemTimings{false};
+
+      /// \brief Wakeup jitter of the rate-limiting wait: actual minus
+      /// requested wait duration per step. Guarded by systemTimingsMutex.
+      private: PhaseTimingWindow pacingWindow;
+
+      /// \brief Spin window of the step pacing clock. When non-zero, the
+      /// rate-limiting wait coarse-sleeps until this long before the step
+      /// deadline and spins on the steady clock for the remainder. See
+      /// ServerConfig::SetSpinWindow.
+      private: std::chrono::steady_clock::duration spinWindow{0};
+
+      /// \brief Write the per-system profile report files. See
+      /// profileReportPath.
+      private: void WriteProfileReport();
+
+      /// \brief Prefix of the profile report files written when the runner
+      /// is destroyed, read from GZ_SIM_PROFILE_REPORT. <prefix>.csv holds
+      /// per-system per-phase statistics and <prefix>.folded holds
+      /// collapsed stacks for flamegraph tools. Empty disables the report;
+      /// non-empty forces timing collection on every step.
+      private: std::string profileReportPath;
+
+      /// \brief Performance metrics publisher.
+      private: gz::transport::Node::Publisher perfPub;
 
       /// \brief Map from file paths to Fuel URIs.
       private: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Cache of generated model elements, reused across calls to
+      /// GenerateWorldSdf so that unchanged models are not regenerated.
+      private: sdf_generator::ModelElementCache sdfGenCache;
+
+      /// \brief Serialized generator configuration that sdfGenCache was
+      /// filled with. The cache is cleared when the configuration changes.
+      private: std::string sdfGenCacheConfig;
+
       /// \brief True if Server::RunOnce triggered a blocking paused step
       private: bool blockingPausedStepPending{false};
 
+      /// \brief True while RunBatch is executing. Disables update period
+      /// throttling and enables the batch callback.
+      private: bool batchStepping{false};
+
+      /// \brief Callback invoked after every step while running a batch.
+      private: BatchStepCallback batchCallback;
+
       /// \brief Whether the simulation runner is currently stepping based on
       /// WorldControl info (true) or not (false)
       private: bool stepping{false};
@@ -18,6 +18,13 @@
 #include <gtest/gtest.h>
 #include <tinyxml2.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
 #include <gz/transport/Node.hh>
@@ -59,6 +66,7 @@
 #include "gz/sim/config.hh"
 
 #include "../test/helpers/EnvTestFixture.hh"
+#include "msgs/performance_metrics.pb.h"
 #include "SimulationRunner.hh"
 
 using namespace gz;
@@ -1666,6 +1674,189 @@ TEST_P(SimulationRunnerTest, GeneratedSdfHasNoSpuriousPlugins)
   EXPECT_TRUE(checkForSpuriousPlugins(newRoot.Element()));
 }
 
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, PipelinedStepping)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // System that counts PostUpdate calls and verifies that the snapshot it
+  // receives is populated.
+  class CountingSystem : public System, public ISystemPostUpdate
+  {
+    public: void PostUpdate(const UpdateInfo &_info,
+                const EntityComponentManager &_ecm) override
+            {
+              if (_ecm.EntityCount() > 0)
+                this->count++;
+              this->lastIteration = _info.iterations;
+            }
+
+    public: std::atomic<uint64_t> count{0};
+    public: std::atomic<uint64_t> lastIteration{0};
+  };
+
+  auto system = std::make_shared<CountingSystem>();
+
+  ServerConfig config;
+  config.SetUsePipelinedStepping(true);
+
+  // Create simulation runner in a scope so that its destructor flushes the
+  // last in-flight PostUpdate batch before the checks below.
+  {
+    auto systemLoader = std::make_shared<SystemLoader>();
+    SimulationRunner runner(root.WorldByIndex(0), systemLoader, config);
+    runner.AddSystem(system);
+
+    runner.SetPaused(false);
+    EXPECT_TRUE(runner.Run(50));
+    EXPECT_EQ(50u, runner.CurrentInfo().iterations);
+  }
+
+  // Every step must have produced exactly one PostUpdate on a populated
+  // snapshot, and the last batch carried the final iteration count.
+  EXPECT_EQ(50u, system->count);
+  EXPECT_EQ(50u, system->lastIteration);
+}
+
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, AsyncStepping)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Slow consumer: each PostUpdate outlasts several steps, so under async
+  // stepping most states must be coalesced away instead of blocking the
+  // run loop.
+  class SlowSystem : public System, public ISystemPostUpdate
+  {
+    public: void PostUpdate(const UpdateInfo &_info,
+                const EntityComponentManager &_ecm) override
+            {
+              if (_ecm.EntityCount() > 0)
+                this->count++;
+              this->lastIteration = _info.iterations;
+              std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+
+    public: std::atomic<uint64_t> count{0};
+    public: std::atomic<uint64_t> lastIteration{0};
+  };
+
+  auto system = std::make_shared<SlowSystem>();
+
+  ServerConfig config;
+  config.SetUseAsyncStepping(true);
+
+  // Create simulation runner in a scope so that its destructor flushes the
+  // last in-flight PostUpdate batch before the checks below.
+  {
+    auto systemLoader = std::make_shared<SystemLoader>();
+    SimulationRunner runner(root.WorldByIndex(0), systemLoader, config);
+    runner.AddSystem(system);
+
+    runner.SetPaused(false);
+    EXPECT_TRUE(runner.Run(50));
+    EXPECT_EQ(50u, runner.CurrentInfo().iterations);
+  }
+
+  // The slow consumer saw at least one populated snapshot but fewer than
+  // one per step, and never an iteration count past the final step.
+  EXPECT_GE(system->count, 1u);
+  EXPECT_LT(system->count, 50u);
+  EXPECT_LE(system->lastIteration, 50u);
+}
+
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, PerformanceMetrics)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create simulation runner
+  auto systemLoader = std::make_shared<SystemLoader>();
+  SimulationRunner runner(root.WorldByIndex(0), systemLoader);
+
+  // System with PreUpdate and PostUpdate phases so that both get timed.
+  class TimedSystem : public System,
+                      public ISystemPreUpdate,
+                      public ISystemPostUpdate
+  {
+    public: void PreUpdate(const UpdateInfo &,
+                EntityComponentManager &) override
+            {
+            }
+
+    public: void PostUpdate(const UpdateInfo &,
+                const EntityComponentManager &) override
+            {
+            }
+  };
+  runner.AddSystem(std::make_shared<TimedSystem>());
+
+  std::mutex msgMutex;
+  std::vector<private_msgs::PerformanceMetrics> perfMsgs;
+  std::function<void(const private_msgs::PerformanceMetrics &)> cb =
+      [&](const private_msgs::PerformanceMetrics &_msg)
+      {
+        std::lock_guard<std::mutex> lock(msgMutex);
+        perfMsgs.push_back(_msg);
+      };
+
+  transport::Node node;
+  EXPECT_TRUE(node.Subscribe("/world/default/performance", cb));
+
+  // Timings are only sampled once the subscription is discovered, so step
+  // in chunks until a message arrives.
+  runner.SetPaused(false);
+  for (int sleep = 0; sleep < 30; ++sleep)
+  {
+    EXPECT_TRUE(runner.Run(100));
+    {
+      std::lock_guard<std::mutex> lock(msgMutex);
+      if (!perfMsgs.empty())
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  std::lock_guard<std::mutex> lock(msgMutex);
+  ASSERT_FALSE(perfMsgs.empty());
+
+  const auto &msg = perfMsgs.back();
+  EXPECT_GT(msg.iterations(), 0u);
+  EXPECT_GT(msg.entity_count(), 0u);
+  EXPECT_GT(msg.component_count(), msg.entity_count());
+
+  ASSERT_EQ(1, msg.system_size());
+  const auto &system = msg.system(0);
+  EXPECT_EQ("system_0", system.name());
+
+  // The system implements PreUpdate and PostUpdate, but not Update.
+  EXPECT_TRUE(system.has_pre_update());
+  EXPECT_FALSE(system.has_update());
+  EXPECT_TRUE(system.has_post_update());
+
+  EXPECT_GT(system.pre_update().sample_count(), 0u);
+  EXPECT_GT(system.pre_update().min(), 0.0);
+  EXPECT_LE(system.pre_update().min(), system.pre_update().mean());
+  EXPECT_LE(system.pre_update().mean(), system.pre_update().max());
+  EXPECT_LE(system.pre_update().p99(), system.pre_update().max());
+  EXPECT_GT(system.post_update().sample_count(), 0u);
+}
+
 // Run multiple times. We want to make sure that static globals don't cause
 // problems.
 INSTANTIATE_TEST_SUITE_P(ServerRepeat, SimulationRunnerTest,
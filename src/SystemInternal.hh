@@ -46,12 +46,18 @@ namespace gz
               : systemPlugin(std::move(_systemPlugin)),
                 system(systemPlugin->QueryInterface<System>()),
                 configure(systemPlugin->QueryInterface<ISystemConfigure>()),
+                configureCached(
+                  systemPlugin->QueryInterface<ISystemConfigureCached>()),
                 configureParameters(
                   systemPlugin->QueryInterface<ISystemConfigureParameters>()),
                 reset(systemPlugin->QueryInterface<ISystemReset>()),
+                stateSerializable(
+                  systemPlugin->QueryInterface<ISystemStateSerializable>()),
                 preupdate(systemPlugin->QueryInterface<ISystemPreUpdate>()),
                 update(systemPlugin->QueryInterface<ISystemUpdate>()),
                 postupdate(systemPlugin->QueryInterface<ISystemPostUpdate>()),
+                componentUsage(
+                  systemPlugin->QueryInterface<ISystemComponentUsage>()),
                 parentEntity(_entity)
       {
       }
@@ -64,12 +70,18 @@ namespace gz
               : systemShared(_system),
                 system(_system.get()),
                 configure(dynamic_cast<ISystemConfigure *>(_system.get())),
+                configureCached(
+                  dynamic_cast<ISystemConfigureCached *>(_system.get())),
                 configureParameters(
                   dynamic_cast<ISystemConfigureParameters *>(_system.get())),
                 reset(dynamic_cast<ISystemReset *>(_system.get())),
+                stateSerializable(
+                  dynamic_cast<ISystemStateSerializable *>(_system.get())),
                 preupdate(dynamic_cast<ISystemPreUpdate *>(_system.get())),
                 update(dynamic_cast<ISystemUpdate *>(_system.get())),
                 postupdate(dynamic_cast<ISystemPostUpdate *>(_system.get())),
+                componentUsage(
+                  dynamic_cast<ISystemComponentUsage *>(_system.get())),
                 parentEntity(_entity)
       {
       }
@@ -90,6 +102,10 @@ namespace gz
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemConfigure *configure = nullptr;
 
+      /// \brief Access this system via the ISystemConfigureCached interface
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemConfigureCached *configureCached = nullptr;
+
       /// \brief Access this system via the ISystemConfigureParameters
       ///   interface.
       /// Will be nullptr if the System doesn't implement this interface.
@@ -99,6 +115,11 @@ namespace gz
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemReset *reset = nullptr;
 
+      /// \brief Access this system via the ISystemStateSerializable
+      ///   interface.
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemStateSerializable *stateSerializable = nullptr;
+
       /// \brief Access this system via the ISystemPreUpdate interface
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemPreUpdate *preupdate = nullptr;
@@ -111,6 +132,10 @@ namespace gz
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemPostUpdate *postupdate = nullptr;
 
+      /// \brief Access this system via the ISystemComponentUsage interface
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemComponentUsage *componentUsage = nullptr;
+
       /// \brief Entity that the system is attached to. It's passed to the
       /// system during the `Configure` call.
       public: Entity parentEntity = {kNullEntity};
@@ -15,9 +15,13 @@
  *
 */
 
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <gz/sim/SystemLoader.hh>
@@ -35,8 +39,60 @@
 #include "gz/sim/InstallationDirectories.hh"
 #include <gz/sim/config.hh>
 
+#include "DiscoveryCache.hh"
+
 using namespace gz::sim;
 
+namespace
+{
+//////////////////////////////////////////////////
+/// \brief Mutex guarding the process-wide plugin loader and index.
+std::mutex &LoaderMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+//////////////////////////////////////////////////
+/// \brief Process-wide plugin loader, shared by every SystemLoader so that
+/// a library stays resident once loaded and repeat loads of the same
+/// system reuse the existing handle instead of scanning and dlopening
+/// again. This matters for test fixtures that create many servers in one
+/// process. Guard access with LoaderMutex().
+gz::plugin::Loader &SharedLoader()
+{
+  static gz::plugin::Loader loader;
+  return loader;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the install-time plugin index, which maps plugin library
+/// names to the library files in the installed plugin directory. The index
+/// is read once per process; the map is empty if no index was installed.
+const std::unordered_map<std::string, std::string> &PluginIndex()
+{
+  static std::unordered_map<std::string, std::string> index;
+  static bool loaded{false};
+
+  std::lock_guard<std::mutex> lock(LoaderMutex());
+  if (loaded)
+    return index;
+  loaded = true;
+
+  std::ifstream indexFile(common::joinPaths(
+      gz::sim::getPluginInstallDir(), "plugins.index"));
+  std::string line;
+  while (std::getline(indexFile, line))
+  {
+    auto sep = line.find(':');
+    if (sep == std::string::npos || 0 == sep)
+      continue;
+    index[line.substr(0, sep)] = line.substr(sep + 1);
+  }
+  return index;
+}
+}  // namespace
+
 class gz::sim::SystemLoaderPrivate
 {
   //////////////////////////////////////////////////
@@ -65,6 +121,51 @@ class gz::sim::SystemLoaderPrivate
     return systemPaths.PluginPaths();
   }
 
+  //////////////////////////////////////////////////
+  /// \brief Get the per-user resolved-path cache, created on first use so
+  /// that its environment signature reflects plugin paths added through
+  /// AddSystemPluginPath.
+  public: DiscoveryCache &DiskCache()
+  {
+    if (!this->diskCache)
+    {
+      // Everything the scans below depend on: the search path variables,
+      // the library version, and what the search directories contain.
+      // The directory signatures stand in for mtime checks and catch
+      // libraries being added to or removed from an unchanged path set.
+      std::string environment;
+      std::string value;
+      common::env(this->pluginPathEnv, value);
+      environment += value + '\n';
+      value.clear();
+      common::env(this->pluginPathEnvDeprecated, value);
+      environment += value + '\n';
+      environment += GZ_SIM_VERSION_FULL;
+      environment += '\n';
+      environment += DiscoveryCache::DirectorySignature(this->PluginPaths());
+      this->diskCache = std::make_unique<DiscoveryCache>(
+          "plugin_paths", environment);
+    }
+    return *this->diskCache;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Look up a plugin library name in the install-time index.
+  /// \param[in] _filename Library name as requested in the SDF plugin.
+  /// \return Full path to the installed library, or an empty string if the
+  /// index has no usable entry for the name.
+  public: std::string IndexedLibraryPath(const std::string &_filename) const
+  {
+    const auto &index = PluginIndex();
+    auto it = index.find(_filename);
+    if (it == index.end())
+      return std::string();
+
+    std::string path = common::joinPaths(
+        gz::sim::getPluginInstallDir(), it->second);
+    return common::exists(path) ? path : std::string();
+  }
+
   //////////////////////////////////////////////////
   public: bool InstantiateSystemPlugin(const sdf::Plugin &_sdfPlugin,
               gz::plugin::PluginPtr &_gzPlugin)
@@ -80,14 +181,53 @@ class gz::sim::SystemLoaderPrivate
              << "]. Using [" << filename << "] instead." << std::endl;
     }
 
-    std::list<std::string> paths = this->PluginPaths();
-    common::SystemPaths systemPaths;
-    for (const auto &p : paths)
+    // Previously resolved library paths are cached so that repeat loads of
+    // the same system skip the directory scans below.
+    std::string pathToLib;
+    auto cachedPath = this->resolvedPaths.find(filename);
+    if (cachedPath != this->resolvedPaths.end())
+      pathToLib = cachedPath->second;
+
+    // The per-user cache carries resolutions across processes, so
+    // short-lived servers skip the directory scans below entirely.
+    if (pathToLib.empty())
+      pathToLib = this->DiskCache().Lookup(filename);
+
+    if (pathToLib.empty())
     {
-      systemPaths.AddPluginPaths(p);
+      // User-provided plugin paths take precedence over the install-time
+      // index and the installed plugin directory.
+      common::SystemPaths userPaths;
+      userPaths.SetPluginPathEnv(this->pluginPathEnv);
+
+      for (const std::string &path : this->systemPluginPaths)
+        userPaths.AddPluginPaths(path);
+
+      std::string homePath;
+      common::env(GZ_HOMEDIR, homePath);
+      userPaths.AddPluginPaths(common::joinPaths(
+          homePath, ".gz", "sim", "plugins"));
+
+      // TODO(CH3): Deprecated. Remove on tock.
+      userPaths.AddPluginPaths(homePath + "/.ignition/gazebo/plugins");
+
+      pathToLib = userPaths.FindSharedLibrary(filename);
+    }
+
+    // The install-time index maps plugin library names straight to the
+    // installed libraries, which skips scanning the plugin directory.
+    if (pathToLib.empty())
+      pathToLib = this->IndexedLibraryPath(filename);
+
+    // Fall back to scanning the installed plugin directory, which also
+    // covers libraries that aren't listed in the index.
+    if (pathToLib.empty())
+    {
+      common::SystemPaths installPaths;
+      installPaths.AddPluginPaths(gz::sim::getPluginInstallDir());
+      pathToLib = installPaths.FindSharedLibrary(filename);
     }
 
-    auto pathToLib = systemPaths.FindSharedLibrary(filename);
     if (pathToLib.empty())
     {
       // Try deprecated environment variable
@@ -108,7 +248,7 @@ class gz::sim::SystemLoaderPrivate
              << "- Requested library name: [" << _sdfPlugin.Filename() << "]\n"
              << "- Library search paths:\n";
 
-          for (const auto &path : systemPaths.PluginPaths())
+          for (const auto &path : this->PluginPaths())
           {
             ss << "  - " << path << "\n";
           }
@@ -129,6 +269,11 @@ class gz::sim::SystemLoaderPrivate
       }
     }
 
+    this->resolvedPaths[filename] = pathToLib;
+    this->DiskCache().Store(filename, pathToLib);
+
+    // The loader is shared process-wide, so serialize access to it.
+    std::lock_guard<std::mutex> lock(LoaderMutex());
     auto pluginNames = this->loader.LoadLib(pathToLib, true);
     if (pluginNames.empty())
     {
@@ -223,11 +368,20 @@ class gz::sim::SystemLoaderPrivate
   public: std::string pluginPathEnv{"GZ_SIM_SYSTEM_PLUGIN_PATH"};
   public: std::string pluginPathEnvDeprecated{"IGN_GAZEBO_SYSTEM_PLUGIN_PATH"};
 
-  /// \brief Plugin loader instace
-  public: gz::plugin::Loader loader;
+  /// \brief Plugin loader instance. Shared process-wide so that library
+  /// handles outlive any one SystemLoader. Guard access with LoaderMutex().
+  public: gz::plugin::Loader &loader = SharedLoader();
 
   /// \brief Paths to search for system plugins.
   public: std::unordered_set<std::string> systemPluginPaths;
+
+  /// \brief Cache of previously resolved plugin library paths, keyed by
+  /// library name. Cleared when a new plugin path is added.
+  public: std::unordered_map<std::string, std::string> resolvedPaths;
+
+  /// \brief Per-user resolved-path cache shared across processes. Created
+  /// by DiskCache(); reset when a new plugin path is added.
+  public: std::unique_ptr<DiscoveryCache> diskCache;
 };
 
 //////////////////////////////////////////////////
@@ -249,6 +403,10 @@ std::list<std::string> SystemLoader::PluginPaths() const
 void SystemLoader::AddSystemPluginPath(const std::string &_path)
 {
   this->dataPtr->systemPluginPaths.insert(_path);
+
+  // The new path may shadow previously resolved libraries.
+  this->dataPtr->resolvedPaths.clear();
+  this->dataPtr->diskCache.reset();
 }
 
 //////////////////////////////////////////////////
@@ -306,5 +464,6 @@ std::optional<SystemPluginPtr> SystemLoader::LoadPlugin(
 //////////////////////////////////////////////////
 std::string SystemLoader::PrettyStr() const
 {
+  std::lock_guard<std::mutex> lock(LoaderMutex());
   return this->dataPtr->loader.PrettyStr();
 }
@@ -61,6 +61,29 @@ TEST(SystemLoader, Constructor)
   }
 }
 
+/////////////////////////////////////////////////
+TEST(SystemLoader, RepeatedLoads)
+{
+  auto testBuildPath = gz::common::joinPaths(
+      std::string(PROJECT_BINARY_PATH), "lib");
+
+  sdf::Plugin plugin;
+  plugin.SetFilename(std::string("libgz-sim") + GZ_SIM_MAJOR_VERSION_STR +
+      "-physics-system.so");
+  plugin.SetName("gz::sim::systems::Physics");
+
+  // Loading the same plugin repeatedly through one loader hits the resolved
+  // path cache, and a second loader reuses the process-wide library handle.
+  sim::SystemLoader sm;
+  sm.AddSystemPluginPath(testBuildPath);
+  EXPECT_TRUE(sm.LoadPlugin(plugin).has_value());
+  EXPECT_TRUE(sm.LoadPlugin(plugin).has_value());
+
+  sim::SystemLoader sm2;
+  sm2.AddSystemPluginPath(testBuildPath);
+  EXPECT_TRUE(sm2.LoadPlugin(plugin).has_value());
+}
+
 /////////////////////////////////////////////////
 TEST(SystemLoader, EmptyNames)
 {
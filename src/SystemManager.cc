@@ -15,8 +15,14 @@
  *
 */
 
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <mutex>
 #include <set>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <gz/common/StringUtils.hh>
 
@@ -27,6 +33,100 @@
 using namespace gz;
 using namespace sim;
 
+namespace
+{
+/// \brief Aggregate declared usage of the systems already placed in the
+/// stage currently being filled.
+struct StageUsage
+{
+  /// \brief Union of the declared reads of the stage's systems.
+  std::unordered_set<ComponentTypeId> reads;
+
+  /// \brief Union of the declared writes of the stage's systems.
+  std::unordered_set<ComponentTypeId> writes;
+
+  /// \brief True if the stage holds a system without declared usage.
+  bool undeclared{false};
+};
+
+//////////////////////////////////////////////////
+/// \brief Check whether two component type sets share an element.
+bool Intersects(const std::unordered_set<ComponentTypeId> &_a,
+    const std::unordered_set<ComponentTypeId> &_b)
+{
+  const auto &small = _a.size() < _b.size() ? _a : _b;
+  const auto &large = _a.size() < _b.size() ? _b : _a;
+  return std::any_of(small.begin(), small.end(),
+      [&large](ComponentTypeId _id) { return large.count(_id) != 0; });
+}
+
+//////////////////////////////////////////////////
+/// \brief Place a system into the last stage if its declared usage does not
+/// conflict with the systems already there, or open a new stage otherwise.
+/// Systems without declared usage always get a stage of their own, so
+/// legacy plugins keep running sequentially in load order.
+template <typename InterfaceT>
+void ScheduleSystem(InterfaceT *_iface,
+    const ISystemComponentUsage *_usageIface,
+    std::vector<std::vector<InterfaceT *>> &_stages,
+    StageUsage &_backUsage)
+{
+  if (nullptr == _iface)
+    return;
+
+  SystemComponentUsage usage;
+  bool startNewStage = _stages.empty() || _backUsage.undeclared;
+  if (nullptr != _usageIface)
+  {
+    usage = _usageIface->ComponentUsage();
+    if (!startNewStage)
+    {
+      // Two systems conflict if either writes a type the other touches
+      startNewStage = Intersects(usage.writes, _backUsage.writes) ||
+          Intersects(usage.writes, _backUsage.reads) ||
+          Intersects(usage.reads, _backUsage.writes);
+    }
+  }
+  else
+  {
+    startNewStage = true;
+  }
+
+  if (startNewStage)
+  {
+    _stages.emplace_back();
+    _backUsage = StageUsage();
+    _backUsage.undeclared = (nullptr == _usageIface);
+  }
+
+  _stages.back().push_back(_iface);
+  _backUsage.reads.insert(usage.reads.begin(), usage.reads.end());
+  _backUsage.writes.insert(usage.writes.begin(), usage.writes.end());
+}
+
+/// \brief Process-wide cache of serialized system configurations, keyed
+/// by plugin name plus a hash of its SDF element. It outlives individual
+/// SystemManager instances, so repeatedly relaunched worlds in the same
+/// process skip re-parsing identical plugin configurations.
+std::mutex gConfigCacheMutex;
+std::unordered_map<std::string, std::string> gConfigCache;
+
+//////////////////////////////////////////////////
+/// \brief Build the configuration cache key for a system.
+/// \param[in] _name Plugin name the system was loaded under.
+/// \param[in] _sdf The system's SDF element.
+/// \return Cache key, empty if there is nothing to key on.
+std::string ConfigCacheKey(const std::string &_name,
+    const std::shared_ptr<const sdf::Element> &_sdf)
+{
+  if (_name.empty() || nullptr == _sdf)
+    return std::string();
+
+  return _name + "|" + std::to_string(
+      std::hash<std::string>{}(_sdf->ToString("")));
+}
+}
+
 //////////////////////////////////////////////////
 SystemManager::SystemManager(
   const SystemLoaderPtr &_systemLoader,
@@ -126,9 +226,26 @@ size_t SystemManager::ActivatePendingSystems()
   }
 
   this->pendingSystems.clear();
+  this->RebuildUpdateStages();
   return count;
 }
 
+//////////////////////////////////////////////////
+void SystemManager::RebuildUpdateStages()
+{
+  this->systemsPreupdateStages.clear();
+  this->systemsUpdateStages.clear();
+
+  StageUsage preUsage, updateUsage;
+  for (const auto &system : this->systems)
+  {
+    ScheduleSystem(system.preupdate, system.componentUsage,
+        this->systemsPreupdateStages, preUsage);
+    ScheduleSystem(system.update, system.componentUsage,
+        this->systemsUpdateStages, updateUsage);
+  }
+}
+
 //////////////////////////////////////////////////
 /// \brief Structure to temporarily store plugin information for reset
 struct PluginInfo {
@@ -156,6 +273,8 @@ void SystemManager::Reset(const UpdateInfo &_info, EntityComponentManager &_ecm)
   this->systemsPreupdate.clear();
   this->systemsUpdate.clear();
   this->systemsPostupdate.clear();
+  this->systemsPreupdateStages.clear();
+  this->systemsUpdateStages.clear();
 
   std::vector<PluginInfo> pluginsToBeLoaded;
 
@@ -253,12 +372,54 @@ void SystemManager::AddSystemImpl(
         components::SystemPluginInfo::typeId);
   }
 
-  // Configure the system, if necessary
+  // Configure the system, if necessary. Systems implementing
+  // ConfigureCached restore a configuration snapshot from a previous
+  // identically-configured instance instead of re-parsing their SDF.
   if (_system.configure && this->entityCompMgr && this->eventMgr)
   {
-    _system.configure->Configure(_system.parentEntity, _sdf,
-                                 *this->entityCompMgr,
-                                 *this->eventMgr);
+    bool configured{false};
+    // Systems added from a pointer have no plugin name; key those on the
+    // implementation type instead.
+    std::string keyName = _system.name;
+    if (keyName.empty() && nullptr != _system.system)
+      keyName = typeid(*_system.system).name();
+    const std::string cacheKey = _system.configureCached ?
+        ConfigCacheKey(keyName, _sdf) : std::string();
+
+    if (!cacheKey.empty())
+    {
+      std::string cachedConfig;
+      {
+        std::lock_guard<std::mutex> lock(gConfigCacheMutex);
+        auto cacheIter = gConfigCache.find(cacheKey);
+        if (cacheIter != gConfigCache.end())
+          cachedConfig = cacheIter->second;
+      }
+
+      if (!cachedConfig.empty())
+      {
+        configured = _system.configureCached->ConfigureCached(
+            _system.parentEntity, _sdf, cachedConfig,
+            *this->entityCompMgr, *this->eventMgr);
+      }
+    }
+
+    if (!configured)
+    {
+      _system.configure->Configure(_system.parentEntity, _sdf,
+                                   *this->entityCompMgr,
+                                   *this->eventMgr);
+
+      if (!cacheKey.empty())
+      {
+        auto config = _system.configureCached->SerializeConfiguration();
+        if (!config.empty())
+        {
+          std::lock_guard<std::mutex> lock(gConfigCacheMutex);
+          gConfigCache[cacheKey] = std::move(config);
+        }
+      }
+    }
   }
 
   // Configure the system parameters, if necessary
@@ -312,6 +473,20 @@ const std::vector<ISystemPostUpdate *>& SystemManager::SystemsPostUpdate()
   return this->systemsPostupdate;
 }
 
+//////////////////////////////////////////////////
+const std::vector<std::vector<ISystemPreUpdate *>>&
+SystemManager::PreUpdateStages()
+{
+  return this->systemsPreupdateStages;
+}
+
+//////////////////////////////////////////////////
+const std::vector<std::vector<ISystemUpdate *>>&
+SystemManager::UpdateStages()
+{
+  return this->systemsUpdateStages;
+}
+
 //////////////////////////////////////////////////
 std::vector<SystemInternal> SystemManager::TotalByEntity(Entity _entity)
 {
@@ -328,6 +503,12 @@ std::vector<SystemInternal> SystemManager::TotalByEntity(Entity _entity)
   return result;
 }
 
+//////////////////////////////////////////////////
+const std::vector<SystemInternal> &SystemManager::ActiveSystems() const
+{
+  return this->systems;
+}
+
 //////////////////////////////////////////////////
 bool SystemManager::EntitySystemAddService(const msgs::EntityPlugin_V &_req,
                                            msgs::Boolean &_res)
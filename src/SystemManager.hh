@@ -138,10 +138,29 @@ namespace gz
       /// \return Vector of systems's post-update interfaces.
       public: const std::vector<ISystemPostUpdate *>& SystemsPostUpdate();
 
+      /// \brief Get the scheduled stages for the PreUpdate phase. Systems
+      /// within one stage declared non-conflicting component usage and may
+      /// run concurrently; stages themselves must run in order. Systems
+      /// without declared usage get a stage of their own, which preserves
+      /// the sequential load order for legacy plugins.
+      /// \return Vector of stages of pre-update interfaces.
+      public: const std::vector<std::vector<ISystemPreUpdate *>>&
+          PreUpdateStages();
+
+      /// \brief Get the scheduled stages for the Update phase.
+      /// \return Vector of stages of update interfaces.
+      /// \sa PreUpdateStages
+      public: const std::vector<std::vector<ISystemUpdate *>>&
+          UpdateStages();
+
       /// \brief Get an vector of all systems attached to a given entity.
       /// \return Vector of systems.
       public: std::vector<SystemInternal> TotalByEntity(Entity _entity);
 
+      /// \brief Get all of the active systems.
+      /// \return Const reference to the vector of active systems.
+      public: const std::vector<SystemInternal> &ActiveSystems() const;
+
       /// \brief Process system messages and add systems to entities
       public: void ProcessPendingEntitySystems();
 
@@ -177,6 +196,10 @@ namespace gz
       private: bool EntitySystemInfoService(const msgs::Empty &_req,
                                             msgs::EntityPlugin_V &_res);
 
+      /// \brief Rebuild the PreUpdate and Update stages from the declared
+      /// component usage of the active systems.
+      private: void RebuildUpdateStages();
+
       /// \brief All the systems.
       private: std::vector<SystemInternal> systems;
 
@@ -205,6 +228,16 @@ namespace gz
       /// \brief Systems implementing PostUpdate
       private: std::vector<ISystemPostUpdate *> systemsPostupdate;
 
+      /// \brief Systems implementing PreUpdate, grouped into stages of
+      /// non-conflicting declared component usage.
+      private: std::vector<std::vector<ISystemPreUpdate *>>
+        systemsPreupdateStages;
+
+      /// \brief Systems implementing Update, grouped into stages of
+      /// non-conflicting declared component usage.
+      private: std::vector<std::vector<ISystemUpdate *>>
+        systemsUpdateStages;
+
       /// \brief System loader, for loading system plugins.
       private: SystemLoaderPtr systemLoader;
 
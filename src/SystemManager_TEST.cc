@@ -49,6 +49,43 @@ class SystemWithConfigure:
   public: int configuredParameters = 0;
 };
 
+/////////////////////////////////////////////////
+class SystemWithCachedConfigure:
+  public System,
+  public ISystemConfigure,
+  public ISystemConfigureCached
+{
+  // Documentation inherited
+  public: void Configure(
+                const Entity &,
+                const std::shared_ptr<const sdf::Element> &,
+                EntityComponentManager &,
+                EventManager &) override { configured++; };
+
+  // Documentation inherited
+  public: std::string SerializeConfiguration() const override
+  {
+    return "parsed";
+  }
+
+  // Documentation inherited
+  public: bool ConfigureCached(
+                const Entity &,
+                const std::shared_ptr<const sdf::Element> &,
+                const std::string &_config,
+                EntityComponentManager &,
+                EventManager &) override
+  {
+    this->config = _config;
+    this->cachedConfigured++;
+    return true;
+  }
+
+  public: int configured = 0;
+  public: int cachedConfigured = 0;
+  public: std::string config;
+};
+
 /////////////////////////////////////////////////
 class SystemWithUpdates:
   public System,
@@ -69,6 +106,28 @@ class SystemWithUpdates:
                 const EntityComponentManager &) override {};
 };
 
+/////////////////////////////////////////////////
+class SystemWithDeclaredUsage:
+  public System,
+  public ISystemUpdate,
+  public ISystemComponentUsage
+{
+  public: explicit SystemWithDeclaredUsage(SystemComponentUsage _usage)
+          : usage(std::move(_usage)) {}
+
+  // Documentation inherited
+  public: void Update(const UpdateInfo &,
+                EntityComponentManager &) override {};
+
+  // Documentation inherited
+  public: SystemComponentUsage ComponentUsage() const override
+  {
+    return this->usage;
+  }
+
+  public: SystemComponentUsage usage;
+};
+
 /////////////////////////////////////////////////
 TEST(SystemManager, Constructor)
 {
@@ -214,6 +273,93 @@ TEST(SystemManager, AddSystemEcm)
   EXPECT_EQ(1u, systemMgr.SystemsPostUpdate().size());
 }
 
+/////////////////////////////////////////////////
+TEST(SystemManager, ConfigureCached)
+{
+  auto loader = std::make_shared<SystemLoader>();
+
+  EntityComponentManager ecm;
+  auto entity = ecm.CreateEntity();
+  EXPECT_NE(kNullEntity, entity);
+
+  auto eventManager = EventManager();
+
+  SystemManager systemMgr(loader, &ecm, &eventManager);
+
+  auto pluginElem = std::make_shared<sdf::Element>();
+  sdf::initFile("plugin.sdf", pluginElem);
+  sdf::readString("<?xml version='1.0'?><sdf version='1.6'>"
+      "  <plugin filename='plum' name='pear'>"
+      "    <avocado>0.75</avocado>"
+      "  </plugin>"
+      "</sdf>", pluginElem);
+
+  // The first instance parses its SDF and populates the cache
+  auto first = std::make_shared<SystemWithCachedConfigure>();
+  systemMgr.AddSystem(first, entity, pluginElem);
+  EXPECT_EQ(1, first->configured);
+  EXPECT_EQ(0, first->cachedConfigured);
+
+  // An identically-configured instance restores the snapshot instead of
+  // being configured again
+  auto second = std::make_shared<SystemWithCachedConfigure>();
+  systemMgr.AddSystem(second, entity, pluginElem);
+  EXPECT_EQ(0, second->configured);
+  EXPECT_EQ(1, second->cachedConfigured);
+  EXPECT_EQ("parsed", second->config);
+
+  // A different configuration misses the cache and is configured normally
+  auto otherElem = std::make_shared<sdf::Element>();
+  sdf::initFile("plugin.sdf", otherElem);
+  sdf::readString("<?xml version='1.0'?><sdf version='1.6'>"
+      "  <plugin filename='plum' name='pear'>"
+      "    <avocado>0.25</avocado>"
+      "  </plugin>"
+      "</sdf>", otherElem);
+
+  auto third = std::make_shared<SystemWithCachedConfigure>();
+  systemMgr.AddSystem(third, entity, otherElem);
+  EXPECT_EQ(1, third->configured);
+  EXPECT_EQ(0, third->cachedConfigured);
+}
+
+/////////////////////////////////////////////////
+TEST(SystemManager, UpdateStages)
+{
+  auto loader = std::make_shared<SystemLoader>();
+  SystemManager systemMgr(loader);
+
+  // Two systems writing disjoint component sets, one overlapping writer and
+  // one legacy system without declared usage
+  auto writesOne = std::make_shared<SystemWithDeclaredUsage>(
+      SystemComponentUsage{{}, {1u}});
+  auto writesTwo = std::make_shared<SystemWithDeclaredUsage>(
+      SystemComponentUsage{{}, {2u}});
+  auto readsOne = std::make_shared<SystemWithDeclaredUsage>(
+      SystemComponentUsage{{1u}, {3u}});
+  auto legacy = std::make_shared<SystemWithUpdates>();
+
+  systemMgr.AddSystem(writesOne, kNullEntity, nullptr);
+  systemMgr.AddSystem(writesTwo, kNullEntity, nullptr);
+  systemMgr.AddSystem(readsOne, kNullEntity, nullptr);
+  systemMgr.AddSystem(legacy, kNullEntity, nullptr);
+  systemMgr.ActivatePendingSystems();
+
+  EXPECT_EQ(4u, systemMgr.SystemsUpdate().size());
+
+  // writesOne and writesTwo share a stage; readsOne conflicts with
+  // writesOne's writes; the legacy system runs in a stage of its own
+  auto &stages = systemMgr.UpdateStages();
+  ASSERT_EQ(3u, stages.size());
+  EXPECT_EQ(2u, stages[0].size());
+  EXPECT_EQ(1u, stages[1].size());
+  EXPECT_EQ(1u, stages[2].size());
+
+  // The legacy system also gets its own PreUpdate stage
+  ASSERT_EQ(1u, systemMgr.PreUpdateStages().size());
+  EXPECT_EQ(1u, systemMgr.PreUpdateStages()[0].size());
+}
+
 /////////////////////////////////////////////////
 TEST(SystemManager, AddSystemWithInfo)
 {
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "TaskPool.hh"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Profiler.hh>
+
+#include "gz/sim/Util.hh"
+
+class gz::sim::TaskPoolPrivate
+{
+  /// \brief Mutex protecting the task queue and counters
+  public: std::mutex mutex;
+
+  /// \brief Condition variable signaling the workers that a task is
+  /// available or that the pool is shutting down
+  public: std::condition_variable workCv;
+
+  /// \brief Condition variable signaling Wait() that all tasks finished
+  public: std::condition_variable doneCv;
+
+  /// \brief Queued tasks, consumed in FIFO order
+  public: std::deque<std::function<void()>> tasks;
+
+  /// \brief Number of posted tasks that have not finished yet. This covers
+  /// both queued tasks and tasks currently running on a worker.
+  public: unsigned int pending{0};
+
+  /// \brief Flag to indicate that the workers should exit
+  public: bool running{true};
+
+  /// \brief Worker threads
+  public: std::vector<std::thread> workers;
+
+  /// \brief Logical CPUs the workers pin themselves to, empty for
+  /// unpinned
+  public: std::vector<unsigned int> cpus;
+
+  /// \brief Worker thread loop: pop and run tasks until shutdown
+  /// \param[in] _id Worker index, only used for the profiler thread name
+  public: void WorkerLoop(unsigned int _id);
+};
+
+using namespace gz::sim;
+
+//////////////////////////////////////////////////
+void TaskPoolPrivate::WorkerLoop(unsigned int _id)
+{
+  std::stringstream ss;
+  ss << "TaskPoolWorker: " << _id;
+  GZ_PROFILE_THREAD_NAME(ss.str().c_str());
+
+  if (!this->cpus.empty() && !setThreadAffinity(this->cpus))
+  {
+    gzwarn << "Failed to pin task pool worker " << _id
+           << " to the configured CPUs" << std::endl;
+  }
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->workCv.wait(lock,
+        [this]() { return !this->running || !this->tasks.empty(); });
+
+    if (!this->running && this->tasks.empty())
+      return;
+
+    auto task = std::move(this->tasks.front());
+    this->tasks.pop_front();
+
+    lock.unlock();
+    task();
+    lock.lock();
+
+    if (--this->pending == 0)
+      this->doneCv.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+TaskPool::TaskPool(unsigned int _threadCount,
+    const std::vector<unsigned int> &_cpus)
+  : dataPtr(std::make_unique<TaskPoolPrivate>())
+{
+  if (_threadCount == 0)
+    _threadCount = 1;
+
+  this->dataPtr->cpus = _cpus;
+
+  this->dataPtr->workers.reserve(_threadCount);
+  for (unsigned int id = 0; id < _threadCount; ++id)
+  {
+    this->dataPtr->workers.push_back(
+        std::thread(&TaskPoolPrivate::WorkerLoop, this->dataPtr.get(), id));
+  }
+}
+
+//////////////////////////////////////////////////
+TaskPool::~TaskPool()
+{
+  this->Wait();
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->running = false;
+  }
+  this->dataPtr->workCv.notify_all();
+  for (auto &worker : this->dataPtr->workers)
+  {
+    worker.join();
+  }
+}
+
+//////////////////////////////////////////////////
+void TaskPool::Post(std::function<void()> _task)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    ++this->dataPtr->pending;
+    this->dataPtr->tasks.push_back(std::move(_task));
+  }
+  this->dataPtr->workCv.notify_one();
+}
+
+//////////////////////////////////////////////////
+void TaskPool::Wait()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->doneCv.wait(lock,
+      [this]() { return this->dataPtr->pending == 0; });
+}
+
+//////////////////////////////////////////////////
+bool TaskPool::Idle() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->pending == 0;
+}
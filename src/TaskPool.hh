@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_SIM_TASKPOOL_HH_
+#define GZ_SIM_TASKPOOL_HH_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/Export.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    // Forward declarations.
+    class TaskPoolPrivate;
+
+    /// \class TaskPool TaskPool.hh
+    /// \brief A persistent pool of worker threads executing queued tasks.
+    ///
+    /// Tasks posted with Post() are picked up by idle workers in FIFO
+    /// order, so short tasks pack onto whichever thread frees up first
+    /// instead of each task being pinned to its own thread. Wait() blocks
+    /// the caller until every posted task has finished, making one
+    /// Post()...Wait() cycle a fork/join step.
+    class GZ_SIM_VISIBLE TaskPool
+    {
+      /// \brief Constructor
+      /// \param[in] _threadCount Number of worker threads to spawn. A
+      /// count of zero is treated as one.
+      /// \param[in] _cpus Logical CPUs the workers are pinned to. The
+      /// workers share the set; an empty set, the default, leaves them
+      /// unpinned. See setThreadAffinity in Util.hh.
+      public: explicit TaskPool(unsigned int _threadCount,
+                  const std::vector<unsigned int> &_cpus = {});
+
+      /// \brief Destructor. Waits for pending tasks and joins the workers.
+      public: ~TaskPool();
+
+      /// \brief Queue a task for execution by the next idle worker.
+      /// \param[in] _task Callable to execute.
+      public: void Post(std::function<void()> _task);
+
+      /// \brief Block until all tasks posted so far have finished.
+      public: void Wait();
+
+      /// \brief Check whether all tasks posted so far have finished,
+      /// without blocking.
+      /// \return True if no posted task is queued or running.
+      public: bool Idle() const;
+
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<TaskPoolPrivate> dataPtr;
+    };
+    }  // namespace GZ_SIM_VERSION_NAMESPACE
+  }  // namespace sim
+}  // namespace gz
+
+#endif  // GZ_SIM_TASKPOOL_HH_
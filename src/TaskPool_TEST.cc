@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "TaskPool.hh"
+
+using namespace gz;
+
+/////////////////////////////////////////////////
+TEST(TaskPool, RunsAllTasks)
+{
+  sim::TaskPool pool(4);
+
+  std::atomic<int> counter{0};
+  const int numTasks = 100;
+  for (int ii = 0; ii < numTasks; ++ii)
+  {
+    pool.Post([&counter]() { ++counter; });
+  }
+  pool.Wait();
+
+  EXPECT_EQ(numTasks, counter);
+}
+
+/////////////////////////////////////////////////
+TEST(TaskPool, ReusableAcrossCycles)
+{
+  sim::TaskPool pool(2);
+
+  std::atomic<int> counter{0};
+  for (int cycle = 0; cycle < 10; ++cycle)
+  {
+    for (int ii = 0; ii < 5; ++ii)
+    {
+      pool.Post([&counter]() { ++counter; });
+    }
+    pool.Wait();
+    EXPECT_EQ((cycle + 1) * 5, counter);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(TaskPool, ShortTasksPackWhileLongTaskRuns)
+{
+  sim::TaskPool pool(2);
+
+  std::atomic<bool> longDone{false};
+  std::atomic<int> shortDone{0};
+
+  pool.Post([&longDone]()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        longDone = true;
+      });
+  for (int ii = 0; ii < 10; ++ii)
+  {
+    pool.Post([&shortDone]() { ++shortDone; });
+  }
+  pool.Wait();
+
+  EXPECT_TRUE(longDone);
+  EXPECT_EQ(10, shortDone);
+}
+
+/////////////////////////////////////////////////
+TEST(TaskPool, ZeroThreadsClampedToOne)
+{
+  sim::TaskPool pool(0);
+
+  std::atomic<int> counter{0};
+  pool.Post([&counter]() { ++counter; });
+  pool.Wait();
+
+  EXPECT_EQ(1, counter);
+}
+
+/////////////////////////////////////////////////
+TEST(TaskPool, WaitWithoutTasks)
+{
+  sim::TaskPool pool(2);
+
+  // Wait on an empty pool should not block
+  pool.Wait();
+  SUCCEED();
+}
@@ -168,6 +168,23 @@ TestFixture &TestFixture::Finalize()
   return *this;
 }
 
+//////////////////////////////////////////////////
+TestFixture &TestFixture::Reset()
+{
+  if (!this->dataPtr->finalized)
+  {
+    gzwarn << "Fixture has not been finalized, call Finalize before Reset."
+            << std::endl;
+    return *this;
+  }
+
+  // Rewind to the retained snapshot and run one paused iteration so the
+  // reset is applied before the next test starts stepping.
+  this->dataPtr->server->RequestReset();
+  this->dataPtr->server->RunOnce(true);
+  return *this;
+}
+
 //////////////////////////////////////////////////
 TestFixture &TestFixture::OnConfigure(std::function<void(
           const Entity &_entity,
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
 
@@ -223,6 +225,41 @@ TEST_F(TestFixtureTest, MultiFinalize)
   EXPECT_EQ(expectedIterations, postUpdates);
 }
 
+/////////////////////////////////////////////////
+TEST_F(TestFixtureTest, SessionReuse)
+{
+  TestFixture testFixture(common::joinPaths(
+      std::string(PROJECT_SOURCE_PATH), "test", "worlds", "shapes.sdf"));
+  ASSERT_NE(nullptr, testFixture.Server());
+
+  std::vector<uint64_t> iterations;
+  testFixture.OnPostUpdate([&](const UpdateInfo &_info,
+    const EntityComponentManager &_ecm)
+    {
+      this->Updates(_info, _ecm);
+      iterations.push_back(_info.iterations);
+    }).Finalize();
+
+  unsigned int expectedIterations{10u};
+  testFixture.Server()->Run(true, expectedIterations, false);
+
+  ASSERT_FALSE(iterations.empty());
+  EXPECT_EQ(expectedIterations, iterations.back());
+
+  // Rewind the same server instead of building a new fixture, as a suite
+  // reusing one session between tests would.
+  iterations.clear();
+  testFixture.Reset();
+
+  testFixture.Server()->Run(true, expectedIterations, false);
+
+  // Simulation restarted from the initial snapshot, so the iteration
+  // count begins again at one and the world entities are still present.
+  ASSERT_FALSE(iterations.empty());
+  EXPECT_EQ(1u, iterations.front());
+  EXPECT_EQ(expectedIterations, iterations.back());
+}
+
 /////////////////////////////////////////////////
 TEST_F(TestFixtureTest, ChangeCallback)
 {
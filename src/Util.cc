@@ -17,6 +17,13 @@
 
 #include <gz/msgs/entity.pb.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <list>
+
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Mesh.hh>
 #include <gz/common/MeshManager.hh>
@@ -38,6 +45,7 @@
 #include "gz/sim/components/Collision.hh"
 #include "gz/sim/components/Environment.hh"
 #include "gz/sim/components/Joint.hh"
+#include "gz/sim/components/KinematicsCache.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
 #include "gz/sim/components/Model.hh"
@@ -55,6 +63,8 @@
 #include "gz/sim/InstallationDirectories.hh"
 #include "gz/sim/Util.hh"
 
+#include "DiscoveryCache.hh"
+
 namespace gz
 {
 namespace sim
@@ -90,6 +100,52 @@ math::Pose3d worldPose(const Entity &_entity,
   return pose;
 }
 
+//////////////////////////////////////////////////
+void enableKinematicsCache(const Entity &_entity,
+    EntityComponentManager &_ecm)
+{
+  if (nullptr != _ecm.Component<components::KinematicsCache>(_entity))
+    return;
+
+  components::KinematicsCacheData data;
+  auto p = _ecm.Component<components::ParentEntity>(_entity);
+  while (p)
+  {
+    if (nullptr == _ecm.Component<components::Pose>(p->Data()))
+      break;
+    data.ancestors.push_back(p->Data());
+    p = _ecm.Component<components::ParentEntity>(p->Data());
+  }
+  _ecm.CreateComponent(_entity, components::KinematicsCache(std::move(data)));
+}
+
+//////////////////////////////////////////////////
+math::Pose3d cachedWorldPose(const Entity &_entity,
+    const EntityComponentManager &_ecm)
+{
+  auto cacheComp = _ecm.Component<components::KinematicsCache>(_entity);
+  if (nullptr == cacheComp)
+    return worldPose(_entity, _ecm);
+
+  auto poseComp = _ecm.Component<components::Pose>(_entity);
+  if (nullptr == poseComp)
+  {
+    gzwarn << "Trying to get world pose from entity [" << _entity
+            << "], which doesn't have a pose component" << std::endl;
+    return math::Pose3d();
+  }
+
+  math::Pose3d pose = poseComp->Data();
+  for (const auto ancestor : cacheComp->Data().ancestors)
+  {
+    auto parentPose = _ecm.Component<components::Pose>(ancestor);
+    if (!parentPose)
+      break;
+    pose = parentPose->Data() * pose;
+  }
+  return pose;
+}
+
 //////////////////////////////////////////////////
 math::Vector3d relativeVel(const Entity &_entity,
     const EntityComponentManager &_ecm)
@@ -134,7 +190,9 @@ std::string scopedName(const Entity &_entity,
     const EntityComponentManager &_ecm, const std::string &_delim,
     bool _includePrefix)
 {
-  std::string result;
+  // Collect the parts while walking up the tree, then compose the result
+  // in a single pass instead of repeatedly inserting at the front.
+  std::vector<std::string> parts;
 
   auto entity = _entity;
 
@@ -158,23 +216,30 @@ std::string scopedName(const Entity &_entity,
     auto parentComp = _ecm.Component<components::ParentEntity>(entity);
     if (!prefix.empty())
     {
-      result.insert(0, name);
       if (_includePrefix)
-      {
-        result.insert(0, _delim);
-        result.insert(0, prefix);
-      }
+        parts.push_back(prefix + _delim + name);
+      else
+        parts.push_back(name);
     }
 
     if (nullptr == parentComp)
       break;
 
     if (!prefix.empty())
-      result.insert(0, _delim);
+      parts.push_back(_delim);
 
     entity = parentComp->Data();
   }
 
+  std::size_t resultSize = 0;
+  for (const auto &part : parts)
+    resultSize += part.size();
+
+  std::string result;
+  result.reserve(resultSize);
+  for (auto it = parts.rbegin(); it != parts.rend(); ++it)
+    result += *it;
+
   return result;
 }
 
@@ -222,10 +287,19 @@ std::unordered_set<Entity> entitiesFromScopedName(
     {
       for (auto res : resVector)
       {
-        auto matches = _ecm.EntitiesByComponents(components::Name(name),
-            components::ParentEntity(res));
-        std::copy(std::begin(matches), std::end(matches),
-            std::back_inserter(current));
+        // Iterate only over the immediate children of the candidate
+        // instead of scanning every named entity in the world.
+        for (const auto &vertex : _ecm.Entities().AdjacentsFrom(res))
+        {
+          const Entity child = vertex.first;
+          auto nameComp = _ecm.Component<components::Name>(child);
+          if (nullptr == nameComp || nameComp->Data() != name)
+            continue;
+          auto parentComp = _ecm.Component<components::ParentEntity>(child);
+          if (nullptr == parentComp || parentComp->Data() != res)
+            continue;
+          current.push_back(child);
+        }
       }
     }
     if (current.empty())
@@ -798,6 +872,27 @@ std::string resolveSdfWorldFile(const std::string &_sdfFile,
 {
   std::string filePath;
 
+  // Per-user cache of previously resolved world files, so repeated
+  // short-lived invocations skip the Fuel client construction and the
+  // directory scans below. The environment signature covers the resource
+  // path, the working directory (relative paths resolve against it), and
+  // the contents of the searched directories.
+  std::string resourcePaths;
+  common::env(kResourcePathEnv, resourcePaths);
+  std::list<std::string> searchDirs;
+  for (const std::string &path : common::Split(resourcePaths, ':'))
+  {
+    if (!path.empty())
+      searchDirs.push_back(path);
+  }
+  searchDirs.push_back(gz::sim::getWorldInstallDir());
+  DiscoveryCache worldCache("world_paths",
+      resourcePaths + '\n' + _fuelResourceCache + '\n' + common::cwd() +
+      '\n' + DiscoveryCache::DirectorySignature(searchDirs));
+  filePath = worldCache.Lookup(_sdfFile);
+  if (!filePath.empty())
+    return filePath;
+
   // Check Fuel if it's a URL
   auto sdfUri = common::URI(_sdfFile);
   if (sdfUri.Scheme() == "http" || sdfUri.Scheme() == "https")
@@ -838,6 +933,7 @@ std::string resolveSdfWorldFile(const std::string &_sdfFile,
     filePath = systemPaths.FindFile(_sdfFile);
   }
 
+  worldCache.Store(_sdfFile, filePath);
   return filePath;
 }
 
@@ -878,6 +974,29 @@ const common::Mesh *loadMesh(const sdf::Mesh &_meshSdf)
   }
   return mesh;
 }
+
+//////////////////////////////////////////////////
+bool setThreadAffinity(const std::vector<unsigned int> &_cpus)
+{
+  if (_cpus.empty())
+    return false;
+
+#ifdef __linux__
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for (const auto cpu : _cpus)
+  {
+    if (cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &cpuSet);
+  }
+  if (CPU_COUNT(&cpuSet) == 0)
+    return false;
+
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+  return false;
+#endif
+}
 }
 }
 }
@@ -26,12 +26,14 @@
 #include "gz/sim/components/Actor.hh"
 #include "gz/sim/components/Collision.hh"
 #include "gz/sim/components/Joint.hh"
+#include "gz/sim/components/KinematicsCache.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/ParticleEmitter.hh"
+#include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/Projector.hh"
 #include "gz/sim/components/Sensor.hh"
 #include "gz/sim/components/Visual.hh"
@@ -589,6 +591,61 @@ TEST_F(UtilTest, TopLevelModel)
   EXPECT_EQ(kNullEntity, topLevelModel(worldEntity, ecm));
 }
 
+/////////////////////////////////////////////////
+TEST_F(UtilTest, CachedWorldPose)
+{
+  EntityComponentManager ecm;
+
+  // world
+  //  - model
+  //    - nested model
+
+  auto worldEntity = ecm.CreateEntity();
+  ecm.CreateComponent(worldEntity, components::World());
+  ecm.CreateComponent(worldEntity, components::Name("world_name"));
+
+  auto modelEntity = ecm.CreateEntity();
+  ecm.CreateComponent(modelEntity, components::Model());
+  ecm.CreateComponent(modelEntity, components::Name("model_name"));
+  ecm.CreateComponent(modelEntity, components::ParentEntity(worldEntity));
+  ecm.CreateComponent(modelEntity,
+      components::Pose({1, 2, 3, 0, 0, 0}));
+
+  auto nestedModelEntity = ecm.CreateEntity();
+  ecm.CreateComponent(nestedModelEntity, components::Model());
+  ecm.CreateComponent(nestedModelEntity,
+      components::Name("nested_model_name"));
+  ecm.CreateComponent(nestedModelEntity,
+      components::ParentEntity(modelEntity));
+  ecm.CreateComponent(nestedModelEntity,
+      components::Pose({0, 0, 1, 0, 0, 0}));
+
+  // Without a cache, the lookup falls back to the ParentEntity walk.
+  EXPECT_EQ(math::Pose3d(1, 2, 4, 0, 0, 0),
+      cachedWorldPose(nestedModelEntity, ecm));
+  EXPECT_EQ(nullptr,
+      ecm.Component<components::KinematicsCache>(nestedModelEntity));
+
+  // The first call creates the cache, later calls reuse it.
+  enableKinematicsCache(nestedModelEntity, ecm);
+  auto *cacheComp =
+      ecm.Component<components::KinematicsCache>(nestedModelEntity);
+  ASSERT_NE(nullptr, cacheComp);
+  EXPECT_EQ(std::vector<Entity>({modelEntity}),
+      cacheComp->Data().ancestors);
+  enableKinematicsCache(nestedModelEntity, ecm);
+  EXPECT_EQ(cacheComp,
+      ecm.Component<components::KinematicsCache>(nestedModelEntity));
+
+  // Cached and uncached lookups agree, also after poses change.
+  EXPECT_EQ(worldPose(nestedModelEntity, ecm),
+      cachedWorldPose(nestedModelEntity, ecm));
+  *ecm.Component<components::Pose>(modelEntity) =
+      components::Pose({5, 0, 0, 0, 0, 0});
+  EXPECT_EQ(math::Pose3d(5, 0, 1, 0, 0, 0),
+      cachedWorldPose(nestedModelEntity, ecm));
+}
+
 /////////////////////////////////////////////////
 TEST_F(UtilTest, ValidTopic)
 {
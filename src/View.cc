@@ -45,6 +45,59 @@ const std::vector<components::BaseComponent *> &View::EntityComponentData(
   return this->validData.at(_entity);
 }
 
+//////////////////////////////////////////////////
+const std::vector<Entity> &View::PackedEntities() const
+{
+  // Concurrent const queries (e.g. parallel system PostUpdates calling
+  // Each with the same signature) can race to rebuild after a membership
+  // change, so the rebuild is gated by the packed-data mutex. In the
+  // steady state the dirty flag is false and the arrays are read-only.
+  if (this->packedDataDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(this->packedDataMutex);
+    if (this->packedDataDirty.load(std::memory_order_relaxed))
+      this->RebuildPackedData();
+  }
+  return this->packedEntities;
+}
+
+//////////////////////////////////////////////////
+const std::vector<components::BaseComponent *>
+    &View::PackedComponentData() const
+{
+  if (this->packedDataDirty.load(std::memory_order_acquire))
+  {
+    std::lock_guard<std::mutex> lock(this->packedDataMutex);
+    if (this->packedDataDirty.load(std::memory_order_relaxed))
+      this->RebuildPackedData();
+  }
+  return this->packedData;
+}
+
+//////////////////////////////////////////////////
+void View::RebuildPackedData() const
+{
+  const auto stride = this->componentTypes.size();
+  this->packedEntities.clear();
+  this->packedData.clear();
+  this->packedEntities.reserve(this->entities.size());
+  this->packedData.reserve(this->entities.size() * stride);
+
+  for (const auto &entity : this->entities)
+  {
+    auto iter = this->validData.find(entity);
+    if (iter == this->validData.end())
+      continue;
+    this->packedEntities.push_back(entity);
+    this->packedData.insert(this->packedData.end(), iter->second.begin(),
+        iter->second.end());
+  }
+
+  // Release so that readers which skip the mutex on a false dirty read
+  // are guaranteed to see the rebuilt arrays.
+  this->packedDataDirty.store(false, std::memory_order_release);
+}
+
 //////////////////////////////////////////////////
 bool View::HasCachedComponentData(const Entity _entity) const
 {
@@ -85,6 +138,7 @@ bool View::RemoveEntity(const Entity _entity)
   this->toAddEntities.erase(_entity);
   this->validData.erase(_entity);
   this->validConstData.erase(_entity);
+  this->packedDataDirty = true;
 
   return true;
 }
@@ -118,6 +172,7 @@ bool View::NotifyComponentAddition(const Entity _entity,
     auto constCompNh = this->invalidConstData.extract(_entity);
     this->validConstData.insert(std::move(constCompNh));
     this->entities.insert(_entity);
+    this->packedDataDirty = true;
     if (_newEntity)
       this->newEntities.insert(_entity);
     this->missingCompTracker.erase(_entity);
@@ -154,6 +209,7 @@ bool View::NotifyComponentRemoval(const Entity _entity,
     this->invalidConstData.insert(std::move(constCompNh));
     this->entities.erase(_entity);
     this->newEntities.erase(_entity);
+    this->packedDataDirty = true;
   }
 
   this->missingCompTracker[_entity].insert(_typeId);
@@ -170,6 +226,7 @@ void View::Reset()
   this->newEntities.clear();
   this->toRemoveEntities.clear();
   this->toAddEntities.clear();
+  this->toAddDirty.store(false, std::memory_order_release);
 
   // reset all data structures unique to the templated view
   this->validData.clear();
@@ -177,6 +234,10 @@ void View::Reset()
   this->invalidData.clear();
   this->invalidConstData.clear();
   this->missingCompTracker.clear();
+
+  this->packedEntities.clear();
+  this->packedData.clear();
+  this->packedDataDirty = true;
 }
 
 }  // namespace detail
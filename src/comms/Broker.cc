@@ -22,6 +22,8 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gz/transport/Node.hh>
 #include "gz/sim/comms/Broker.hh"
@@ -38,6 +40,15 @@ class gz::sim::comms::Broker::Implementation
   /// \brief Protect data from races.
   public: std::mutex mutex;
 
+  /// \brief Messages received from the clients and not routed yet. They are
+  /// moved into the outbound queues once per step by DispatchPendingMsgs().
+  public: std::vector<msgs::DataframeSharedPtr> pendingMsgs;
+
+  /// \brief Protect pendingMsgs. Kept separate from the main mutex so that
+  /// client callbacks only block for the time of one push, never for a whole
+  /// comms model step.
+  public: std::mutex pendingMutex;
+
   /// \brief Topic used to centralize all messages sent from the agents.
   public: std::string msgTopic = "/broker/msgs";
 
@@ -181,16 +192,31 @@ void Broker::OnUnbind(const gz::msgs::StringMsg_V &_req)
 //////////////////////////////////////////////////
 void Broker::OnMsg(const gz::msgs::Dataframe &_msg)
 {
-  // Place the message in the outbound queue of the sender.
+  // Stage the message; it's routed to the outbound queue of the sender on
+  // the next DispatchPendingMsgs() call.
   auto msgPtr = std::make_shared<gz::msgs::Dataframe>(_msg);
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::lock_guard<std::mutex> lock(this->dataPtr->pendingMutex);
+  this->dataPtr->pendingMsgs.push_back(std::move(msgPtr));
+}
 
-  // Stamp the time.
-  msgPtr->mutable_header()->mutable_stamp()->CopyFrom(
-      sim::convert<msgs::Time>(this->dataPtr->time));
+//////////////////////////////////////////////////
+void Broker::DispatchPendingMsgs()
+{
+  std::vector<msgs::DataframeSharedPtr> pending;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->pendingMutex);
+    pending.swap(this->dataPtr->pendingMsgs);
+  }
 
-  this->DataManager().AddOutbound(_msg.src_address(), msgPtr);
+  for (auto &msgPtr : pending)
+  {
+    // Stamp the time.
+    msgPtr->mutable_header()->mutable_stamp()->CopyFrom(
+        sim::convert<msgs::Time>(this->dataPtr->time));
+
+    this->DataManager().AddOutbound(msgPtr->src_address(), msgPtr);
+  }
 }
 
 //////////////////////////////////////////////////
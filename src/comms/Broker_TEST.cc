@@ -69,6 +69,7 @@ TEST_F(BrokerTest, Broker)
   msgs::Dataframe msg;
   msg.set_src_address("addr1");
   broker.OnMsg(msg);
+  broker.DispatchPendingMsgs();
   EXPECT_EQ(1u, allData["addr1"].outboundMsgs.size());
   EXPECT_EQ("addr1", allData["addr1"].outboundMsgs[0u]->src_address());
 
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <utility>
 
 #include <gz/common/Profiler.hh>
 #include <sdf/Element.hh>
@@ -114,12 +115,16 @@ void ICommsModel::StepImpl(const UpdateInfo &_info,
   // Update the time in the broker.
   this->dataPtr->broker.SetTime(_info.simTime);
 
+  // Route the messages received from the clients since the last step into
+  // the outbound queues.
+  this->dataPtr->broker.DispatchPendingMsgs();
+
   // Step the comms model.
   const Registry &currentRegistry =
     this->dataPtr->broker.DataManager().DataConst();
   Registry newRegistry = this->dataPtr->broker.DataManager().Copy();
   this->Step(_info, currentRegistry, newRegistry, _ecm);
-  this->dataPtr->broker.DataManager().Set(newRegistry);
+  this->dataPtr->broker.DataManager().Set(std::move(newRegistry));
 
   this->dataPtr->broker.Unlock();
 
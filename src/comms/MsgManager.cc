@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
 
 #include <gz/transport/Node.hh>
 #include <gz/utils/ImplPtr.hh>
@@ -185,3 +186,9 @@ void MsgManager::Set(const Registry &_newContent)
 {
   this->dataPtr->data = _newContent;
 }
+
+//////////////////////////////////////////////////
+void MsgManager::Set(Registry &&_newContent)
+{
+  this->dataPtr->data = std::move(_newContent);
+}
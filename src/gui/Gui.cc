@@ -16,6 +16,10 @@
  */
 #include <QScreen>
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gz/msgs/gui.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/stringmsg_v.pb.h>
@@ -272,6 +276,30 @@ std::unique_ptr<gz::gui::Application> createGui(
     startingWorldPub.Publish(msg);
   }
 
+  // Start discovering the list of worlds now, in parallel with application
+  // construction and QML compilation below. The server may still be busy
+  // downloading resources, and there's no reason to hold the window back
+  // while waiting for it.
+  bool executed{false};
+  bool result{false};
+  const unsigned int timeout{5000};
+  msgs::StringMsg_V worldsMsg;
+
+  // This loop is here to allow the server time to download resources.
+  // \todo(nkoenig) Async resource download. Search for "Async resource
+  // download in `src/Server.cc` for corresponding todo item. This todo is
+  // resolved when this while loop can be removed.
+  std::thread worldsDiscovery([&]()
+  {
+    const std::string service{"/gazebo/worlds"};
+    while (!sigKilled && !executed)
+    {
+      gzdbg << "GUI requesting list of world names. The server may be busy "
+        << "downloading resources. Please be patient." << std::endl;
+      executed = node.Request(service, timeout, worldsMsg, result);
+    }
+  });
+
   // Launch main window
   auto app = std::make_unique<gz::gui::Application>(
     _argc, _argv, gz::gui::WindowType::kMainWindow);
@@ -325,23 +353,9 @@ std::unique_ptr<gz::gui::Application> createGui(
            << std::endl;
   }
 
-  // Get list of worlds
-  bool executed{false};
-  bool result{false};
-  unsigned int timeout{5000};
-  std::string service{"/gazebo/worlds"};
-  msgs::StringMsg_V worldsMsg;
-
-  // This loop is here to allow the server time to download resources.
-  // \todo(nkoenig) Async resource download. Search for "Async resource
-  // download in `src/Server.cc` for corresponding todo item. This todo is
-  // resolved when this while loop can be removed.
-  while (!sigKilled && !executed)
-  {
-    gzdbg << "GUI requesting list of world names. The server may be busy "
-      << "downloading resources. Please be patient." << std::endl;
-    executed = node.Request(service, timeout, worldsMsg, result);
-  }
+  // Wait for the list of worlds requested before the window was built; by
+  // now the QML compilation it overlapped with is done.
+  worldsDiscovery.join();
 
   // Only print error message if a sigkill was not received.
   if (!sigKilled)
@@ -378,39 +392,51 @@ std::unique_ptr<gz::gui::Application> createGui(
   // GUI configuration from SDF (request to server)
   else
   {
-    // TODO(anyone) Parallelize this if multiple worlds becomes an important use
-    // case.
+    // Request GUI info for all worlds up front and in parallel. Plugin
+    // loading itself has to stay on the Qt thread, but the service round
+    // trips don't, so multi-world sessions only wait for the slowest
+    // response instead of one blocking request per world.
+    std::vector<gz::msgs::GUI> guiInfos(worldsMsg.data_size());
+    std::vector<std::thread> guiInfoRequests;
     for (int w = 0; w < worldsMsg.data_size(); ++w)
     {
-      const auto &worldName = worldsMsg.data(w);
-
-      // Request GUI info for each world
-      result = false;
-      gz::msgs::GUI res;
-      service = transport::TopicUtils::AsValidTopic("/world/" + worldName +
-          "/gui/info");
-      if (service.empty())
-      {
-        gzerr << "Failed to generate valid service for world [" << worldName
-               << "]" << std::endl;
-      }
-      else
+      guiInfoRequests.emplace_back([&, w]()
       {
+        const auto &worldName = worldsMsg.data(w);
+        auto service = transport::TopicUtils::AsValidTopic("/world/" +
+            worldName + "/gui/info");
+        if (service.empty())
+        {
+          gzerr << "Failed to generate valid service for world [" << worldName
+                 << "]" << std::endl;
+          return;
+        }
+
         gzdbg << "Requesting GUI from [" << service << "]..." << std::endl;
 
         // Request and block
-        executed = node.Request(service, timeout, res, result);
+        bool guiResult{false};
+        bool guiExecuted = node.Request(service, timeout, guiInfos[w],
+            guiResult);
 
-        if (!executed)
+        if (!guiExecuted)
         {
           gzerr << "Service call timed out for [" << service << "]"
                  << std::endl;
         }
-        else if (!result)
+        else if (!guiResult)
         {
           gzerr << "Service call failed for [" << service << "]" << std::endl;
         }
-      }
+      });
+    }
+    for (auto &request : guiInfoRequests)
+      request.join();
+
+    for (int w = 0; w < worldsMsg.data_size(); ++w)
+    {
+      const auto &worldName = worldsMsg.data(w);
+      gz::msgs::GUI &res = guiInfos[w];
 
       // GUI runner
       auto runner = new gz::sim::GuiRunner(worldName);
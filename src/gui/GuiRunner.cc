@@ -16,6 +16,7 @@
 */
 
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -49,6 +50,33 @@ using namespace sim;
 // of this type in QMetaObject::invokeMethod
 Q_DECLARE_METATYPE(msgs::SerializedStepMap)
 
+/////////////////////////////////////////////////
+/// \brief Merge a state delta into an accumulated state message so that all
+/// pending deltas can be applied to the ECM in a single pass.
+/// \param[in, out] _to Accumulated state.
+/// \param[in] _from Newly received delta.
+static void mergeStateDelta(msgs::SerializedStateMap &_to,
+                            const msgs::SerializedStateMap &_from)
+{
+  for (const auto &[entityId, entityDelta] : _from.entities())
+  {
+    auto entityIt = _to.mutable_entities()->find(entityId);
+    if (entityIt == _to.mutable_entities()->end() || entityDelta.remove())
+    {
+      (*_to.mutable_entities())[entityId] = entityDelta;
+      continue;
+    }
+
+    // Later deltas carry the latest value of each component, so
+    // insert-or-assign keeps removals and re-additions intact.
+    auto &entity = entityIt->second;
+    for (const auto &[typeId, compDelta] : entityDelta.components())
+    {
+      (*entity.mutable_components())[typeId] = compDelta;
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 class gz::sim::GuiRunner::Implementation
 {
@@ -76,6 +104,18 @@ class gz::sim::GuiRunner::Implementation
   /// \brief True if the initial state has been received and processed.
   public: bool receivedInitialState{false};
 
+  /// \brief State deltas received since the last time the Qt thread applied
+  /// them to the ECM. Deltas are merged here on the transport thread so the
+  /// Qt thread performs a single SetState per frame even when the GUI falls
+  /// behind the server's state publications.
+  public: msgs::SerializedStepMap pendingState;
+
+  /// \brief True if pendingState holds deltas not yet applied to the ECM.
+  public: bool hasPendingState{false};
+
+  /// \brief Mutex to protect pendingState and hasPendingState.
+  public: std::mutex pendingStateMutex;
+
   /// \brief Name of WorldControl service
   public: std::string controlService;
 
@@ -299,12 +339,26 @@ void GuiRunner::OnState(const msgs::SerializedStepMap &_msg)
   if (!this->dataPtr->receivedInitialState)
     return;
 
-  // Since this function may be called from a transport thread, we push the
-  // OnStateQt function to the queue so that its called from the Qt thread. This
-  // ensures that only one thread has access to the ecm and updateInfo
-  // variables.
-  QMetaObject::invokeMethod(this, "OnStateQt", Qt::QueuedConnection,
-                            Q_ARG(msgs::SerializedStepMap, _msg));
+  // Merge the delta into the pending state on the transport thread and let
+  // the Qt thread apply everything pending in one pass. This keeps the
+  // expensive deserialization work per frame bounded when state messages
+  // arrive faster than the Qt event loop drains them.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->pendingStateMutex);
+    if (!this->dataPtr->hasPendingState)
+    {
+      this->dataPtr->pendingState = _msg;
+      this->dataPtr->hasPendingState = true;
+    }
+    else
+    {
+      mergeStateDelta(*this->dataPtr->pendingState.mutable_state(),
+                      _msg.state());
+      this->dataPtr->pendingState.mutable_stats()->CopyFrom(_msg.stats());
+    }
+  }
+
+  QMetaObject::invokeMethod(this, "ProcessStateQt", Qt::QueuedConnection);
 }
 
 /////////////////////////////////////////////////
@@ -319,6 +373,30 @@ void GuiRunner::OnStateQt(const msgs::SerializedStepMap &_msg)
   this->UpdatePlugins();
 }
 
+/////////////////////////////////////////////////
+void GuiRunner::ProcessStateQt()
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("GuiRunner::Update");
+
+  msgs::SerializedStepMap msg;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->pendingStateMutex);
+    // Earlier queued invocations may have already applied the pending state.
+    if (!this->dataPtr->hasPendingState)
+      return;
+    msg = std::move(this->dataPtr->pendingState);
+    this->dataPtr->pendingState.Clear();
+    this->dataPtr->hasPendingState = false;
+  }
+
+  this->dataPtr->ecm.SetState(msg.state());
+
+  // Update all plugins
+  this->dataPtr->updateInfo = convert<UpdateInfo>(msg.stats());
+  this->UpdatePlugins();
+}
+
 /////////////////////////////////////////////////
 void GuiRunner::UpdatePlugins()
 {
@@ -331,6 +409,10 @@ void GuiRunner::UpdatePlugins()
   this->dataPtr->ecm.ClearRemovedComponents();
   this->dataPtr->ecm.ClearNewlyCreatedEntities();
   this->dataPtr->ecm.ProcessRemoveEntityRequests();
+  // Mirror the server-side runner so that per-cycle component change flags
+  // are meaningful to GUI systems: SetState marks received components as
+  // changed, plugins have now seen them, so reset the flags.
+  this->dataPtr->ecm.SetAllComponentsUnchanged();
 
   // gz-sim systems
   this->LoadSystems();
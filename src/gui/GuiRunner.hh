@@ -69,6 +69,11 @@ class GZ_SIM_GUI_VISIBLE GuiRunner : public QObject
   /// \param[in] _msg New state message.
   private: Q_INVOKABLE void OnStateQt(const msgs::SerializedStepMap &_msg);
 
+  /// \brief Called by the Qt thread to apply the pending state accumulated
+  /// by OnState. All deltas received since the last call are applied to the
+  /// ECM in a single pass.
+  private: Q_INVOKABLE void ProcessStateQt();
+
   /// \brief Update the plugins.
   private: Q_INVOKABLE void UpdatePlugins();
 
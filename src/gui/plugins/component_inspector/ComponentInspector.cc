@@ -15,8 +15,10 @@
  *
 */
 
+#include <chrono>
 #include <iostream>
 #include <list>
+#include <map>
 #include <regex>
 #include <unordered_map>
 #include <QColorDialog>
@@ -113,6 +115,19 @@ namespace gz::sim
     /// \brief Whether updates are currently paused.
     public: bool paused{false};
 
+    /// \brief Entity inspected on the previous update, used to force a full
+    /// refresh when the selection changes.
+    public: Entity lastEntity{kNullEntity};
+
+    /// \brief Minimum wall-clock interval between refreshes of a
+    /// periodically changing component type, so a fast-changing component
+    /// doesn't rebuild its widget at render rate.
+    public: std::chrono::milliseconds refreshPeriod{100};
+
+    /// \brief Last wall-clock refresh time per displayed component type.
+    public: std::map<ComponentTypeId, std::chrono::steady_clock::time_point>
+        lastRefresh;
+
     /// \brief Transport node for making command requests
     public: transport::Node node;
 
@@ -501,6 +516,16 @@ void ComponentInspector::Update(const UpdateInfo &,
 
   auto componentTypes = _ecm.ComponentTypes(this->dataPtr->entity);
 
+  // Refresh everything when the inspected entity changes, since items of
+  // component types shared with the previous entity are reused.
+  const bool entityChanged =
+      this->dataPtr->entity != this->dataPtr->lastEntity;
+  this->dataPtr->lastEntity = this->dataPtr->entity;
+  if (entityChanged)
+    this->dataPtr->lastRefresh.clear();
+
+  const auto now = std::chrono::steady_clock::now();
+
   // List all components
   for (const auto &typeId : componentTypes)
   {
@@ -579,6 +604,7 @@ void ComponentInspector::Update(const UpdateInfo &,
 
     // Get component item
     QStandardItem *item;
+    bool newItem{false};
     auto itemIt = this->dataPtr->componentsModel.items.find(typeId);
     if (itemIt != this->dataPtr->componentsModel.items.end())
     {
@@ -588,11 +614,9 @@ void ComponentInspector::Update(const UpdateInfo &,
     else
     {
       item = this->dataPtr->componentsModel.AddComponentType(typeId);
+      newItem = true;
     }
 
-    item->setData(QString::number(this->dataPtr->entity),
-                  ComponentsModel::RoleNames().key("entity"));
-
     if (nullptr == item)
     {
       gzerr << "Failed to get item for component type [" << typeId << "]"
@@ -600,6 +624,30 @@ void ComponentInspector::Update(const UpdateInfo &,
       continue;
     }
 
+    // Skip components that haven't changed since the last update, and cap
+    // the refresh rate of periodically changing ones. One-time changes are
+    // always processed.
+    if (!newItem && !entityChanged)
+    {
+      auto state = _ecm.ComponentState(this->dataPtr->entity, typeId);
+      if (state == ComponentState::NoChange)
+        continue;
+
+      if (state == ComponentState::PeriodicChange)
+      {
+        auto lastIt = this->dataPtr->lastRefresh.find(typeId);
+        if (lastIt != this->dataPtr->lastRefresh.end() &&
+            now - lastIt->second < this->dataPtr->refreshPeriod)
+        {
+          continue;
+        }
+      }
+    }
+    this->dataPtr->lastRefresh[typeId] = now;
+
+    item->setData(QString::number(this->dataPtr->entity),
+                  ComponentsModel::RoleNames().key("entity"));
+
     // Populate component-specific data
     if (typeId == components::AngularAcceleration::typeId)
     {
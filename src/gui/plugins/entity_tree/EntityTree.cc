@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
@@ -119,67 +120,103 @@ QString entityType(Entity _entity,
 TreeModel::TreeModel() : QStandardItemModel()
 {
   qRegisterMetaType<Entity>("Entity");
+  qRegisterMetaType<TreeModel::EntityInfoList>("TreeModel::EntityInfoList");
 }
 
 /////////////////////////////////////////////////
 void TreeModel::AddEntity(Entity _entity, const QString &_entityName,
     Entity _parentEntity, const QString &_type)
 {
-  GZ_PROFILE_THREAD_NAME("Qt thread");
-  GZ_PROFILE("TreeModel::AddEntity");
-  QStandardItem *parentItem{nullptr};
-
-  // check if entity has already been added or not.
-  // This could happen because we get new and removed entity updates from both
-  // the ECM and GUI events.
-  if (this->entityItems.find(_entity) != this->entityItems.end())
-    return;
+  this->AddEntities({{_entity, _entityName, _parentEntity, _type}});
+}
 
-  // Root
-  if (_parentEntity == kNullEntity)
+/////////////////////////////////////////////////
+void TreeModel::AddEntities(const EntityInfoList &_entities)
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("TreeModel::AddEntities");
+
+  // roleNames() builds the hash on every call, so resolve the keys once for
+  // the whole batch.
+  const auto roles = this->roleNames();
+  const int entityNameRole = roles.key("entityName");
+  const int entityRole = roles.key("entity");
+  const int typeRole = roles.key("type");
+
+  // Rows to be appended per parent item, so that each parent performs a
+  // single row insertion for the whole batch.
+  std::map<QStandardItem *, QList<QStandardItem *>> rowsPerParent;
+
+  // Create the item for one entity. Returns false if the parent is not known
+  // yet, in which case the entity stays pending.
+  auto addOne = [&](const EntityInfo &_info) -> bool
   {
-    parentItem = this->invisibleRootItem();
-  }
+    // check if entity has already been added or not.
+    // This could happen because we get new and removed entity updates from
+    // both the ECM and GUI events.
+    if (this->entityItems.find(_info.entity) != this->entityItems.end())
+      return true;
 
-  // Nested
-  // TODO(louise) There should be a way to easily access these from
-  // QStandardItemModel instead of keeping our own map
-  auto item = this->entityItems.find(_parentEntity);
-  if (item != this->entityItems.end())
-  {
-    parentItem = item->second;
-  }
+    QStandardItem *parentItem{nullptr};
 
-  if (nullptr == parentItem)
-  {
-    this->pendingEntities.push_back(
-      {_entity, _entityName, _parentEntity, _type});
-    return;
-  }
+    // Root
+    if (_info.parentEntity == kNullEntity)
+    {
+      parentItem = this->invisibleRootItem();
+    }
 
-  // New entity item
-  auto entityItem = new QStandardItem(_entityName);
-  entityItem->setData(_entityName, this->roleNames().key("entityName"));
-  entityItem->setData(QString::number(_entity),
-      this->roleNames().key("entity"));
-  entityItem->setData(_type, this->roleNames().key("type"));
+    // Nested
+    // TODO(louise) There should be a way to easily access these from
+    // QStandardItemModel instead of keeping our own map
+    auto item = this->entityItems.find(_info.parentEntity);
+    if (item != this->entityItems.end())
+    {
+      parentItem = item->second;
+    }
 
-  parentItem->appendRow(entityItem);
+    if (nullptr == parentItem)
+      return false;
 
-  this->entityItems[_entity] = entityItem;
+    // New entity item
+    auto entityItem = new QStandardItem(_info.name);
+    entityItem->setData(_info.name, entityNameRole);
+    entityItem->setData(QString::number(_info.entity), entityRole);
+    entityItem->setData(_info.type, typeRole);
 
-  // Check if there are pending children
-  auto sep = std::partition(this->pendingEntities.begin(),
-      this->pendingEntities.end(), [&_entity](const EntityInfo &_entityInfo)
-      {
-        return _entityInfo.parentEntity != _entity;
-      });
+    this->entityItems[_info.entity] = entityItem;
+    rowsPerParent[parentItem].append(entityItem);
+    return true;
+  };
 
-  for (auto it = sep; it != this->pendingEntities.end(); ++it)
+  for (const auto &info : _entities)
   {
-    this->AddEntity(it->entity, it->name, it->parentEntity, it->type);
+    if (!addOne(info))
+      this->pendingEntities.push_back(info);
+  }
+
+  // Entities added above may be the parents of pending ones; keep resolving
+  // until no pending entity can be placed.
+  bool progress{true};
+  while (progress)
+  {
+    progress = false;
+    for (auto it = this->pendingEntities.begin();
+         it != this->pendingEntities.end();)
+    {
+      if (addOne(*it))
+      {
+        it = this->pendingEntities.erase(it);
+        progress = true;
+      }
+      else
+      {
+        ++it;
+      }
+    }
   }
-  this->pendingEntities.erase(sep, this->pendingEntities.end());
+
+  for (auto &[parentItem, rows] : rowsPerParent)
+    parentItem->appendRows(rows);
 }
 
 /////////////////////////////////////////////////
@@ -313,6 +350,10 @@ void EntityTree::LoadConfig(const tinyxml2::XMLElement *)
 void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
 {
   GZ_PROFILE("EntityTree::Update");
+
+  // Entities added this update, pushed to the model in a single batch.
+  TreeModel::EntityInfoList toAdd;
+
   // Treat all pre-existent entities as new at startup
   if (!this->dataPtr->initialized)
   {
@@ -345,12 +386,8 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      toAdd.append({_entity, QString::fromStdString(_name->Data()),
+          parentEntity, entityType(_entity, _ecm)});
       return true;
     });
 
@@ -375,12 +412,8 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      toAdd.append({_entity, QString::fromStdString(_name->Data()),
+          parentEntity, entityType(_entity, _ecm)});
       return true;
     });
   }
@@ -425,12 +458,8 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, entity),
-          Q_ARG(QString, QString::fromStdString(nameComp->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(entity, _ecm)));
+      toAdd.append({entity, QString::fromStdString(nameComp->Data()),
+          parentEntity, entityType(entity, _ecm)});
     }
 
     for (auto entity : this->dataPtr->removedEntities)
@@ -443,6 +472,13 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
     this->dataPtr->newEntities.clear();
     this->dataPtr->removedEntities.clear();
   }
+
+  if (!toAdd.isEmpty())
+  {
+    QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntities",
+        Qt::QueuedConnection,
+        Q_ARG(TreeModel::EntityInfoList, toAdd));
+  }
 }
 
 /////////////////////////////////////////////////
@@ -45,6 +45,29 @@ namespace sim
     // Documentation inherited
     public: QHash<int, QByteArray> roleNames() const override;
 
+    /// \brief Entity information used to batch and queue pending entities
+    public: struct EntityInfo
+    {
+      /// \brief Entity ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity entity;
+
+      /// \brief Entity name
+      QString name;
+
+      /// \brief Parent ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity parentEntity;
+
+      /// \brief Entity type
+      QString type;
+    };
+
+    /// \brief A batch of entities to be added to the tree.
+    public: using EntityInfoList = QVector<EntityInfo>;
+
     /// \brief Add an entity to the tree.
     /// \param[in] _entity Entity to be added
     /// \param[in] _entityName Name of entity to be added
@@ -56,6 +79,12 @@ namespace sim
         Entity _parentEntity = kNullEntity,
         const QString &_type = QString());
 
+    /// \brief Add a batch of entities to the tree. Rows are appended to each
+    /// parent in a single insertion so the view performs one layout pass per
+    /// parent instead of one per entity.
+    /// \param[in] _entities Entities to be added
+    public slots: void AddEntities(const EntityInfoList &_entities);
+
     /// \brief Remove an entity from the tree.
     /// \param[in] _entity Entity to be removed
     public slots: void RemoveEntity(Entity _entity);
@@ -78,26 +107,6 @@ namespace sim
     /// \brief Keep track of which item corresponds to which entity.
     private: std::map<Entity, QStandardItem *> entityItems;
 
-    /// \brief Entity information used to queue the pending entities
-    struct EntityInfo
-    {
-      /// \brief Entity ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity entity;
-
-      /// \brief Entity name
-      QString name;
-
-      /// \brief Parent ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity parentEntity;
-
-      /// \brief Entity type
-      QString type;
-    };
-
     /// \brief If an entity is added before its parent, we queue it in this
     /// vector until their parent shows up or they are deleted.
     private: std::vector<EntityInfo> pendingEntities;
@@ -150,4 +159,8 @@ namespace sim
 }
 }
 
+// Register EntityInfoList to the Qt meta type system so batches can be passed
+// in QMetaObject::invokeMethod
+Q_DECLARE_METATYPE(gz::sim::TreeModel::EntityInfoList)
+
 #endif
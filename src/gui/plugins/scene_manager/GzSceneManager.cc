@@ -114,6 +114,10 @@ void GzSceneManager::LoadConfig(const tinyxml2::XMLElement *)
   gz::gui::App()->findChild<
       gz::gui::MainWindow *>()->installEventFilter(this);
 
+  // The GUI usually renders faster than states arrive; interpolate poses
+  // between state updates to keep the display smooth.
+  this->dataPtr->renderUtil.SetPoseInterpolation(true);
+
   this->dataPtr->initialized = true;
 }
 
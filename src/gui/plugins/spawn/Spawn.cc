@@ -23,7 +23,10 @@
 #include <algorithm>
 #include <limits>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <QQmlProperty>
 
@@ -52,18 +55,33 @@
 #include <gz/transport/Node.hh>
 #include <gz/transport/Publisher.hh>
 
+#include <sdf/Geometry.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Root.hh>
 
 #include "gz/sim/rendering/RenderUtil.hh"
 #include "gz/sim/rendering/SceneManager.hh"
+#include "gz/sim/Util.hh"
 
 namespace gz::sim
 {
   class SpawnPrivate
   {
+    /// \brief Destructor. Joins the preview loader thread.
+    public: ~SpawnPrivate();
+
     /// \brief Perform operations in the render thread.
     public: void OnRender();
 
+    /// \brief Parse an SDF resource and decode its meshes into the mesh
+    /// cache. Run on the preview loader thread, so large assets do not
+    /// freeze the GUI; once previewReady is set, the render thread
+    /// builds the preview geometry from the warmed cache.
+    /// \param[in] _sdfString SDF string to parse, may be empty
+    /// \param[in] _sdfPath SDF file to parse when the string is empty
+    public: void LoadPreviewResource(const std::string &_sdfString,
+        const std::string &_sdfPath);
+
     /// \brief Delete the visuals generated while an entity is being spawned.
     public: void TerminateSpawnPreview();
 
@@ -86,6 +104,31 @@ namespace gz::sim
     /// \brief Flag for indicating whether the preview needs to be generated.
     public: bool generatePreview = false;
 
+    /// \brief Thread that parses the requested resource and warms the
+    /// mesh cache before the preview is created.
+    public: std::thread previewLoader;
+
+    /// \brief Protects previewRoot and previewReady.
+    public: std::mutex previewLoadMutex;
+
+    /// \brief SDF DOM parsed by the preview loader thread.
+    public: sdf::Root previewRoot;
+
+    /// \brief True once the preview loader thread finished.
+    public: bool previewReady = false;
+
+    /// \brief True while the preview loader thread is in flight. Only
+    /// accessed by the render thread.
+    public: bool previewLoading = false;
+
+    /// \brief SDF string the in-flight loader thread was started with.
+    /// Only accessed by the render thread.
+    public: std::string previewLoadingSdfString;
+
+    /// \brief SDF path the in-flight loader thread was started with.
+    /// Only accessed by the render thread.
+    public: std::string previewLoadingSdfPath;
+
     /// \brief Flag for indicating whether the user is currently placing a
     /// resource or not
     public: bool isPlacing = false;
@@ -165,6 +208,61 @@ Spawn::Spawn()
 /////////////////////////////////////////////////
 Spawn::~Spawn() = default;
 
+/////////////////////////////////////////////////
+SpawnPrivate::~SpawnPrivate()
+{
+  if (this->previewLoader.joinable())
+    this->previewLoader.join();
+}
+
+/////////////////////////////////////////////////
+void SpawnPrivate::LoadPreviewResource(const std::string &_sdfString,
+    const std::string &_sdfPath)
+{
+  sdf::Root root;
+  if (!_sdfString.empty())
+    root.LoadSdfString(_sdfString);
+  else if (!_sdfPath.empty())
+    root.Load(_sdfPath);
+
+  // Decode the model's meshes into the shared mesh cache so that
+  // creating the preview geometry on the render thread finds them
+  // already loaded.
+  if (root.Model())
+  {
+    auto meshManager = common::MeshManager::Instance();
+    for (auto j = 0u; j < root.Model()->LinkCount(); ++j)
+    {
+      const sdf::Link *link = root.Model()->LinkByIndex(j);
+      for (auto k = 0u; k < link->VisualCount(); ++k)
+      {
+        const sdf::Geometry *geom = link->VisualByIndex(k)->Geom();
+        if (!geom || geom->Type() != sdf::GeometryType::MESH ||
+            !geom->MeshShape())
+          continue;
+
+        const std::string &uri = geom->MeshShape()->Uri();
+        // name:// meshes live in the mesh cache already
+        if (uri.rfind("name://", 0) == 0)
+          continue;
+
+        std::string fullPath = asFullPath(uri,
+            geom->MeshShape()->FilePath());
+        if (meshManager->IsValidFilename(fullPath) &&
+            !meshManager->Load(fullPath))
+        {
+          gzwarn << "Failed to preload mesh [" << fullPath << "]"
+                  << std::endl;
+        }
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(this->previewLoadMutex);
+  this->previewRoot = std::move(root);
+  this->previewReady = true;
+}
+
 /////////////////////////////////////////////////
 void Spawn::LoadConfig(const tinyxml2::XMLElement *)
 {
@@ -316,34 +414,57 @@ void SpawnPrivate::OnRender()
   GZ_PROFILE("GzRenderer::Render Spawn");
   if (this->generatePreview)
   {
-    bool cloningResource = false;
-
-    // Generate spawn preview
-    rendering::VisualPtr rootVis = this->scene->RootVisual();
-    sdf::Root root;
-    if (!this->spawnSdfString.empty())
+    if (!this->spawnCloneName.empty())
     {
-      root.LoadSdfString(this->spawnSdfString);
-    }
-    else if (!this->spawnSdfPath.empty())
-    {
-      root.Load(this->spawnSdfPath);
+      this->isPlacing = this->GeneratePreview(this->spawnCloneName);
+      this->generatePreview = false;
     }
-    else if (!this->spawnCloneName.empty())
+    else if (!this->spawnSdfString.empty() || !this->spawnSdfPath.empty())
     {
-      this->isPlacing = this->GeneratePreview(this->spawnCloneName);
-      cloningResource = true;
+      // Parse the SDF and decode its meshes off the render thread;
+      // doing it here freezes the GUI for the whole load of a large
+      // asset.
+      if (!this->previewLoading)
+      {
+        this->previewLoading = true;
+        this->previewLoadingSdfString = this->spawnSdfString;
+        this->previewLoadingSdfPath = this->spawnSdfPath;
+        if (this->previewLoader.joinable())
+          this->previewLoader.join();
+        this->previewLoader = std::thread(
+            &SpawnPrivate::LoadPreviewResource, this,
+            this->previewLoadingSdfString, this->previewLoadingSdfPath);
+      }
     }
     else
     {
       gzwarn << "Failed to spawn: no SDF string, path, or name of resource "
               << "to clone" << std::endl;
+      this->generatePreview = false;
     }
+  }
 
-    if (!cloningResource)
-      this->isPlacing = this->GeneratePreview(root);
-
-    this->generatePreview = false;
+  // Create the preview once the loader thread finished. The meshes are
+  // in the cache at this point, so this is quick even for large assets.
+  if (this->previewLoading)
+  {
+    std::lock_guard<std::mutex> lock(this->previewLoadMutex);
+    if (this->previewReady)
+    {
+      // An escape release while loading cancels the spawn, and a newer
+      // spawn request supersedes the resource this load was started
+      // for; in that case the next render iteration restarts the load.
+      bool stale = this->spawnSdfString != this->previewLoadingSdfString ||
+          this->spawnSdfPath != this->previewLoadingSdfPath;
+      if (this->generatePreview && !stale)
+      {
+        this->isPlacing = this->GeneratePreview(this->previewRoot);
+        this->generatePreview = false;
+      }
+      this->previewRoot = sdf::Root();
+      this->previewReady = false;
+      this->previewLoading = false;
+    }
   }
 
   // Escape action, clear all selections and terminate any
@@ -352,6 +473,7 @@ void SpawnPrivate::OnRender()
     if (this->escapeReleased)
     {
       this->TerminateSpawnPreview();
+      this->generatePreview = false;
       this->escapeReleased = false;
     }
   }
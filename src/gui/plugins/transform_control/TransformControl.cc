@@ -662,9 +662,10 @@ void TransformControlPrivate::HandleMouseEvents()
             // * top-level nodes (model, light...)
             if (this->transformMode != rendering::TransformMode::TM_NONE)
             {
-              rendering::VisualPtr clickedVisual = this->scene->VisualAt(
-                    this->camera,
-                    this->mouseEvent.Pos());
+              // Reuse the visual picked above: VisualAt renders the scene's
+              // selection buffer and reads a pixel back, so picking the same
+              // mouse position again would repeat that work.
+              rendering::VisualPtr clickedVisual = visual;
 
               auto topClickedNode = this->TopLevelNode(clickedVisual);
               auto topClickedVisual =
@@ -26,7 +26,6 @@
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Profiler.hh>
-#include <gz/common/VideoEncoder.hh>
 #include <gz/gui/Application.hh>
 #include <gz/gui/GuiEvents.hh>
 #include <gz/gui/MainWindow.hh>
@@ -34,8 +33,8 @@
 #include <gz/rendering/Camera.hh>
 #include <gz/rendering/RenderingIface.hh>
 #include <gz/rendering/Scene.hh>
-#include <gz/transport/Node.hh>
-#include <gz/transport/Publisher.hh>
+
+#include "gz/sim/rendering/VideoCapture.hh"
 
 /// \brief condition variable for lockstepping video recording
 /// todo(anyone) avoid using a global condition variable when we support
@@ -52,17 +51,15 @@ namespace gz::sim
     /// \brief Initialize rendering and transport.
     public: void Initialize();
 
-    /// \brief Gazebo communication node.
-    public: transport::Node node;
-
     /// \brief Pointer to the camera being recorded
     public: rendering::CameraPtr camera{nullptr};
 
     /// \brief Pointer to the 3D scene
     public: rendering::ScenePtr scene{nullptr};
 
-    /// \brief Video encoder
-    public: common::VideoEncoder videoEncoder;
+    /// \brief Worker-thread video capture shared with the camera video
+    /// recorder system, so encoding does not stall the render thread.
+    public: VideoCapture videoCapture;
 
     /// \brief Image from user camera
     public: rendering::Image cameraImage;
@@ -83,12 +80,6 @@ namespace gz::sim
     /// \brief Video recorder bitrate (bps)
     public: unsigned int bitrate = 2070000;
 
-    /// \brief Start tiem of video recording
-    public: std::chrono::steady_clock::time_point startTime;
-
-    /// \brief Camera pose publisher
-    public: transport::Node::Publisher recorderStatsPub;
-
     /// \brief Record stats topic name
     public: std::string recorderStatsTopic = "/gui/record_video/stats";
 
@@ -146,8 +137,7 @@ void VideoRecorderPrivate::Initialize()
   }
 
   // recorder stats topic
-  this->recorderStatsPub =
-    this->node.Advertise<msgs::Time>(this->recorderStatsTopic);
+  this->videoCapture.SetStatsTopic(this->recorderStatsTopic);
   gzmsg << "Video recorder stats topic advertised on ["
          << this->recorderStatsTopic << "]" << std::endl;
 }
@@ -172,7 +162,7 @@ void VideoRecorderPrivate::OnRender()
       }
 
       // Video recorder is on. Add more frames to it
-      if (this->videoEncoder.IsEncoding())
+      if (this->videoCapture.Encoding())
       {
         this->camera->Copy(this->cameraImage);
 
@@ -183,29 +173,9 @@ void VideoRecorderPrivate::OnRender()
           t = std::chrono::steady_clock::time_point(
               this->simTime);
         }
-        bool frameAdded = this->videoEncoder.AddFrame(
-            this->cameraImage.Data<unsigned char>(), width, height, t);
-
-        if (frameAdded)
-        {
-          // publish recorder stats
-          if (this->startTime ==
-              std::chrono::steady_clock::time_point(
-              std::chrono::duration(std::chrono::seconds(0))))
-          {
-            // start time, i.e. time when first frame is added
-            this->startTime = t;
-          }
-
-          std::chrono::steady_clock::duration dt;
-          dt = t - this->startTime;
-          int64_t sec, nsec;
-          std::tie(sec, nsec) = gz::math::durationToSecNsec(dt);
-          msgs::Time msg;
-          msg.set_sec(sec);
-          msg.set_nsec(nsec);
-          this->recorderStatsPub.Publish(msg);
-        }
+        // Hand the frame to the encoder thread; encoding here would
+        // stall the render thread and drop the interactive framerate.
+        this->videoCapture.AddFrame(this->cameraImage, t);
       }
       // Video recorder is idle. Start recording.
       else
@@ -223,16 +193,17 @@ void VideoRecorderPrivate::OnRender()
         }
         gzmsg << "Recording video using bitrate: "
                << this->bitrate <<  std::endl;
-        this->videoEncoder.Start(this->format,
+        // In lockstep mode every frame has to make it into the video,
+        // so block on a full queue instead of dropping.
+        this->videoCapture.SetDropOnOverflow(!this->lockstep);
+        this->videoCapture.Start(this->format,
             this->filename, width, height, 25,
             this->bitrate);
-        this->startTime = std::chrono::steady_clock::time_point(
-            std::chrono::duration(std::chrono::seconds(0)));
       }
     }
-    else if (this->videoEncoder.IsEncoding())
+    else if (this->videoCapture.Encoding())
     {
-      this->videoEncoder.Stop();
+      this->videoCapture.Stop();
     }
   }
   // only has an effect in video recording lockstep mode
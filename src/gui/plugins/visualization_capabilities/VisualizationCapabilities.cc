@@ -102,6 +102,13 @@ namespace gz::sim
     /// \brief Update the 3D scene.
     public: void OnRender();
 
+    /// \brief Maximum number of queued visual creations processed per
+    /// render pass. Bulk toggles such as "view collisions" on a large world
+    /// queue thousands of links at once; spreading their creation across
+    /// frames keeps the GUI interactive. Visuals must be created on the
+    /// render thread, so the work cannot be moved off of it.
+    public: std::size_t visualCreationBudget{50u};
+
     /// \brief Helper function to get all child links of a model entity.
     /// \param[in] _entity Entity to find child links
     /// \return Vector of child links found for the parent entity
@@ -556,8 +563,21 @@ void VisualizationCapabilitiesPrivate::OnRender()
     this->sceneManager.SetScene(this->scene);
   }
 
+  // Number of queued visual creations still allowed in this pass. Each
+  // queue below takes a batch out of the remaining budget and leaves the
+  // rest for the next render pass.
+  std::size_t budget = this->visualCreationBudget;
+  auto takeBatch = [&budget](std::vector<Entity> &_queue)
+  {
+    const std::size_t count = std::min(budget, _queue.size());
+    std::vector<Entity> batch(_queue.begin(), _queue.begin() + count);
+    _queue.erase(_queue.begin(), _queue.begin() + count);
+    budget -= count;
+    return batch;
+  };
+
   // create new wireframe visuals
-  for (const auto &link : this->newWireframeVisualLinks)
+  for (const auto &link : takeBatch(this->newWireframeVisualLinks))
   {
     std::vector<Entity> visEntities =
         this->linkToVisualEntities[link];
@@ -575,7 +595,6 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newWireframeVisualLinks.clear();
 
   // update joint parent visual poses
   {
@@ -587,7 +606,7 @@ void VisualizationCapabilitiesPrivate::OnRender()
   this->updateJointParentPoses.clear();
 
   // create new transparent visuals
-  for (const auto &link : this->newTransparentVisualLinks)
+  for (const auto &link : takeBatch(this->newTransparentVisualLinks))
   {
     std::vector<Entity> visEntities =
         this->linkToVisualEntities[link];
@@ -606,10 +625,9 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newTransparentVisualLinks.clear();
 
   // create new inertia visuals
-  for (const auto &link : this->newInertiaLinks)
+  for (const auto &link : takeBatch(this->newInertiaLinks))
   {
     // create a new id for the inertia visual
     auto attempts = 100000u;
@@ -638,11 +656,10 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newInertiaLinks.clear();
 
   // create new joint visuals
   {
-    for (const auto &model : this->newJointModels)
+    for (const auto &model : takeBatch(this->newJointModels))
     {
       std::vector<Entity> jointEntities =
           this->modelToJointEntities[model];
@@ -680,10 +697,9 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newJointModels.clear();
 
   // create new center of mass visuals
-  for (const auto &link : this->newCOMLinks)
+  for (const auto &link : takeBatch(this->newCOMLinks))
   {
     // create a new id for the center of mass visual
     auto attempts = 100000u;
@@ -712,10 +728,9 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newCOMLinks.clear();
 
   // create new collision visuals
-  for (const auto &link : this->newCollisionLinks)
+  for (const auto &link : takeBatch(this->newCollisionLinks))
   {
     std::vector<Entity> colEntities =
         this->linkToCollisionEntities[link];
@@ -762,10 +777,9 @@ void VisualizationCapabilitiesPrivate::OnRender()
       }
     }
   }
-  this->newCollisionLinks.clear();
 
   // create new frame visuals
-  for (const auto &entity : this->newFrameEntities)
+  for (const auto &entity : takeBatch(this->newFrameEntities))
   {
     if (this->viewingFrames[entity])
       continue;
@@ -794,7 +808,6 @@ void VisualizationCapabilitiesPrivate::OnRender()
       break;
     }
   }
-  this->newFrameEntities.clear();
 
   // View center of mass
   {
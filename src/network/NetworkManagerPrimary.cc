@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <future>
+#include <limits>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -30,6 +32,7 @@
 #include "msgs/peer_control.pb.h"
 #include "msgs/simulation_step.pb.h"
 
+#include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/PerformerAffinity.hh"
 #include "gz/sim/components/PerformerLevels.hh"
 #include "gz/sim/Conversions.hh"
@@ -114,6 +117,8 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
 {
   GZ_PROFILE("NetworkManagerPrimary::Step");
 
+  ++this->stepCount;
+
   // Check all secondaries have been registered
   bool ready = true;
   for (const auto &secondary : this->secondaries)
@@ -147,6 +152,7 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
   this->secondaryStatesPromise = std::promise<void>{};
   auto future = this->secondaryStatesPromise.get_future();
   this->simStepPub.Publish(step);
+  this->dataPtr->tracker->NotifyActivity();
 
   // Block until all secondaries are done
   {
@@ -171,6 +177,29 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
     for (const auto &msg : this->secondaryStates)
     {
       this->dataPtr->ecm->SetState(msg);
+
+      // Update the measured cost of the secondary that sent this state.
+      std::string prefix;
+      double cost{-1.0};
+      for (int i = 0; i < msg.header().data_size(); ++i)
+      {
+        const auto &data = msg.header().data(i);
+        if (data.key() == "secondary" && data.value_size() > 0)
+          prefix = data.value(0);
+        else if (data.key() == "step_ms" && data.value_size() > 0)
+          cost = std::stod(data.value(0));
+      }
+      // The acknowledgement itself proves the secondary is alive.
+      this->dataPtr->tracker->RefreshLiveness(prefix);
+
+      if (!prefix.empty() && cost >= 0.0)
+      {
+        auto costIt = this->secondaryCosts.find(prefix);
+        if (costIt == this->secondaryCosts.end())
+          this->secondaryCosts[prefix] = cost;
+        else
+          costIt->second = 0.9 * costIt->second + 0.1 * cost;
+      }
     }
     this->secondaryStates.clear();
   }
@@ -199,6 +228,45 @@ std::map<std::string, SecondaryControl::Ptr>
 //////////////////////////////////////////////////
 void NetworkManagerPrimary::OnStepAck(const msgs::SerializedStateMap &_msg)
 {
+  // Same-host secondaries publish a small descriptor pointing into their
+  // shared-memory ring instead of the serialized state.
+  for (int i = 0; i < _msg.header().data_size(); ++i)
+  {
+    const auto &data = _msg.header().data(i);
+    if (data.key() != "shm" || data.value_size() < 3)
+      continue;
+
+    const auto &ringName = data.value(0);
+    auto &reader = this->shmReaders[ringName];
+    if (nullptr == reader)
+    {
+      reader = ShmStateBuffer::Open(ringName);
+      if (nullptr == reader)
+      {
+        gzerr << "Failed to open shared-memory ring [" << ringName
+               << "] referenced by a step acknowledgement." << std::endl;
+        break;
+      }
+    }
+
+    std::string bytes;
+    msgs::SerializedStateMap state;
+    if (!reader->Read(std::stoull(data.value(1)), std::stoull(data.value(2)),
+        bytes) || !state.ParseFromString(bytes))
+    {
+      gzerr << "Failed to read step acknowledgement from shared-memory "
+             << "ring [" << ringName << "]." << std::endl;
+      break;
+    }
+
+    this->secondaryStates.push_back(std::move(state));
+    if (this->secondaryStates.size() == this->secondaries.size())
+    {
+      this->secondaryStatesPromise.set_value();
+    }
+    return;
+  }
+
   this->secondaryStates.push_back(_msg);
   if (this->secondaryStates.size() == this->secondaries.size())
   {
@@ -300,7 +368,116 @@ void NetworkManagerPrimary::PopulateAffinities(
     return;
   }
 
+  // Assign performers that appeared at runtime to the secondary with the
+  // lowest measured cost, falling back to the first one before any
+  // samples have arrived.
+  for (auto performer : allPerformers)
+  {
+    if (pToSPrevious.find(performer) != pToSPrevious.end())
+      continue;
+
+    std::string target = this->secondaries.begin()->second->prefix;
+    double best{std::numeric_limits<double>::max()};
+    for (const auto &[prefix, cost] : this->secondaryCosts)
+    {
+      if (cost < best)
+      {
+        best = cost;
+        target = prefix;
+      }
+    }
+    this->SetAffinity(performer, target, _msg.add_affinity());
+  }
+
   // TODO(louise) Process level changes
+
+  this->RebalanceAffinities(pToSPrevious, _msg);
+}
+
+//////////////////////////////////////////////////
+void NetworkManagerPrimary::RebalanceAffinities(
+    const std::map<Entity, std::string> &_pToS,
+    private_msgs::SimulationStep &_msg)
+{
+  GZ_PROFILE("NetworkManagerPrimary::RebalanceAffinities");
+
+  // Need at least two secondaries and a cost sample from each of them.
+  if (this->secondaries.size() < 2 ||
+      this->secondaryCosts.size() < this->secondaries.size())
+  {
+    return;
+  }
+
+  // Current performers per secondary
+  std::map<std::string, std::vector<Entity>> sToP;
+  for (const auto &[performer, prefix] : _pToS)
+  {
+    sToP[prefix].push_back(performer);
+  }
+
+  // Most and least loaded secondaries by measured cost
+  std::string maxPrefix, minPrefix;
+  double maxCost{-1.0};
+  double minCost{std::numeric_limits<double>::max()};
+  for (const auto &[prefix, cost] : this->secondaryCosts)
+  {
+    if (cost > maxCost)
+    {
+      maxCost = cost;
+      maxPrefix = prefix;
+    }
+    if (cost < minCost)
+    {
+      minCost = cost;
+      minPrefix = prefix;
+    }
+  }
+
+  // The source must keep at least one performer, and the imbalance must
+  // exceed the threshold.
+  if (maxPrefix == minPrefix || sToP[maxPrefix].size() < 2 ||
+      maxCost <= this->costRatioThreshold * std::max(minCost, 1e-6))
+  {
+    this->imbalancedSteps = 0;
+    return;
+  }
+
+  // Hysteresis: the imbalance must persist, and migrations must be
+  // spaced out, so a transient spike doesn't bounce performers around.
+  if (++this->imbalancedSteps < this->imbalancePersistSteps)
+    return;
+
+  if (this->stepCount - this->lastMigrationStep <
+      this->migrationCooldownSteps)
+  {
+    return;
+  }
+
+  this->imbalancedSteps = 0;
+  this->lastMigrationStep = this->stepCount;
+
+  // Migrate one performer. The primary holds the authoritative state of
+  // every performer, so the serialized model subtree travels with the
+  // affinity and the new secondary recreates it with the same entity ids.
+  const Entity performer = sToP[maxPrefix].front();
+  auto *affinityMsg = _msg.add_affinity();
+  this->SetAffinity(performer, minPrefix, affinityMsg);
+
+  auto parentComp =
+      this->dataPtr->ecm->Component<components::ParentEntity>(performer);
+  if (parentComp)
+  {
+    this->dataPtr->ecm->State(*affinityMsg->mutable_state(),
+        this->dataPtr->ecm->Descendants(parentComp->Data()), {}, true);
+  }
+
+  // Drop the stale samples so the next decision reflects the new
+  // assignment.
+  this->secondaryCosts.clear();
+
+  gzmsg << "Migrating performer [" << performer << "] from secondary ["
+        << maxPrefix << "] (" << maxCost << " ms) to [" << minPrefix
+        << "] (" << minCost << " ms)" << std::endl;
 }
 
 //////////////////////////////////////////////////
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gz/sim/config.hh>
@@ -33,6 +34,7 @@
 #include "msgs/simulation_step.pb.h"
 
 #include "NetworkManager.hh"
+#include "ShmStateBuffer.hh"
 
 namespace gz
 {
@@ -108,6 +110,18 @@ namespace gz
       private: void SetAffinity(Entity _performer,
           const std::string &_secondary, private_msgs::PerformerAffinity *_msg);
 
+      /// \brief Migrate a performer from the most to the least loaded
+      /// secondary when the measured step costs stay imbalanced beyond
+      /// the threshold. At most one performer moves at a time, the
+      /// imbalance must persist for a number of steps, and a cooldown
+      /// separates consecutive migrations, so transient spikes do not
+      /// cause thrashing.
+      /// \param[in] _pToS Current performer-to-secondary assignment.
+      /// \param[out] _msg Step message the migration is appended to.
+      private: void RebalanceAffinities(
+          const std::map<Entity, std::string> &_pToS,
+          private_msgs::SimulationStep &_msg);
+
       /// \brief Container of currently used secondary peers
       private: std::map<std::string, SecondaryControl::Ptr> secondaries;
 
@@ -122,6 +136,38 @@ namespace gz
 
       /// \brief Promise used to notify when all secondaryStates where received.
       private: std::promise<void> secondaryStatesPromise;
+
+      /// \brief Shared-memory rings of same-host secondaries, keyed by
+      /// ring name and opened lazily when the first descriptor message
+      /// referencing them arrives.
+      private: std::unordered_map<std::string,
+          std::unique_ptr<ShmStateBuffer>> shmReaders;
+
+      /// \brief Exponential moving average of the step cost each secondary
+      /// reports in its acknowledgements, in milliseconds, keyed by
+      /// secondary prefix.
+      private: std::map<std::string, double> secondaryCosts;
+
+      /// \brief Number of steps run so far, used for the migration
+      /// cooldown.
+      private: uint64_t stepCount{0};
+
+      /// \brief Step at which the last migration happened.
+      private: uint64_t lastMigrationStep{0};
+
+      /// \brief Number of consecutive steps the cost imbalance has been
+      /// above the threshold.
+      private: uint64_t imbalancedSteps{0};
+
+      /// \brief Ratio between the most and least loaded secondary's cost
+      /// above which a migration is considered.
+      private: double costRatioThreshold{1.5};
+
+      /// \brief Steps the imbalance must persist before migrating.
+      private: uint64_t imbalancePersistSteps{100};
+
+      /// \brief Minimum number of steps between migrations.
+      private: uint64_t migrationCooldownSteps{1000};
     };
     }
   }  // namespace sim
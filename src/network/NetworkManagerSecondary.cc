@@ -16,7 +16,9 @@
 */
 
 #include <algorithm>
+#include <chrono>
 #include <string>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -62,6 +64,24 @@ NetworkManagerSecondary::NetworkManagerSecondary(
   this->node.Subscribe("step", &NetworkManagerSecondary::OnStep, this);
 
   this->stepAckPub = this->node.Advertise<msgs::SerializedStateMap>("step_ack");
+
+  // Optional speculative stepping: run up to this many steps ahead of the
+  // primary using the last known affinities, rolling back when a step
+  // message invalidates the speculation.
+  std::string speculativeStepsStr;
+  if (common::env("GZ_SIM_SPECULATIVE_STEPS", speculativeStepsStr))
+  {
+    try
+    {
+      this->speculativeSteps = std::stoul(speculativeStepsStr);
+    }
+    catch (const std::exception &)
+    {
+      gzwarn << "Invalid GZ_SIM_SPECULATIVE_STEPS value ["
+             << speculativeStepsStr << "], speculative stepping disabled."
+             << std::endl;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -102,6 +122,9 @@ void NetworkManagerSecondary::OnStep(
 {
   GZ_PROFILE("NetworkManagerSecondary::OnStep");
 
+  // The step itself proves the primary is alive.
+  this->dataPtr->tracker->RefreshLiveness(NetworkRole::SimulationPrimary);
+
   // Throttle the number of step messages going to the debug output.
   if (!_msg.stats().paused() && _msg.stats().iterations() % 1000 == 0)
   {
@@ -109,6 +132,54 @@ void NetworkManagerSecondary::OnStep(
            << std::endl;
   }
 
+  // Try to satisfy the step from the speculative window.
+  if (!this->speculativeWindow.empty())
+  {
+    auto expected = convert<UpdateInfo>(_msg.stats());
+    auto &front = this->speculativeWindow.front();
+
+    if (_msg.affinity_size() == 0 &&
+        front.info.iterations == expected.iterations &&
+        front.info.paused == expected.paused &&
+        front.info.dt == expected.dt &&
+        front.info.simTime == expected.simTime)
+    {
+      // The speculation holds: acknowledge from the captured state
+      // without stepping.
+      const bool keyframe = this->stateKeyframeInterval == 0 ||
+          front.info.iterations % this->stateKeyframeInterval == 0;
+      this->FilterUnchangedComponents(front.state, keyframe);
+      front.state.set_has_one_time_component_changes(
+          front.hasOneTimeChanges);
+
+      auto *headerData = front.state.mutable_header()->add_data();
+      headerData->set_key("secondary");
+      headerData->add_value(this->Namespace());
+      headerData = front.state.mutable_header()->add_data();
+      headerData->set_key("step_ms");
+      headerData->add_value(std::to_string(front.stepCostMs));
+
+      this->PublishAck(front.state);
+
+      this->confirmedInfos.push_back(front.info);
+      this->speculativeWindow.pop_front();
+      this->SpeculateAhead(expected);
+      return;
+    }
+
+    // The primary's step invalidates the speculation: roll back to the
+    // window baseline and replay the steps that were already confirmed.
+    // The value-level delta filter makes the next acknowledgement carry
+    // only what actually differs from the last published state.
+    this->dataPtr->ecm->ResetTo(this->speculationBaseline);
+    for (const auto &replayInfo : this->confirmedInfos)
+    {
+      this->dataPtr->stepFunction(replayInfo);
+    }
+    this->speculativeWindow.clear();
+    this->confirmedInfos.clear();
+  }
+
   // Update affinities
   for (int i = 0; i < _msg.affinity_size(); ++i)
   {
@@ -117,6 +188,14 @@ void NetworkManagerSecondary::OnStep(
 
     if (affinityMsg.secondary_prefix() == this->Namespace())
     {
+      // A performer migrating from another secondary arrives with the
+      // primary's authoritative state of its model subtree; applying it
+      // recreates the model with the entity ids the network already uses.
+      if (affinityMsg.state().entities_size() > 0)
+      {
+        this->dataPtr->ecm->SetState(affinityMsg.state());
+      }
+
       this->performers.insert(entityId);
 
       gzmsg << "Secondary [" << this->Namespace()
@@ -143,10 +222,101 @@ void NetworkManagerSecondary::OnStep(
   // Update info
   auto info = convert<UpdateInfo>(_msg.stats());
 
-  // Step runner
+  // Step runner, measuring its cost so the primary can rebalance
+  // performers across secondaries.
+  auto stepStart = std::chrono::steady_clock::now();
   this->dataPtr->stepFunction(info);
+  const double stepMs = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - stepStart).count();
 
   // Update state with all the performer's entities
+  auto entities = this->PerformerEntities();
+
+  msgs::SerializedStateMap stateMsg;
+  if (!entities.empty())
+  {
+    // Periodically serialize the performers' full state as a resync
+    // keyframe; in between, send only the change-tracked components and
+    // drop the ones whose serialized value did not actually move.
+    const bool keyframe = this->stateKeyframeInterval == 0 ||
+        _msg.stats().iterations() % this->stateKeyframeInterval == 0;
+
+    this->dataPtr->ecm->State(stateMsg, entities, {}, keyframe);
+    this->FilterUnchangedComponents(stateMsg, keyframe);
+  }
+  stateMsg.set_has_one_time_component_changes(
+    this->dataPtr->ecm->HasOneTimeComponentChanges());
+
+  auto *headerData = stateMsg.mutable_header()->add_data();
+  headerData->set_key("secondary");
+  headerData->add_value(this->Namespace());
+  headerData = stateMsg.mutable_header()->add_data();
+  headerData->set_key("step_ms");
+  headerData->add_value(std::to_string(stepMs));
+
+  this->PublishAck(stateMsg);
+
+  this->dataPtr->ecm->SetAllComponentsUnchanged();
+
+  this->SpeculateAhead(info);
+}
+
+/////////////////////////////////////////////////
+void NetworkManagerSecondary::PublishAck(const msgs::SerializedStateMap &_msg)
+{
+  if (!this->shmChecked)
+  {
+    this->shmChecked = true;
+
+    // The state exchange only goes through shared memory when the primary
+    // was discovered on this host.
+    auto primaryHost = this->dataPtr->tracker->PeerHostname(
+        NetworkRole::SimulationPrimary);
+    if (!primaryHost.empty() &&
+        primaryHost == this->dataPtr->peerInfo.hostname)
+    {
+      // Sized to hold many steps' worth of state, so blocks are long
+      // consumed before the ring wraps back over them.
+      const uint64_t kShmCapacity = 64 << 20;
+      this->shmBuffer = ShmStateBuffer::Create(
+          "/gz-sim-" + this->Namespace() + "-step-ack", kShmCapacity);
+      if (this->shmBuffer)
+      {
+        gzmsg << "Primary is on the same host; exchanging state through "
+              << "shared memory [" << this->shmBuffer->Name() << "]."
+              << std::endl;
+      }
+    }
+  }
+
+  if (this->shmBuffer)
+  {
+    std::string bytes;
+    if (_msg.SerializeToString(&bytes))
+    {
+      auto offset = this->shmBuffer->Write(bytes);
+      if (offset)
+      {
+        msgs::SerializedStateMap descriptor;
+        auto *headerData = descriptor.mutable_header()->add_data();
+        headerData->set_key("shm");
+        headerData->add_value(this->shmBuffer->Name());
+        headerData->add_value(std::to_string(*offset));
+        headerData->add_value(std::to_string(bytes.size()));
+        this->stepAckPub.Publish(descriptor);
+        this->dataPtr->tracker->NotifyActivity();
+        return;
+      }
+    }
+  }
+
+  this->stepAckPub.Publish(_msg);
+  this->dataPtr->tracker->NotifyActivity();
+}
+
+/////////////////////////////////////////////////
+std::unordered_set<Entity> NetworkManagerSecondary::PerformerEntities() const
+{
   std::unordered_set<Entity> entities;
   for (const auto &perf : this->performers)
   {
@@ -163,14 +333,103 @@ void NetworkManagerSecondary::OnStep(
     auto children = this->dataPtr->ecm->Descendants(modelEntity);
     entities.insert(children.begin(), children.end());
   }
+  return entities;
+}
 
-  msgs::SerializedStateMap stateMsg;
-  if (!entities.empty())
-    this->dataPtr->ecm->State(stateMsg, entities);
-  stateMsg.set_has_one_time_component_changes(
-    this->dataPtr->ecm->HasOneTimeComponentChanges());
+/////////////////////////////////////////////////
+void NetworkManagerSecondary::SpeculateAhead(const UpdateInfo &_lastInfo)
+{
+  if (this->speculativeSteps == 0 || !this->speculativeWindow.empty() ||
+      _lastInfo.paused || !this->enableSim)
+  {
+    return;
+  }
 
-  this->stepAckPub.Publish(stateMsg);
+  GZ_PROFILE("NetworkManagerSecondary::SpeculateAhead");
 
-  this->dataPtr->ecm->SetAllComponentsUnchanged();
+  // The window is empty, so the ECM holds the state of the last confirmed
+  // step; that state is the rollback baseline for the new window.
+  this->speculationBaseline.CopyFrom(*this->dataPtr->ecm);
+  this->confirmedInfos.clear();
+
+  UpdateInfo info = _lastInfo;
+  for (uint64_t i = 0; i < this->speculativeSteps; ++i)
+  {
+    ++info.iterations;
+    info.simTime += info.dt;
+    info.realTime += info.dt;
+
+    auto stepStart = std::chrono::steady_clock::now();
+    this->dataPtr->stepFunction(info);
+
+    SpeculativeStep step;
+    step.info = info;
+    step.stepCostMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - stepStart).count();
+    auto entities = this->PerformerEntities();
+    if (!entities.empty())
+    {
+      const bool keyframe = this->stateKeyframeInterval == 0 ||
+          info.iterations % this->stateKeyframeInterval == 0;
+      this->dataPtr->ecm->State(step.state, entities, {}, keyframe);
+    }
+    step.hasOneTimeChanges =
+        this->dataPtr->ecm->HasOneTimeComponentChanges();
+    this->dataPtr->ecm->SetAllComponentsUnchanged();
+
+    this->speculativeWindow.push_back(std::move(step));
+  }
+}
+
+/////////////////////////////////////////////////
+void NetworkManagerSecondary::FilterUnchangedComponents(
+    msgs::SerializedStateMap &_msg, const bool _keyframe)
+{
+  GZ_PROFILE("NetworkManagerSecondary::FilterUnchangedComponents");
+
+  if (_keyframe)
+    this->lastSentComponents.clear();
+
+  std::vector<uint64_t> entitiesToDrop;
+  for (auto &[entityId, entityMsg] : *_msg.mutable_entities())
+  {
+    if (entityMsg.remove())
+    {
+      this->lastSentComponents.erase(entityId);
+      continue;
+    }
+
+    auto &cache = this->lastSentComponents[entityId];
+
+    std::vector<int64_t> componentsToDrop;
+    for (auto &[typeId, compMsg] : *entityMsg.mutable_components())
+    {
+      if (compMsg.remove())
+      {
+        cache.erase(typeId);
+        continue;
+      }
+
+      auto cacheIter = cache.find(typeId);
+      if (!_keyframe && cacheIter != cache.end() &&
+          cacheIter->second == compMsg.component())
+      {
+        componentsToDrop.push_back(typeId);
+        continue;
+      }
+
+      cache[typeId] = compMsg.component();
+    }
+
+    for (const auto typeId : componentsToDrop)
+      entityMsg.mutable_components()->erase(typeId);
+
+    // An entity entry that carries neither components nor a remove flag
+    // tells the primary nothing new.
+    if (entityMsg.components().empty())
+      entitiesToDrop.push_back(entityId);
+  }
+
+  for (const auto entityId : entitiesToDrop)
+    _msg.mutable_entities()->erase(entityId);
 }
@@ -18,11 +18,17 @@
 #define GZ_SIM_NETWORK_NETWORKMANAGERSECONDARY_HH_
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+
+#include <gz/msgs/serialized_map.pb.h>
 
 #include <gz/sim/config.hh>
+#include <gz/sim/EntityComponentManager.hh>
 #include <gz/sim/Export.hh>
 #include <gz/transport/Node.hh>
 
@@ -30,6 +36,7 @@
 #include "msgs/peer_control.pb.h"
 
 #include "NetworkManager.hh"
+#include "ShmStateBuffer.hh"
 
 namespace gz
 {
@@ -70,6 +77,40 @@ namespace gz
       /// \param[in] _msg Step message.
       private: void OnStep(const private_msgs::SimulationStep &_msg);
 
+      /// \brief Remove from a state message the components whose serialized
+      /// value is identical to what was last sent to the primary, and
+      /// refresh the cache with the values that are kept. Physics marks the
+      /// components of everything it touches as changed every step, so the
+      /// change-tracked state still carries many values that did not move;
+      /// comparing the serialized bytes suppresses those.
+      /// \param[in, out] _msg State message to filter.
+      /// \param[in] _keyframe True if the message is a full keyframe, in
+      /// which case nothing is removed and the cache is rebuilt.
+      private: void FilterUnchangedComponents(msgs::SerializedStateMap &_msg,
+          bool _keyframe);
+
+      /// \brief Collect the entities of all performers assigned to this
+      /// secondary, including their descendants.
+      /// \return Set of entities to serialize for the primary.
+      private: std::unordered_set<Entity> PerformerEntities() const;
+
+      /// \brief Run steps ahead of the primary using the last known
+      /// affinities, capturing the state after each one. When the
+      /// primary's next step messages match the speculation, their
+      /// acknowledgements are published from the captured states without
+      /// stepping, hiding the network round trip. Only runs once the
+      /// speculative window has fully drained, so the rollback replay is
+      /// bounded by the window size.
+      /// \param[in] _lastInfo Info of the last step that was run.
+      private: void SpeculateAhead(const UpdateInfo &_lastInfo);
+
+      /// \brief Publish a step acknowledgement. When the primary runs on
+      /// the same host, the serialized state goes through the
+      /// shared-memory ring and only a small descriptor is published;
+      /// otherwise the state is published as-is.
+      /// \param[in] _msg Acknowledgement state to deliver.
+      private: void PublishAck(const msgs::SerializedStateMap &_msg);
+
       /// \brief Flag to control enabling/disabling simulation secondary.
       private: std::atomic<bool> enableSim {false};
 
@@ -81,6 +122,63 @@ namespace gz
 
       /// \brief Collection of performers associated with this secondary.
       private: std::unordered_set<Entity> performers;
+
+      /// \brief Serialized bytes last sent to the primary, per entity and
+      /// component type.
+      private: std::unordered_map<uint64_t,
+          std::unordered_map<int64_t, std::string>> lastSentComponents;
+
+      /// \brief Interval, in iterations, at which the full state of the
+      /// performers is sent to the primary instead of a delta. The deltas
+      /// only carry components whose value changed, so the keyframe bounds
+      /// how long the primary can stay out of sync. Zero sends full state
+      /// every step.
+      private: uint64_t stateKeyframeInterval{100};
+
+      /// \brief One speculative step: the info it was run with and the
+      /// change-tracked state captured right after it. The value-level
+      /// delta filtering happens at publish time, so speculations that
+      /// are rolled back never touch the delta cache.
+      private: struct SpeculativeStep
+      {
+        /// \brief Info the step was run with.
+        UpdateInfo info;
+
+        /// \brief Change-tracked state captured after the step.
+        msgs::SerializedStateMap state;
+
+        /// \brief Whether one-time component changes were pending.
+        bool hasOneTimeChanges{false};
+
+        /// \brief Measured cost of the step, in milliseconds, reported to
+        /// the primary for load balancing.
+        double stepCostMs{0.0};
+      };
+
+      /// \brief Steps run ahead of the primary, oldest first.
+      private: std::list<SpeculativeStep> speculativeWindow;
+
+      /// \brief Infos of the steps confirmed since the speculation
+      /// baseline was taken, replayed after a rollback to rebuild the
+      /// confirmed state.
+      private: std::vector<UpdateInfo> confirmedInfos;
+
+      /// \brief ECM snapshot at the start of the speculation window,
+      /// restored when the primary's step invalidates the speculation.
+      private: EntityComponentManager speculationBaseline;
+
+      /// \brief Number of steps to run ahead of the primary. Read from
+      /// GZ_SIM_SPECULATIVE_STEPS; zero disables speculative stepping and
+      /// keeps strict lockstep.
+      private: uint64_t speculativeSteps{0};
+
+      /// \brief Shared-memory ring toward a same-host primary. Null when
+      /// the primary is remote or the platform has no shared memory
+      /// support, in which case acknowledgements go over the wire.
+      private: std::unique_ptr<ShmStateBuffer> shmBuffer;
+
+      /// \brief Whether the same-host check has been performed.
+      private: bool shmChecked{false};
     };
     }
   }  // namespace sim
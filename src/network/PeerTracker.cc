@@ -96,17 +96,17 @@ size_t PeerTracker::StaleMultiplier() const
 /////////////////////////////////////////////////
 size_t PeerTracker::NumPeers() const
 {
-  auto lock = PeerLock(this->peersMutex);
+  auto lock = PeerReadLock(this->peersMutex);
   return this->peers.size();
 }
 
 /////////////////////////////////////////////////
 size_t PeerTracker::NumPeers(const NetworkRole &_role) const
 {
-  auto lock = PeerLock(this->peersMutex);
+  auto lock = PeerReadLock(this->peersMutex);
 
   size_t count = 0;
-  for (auto peer : peers)
+  for (const auto &peer : peers)
   {
     if (peer.second.info.role == _role)
     {
@@ -116,6 +116,55 @@ size_t PeerTracker::NumPeers(const NetworkRole &_role) const
   return count;
 }
 
+/////////////////////////////////////////////////
+void PeerTracker::NotifyActivity()
+{
+  this->lastActivity =
+      std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+/////////////////////////////////////////////////
+void PeerTracker::RefreshLiveness(const std::string &_idOrPrefix)
+{
+  if (_idOrPrefix.empty())
+    return;
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+  auto lock = PeerReadLock(this->peersMutex);
+  auto iter = this->peers.find(_idOrPrefix);
+  if (iter != this->peers.end())
+  {
+    iter->second.lastSeen = now;
+    return;
+  }
+
+  // Step topics identify peers by the prefix of their id.
+  for (auto &peer : this->peers)
+  {
+    if (peer.first.compare(0, _idOrPrefix.size(), _idOrPrefix) == 0)
+    {
+      peer.second.lastSeen = now;
+      return;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void PeerTracker::RefreshLiveness(const NetworkRole &_role)
+{
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+
+  auto lock = PeerReadLock(this->peersMutex);
+  for (auto &peer : this->peers)
+  {
+    if (peer.second.info.role == _role)
+    {
+      peer.second.lastSeen = now;
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 void PeerTracker::HeartbeatLoop()
 {
@@ -125,15 +174,28 @@ void PeerTracker::HeartbeatLoop()
   while (this->heartbeatRunning)
   {
     lastUpdateTime = Clock::now();
-    this->heartbeatPub.Publish(toProto(this->info));
+
+    // Step traffic already proves this peer is alive to anyone receiving
+    // it, so only publish a heartbeat when the network has been idle for
+    // a full period.
+    auto idleTime = lastUpdateTime -
+        Clock::time_point(Clock::duration(this->lastActivity.load()));
+    if (idleTime >= this->heartbeatPeriod)
+    {
+      this->heartbeatPub.Publish(toProto(this->info));
+    }
 
     std::vector<PeerInfo> toRemove;
-    for (auto peer : this->peers)
     {
-      auto age = Clock::now() - peer.second.lastSeen;
-      if (age > (this->staleMultiplier * this->heartbeatPeriod))
+      auto lock = PeerReadLock(this->peersMutex);
+      for (const auto &peer : this->peers)
       {
-        toRemove.push_back(peer.second.info);
+        auto age = Clock::now() -
+            Clock::time_point(Clock::duration(peer.second.lastSeen.load()));
+        if (age > (this->staleMultiplier * this->heartbeatPeriod))
+        {
+          toRemove.push_back(peer.second.info);
+        }
       }
     }
 
@@ -205,33 +267,39 @@ void PeerTracker::OnPeerHeartbeat(const private_msgs::PeerInfo &_info)
     return;
   }
 
-  auto lock = PeerLock(this->peersMutex);
-
-  // If it doesn't exist, we may have missed a peer announce,
-  // so add it here on the heartbeat.
-  if (this->peers.find(peer.id) == this->peers.end())
+  // Update information about the state of this peer. The time stamps
+  // are atomic, so the common refresh path only needs a shared lock.
   {
-    this->OnPeerAdded(peer);
+    auto lock = PeerReadLock(this->peersMutex);
+    auto iter = this->peers.find(peer.id);
+    if (iter != this->peers.end())
+    {
+      iter->second.lastSeen =
+          std::chrono::steady_clock::now().time_since_epoch().count();
+      iter->second.lastHeader = std::chrono::steady_clock::duration(
+          std::chrono::seconds(_info.header().stamp().sec()) +
+          std::chrono::nanoseconds(_info.header().stamp().nsec())).count();
+      return;
+    }
   }
 
-  // Update information about the state of this peer.
-  auto &peerState = this->peers[peer.id];
-  peerState.lastSeen = std::chrono::steady_clock::now();
-  peerState.lastHeader = std::chrono::steady_clock::time_point(
-      std::chrono::seconds(_info.header().stamp().sec()) +
-      std::chrono::nanoseconds(_info.header().stamp().nsec()));
+  // We may have missed a peer announce, so add it here on the heartbeat.
+  this->OnPeerAdded(peer);
 }
 
 /////////////////////////////////////////////////
 void PeerTracker::OnPeerAdded(const PeerInfo &_info)
 {
-  auto lock = PeerLock(this->peersMutex);
-  auto peerState = PeerState();
-  peerState.info = _info;
-  peerState.lastSeen = std::chrono::steady_clock::now();
-  this->peers[_info.id] = peerState;
+  {
+    auto lock = PeerLock(this->peersMutex);
+    auto &peerState = this->peers[_info.id];
+    peerState.info = _info;
+    peerState.lastSeen =
+        std::chrono::steady_clock::now().time_since_epoch().count();
+  }
 
-  // Emit event for any consumers
+  // Emit event for any consumers, outside the lock so they can query
+  // the tracker.
   if (eventMgr)
     eventMgr->Emit<PeerAdded>(_info);
 }
@@ -17,8 +17,10 @@
 #ifndef GZ_SIM_NETWORK_PEERTRACKER_HH_
 #define GZ_SIM_NETWORK_PEERTRACKER_HH_
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -128,6 +130,7 @@ namespace gz
       /// \brief Retrieve the ids of discovered peers.
       public: std::vector<std::string> SecondaryPeers() const
               {
+                PeerReadLock lock(this->peersMutex);
                 std::vector<std::string> ret;
                 for (const auto& it : this->peers)
                 {
@@ -136,6 +139,53 @@ namespace gz
                 return ret;
               }
 
+      /// \brief Retrieve the hostname of the first discovered peer with
+      /// the given role.
+      /// \param[in] _role Role to look for.
+      /// \return The peer's hostname, or empty if no such peer was
+      /// discovered.
+      public: std::string PeerHostname(const NetworkRole &_role) const
+              {
+                PeerReadLock lock(this->peersMutex);
+                for (const auto &it : this->peers)
+                {
+                  if (it.second.info.role == _role)
+                    return it.second.info.hostname;
+                }
+                return {};
+              }
+
+      /// \brief Retrieve the hostname of the discovered peer with the
+      /// given id.
+      /// \param[in] _id Peer id to look for.
+      /// \return The peer's hostname, or empty if no such peer was
+      /// discovered.
+      public: std::string PeerHostname(const std::string &_id) const
+              {
+                PeerReadLock lock(this->peersMutex);
+                auto it = this->peers.find(_id);
+                if (it != this->peers.end())
+                  return it->second.info.hostname;
+                return {};
+              }
+
+      /// \brief Record that simulation traffic was just sent to the
+      /// network. Step and acknowledgement messages prove this peer is
+      /// alive to anyone receiving them, so the heartbeat loop only
+      /// publishes when no traffic went out for a full period.
+      public: void NotifyActivity();
+
+      /// \brief Refresh the liveness of a peer from simulation traffic,
+      /// as if a heartbeat had been received from it.
+      /// \param[in] _idOrPrefix Peer id, or the prefix of one as used by
+      /// the step topics.
+      public: void RefreshLiveness(const std::string &_idOrPrefix);
+
+      /// \brief Refresh the liveness of all peers with the given role
+      /// from simulation traffic.
+      /// \param[in] _role Role of the peers to refresh.
+      public: void RefreshLiveness(const NetworkRole &_role);
+
       /// \brief Internal loop to announce and check stale peers.
       private: void HeartbeatLoop();
 
@@ -164,25 +214,32 @@ namespace gz
       /// \param[in] _info Info from peer which is stale.
       private: void OnPeerStale(const PeerInfo &_info);
 
-      /// \brief Information about discovered peers
+      /// \brief Information about discovered peers.
+      /// The time stamps are stored as steady clock ticks in atomics so
+      /// that the frequent refresh paths (heartbeats, step traffic) only
+      /// need a shared lock on the map; the exclusive lock is reserved
+      /// for peers being added or removed.
       struct PeerState
       {
         /// \brief Peer info
         PeerInfo info;
 
          /// \brief Keep last header time
-        std::chrono::steady_clock::time_point lastHeader;
+        std::atomic<std::chrono::steady_clock::rep> lastHeader{0};
 
-        /// \brief Keep last time heartbeat was received
-        std::chrono::steady_clock::time_point lastSeen;
+        /// \brief Keep last time heartbeat or step traffic was received
+        std::atomic<std::chrono::steady_clock::rep> lastSeen{0};
       };
 
       /// \brief Convenience type alias
-      private: using PeerMutex = std::recursive_mutex;
+      private: using PeerMutex = std::shared_mutex;
 
-      /// \brief Convenience type alias
+      /// \brief Exclusive lock, for changes to the set of peers.
       private: using PeerLock = std::lock_guard<PeerMutex>;
 
+      /// \brief Shared lock, for queries and in-place refreshes.
+      private: using PeerReadLock = std::shared_lock<PeerMutex>;
+
       /// \brief Used for guarding map of peers.
       /// N.b. marked mutable to allow const in places that are read only.
       private: mutable PeerMutex peersMutex;
@@ -199,6 +256,10 @@ namespace gz
       /// \brief Period to publish heartbeat at
       private: Duration heartbeatPeriod {std::chrono::milliseconds(100)};
 
+      /// \brief Last time simulation traffic was sent, as steady clock
+      /// ticks. Heartbeats are suppressed while traffic keeps flowing.
+      private: std::atomic<std::chrono::steady_clock::rep> lastActivity{0};
+
       /// \brief Timeout to mark a peer as stale.
       private: size_t staleMultiplier {100};
 
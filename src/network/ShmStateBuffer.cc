@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "ShmStateBuffer.hh"
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+std::unique_ptr<ShmStateBuffer> ShmStateBuffer::Create(
+    const std::string &_name, const uint64_t _capacity)
+{
+#ifndef _WIN32
+  // Remove any region left over from a previous run that did not shut
+  // down cleanly.
+  shm_unlink(_name.c_str());
+
+  int fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0)
+    return nullptr;
+
+  if (ftruncate(fd, static_cast<off_t>(_capacity)) != 0)
+  {
+    close(fd);
+    shm_unlink(_name.c_str());
+    return nullptr;
+  }
+
+  void *mem = mmap(nullptr, _capacity, PROT_READ | PROT_WRITE, MAP_SHARED,
+      fd, 0);
+  close(fd);
+  if (MAP_FAILED == mem)
+  {
+    shm_unlink(_name.c_str());
+    return nullptr;
+  }
+
+  auto buffer = std::unique_ptr<ShmStateBuffer>(new ShmStateBuffer());
+  buffer->name = _name;
+  buffer->ringData = static_cast<uint8_t *>(mem);
+  buffer->capacity = _capacity;
+  buffer->owner = true;
+  return buffer;
+#else
+  (void)_name;
+  (void)_capacity;
+  return nullptr;
+#endif
+}
+
+/////////////////////////////////////////////////
+std::unique_ptr<ShmStateBuffer> ShmStateBuffer::Open(const std::string &_name)
+{
+#ifndef _WIN32
+  int fd = shm_open(_name.c_str(), O_RDONLY, 0600);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  void *mem = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+      MAP_SHARED, fd, 0);
+  close(fd);
+  if (MAP_FAILED == mem)
+    return nullptr;
+
+  auto buffer = std::unique_ptr<ShmStateBuffer>(new ShmStateBuffer());
+  buffer->name = _name;
+  buffer->ringData = static_cast<uint8_t *>(mem);
+  buffer->capacity = static_cast<uint64_t>(info.st_size);
+  return buffer;
+#else
+  (void)_name;
+  return nullptr;
+#endif
+}
+
+/////////////////////////////////////////////////
+ShmStateBuffer::~ShmStateBuffer()
+{
+#ifndef _WIN32
+  if (this->ringData)
+    munmap(this->ringData, this->capacity);
+  if (this->owner)
+    shm_unlink(this->name.c_str());
+#endif
+}
+
+/////////////////////////////////////////////////
+std::optional<uint64_t> ShmStateBuffer::Write(const std::string &_data)
+{
+  if (_data.size() > this->capacity)
+    return std::nullopt;
+
+  // Keep every block contiguous: wrap to the start when the block does
+  // not fit in the remaining tail space.
+  if (this->writeOffset + _data.size() > this->capacity)
+    this->writeOffset = 0;
+
+  std::memcpy(this->ringData + this->writeOffset, _data.data(), _data.size());
+
+  const uint64_t offset = this->writeOffset;
+  this->writeOffset += _data.size();
+  return offset;
+}
+
+/////////////////////////////////////////////////
+bool ShmStateBuffer::Read(const uint64_t _offset, const uint64_t _size,
+    std::string &_data) const
+{
+  if (_offset > this->capacity || _size > this->capacity - _offset)
+    return false;
+
+  _data.assign(reinterpret_cast<const char *>(this->ringData + _offset),
+      _size);
+  return true;
+}
+
+/////////////////////////////////////////////////
+const std::string &ShmStateBuffer::Name() const
+{
+  return this->name;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_NETWORK_SHMSTATEBUFFER_HH_
+#define GZ_SIM_NETWORK_SHMSTATEBUFFER_HH_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/Export.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    /// \class ShmStateBuffer ShmStateBuffer.hh
+    /// \brief Single-producer, single-consumer shared-memory ring used to
+    /// move serialized state between a primary and a secondary running on
+    /// the same host, so multi-megabyte state messages skip the loopback
+    /// transport. The producer writes a contiguous block and hands its
+    /// offset and size to the consumer in a small descriptor message; the
+    /// descriptor traveling over the regular transport is the
+    /// synchronization point between the two processes.
+    ///
+    /// The ring relies on the step protocol being strictly
+    /// request-acknowledge: the consumer reads each block before the
+    /// producer has written more than a ring's worth of new data, so
+    /// blocks are never overwritten while still unread.
+    ///
+    /// Only implemented for POSIX shared memory; Create and Open return
+    /// nullptr on unsupported platforms, in which case callers keep using
+    /// the wire protocol.
+    class GZ_SIM_VISIBLE ShmStateBuffer
+    {
+      /// \brief Create a ring as the producing side, replacing any
+      /// leftover region with the same name.
+      /// \param[in] _name Shared memory object name. Must start with '/'
+      /// and contain no further slashes.
+      /// \param[in] _capacity Ring capacity in bytes.
+      /// \return The buffer, or nullptr if the region could not be set up.
+      public: static std::unique_ptr<ShmStateBuffer> Create(
+          const std::string &_name, uint64_t _capacity);
+
+      /// \brief Open an existing ring as the consuming side.
+      /// \param[in] _name Shared memory object name used by the producer.
+      /// \return The buffer, or nullptr if the region could not be opened.
+      public: static std::unique_ptr<ShmStateBuffer> Open(
+          const std::string &_name);
+
+      /// \brief Destructor. Unmaps the region, and unlinks it on the
+      /// producing side.
+      public: ~ShmStateBuffer();
+
+      /// \brief Write a block of data into the ring, wrapping to the
+      /// start when the block does not fit in the remaining tail space.
+      /// \param[in] _data Bytes to write.
+      /// \return Offset of the block within the ring, or nullopt if the
+      /// block is larger than the ring.
+      public: std::optional<uint64_t> Write(const std::string &_data);
+
+      /// \brief Read a block of data out of the ring.
+      /// \param[in] _offset Offset of the block within the ring.
+      /// \param[in] _size Size of the block in bytes.
+      /// \param[out] _data Bytes read.
+      /// \return False if the block does not lie within the ring.
+      public: bool Read(uint64_t _offset, uint64_t _size,
+          std::string &_data) const;
+
+      /// \brief Get the shared memory object name.
+      /// \return The name passed to Create or Open.
+      public: const std::string &Name() const;
+
+      /// \brief Constructor. Use Create or Open instead.
+      private: ShmStateBuffer() = default;
+
+      /// \brief Shared memory object name.
+      private: std::string name;
+
+      /// \brief Mapped ring memory.
+      private: uint8_t *ringData{nullptr};
+
+      /// \brief Ring capacity in bytes.
+      private: uint64_t capacity{0};
+
+      /// \brief Next write position. Only used by the producing side.
+      private: uint64_t writeOffset{0};
+
+      /// \brief Whether this side created, and therefore unlinks, the
+      /// region.
+      private: bool owner{false};
+    };
+    }
+  }  // namespace sim
+}  // namespace gz
+
+#endif  // GZ_SIM_NETWORK_SHMSTATEBUFFER_HH_
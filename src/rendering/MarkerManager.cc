@@ -103,6 +103,11 @@ class gz::sim::MarkerManagerPrivate
   /// \brief Previous sim time received
   public: std::chrono::steady_clock::duration lastSimTime;
 
+  /// \brief Whether the last lifetime sweep found any marker with a finite
+  /// lifetime. When false and no new messages arrived, Update can skip
+  /// walking the marker visuals entirely.
+  public: bool hasLifetimeMarkers{false};
+
   /// \brief Mutex to protect message list.
   public: std::mutex mutex;
 
@@ -125,6 +130,11 @@ class gz::sim::MarkerManagerPrivate
   /// \brief The last marker message received
   public: msgs::Marker msg;
 
+  /// \brief Number of points last written to each marker, keyed by the
+  /// marker geometry's name. Used to update the marker's dynamic buffer
+  /// in place when a message carries the same number of points.
+  public: std::map<std::string, int> markerPointCounts;
+
   /// \brief Topic name for the marker service
   public: std::string topicName = "/marker";
 };
@@ -218,6 +228,8 @@ void MarkerManagerPrivate::Update()
 {
   std::lock_guard<std::mutex> lock(this->mutex);
 
+  const bool hadMsgs = !this->markerMsgs.empty();
+
   // Process the marker messages.
   for (auto markerIter = this->markerMsgs.begin();
        markerIter != this->markerMsgs.end();)
@@ -226,8 +238,17 @@ void MarkerManagerPrivate::Update()
     this->markerMsgs.erase(markerIter++);
   }
 
+  // This runs on every render frame; skip the lifetime sweep when no
+  // message arrived and the previous sweep found no marker with a finite
+  // lifetime - the common idle case.
+  if (!hadMsgs && !this->hasLifetimeMarkers)
+  {
+    this->lastSimTime = this->simTime;
+    return;
+  }
 
   // Erase any markers that have a lifetime.
+  bool lifetimeMarkersRemain = false;
   for (auto mit = this->visuals.begin();
        mit != this->visuals.end();)
   {
@@ -242,13 +263,20 @@ void MarkerManagerPrivate::Update()
             (it->second->GeometryByIndex(0u));
       if (markerPtr != nullptr)
       {
-        if (markerPtr->Lifetime().count() != 0 &&
-            (markerPtr->Lifetime() <= simTime ||
-            this->simTime < this->lastSimTime))
+        if (markerPtr->Lifetime().count() != 0)
         {
-          this->scene->DestroyVisual(it->second);
-          it = mit->second.erase(it);
-          break;
+          if (markerPtr->Lifetime() <= simTime ||
+              this->simTime < this->lastSimTime)
+          {
+            this->markerPointCounts.erase(markerPtr->Name());
+            this->scene->DestroyVisual(it->second);
+            it = mit->second.erase(it);
+            // the sweep breaks out below without visiting the rest of this
+            // namespace, so sweep again next frame
+            lifetimeMarkersRemain = true;
+            break;
+          }
+          lifetimeMarkersRemain = true;
         }
       }
     }
@@ -259,6 +287,7 @@ void MarkerManagerPrivate::Update()
     else
       ++mit;
   }
+  this->hasLifetimeMarkers = lifetimeMarkersRemain;
   this->lastSimTime = this->simTime;
 }
 
@@ -327,23 +356,48 @@ void MarkerManagerPrivate::SetMarker(const msgs::Marker &_msg,
     _markerPtr->SetLifetime(std::chrono::seconds(0));
   }
   // Set Marker Render Type
+  rendering::MarkerType oldType = _markerPtr->Type();
   rendering::MarkerType markerType = MsgToType(_msg);
   _markerPtr->SetType(markerType);
 
   // Set Marker Material
   if (_msg.has_material())
   {
-    rendering::MaterialPtr materialPtr = MsgToMaterial(_msg);
-    _markerPtr->SetMaterial(materialPtr, true /* clone */);
-
-    // clean up material after clone
-    this->scene->DestroyMaterial(materialPtr);
-  }
+    rendering::MaterialPtr materialPtr = _markerPtr->Material();
+    if (materialPtr)
+    {
+      // Update the marker's existing material in place instead of
+      // creating, cloning and destroying one material per message
+      materialPtr->SetAmbient(
+          _msg.material().ambient().r(),
+          _msg.material().ambient().g(),
+          _msg.material().ambient().b(),
+          _msg.material().ambient().a());
+      materialPtr->SetDiffuse(
+          _msg.material().diffuse().r(),
+          _msg.material().diffuse().g(),
+          _msg.material().diffuse().b(),
+          _msg.material().diffuse().a());
+      materialPtr->SetSpecular(
+          _msg.material().specular().r(),
+          _msg.material().specular().g(),
+          _msg.material().specular().b(),
+          _msg.material().specular().a());
+      materialPtr->SetEmissive(
+          _msg.material().emissive().r(),
+          _msg.material().emissive().g(),
+          _msg.material().emissive().b(),
+          _msg.material().emissive().a());
+      materialPtr->SetLightingEnabled(_msg.material().lighting());
+    }
+    else
+    {
+      materialPtr = MsgToMaterial(_msg);
+      _markerPtr->SetMaterial(materialPtr, true /* clone */);
 
-  // Assume the presence of points means we clear old ones
-  if (_msg.point().size() > 0)
-  {
-    _markerPtr->ClearPoints();
+      // clean up material after clone
+      this->scene->DestroyMaterial(materialPtr);
+    }
   }
 
   math::Color color(
@@ -352,15 +406,40 @@ void MarkerManagerPrivate::SetMarker(const msgs::Marker &_msg,
       _msg.material().diffuse().b(),
       _msg.material().diffuse().a());
 
-  // Set Marker Points
-  for (int i = 0; i < _msg.point().size(); ++i)
+  // Point and line cloud updates commonly stream the same number of
+  // points every message. Write into the marker's retained dynamic
+  // buffer in place when the count and type are unchanged; otherwise
+  // clear and refill.
+  auto countIter = this->markerPointCounts.find(_markerPtr->Name());
+  if (_msg.point().size() > 0 && markerType == oldType &&
+      countIter != this->markerPointCounts.end() &&
+      countIter->second == _msg.point().size())
   {
-    math::Vector3d vector(
-        _msg.point(i).x(),
-        _msg.point(i).y(),
-        _msg.point(i).z());
+    for (int i = 0; i < _msg.point().size(); ++i)
+    {
+      math::Vector3d vector(
+          _msg.point(i).x(),
+          _msg.point(i).y(),
+          _msg.point(i).z());
 
-    _markerPtr->AddPoint(vector, color);
+      _markerPtr->SetPoint(i, vector);
+    }
+  }
+  else if (_msg.point().size() > 0)
+  {
+    _markerPtr->ClearPoints();
+
+    // Set Marker Points
+    for (int i = 0; i < _msg.point().size(); ++i)
+    {
+      math::Vector3d vector(
+          _msg.point(i).x(),
+          _msg.point(i).y(),
+          _msg.point(i).z());
+
+      _markerPtr->AddPoint(vector, color);
+    }
+    this->markerPointCounts[_markerPtr->Name()] = _msg.point().size();
   }
 }
 
@@ -492,15 +571,16 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
               std::dynamic_pointer_cast<rendering::Marker>
               (visualIter->second->GeometryByIndex(0));
 
-        visualIter->second->RemoveGeometryByIndex(0);
+        // Update the visual and marker in place. Detaching and
+        // re-attaching the geometry here would force a scene node
+        // update per message, which dominates when markers stream at
+        // high rates.
 
         // Set the visual values from the Marker Message
         this->SetVisual(_msg, visualIter->second);
 
         // Set the marker values from the Marker Message
         this->SetMarker(_msg, markerPtr);
-
-        visualIter->second->AddGeometry(markerPtr);
       }
     }
     // Otherwise create a new marker
@@ -542,6 +622,11 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
     if (nsIter != this->visuals.end() &&
         visualIter != nsIter->second.end())
     {
+      if (visualIter->second->GeometryCount() > 0u)
+      {
+        this->markerPointCounts.erase(
+            visualIter->second->GeometryByIndex(0u)->Name());
+      }
       this->scene->DestroyVisual(visualIter->second);
       this->visuals[ns].erase(visualIter);
 
@@ -571,6 +656,8 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
     {
       for (auto it : nsIter->second)
       {
+        if (it.second->GeometryCount() > 0u)
+          this->markerPointCounts.erase(it.second->GeometryByIndex(0u)->Name());
         this->scene->DestroyVisual(it.second);
       }
       nsIter->second.clear();
@@ -588,6 +675,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
         }
       }
       this->visuals.clear();
+      this->markerPointCounts.clear();
     }
   }
   else
@@ -643,5 +731,6 @@ void MarkerManager::Clear()
 {
   this->dataPtr->visuals.clear();
   this->dataPtr->markerMsgs.clear();
+  this->dataPtr->markerPointCounts.clear();
   this->dataPtr->scene.reset();
 }
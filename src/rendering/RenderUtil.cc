@@ -15,11 +15,18 @@
  *
  */
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
 #include <map>
 #include <stack>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -35,9 +42,13 @@
 #include <sdf/SDFImpl.hh>
 #include <sdf/Visual.hh>
 
+#include <gz/common/Filesystem.hh>
+#include <gz/common/MeshManager.hh>
 #include <gz/common/Profiler.hh>
 #include <gz/common/Skeleton.hh>
 #include <gz/common/SkeletonAnimation.hh>
+#include <gz/common/URI.hh>
+#include <gz/common/Util.hh>
 
 #include <gz/math/Color.hh>
 #include <gz/math/Helpers.hh>
@@ -67,6 +78,7 @@
 #include "gz/sim/components/LaserRetro.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/LightCmd.hh"
+#include "gz/sim/components/LightLod.hh"
 #include "gz/sim/components/Link.hh"
 #include "gz/sim/components/Material.hh"
 #include "gz/sim/components/Model.hh"
@@ -90,6 +102,7 @@
 #include "gz/sim/components/Visibility.hh"
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/components/VisualCmd.hh"
+#include "gz/sim/components/VisualLod.hh"
 #include "gz/sim/components/WideAngleCamera.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/EntityComponentManager.hh"
@@ -244,81 +257,26 @@ class gz::sim::RenderUtilPrivate
   /// \brief Window ID handle
   public: std::string winID = "";
 
-  /// \brief New scenes to be created
-  public: std::vector<sdf::Scene> newScenes;
+  /// \brief Directory for the engine's persistent shader cache. Empty
+  /// means a per-user default keyed by the engine name is derived during
+  /// Init.
+  public: std::string shaderCachePath = "";
 
   /// \brief is headless mode active
   public: bool isHeadlessRendering = false;
 
-  /// \brief New models to be created. The elements in the tuple are:
-  /// [0] entity id, [1], SDF DOM, [2] parent entity id, [3] sim iteration
-  public: std::vector<std::tuple<Entity, sdf::Model, Entity, uint64_t>>
-      newModels;
-
-  /// \brief New links to be created. The elements in the tuple are:
-  /// [0] entity id, [1] SDF DOM, [2] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Link, Entity>> newLinks;
-
-  /// \brief New visuals to be created. The elements in the tuple are:
-  /// [0] entity id, [1] SDF DOM, [2] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Visual, Entity>> newVisuals;
-
-  /// \brief New actors to be created. The elements in the tuple are:
-  /// [0] entity id, [1] SDF DOM, [2] actor name, [3] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Actor, std::string, Entity>>
-          newActors;
-
-  /// \brief New lights to be created. The elements in the tuple are:
-  /// [0] entity id, [1] SDF DOM, [2] light name, [3] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Light, std::string, Entity>>
-          newLights;
-
   /// \brief A map of entity light ids and light visuals
   public: std::map<Entity, Entity> matchLightWithVisuals;
 
-  /// \brief New sensors to be created. The elements in the tuple are:
-  /// [0] entity id, [1] SDF DOM, [2] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Sensor, Entity>>
-      newSensors;
-
-  /// \brief New particle emitter to be created. The elements in the tuple are:
-  /// [0] entity id, [1] particle emitter, [2] parent entity id
-  public: std::vector<std::tuple<Entity, msgs::ParticleEmitter, Entity>>
-      newParticleEmitters;
-
-  /// \brief New particle emitter commands to be requested.
-  /// The map key and value are: entity id of the particle emitter to
-  /// update, and particle emitter msg
-  public: std::unordered_map<Entity, msgs::ParticleEmitter>
-      newParticleEmittersCmds;
-
-  /// \brief New projector to be created. The elements in the tuple are:
-  /// [0] entity id, [1] projector, [2] parent entity id
-  public: std::vector<std::tuple<Entity, sdf::Projector, Entity>>
-      newProjectors;
-
   /// \brief New sensor topics that should be added to ECM as new components
   public: std::unordered_map<Entity, std::string> newSensorTopics;
 
   /// \brief A list of entities with particle emitter cmds to remove
   public: std::vector<Entity> particleCmdsToRemove;
 
-  /// \brief Map of ids of entites to be removed and sim iteration when the
-  /// remove request is received
-  public: std::unordered_map<Entity, uint64_t> removeEntities;
-
-  /// \brief A map of entity ids and pose updates.
-  public: std::unordered_map<Entity, math::Pose3d> entityPoses;
-
-  /// \brief A map of entity ids and light updates.
-  public: std::unordered_map<Entity, msgs::Light> entityLights;
-
   /// \brief A map of entity ids and light updates.
   public: std::vector<Entity> entityLightsCmdToDelete;
 
-  /// \brief A map of entity ids and visual updates.
-  public: std::map<Entity, msgs::Visual> entityVisuals;
-
   /// \brief A vector of entity ids of VisualCmds to delete
   public: std::vector<Entity> entityVisualsCmdToDelete;
 
@@ -335,36 +293,9 @@ class gz::sim::RenderUtilPrivate
                 _a.Emissive() == _b.Emissive();
             }};
 
-  /// \brief A map of entity ids and actor transforms.
-  public: std::map<Entity, std::map<std::string, math::Matrix4d>>
-                          actorTransforms;
-
-  /// \brief A map of entity ids and temperature data.
-  /// The value of this map (tuple) represents either a single (uniform)
-  /// temperature, or a heat signature with a min/max temperature. If the string
-  /// in the tuple is empty, then this entity has a uniform temperature across
-  /// its surface, and this uniform temperature is stored in the first float of
-  /// the tuple (the second float and string are unused for uniform temperature
-  /// entities). If the string in the tuple is not empty, then the string
-  /// represents the entity's heat signature (a path to a heat signature texture
-  /// file), and the floats represent the min/max temperatures of the heat
-  /// signature, respectively.
-  ///
-  /// All temperatures are in Kelvin.
-  public: std::map<Entity, std::tuple<float, float, std::string>> entityTemp;
-
-  /// \brief A map of entity ids and label data for datasets annotations
-  public: std::unordered_map<Entity, int> entityLabel;
-
   /// \brief A map of entity ids and wire boxes
   public: std::unordered_map<Entity, gz::rendering::WireBoxPtr> wireBoxes;
 
-  /// \brief A map of entity ids and trajectory pose updates.
-  public: std::unordered_map<Entity, math::Pose3d> trajectoryPoses;
-
-  /// \brief A map of entity ids and actor animation info.
-  public: std::unordered_map<Entity, AnimationUpdateData> actorAnimationData;
-
   /// \brief A map of entity ids and the world pose of actor at current
   /// timestep. The pose data is used to update the WorldPose component in the
   /// ECM
@@ -376,12 +307,237 @@ class gz::sim::RenderUtilPrivate
   /// \todo(anyone) Let this be turned on from a component
   public: bool actorManualSkeletonUpdate = false;
 
-  /// \brief Mutex to protect updates
+  /// \brief Buffers of per-iteration state staged for the render thread.
+  /// See staged and pending for the threading contract.
+  public: struct UpdateBuffer
+  {
+    /// \brief New scenes to be created
+    public: std::vector<sdf::Scene> newScenes;
+
+    /// \brief New models to be created. The elements in the tuple are:
+    /// [0] entity id, [1], SDF DOM, [2] parent entity id, [3] sim iteration
+    public: std::vector<std::tuple<Entity, sdf::Model, Entity, uint64_t>>
+        newModels;
+
+    /// \brief New links to be created. The elements in the tuple are:
+    /// [0] entity id, [1] SDF DOM, [2] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Link, Entity>> newLinks;
+
+    /// \brief New visuals to be created. The elements in the tuple are:
+    /// [0] entity id, [1] SDF DOM, [2] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Visual, Entity>> newVisuals;
+
+    /// \brief Levels of detail for newly created visuals. The map key
+    /// and value are: entity id of the visual, and its declared levels
+    public: std::unordered_map<Entity,
+        std::vector<components::VisualLodLevel>> newVisualLods;
+
+    /// \brief New actors to be created. The elements in the tuple are:
+    /// [0] entity id, [1] SDF DOM, [2] actor name, [3] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Actor, std::string, Entity>>
+            newActors;
+
+    /// \brief New lights to be created. The elements in the tuple are:
+    /// [0] entity id, [1] SDF DOM, [2] light name, [3] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Light, std::string, Entity>>
+            newLights;
+
+    /// \brief Maximum visible distances for newly created lights. The
+    /// map key and value are: entity id of the light, and the distance
+    /// from the closest camera beyond which it is deactivated
+    public: std::unordered_map<Entity, double> newLightLods;
+
+    /// \brief New sensors to be created. The elements in the tuple are:
+    /// [0] entity id, [1] SDF DOM, [2] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Sensor, Entity>>
+        newSensors;
+
+    /// \brief New particle emitter to be created. The elements in the tuple are:
+    /// [0] entity id, [1] particle emitter, [2] parent entity id
+    public: std::vector<std::tuple<Entity, msgs::ParticleEmitter, Entity>>
+        newParticleEmitters;
+
+    /// \brief New particle emitter commands to be requested.
+    /// The map key and value are: entity id of the particle emitter to
+    /// update, and particle emitter msg
+    public: std::unordered_map<Entity, msgs::ParticleEmitter>
+        newParticleEmittersCmds;
+
+    /// \brief New projector to be created. The elements in the tuple are:
+    /// [0] entity id, [1] projector, [2] parent entity id
+    public: std::vector<std::tuple<Entity, sdf::Projector, Entity>>
+        newProjectors;
+
+    /// \brief Map of ids of entites to be removed and sim iteration when the
+    /// remove request is received
+    public: std::unordered_map<Entity, uint64_t> removeEntities;
+
+    /// \brief A map of entity ids and pose updates.
+    public: std::unordered_map<Entity, math::Pose3d> entityPoses;
+
+    /// \brief A map of entity ids and light updates.
+    public: std::unordered_map<Entity, msgs::Light> entityLights;
+
+    /// \brief A map of entity ids and visual updates.
+    public: std::map<Entity, msgs::Visual> entityVisuals;
+
+    /// \brief A list of joint visuals for which the parent visual poses
+    /// have to be updated.
+    public: std::vector<Entity> updateJointParentPoses;
+
+    /// \brief A map of entity ids and trajectory pose updates.
+    public: std::unordered_map<Entity, math::Pose3d> trajectoryPoses;
+
+    /// \brief A map of entity ids and actor transforms.
+    public: std::map<Entity, std::map<std::string, math::Matrix4d>>
+                            actorTransforms;
+
+    /// \brief A map of entity ids and actor animation info.
+    public: std::unordered_map<Entity, AnimationUpdateData> actorAnimationData;
+
+    /// \brief A map of entity ids and temperature data.
+    /// The value of this map (tuple) represents either a single (uniform)
+    /// temperature, or a heat signature with a min/max temperature. If the string
+    /// in the tuple is empty, then this entity has a uniform temperature across
+    /// its surface, and this uniform temperature is stored in the first float of
+    /// the tuple (the second float and string are unused for uniform temperature
+    /// entities). If the string in the tuple is not empty, then the string
+    /// represents the entity's heat signature (a path to a heat signature texture
+    /// file), and the floats represent the min/max temperatures of the heat
+    /// signature, respectively.
+    ///
+    /// All temperatures are in Kelvin.
+    public: std::map<Entity, std::tuple<float, float, std::string>> entityTemp;
+
+    /// \brief A map of entity ids and label data for datasets annotations
+    public: std::unordered_map<Entity, int> entityLabel;
+
+    /// \brief A list of links used to toggle transparent mode for visuals
+    public: std::vector<Entity> newTransparentVisualLinks;
+
+    /// \brief A list of links used to create new inertia visuals
+    public: std::vector<Entity> newInertiaLinks;
+
+    /// \brief A list of models used to create new joint visuals
+    public: std::vector<Entity> newJointModels;
+
+    /// \brief A list of links used to create new center of mass visuals
+    public: std::vector<Entity> newCOMLinks;
+
+    /// \brief A list of links used to toggle wireframe mode for visuals
+    public: std::vector<Entity> newWireframeVisualLinks;
+
+    /// \brief A list of links used to create new collision visuals
+    public: std::vector<Entity> newCollisionLinks;
+
+    /// \brief A map of entity id to thermal camera sensor configuration
+    /// properties. The elements in the tuple are:
+    /// <resolution, temperature range (min, max)>
+    public: std::unordered_map<Entity,
+        std::tuple<double, components::TemperatureRangeInfo>> thermalCameraData;
+
+    /// \brief Merge another buffer into this one. Vectors are appended
+    /// and map entries overwrite existing keys, preserving the order the
+    /// updates were staged in. The source buffer is left empty. When this
+    /// buffer is empty the merge reduces to per-member swaps.
+    /// \param[in, out] _from Buffer to merge from.
+    public: void MergeFrom(UpdateBuffer &_from);
+  };
+
+  /// \brief Back buffer filled by the ECM-facing update functions. Owned
+  /// exclusively by the thread calling UpdateECM / UpdateFromECM /
+  /// CreateVisualsForEntities, so the ECM traversal runs without holding
+  /// updateMutex.
+  public: UpdateBuffer staged;
+
+  /// \brief Front buffer holding staged state not yet consumed by the
+  /// render thread. Filled by the splice at the end of UpdateFromECM and
+  /// swapped out at the start of Update. Protected by updateMutex.
+  public: UpdateBuffer pending;
+
+  /// \brief Mutex protecting pending, simTime and the remaining state
+  /// exchanged between the simulation and render threads
   public: std::mutex updateMutex;
 
   //// \brief Flag to indicate whether to create sensors
   public: bool enableSensors = false;
 
+  /// \brief True if received poses are interpolated at render time. Enabled
+  /// by the GUI scene, where the display rate usually exceeds the state
+  /// stream rate; must stay disabled for rendering sensors, which need the
+  /// exact pose at the current sim time.
+  public: bool usePoseInterpolation = false;
+
+  /// \brief The last two timestamped pose samples of an entity, used for
+  /// pose interpolation.
+  public: struct PoseSamples
+  {
+    /// \brief Previously received pose.
+    math::Pose3d prev;
+
+    /// \brief Most recently received pose.
+    math::Pose3d curr;
+
+    /// \brief Wall-clock time at which prev was received.
+    std::chrono::steady_clock::time_point prevTime;
+
+    /// \brief Wall-clock time at which curr was received.
+    std::chrono::steady_clock::time_point currTime;
+
+    /// \brief True once curr has been displayed, so settled entities are
+    /// not re-applied every frame.
+    bool settled{false};
+  };
+
+  /// \brief Pose samples per entity. Only accessed by the render thread.
+  public: std::unordered_map<Entity, PoseSamples> poseSamples;
+
+  /// \brief Last pose staged for each entity. Only accessed by the
+  /// simulation thread; used to stage only entities whose pose actually
+  /// changed, so buffer and render-thread costs scale with activity
+  /// instead of world size.
+  public: std::unordered_map<Entity, math::Pose3d> lastStagedPoses;
+
+  /// \brief Position jump between consecutive pose samples above which the
+  /// display snaps to the new pose instead of interpolating, so teleports
+  /// aren't animated as motion.
+  public: static constexpr double kSnapTranslation{1.0};
+
+  /// \brief Stop the mesh prefetch thread, if running.
+  public: ~RenderUtilPrivate();
+
+  /// \brief Queue the mesh file referenced by a geometry, if any, to be
+  /// decoded on the prefetch thread. Called from the simulation thread
+  /// when a new visual is staged, so the file is usually already in the
+  /// common::MeshManager cache by the time the render thread creates the
+  /// corresponding geometry.
+  /// \param[in] _geom Geometry of the staged visual.
+  public: void PrefetchMesh(const sdf::Geometry &_geom);
+
+  /// \brief Loop run by meshPrefetchThread. Loads queued mesh files into
+  /// the common::MeshManager cache.
+  public: void MeshPrefetchLoop();
+
+  /// \brief Thread decoding mesh files ahead of the render thread.
+  public: std::thread meshPrefetchThread;
+
+  /// \brief Protects meshPrefetchQueue.
+  public: std::mutex meshPrefetchMutex;
+
+  /// \brief Signals new queue entries or shutdown to the prefetch thread.
+  public: std::condition_variable meshPrefetchCv;
+
+  /// \brief Mesh file paths waiting to be decoded.
+  public: std::deque<std::string> meshPrefetchQueue;
+
+  /// \brief Paths already handed to the prefetch thread, so a mesh used
+  /// by many visuals is queued only once. Only accessed by the simulation
+  /// thread.
+  public: std::unordered_set<std::string> meshPrefetchRequested;
+
+  /// \brief Whether the prefetch thread should keep running.
+  public: std::atomic<bool> meshPrefetchRunning{false};
+
   /// \brief A set containing all the entities with attached rendering sensors
   public: std::unordered_set<Entity> sensorEntities;
 
@@ -451,9 +607,6 @@ class gz::sim::RenderUtilPrivate
   /// \param[in] _ecm The entity-component manager
   public: void FindJointModels(const EntityComponentManager &_ecm);
 
-  /// \brief A list of models used to create new joint visuals
-  public: std::vector<Entity> newJointModels;
-
   /// \brief A map of joint entity ids and their SDF DOM
   public: std::map<Entity, sdf::Joint> entityJoints;
 
@@ -464,10 +617,6 @@ class gz::sim::RenderUtilPrivate
   /// visible
   public: std::map<Entity, bool> viewingJoints;
 
-  /// \brief A list of joint visuals for which the parent visual poses
-  /// have to be updated.
-  public: std::vector<Entity> updateJointParentPoses;
-
   /// \brief A map of models entities and link attributes used
   /// to create joint visuals
   public: std::map<Entity, std::map<std::string, Entity>>
@@ -476,9 +625,6 @@ class gz::sim::RenderUtilPrivate
   /// \brief New center of mass visuals to be created
   public: std::vector<Entity> newCOMVisuals;
 
-  /// \brief A list of links used to create new center of mass visuals
-  public: std::vector<Entity> newCOMLinks;
-
   /// \brief A map of link entities and if their center of mass visuals
   /// are currently visible
   public: std::map<Entity, bool> viewingCOM;
@@ -501,9 +647,6 @@ class gz::sim::RenderUtilPrivate
   /// \param[in] _ecm The entity-component manager
   public: void FindInertialLinks(const EntityComponentManager &_ecm);
 
-  /// \brief A list of links used to create new inertia visuals
-  public: std::vector<Entity> newInertiaLinks;
-
   /// \brief A map of entity ids and their inertials
   public: std::map<Entity, math::Inertiald> entityInertials;
 
@@ -525,12 +668,6 @@ class gz::sim::RenderUtilPrivate
   /// \param[in] _ecm The entity-component manager
   public: void PopulateViewModeVisualLinks(const EntityComponentManager &_ecm);
 
-  /// \brief A list of links used to toggle wireframe mode for visuals
-  public: std::vector<Entity> newWireframeVisualLinks;
-
-  /// \brief A list of links used to toggle transparent mode for visuals
-  public: std::vector<Entity> newTransparentVisualLinks;
-
   /// \brief A map of link entities and their corresponding children visuals
   public: std::map<Entity, std::vector<Entity>> linkToVisualEntities;
 
@@ -550,9 +687,6 @@ class gz::sim::RenderUtilPrivate
   /// \param[in] _ecm The entity-component manager
   public: void FindCollisionLinks(const EntityComponentManager &_ecm);
 
-  /// \brief A list of links used to create new collision visuals
-  public: std::vector<Entity> newCollisionLinks;
-
   /// \brief A map of collision entity ids and their SDF DOM
   public: std::map<Entity, sdf::Collision> entityCollisions;
 
@@ -569,12 +703,6 @@ class gz::sim::RenderUtilPrivate
   /// \brief A map of model entities and their corresponding children models
   public: std::map<Entity, std::vector<Entity>> modelToModelEntities;
 
-  /// \brief A map of entity id to thermal camera sensor configuration
-  /// properties. The elements in the tuple are:
-  /// <resolution, temperature range (min, max)>
-  public: std::unordered_map<Entity,
-      std::tuple<double, components::TemperatureRangeInfo>> thermalCameraData;
-
   /// \brief Update the visuals with label user data
   /// \param[in] _entityLabel Map with key visual entity id and value label
   public: void UpdateVisualLabels(
@@ -630,6 +758,83 @@ RenderUtil::RenderUtil() : dataPtr(std::make_unique<RenderUtilPrivate>())
 //////////////////////////////////////////////////
 RenderUtil::~RenderUtil() = default;
 
+//////////////////////////////////////////////////
+RenderUtilPrivate::~RenderUtilPrivate()
+{
+  if (this->meshPrefetchThread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->meshPrefetchMutex);
+      this->meshPrefetchRunning = false;
+    }
+    this->meshPrefetchCv.notify_one();
+    this->meshPrefetchThread.join();
+  }
+}
+
+//////////////////////////////////////////////////
+void RenderUtilPrivate::PrefetchMesh(const sdf::Geometry &_geom)
+{
+  if (_geom.Type() != sdf::GeometryType::MESH || nullptr == _geom.MeshShape())
+    return;
+
+  // Meshes with a name:// scheme are registered directly with the mesh
+  // manager and have no file to decode.
+  if (common::URI(_geom.MeshShape()->Uri()).Scheme() == "name")
+    return;
+
+  if (!common::MeshManager::Instance()->IsValidFilename(
+      _geom.MeshShape()->Uri()))
+    return;
+
+  auto fullPath = asFullPath(_geom.MeshShape()->Uri(),
+      _geom.MeshShape()->FilePath());
+  if (!this->meshPrefetchRequested.insert(fullPath).second)
+    return;
+
+  if (!this->meshPrefetchThread.joinable())
+  {
+    this->meshPrefetchRunning = true;
+    this->meshPrefetchThread =
+        std::thread(&RenderUtilPrivate::MeshPrefetchLoop, this);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->meshPrefetchMutex);
+    this->meshPrefetchQueue.push_back(std::move(fullPath));
+  }
+  this->meshPrefetchCv.notify_one();
+}
+
+//////////////////////////////////////////////////
+void RenderUtilPrivate::MeshPrefetchLoop()
+{
+  std::unique_lock<std::mutex> lock(this->meshPrefetchMutex);
+  while (true)
+  {
+    this->meshPrefetchCv.wait(lock, [this]
+        {
+          return !this->meshPrefetchQueue.empty() ||
+              !this->meshPrefetchRunning;
+        });
+    if (!this->meshPrefetchRunning)
+      return;
+
+    auto path = std::move(this->meshPrefetchQueue.front());
+    this->meshPrefetchQueue.pop_front();
+    lock.unlock();
+
+    // Load decodes the file and caches the result in the mesh manager;
+    // if the render thread got to this mesh first, this is a cache hit.
+    if (nullptr == common::MeshManager::Instance()->Load(path))
+    {
+      gzwarn << "Failed to prefetch mesh from [" << path << "]."
+             << std::endl;
+    }
+    lock.lock();
+  }
+}
+
 //////////////////////////////////////////////////
 rendering::ScenePtr RenderUtil::Scene() const
 {
@@ -655,7 +860,7 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
           const components::ParticleEmitterCmd *_emitterCmd) -> bool
       {
         // store emitter properties and update them in rendering thread
-        this->dataPtr->newParticleEmittersCmds[_entity] =
+        this->dataPtr->staged.newParticleEmittersCmds[_entity] =
         _emitterCmd->Data();
 
         // update pose comp here
@@ -680,7 +885,7 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
       [&](const Entity &_entity,
           const components::LightCmd * _lightCmd) -> bool
       {
-        this->dataPtr->entityLights[_entity] = _lightCmd->Data();
+        this->dataPtr->staged.entityLights[_entity] = _lightCmd->Data();
         this->dataPtr->entityLightsCmdToDelete.push_back(_entity);
 
         auto lightComp = _ecm.Component<components::Light>(_entity);
@@ -736,7 +941,7 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
 
         if (resolutionComp || tempRangeComp)
         {
-          this->dataPtr->thermalCameraData[_entity] =
+          this->dataPtr->staged.thermalCameraData[_entity] =
               std::make_tuple(resolution, range);
         }
         return true;
@@ -754,7 +959,7 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
       [&](const Entity &_entity,
           const components::VisualCmd *_visualCmd) -> bool
       {
-        this->dataPtr->entityVisuals[_entity] = _visualCmd->Data();
+        this->dataPtr->staged.entityVisuals[_entity] = _visualCmd->Data();
         this->dataPtr->entityVisualsCmdToDelete.push_back(_entity);
 
         auto materialComp = _ecm.Component<components::Material>(_entity);
@@ -787,7 +992,6 @@ void RenderUtil::UpdateECM(const UpdateInfo &/*_info*/,
     this->dataPtr->newSensorTopics.clear();
   }
 
-
   // update actor world pose
   {
     for (const auto &it : this->dataPtr->actorWorldPoses)
@@ -812,13 +1016,13 @@ void RenderUtil::UpdateFromECM(const UpdateInfo &_info,
                                const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("RenderUtil::UpdateFromECM");
-  std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
-  this->dataPtr->simTime = _info.simTime;
 
+  // The ECM scans below only fill the staged back buffer, which is owned
+  // exclusively by this thread, so they run without holding updateMutex
+  // and no longer block the render thread for the duration of the scan.
   this->dataPtr->CreateRenderingEntities(_ecm, _info);
   this->dataPtr->UpdateRenderingEntities(_ecm);
   this->dataPtr->RemoveRenderingEntities(_ecm, _info);
-  this->dataPtr->markerManager.SetSimTime(_info.simTime);
   this->dataPtr->PopulateViewModeVisualLinks(_ecm);
   this->dataPtr->FindInertialLinks(_ecm);
   this->dataPtr->FindJointModels(_ecm);
@@ -830,11 +1034,20 @@ void RenderUtil::UpdateFromECM(const UpdateInfo &_info,
   auto sphericalCoordinatesComponent =
     _ecm.Component<components::SphericalCoordinates>(
         worldEntity);
+
+  // Publish the staged buffer to the render thread. This splice is the
+  // only point where this thread can block on the render thread, and it
+  // is bounded by the merge, which degenerates to per-member swaps when
+  // the previous frame has already been drained.
+  std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
+  this->dataPtr->simTime = _info.simTime;
+  this->dataPtr->markerManager.SetSimTime(_info.simTime);
   if (sphericalCoordinatesComponent)
   {
     this->dataPtr->sceneManager.SetSphericalCoordinates(
         sphericalCoordinatesComponent->Data());
   }
+  this->dataPtr->pending.MergeFrom(this->dataPtr->staged);
 }
 
 //////////////////////////////////////////////////
@@ -898,7 +1111,7 @@ void RenderUtilPrivate::FindInertialLinks(const EntityComponentManager &_ecm)
       continue;
     }
 
-    this->newInertiaLinks.insert(this->newInertiaLinks.end(),
+    this->staged.newInertiaLinks.insert(this->staged.newInertiaLinks.end(),
         links.begin(),
         links.end());
   }
@@ -922,7 +1135,7 @@ void RenderUtilPrivate::FindInertialLinks(const EntityComponentManager &_ecm)
       continue;
     }
 
-    this->newCOMLinks.insert(this->newCOMLinks.end(),
+    this->staged.newCOMLinks.insert(this->staged.newCOMLinks.end(),
         links.begin(),
         links.end());
   }
@@ -970,7 +1183,7 @@ void RenderUtilPrivate::FindJointModels(const EntityComponentManager &_ecm)
       continue;
     }
 
-    this->newJointModels.insert(this->newJointModels.end(),
+    this->staged.newJointModels.insert(this->staged.newJointModels.end(),
         models.begin(),
         models.end());
   }
@@ -1000,7 +1213,7 @@ void RenderUtilPrivate::PopulateViewModeVisualLinks(
       continue;
     }
 
-    this->newWireframeVisualLinks.insert(this->newWireframeVisualLinks.end(),
+    this->staged.newWireframeVisualLinks.insert(this->staged.newWireframeVisualLinks.end(),
         links.begin(),
         links.end());
   }
@@ -1025,8 +1238,8 @@ void RenderUtilPrivate::PopulateViewModeVisualLinks(
       continue;
     }
 
-    this->newTransparentVisualLinks.insert(
-        this->newTransparentVisualLinks.end(),
+    this->staged.newTransparentVisualLinks.insert(
+        this->staged.newTransparentVisualLinks.end(),
         links.begin(),
         links.end());
   }
@@ -1057,7 +1270,7 @@ void RenderUtilPrivate::FindCollisionLinks(const EntityComponentManager &_ecm)
       continue;
     }
 
-    this->newCollisionLinks.insert(this->newCollisionLinks.end(),
+    this->staged.newCollisionLinks.insert(this->staged.newCollisionLinks.end(),
         links.begin(),
         links.end());
   }
@@ -1073,12 +1286,74 @@ int RenderUtil::PendingSensors() const
   if (!this->dataPtr->scene)
     return -1;
 
+  // The staged buffer is owned by the thread that fills it from the ECM,
+  // which is also the thread querying pending sensors.
+  int nSensors = this->dataPtr->staged.newSensors.size();
   this->dataPtr->updateMutex.lock();
-  int nSensors = this->dataPtr->newSensors.size();
+  nSensors += this->dataPtr->pending.newSensors.size();
   this->dataPtr->updateMutex.unlock();
   return nSensors;
 }
 
+//////////////////////////////////////////////////
+void RenderUtilPrivate::UpdateBuffer::MergeFrom(UpdateBuffer &_from)
+{
+  // The destination being empty is the common case: the render thread
+  // drains the pending buffer every frame, so most merges are swaps.
+  auto mergeVec = [](auto &_dst, auto &_src)
+  {
+    if (_dst.empty())
+    {
+      std::swap(_dst, _src);
+      return;
+    }
+    _dst.insert(_dst.end(), std::make_move_iterator(_src.begin()),
+        std::make_move_iterator(_src.end()));
+    _src.clear();
+  };
+  auto mergeMap = [](auto &_dst, auto &_src)
+  {
+    if (_dst.empty())
+    {
+      std::swap(_dst, _src);
+      return;
+    }
+    for (auto &entry : _src)
+      _dst[entry.first] = std::move(entry.second);
+    _src.clear();
+  };
+
+  mergeVec(this->newScenes, _from.newScenes);
+  mergeVec(this->newModels, _from.newModels);
+  mergeVec(this->newLinks, _from.newLinks);
+  mergeVec(this->newVisuals, _from.newVisuals);
+  mergeMap(this->newVisualLods, _from.newVisualLods);
+  mergeVec(this->newActors, _from.newActors);
+  mergeVec(this->newLights, _from.newLights);
+  mergeMap(this->newLightLods, _from.newLightLods);
+  mergeVec(this->newSensors, _from.newSensors);
+  mergeVec(this->newParticleEmitters, _from.newParticleEmitters);
+  mergeMap(this->newParticleEmittersCmds, _from.newParticleEmittersCmds);
+  mergeVec(this->newProjectors, _from.newProjectors);
+  mergeMap(this->removeEntities, _from.removeEntities);
+  mergeMap(this->entityPoses, _from.entityPoses);
+  mergeMap(this->entityLights, _from.entityLights);
+  mergeMap(this->entityVisuals, _from.entityVisuals);
+  mergeVec(this->updateJointParentPoses, _from.updateJointParentPoses);
+  mergeMap(this->trajectoryPoses, _from.trajectoryPoses);
+  mergeMap(this->actorTransforms, _from.actorTransforms);
+  mergeMap(this->actorAnimationData, _from.actorAnimationData);
+  mergeMap(this->entityTemp, _from.entityTemp);
+  mergeMap(this->entityLabel, _from.entityLabel);
+  mergeVec(this->newTransparentVisualLinks, _from.newTransparentVisualLinks);
+  mergeVec(this->newInertiaLinks, _from.newInertiaLinks);
+  mergeVec(this->newJointModels, _from.newJointModels);
+  mergeVec(this->newCOMLinks, _from.newCOMLinks);
+  mergeVec(this->newWireframeVisualLinks, _from.newWireframeVisualLinks);
+  mergeVec(this->newCollisionLinks, _from.newCollisionLinks);
+  mergeMap(this->thermalCameraData, _from.thermalCameraData);
+}
+
 //////////////////////////////////////////////////
 void RenderUtil::Update()
 {
@@ -1092,74 +1367,52 @@ void RenderUtil::Update()
   this->dataPtr->updateMutex.lock();
 
   this->dataPtr->scene->SetTime(this->dataPtr->simTime);
-  auto newScenes = std::move(this->dataPtr->newScenes);
-  auto newModels = std::move(this->dataPtr->newModels);
-  auto newLinks = std::move(this->dataPtr->newLinks);
-  auto newVisuals = std::move(this->dataPtr->newVisuals);
-  auto newActors = std::move(this->dataPtr->newActors);
-  auto newLights = std::move(this->dataPtr->newLights);
-  auto newParticleEmitters = std::move(this->dataPtr->newParticleEmitters);
-  auto newParticleEmittersCmds =
-    std::move(this->dataPtr->newParticleEmittersCmds);
-  auto newProjectors = std::move(this->dataPtr->newProjectors);
-  auto removeEntities = std::move(this->dataPtr->removeEntities);
-  auto entityPoses = std::move(this->dataPtr->entityPoses);
-  auto entityLights = std::move(this->dataPtr->entityLights);
-  auto entityVisuals = std::move(this->dataPtr->entityVisuals);
-  auto updateJointParentPoses =
-    std::move(this->dataPtr->updateJointParentPoses);
-  auto trajectoryPoses = std::move(this->dataPtr->trajectoryPoses);
-  auto actorTransforms = std::move(this->dataPtr->actorTransforms);
-  auto actorAnimationData = std::move(this->dataPtr->actorAnimationData);
-  auto entityTemp = std::move(this->dataPtr->entityTemp);
-  auto entityLabel = std::move(this->dataPtr->entityLabel);
-  auto newTransparentVisualLinks =
-    std::move(this->dataPtr->newTransparentVisualLinks);
-  auto newInertiaLinks = std::move(this->dataPtr->newInertiaLinks);
-  auto newJointModels = std::move(this->dataPtr->newJointModels);
-  auto newCOMLinks = std::move(this->dataPtr->newCOMLinks);
-  auto newWireframeVisualLinks =
-    std::move(this->dataPtr->newWireframeVisualLinks);
-  auto newCollisionLinks = std::move(this->dataPtr->newCollisionLinks);
-  auto thermalCameraData = std::move(this->dataPtr->thermalCameraData);
-
-  this->dataPtr->newScenes.clear();
-  this->dataPtr->newModels.clear();
-  this->dataPtr->newLinks.clear();
-  this->dataPtr->newVisuals.clear();
-  this->dataPtr->newActors.clear();
-  this->dataPtr->newLights.clear();
-  this->dataPtr->newParticleEmitters.clear();
-  this->dataPtr->newParticleEmittersCmds.clear();
-  this->dataPtr->newProjectors.clear();
-  this->dataPtr->removeEntities.clear();
-  this->dataPtr->entityPoses.clear();
-  this->dataPtr->entityLights.clear();
-  this->dataPtr->entityVisuals.clear();
-  this->dataPtr->updateJointParentPoses.clear();
-  this->dataPtr->trajectoryPoses.clear();
-  this->dataPtr->actorTransforms.clear();
-  this->dataPtr->actorAnimationData.clear();
-  this->dataPtr->entityTemp.clear();
-  this->dataPtr->entityLabel.clear();
-  this->dataPtr->newTransparentVisualLinks.clear();
-  this->dataPtr->newInertiaLinks.clear();
-  this->dataPtr->newJointModels.clear();
-  this->dataPtr->newCOMLinks.clear();
-  this->dataPtr->newWireframeVisualLinks.clear();
-  this->dataPtr->newCollisionLinks.clear();
-  this->dataPtr->thermalCameraData.clear();
+
+  // Take over the front buffer with a swap so the simulation thread only
+  // ever blocks on this short critical section, then process it below
+  // with the mutex released.
+  RenderUtilPrivate::UpdateBuffer buffer;
+  std::swap(buffer, this->dataPtr->pending);
 
   this->dataPtr->markerManager.Update();
 
   std::vector<std::tuple<Entity, sdf::Sensor, Entity>> newSensors;
   if (this->dataPtr->enableSensors)
   {
-    newSensors = std::move(this->dataPtr->newSensors);
-    this->dataPtr->newSensors.clear();
+    newSensors = std::move(buffer.newSensors);
   }
   this->dataPtr->updateMutex.unlock();
 
+  auto newScenes = std::move(buffer.newScenes);
+  auto newModels = std::move(buffer.newModels);
+  auto newLinks = std::move(buffer.newLinks);
+  auto newVisuals = std::move(buffer.newVisuals);
+  auto newVisualLods = std::move(buffer.newVisualLods);
+  auto newActors = std::move(buffer.newActors);
+  auto newLights = std::move(buffer.newLights);
+  auto newLightLods = std::move(buffer.newLightLods);
+  auto newParticleEmitters = std::move(buffer.newParticleEmitters);
+  auto newParticleEmittersCmds = std::move(buffer.newParticleEmittersCmds);
+  auto newProjectors = std::move(buffer.newProjectors);
+  auto removeEntities = std::move(buffer.removeEntities);
+  auto entityPoses = std::move(buffer.entityPoses);
+  auto entityLights = std::move(buffer.entityLights);
+  auto entityVisuals = std::move(buffer.entityVisuals);
+  auto updateJointParentPoses = std::move(buffer.updateJointParentPoses);
+  auto trajectoryPoses = std::move(buffer.trajectoryPoses);
+  auto actorTransforms = std::move(buffer.actorTransforms);
+  auto actorAnimationData = std::move(buffer.actorAnimationData);
+  auto entityTemp = std::move(buffer.entityTemp);
+  auto entityLabel = std::move(buffer.entityLabel);
+  auto newTransparentVisualLinks =
+    std::move(buffer.newTransparentVisualLinks);
+  auto newInertiaLinks = std::move(buffer.newInertiaLinks);
+  auto newJointModels = std::move(buffer.newJointModels);
+  auto newCOMLinks = std::move(buffer.newCOMLinks);
+  auto newWireframeVisualLinks = std::move(buffer.newWireframeVisualLinks);
+  auto newCollisionLinks = std::move(buffer.newCollisionLinks);
+  auto thermalCameraData = std::move(buffer.thermalCameraData);
+
   // scene - only one scene is supported for now
   // extend the sensor system to support mutliple scenes in the future
   for (auto &scene : newScenes)
@@ -1196,6 +1449,7 @@ void RenderUtil::Update()
           this->dataPtr->selectedEntities.end(), entity.first),
           this->dataPtr->selectedEntities.end());
       this->dataPtr->sceneManager.RemoveEntity(entity.first);
+      this->dataPtr->poseSamples.erase(entity.first);
 
       this->dataPtr->RemoveSensor(entity.first);
       this->dataPtr->RemoveBoundingBox(entity.first);
@@ -1245,6 +1499,11 @@ void RenderUtil::Update()
           std::get<0>(visual), std::get<1>(visual), std::get<2>(visual));
     }
 
+    for (const auto &lod : newVisualLods)
+    {
+      this->dataPtr->sceneManager.SetVisualLod(lod.first, lod.second);
+    }
+
     for (const auto &light : newLights)
     {
       auto newLightRendering = this->dataPtr->sceneManager.CreateLight(
@@ -1270,6 +1529,11 @@ void RenderUtil::Update()
       }
     }
 
+    for (const auto &lod : newLightLods)
+    {
+      this->dataPtr->sceneManager.SetLightLod(lod.first, lod.second);
+    }
+
     for (const auto &emitter : newParticleEmitters)
     {
       this->dataPtr->sceneManager.CreateParticleEmitter(
@@ -1327,11 +1591,11 @@ void RenderUtil::Update()
   // update entities' pose
   {
     GZ_PROFILE("RenderUtil::Update Poses");
-    for (const auto &pose : entityPoses)
+    auto applyPose = [this](Entity _entity, const math::Pose3d &_pose)
     {
-      auto node = this->dataPtr->sceneManager.NodeById(pose.first);
+      auto node = this->dataPtr->sceneManager.NodeById(_entity);
       if (!node)
-        continue;
+        return;
 
       // Don't move entity being manipulated (last selected)
       // TODO(anyone) Check top level visual instead of parent
@@ -1348,14 +1612,75 @@ void RenderUtil::Update()
         entityId = std::get<uint64_t>(vis->UserData("gazebo-entity"));
       }
       if ((this->dataPtr->transformActive &&
-          (pose.first == this->dataPtr->selectedEntities.back() ||
+          (_entity == this->dataPtr->selectedEntities.back() ||
           entityId == this->dataPtr->selectedEntities.back())) ||
           updateNode)
       {
-        continue;
+        return;
       }
 
-      node->SetLocalPose(pose.second);
+      node->SetLocalPose(_pose);
+    };
+
+    if (!this->dataPtr->usePoseInterpolation)
+    {
+      for (const auto &pose : entityPoses)
+        applyPose(pose.first, pose.second);
+    }
+    else
+    {
+      const auto now = std::chrono::steady_clock::now();
+
+      // Record the new samples
+      for (const auto &pose : entityPoses)
+      {
+        auto sampleIt = this->dataPtr->poseSamples.find(pose.first);
+        // First sample of an entity, or a teleport: display right away.
+        if (sampleIt == this->dataPtr->poseSamples.end() ||
+            (pose.second.Pos() - sampleIt->second.curr.Pos()).Length() >
+            RenderUtilPrivate::kSnapTranslation)
+        {
+          this->dataPtr->poseSamples[pose.first] =
+              {pose.second, pose.second, now, now, false};
+          continue;
+        }
+
+        auto &samples = sampleIt->second;
+        samples.prev = samples.curr;
+        samples.prevTime = samples.currTime;
+        samples.curr = pose.second;
+        samples.currTime = now;
+        samples.settled = false;
+      }
+
+      // Display an interpolated pose for every entity still in motion,
+      // assuming the next sample will arrive after roughly the same
+      // interval as the last two.
+      for (auto &[entity, samples] : this->dataPtr->poseSamples)
+      {
+        if (samples.settled)
+          continue;
+
+        const double interval = std::chrono::duration<double>(
+            samples.currTime - samples.prevTime).count();
+        double alpha = 1.0;
+        if (interval > 0.0)
+        {
+          alpha = std::chrono::duration<double>(
+              now - samples.currTime).count() / interval;
+        }
+        if (alpha >= 1.0)
+        {
+          alpha = 1.0;
+          samples.settled = true;
+        }
+
+        applyPose(entity, math::Pose3d(
+            samples.prev.Pos() +
+            (samples.curr.Pos() - samples.prev.Pos()) * alpha,
+            math::Quaterniond::Slerp(
+                alpha, samples.prev.Rot(), samples.curr.Rot(), true)));
+      }
     }
 
     // update entities' local transformations
@@ -1514,10 +1839,12 @@ void RenderUtil::Update()
               jointEntity, joint, childId, parentId);
           this->dataPtr->viewingJoints[jointEntity] = true;
 
-          // Update joint parent visual pose
+          // Update joint parent visual pose on the next frame
           if (joint.Axis(1))
           {
-            this->dataPtr->updateJointParentPoses.push_back(jointEntity);
+            std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
+            this->dataPtr->pending.updateJointParentPoses.push_back(
+                jointEntity);
           }
         }
       }
@@ -1665,6 +1992,10 @@ void RenderUtil::Update()
     }
   }
 
+  // Select levels of detail against the current camera poses
+  this->dataPtr->sceneManager.UpdateVisualLods();
+  this->dataPtr->sceneManager.UpdateLightLods();
+
   if (this->dataPtr->eventManager)
     this->dataPtr->eventManager->Emit<events::SceneUpdate>();
 }
@@ -1704,7 +2035,7 @@ void RenderUtilPrivate::AddNewSensor(const EntityComponentManager &_ecm,
     sdfDataCopy.SetTopic(scopedName(_entity, _ecm) + _topicSuffix);
   }
   this->newSensorTopics[_entity] = sdfDataCopy.Topic();
-  this->newSensors.push_back(
+  this->staged.newSensors.push_back(
       std::make_tuple(_entity, std::move(sdfDataCopy), _parent));
   this->sensorEntities.insert(_entity);
 }
@@ -1730,9 +2061,13 @@ void RenderUtilPrivate::CreateEntitiesFirstUpdate(
         const components::World *,
         const components::Scene *_scene)->bool
       {
-        this->sceneManager.SetWorldId(_entity);
+        {
+          // The scene manager is shared with the render thread
+          std::lock_guard<std::mutex> lock(this->updateMutex);
+          this->sceneManager.SetWorldId(_entity);
+        }
         const sdf::Scene &sceneSdf = _scene->Data();
-        this->newScenes.push_back(sceneSdf);
+        this->staged.newScenes.push_back(sceneSdf);
         return true;
       });
 
@@ -1747,7 +2082,7 @@ void RenderUtilPrivate::CreateEntitiesFirstUpdate(
         sdf::Model model;
         model.SetName(_name->Data());
         model.SetRawPose(_pose->Data());
-        this->newModels.push_back(std::make_tuple(_entity, model,
+        this->staged.newModels.push_back(std::make_tuple(_entity, model,
             _parent->Data(), _info.iterations));
         this->modelToModelEntities[_parent->Data()].push_back(_entity);
         return true;
@@ -1794,14 +2129,14 @@ void RenderUtilPrivate::CreateEntitiesFirstUpdate(
           const components::Name *_name,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newActors.push_back(std::make_tuple(_entity, _actor->Data(),
+        this->staged.newActors.push_back(std::make_tuple(_entity, _actor->Data(),
             _name->Data(), _parent->Data()));
 
         // set label
         auto label = _ecm.Component<components::SemanticLabel>(_entity);
         if (label != nullptr)
         {
-          this->entityLabel[_entity] = label->Data();
+          this->staged.entityLabel[_entity] = label->Data();
         }
 
         return true;
@@ -1889,7 +2224,7 @@ void RenderUtilPrivate::CreateEntitiesFirstUpdate(
           const components::ParticleEmitter *_emitter,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newParticleEmitters.push_back(
+        this->staged.newParticleEmitters.push_back(
             std::make_tuple(_entity, _emitter->Data(), _parent->Data()));
         return true;
       });
@@ -1900,7 +2235,7 @@ void RenderUtilPrivate::CreateEntitiesFirstUpdate(
           const components::Projector *_projector,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newProjectors.push_back(
+        this->staged.newProjectors.push_back(
             std::make_tuple(_entity, _projector->Data(), _parent->Data()));
         return true;
       });
@@ -2018,9 +2353,13 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
         const components::World *,
         const components::Scene *_scene)->bool
       {
-        this->sceneManager.SetWorldId(_entity);
+        {
+          // The scene manager is shared with the render thread
+          std::lock_guard<std::mutex> lock(this->updateMutex);
+          this->sceneManager.SetWorldId(_entity);
+        }
         const sdf::Scene &sceneSdf = _scene->Data();
-        this->newScenes.push_back(sceneSdf);
+        this->staged.newScenes.push_back(sceneSdf);
         return true;
       });
 
@@ -2035,7 +2374,7 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
         sdf::Model model;
         model.SetName(_name->Data());
         model.SetRawPose(_pose->Data());
-        this->newModels.push_back(std::make_tuple(_entity, model,
+        this->staged.newModels.push_back(std::make_tuple(_entity, model,
             _parent->Data(), _info.iterations));
         this->modelToModelEntities[_parent->Data()].push_back(_entity);
         return true;
@@ -2082,7 +2421,7 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
           const components::Name *_name,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newActors.push_back(
+        this->staged.newActors.push_back(
             std::make_tuple(_entity, _actor->Data(), _name->Data(),
               _parent->Data()));
 
@@ -2090,7 +2429,7 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
         auto label = _ecm.Component<components::SemanticLabel>(_entity);
         if (label != nullptr)
         {
-          this->entityLabel[_entity] = label->Data();
+          this->staged.entityLabel[_entity] = label->Data();
         }
 
         return true;
@@ -2178,7 +2517,7 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
           const components::ParticleEmitter *_emitter,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newParticleEmitters.push_back(
+        this->staged.newParticleEmitters.push_back(
             std::make_tuple(_entity, _emitter->Data(), _parent->Data()));
         return true;
       });
@@ -2189,7 +2528,7 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
           const components::Projector *_projector,
           const components::ParentEntity *_parent) -> bool
       {
-        this->newProjectors.push_back(
+        this->staged.newProjectors.push_back(
             std::make_tuple(_entity, _projector->Data(), _parent->Data()));
         return true;
       });
@@ -2291,12 +2630,29 @@ void RenderUtilPrivate::UpdateRenderingEntities(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("RenderUtilPrivate::UpdateRenderingEntities");
+
+  // Stage a pose only if it differs from the last one staged for that
+  // entity. In mostly-static worlds this keeps the staged buffer, the
+  // merge under updateMutex and the render thread's pose application
+  // proportional to the number of entities that actually moved.
+  auto stagePose = [this](const Entity _entity, const math::Pose3d &_pose)
+  {
+    auto [it, inserted] = this->lastStagedPoses.emplace(_entity, _pose);
+    if (!inserted)
+    {
+      if (it->second == _pose)
+        return;
+      it->second = _pose;
+    }
+    this->staged.entityPoses[_entity] = _pose;
+  };
+
   _ecm.Each<components::Model, components::Pose>(
       [&](const Entity &_entity,
         const components::Model *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2305,7 +2661,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Link *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2315,7 +2671,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Visual *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2326,11 +2682,15 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Pose *_pose)->bool
       {
         // Trajectory origin
-        this->entityPoses[_entity] = _pose->Data();
+        this->staged.entityPoses[_entity] = _pose->Data();
 
         auto animTimeComp = _ecm.Component<components::AnimationTime>(_entity);
         auto animNameComp = _ecm.Component<components::AnimationName>(_entity);
 
+        // The scene manager's actor skeletons are shared with the render
+        // thread
+        std::lock_guard<std::mutex> lock(this->updateMutex);
+
         // Animation time set through ECM so gz-rendering can calculate bone
         // transforms
         if (animTimeComp && animNameComp)
@@ -2345,13 +2705,13 @@ void RenderUtilPrivate::UpdateRenderingEntities(
             animData.time = animTimeComp->Data();
             animData.rootTransform = skel->RootNode()->Transform();
             animData.valid = true;
-            this->actorAnimationData[_entity] = animData;
+            this->staged.actorAnimationData[_entity] = animData;
           }
         }
         // Bone poses calculated by gz-common
         else if (this->actorManualSkeletonUpdate)
         {
-          this->actorTransforms[_entity] =
+          this->staged.actorTransforms[_entity] =
               this->sceneManager.ActorSkeletonTransformsAt(
               _entity, this->simTime);
         }
@@ -2363,14 +2723,14 @@ void RenderUtilPrivate::UpdateRenderingEntities(
 
           if (animData.valid)
           {
-            this->actorAnimationData[_entity] = animData;
+            this->staged.actorAnimationData[_entity] = animData;
           }
         }
 
         // Trajectory pose set by other systems
         auto trajPoseComp = _ecm.Component<components::TrajectoryPose>(_entity);
         if (trajPoseComp)
-          this->trajectoryPoses[_entity] = trajPoseComp->Data();
+          this->staged.trajectoryPoses[_entity] = trajPoseComp->Data();
         return true;
       });
 
@@ -2380,7 +2740,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Light *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2390,7 +2750,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Camera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2400,7 +2760,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::DepthCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2410,7 +2770,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::RgbdCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2420,7 +2780,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::GpuLidar *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2430,7 +2790,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::ThermalCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2440,7 +2800,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::SegmentationCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2450,7 +2810,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::BoundingBoxCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 
@@ -2460,7 +2820,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::WideAngleCamera *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        stagePose(_entity, _pose->Data());
         return true;
       });
 }
@@ -2473,18 +2833,19 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Actor>(
       [&](const Entity &_entity, const components::Actor *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
-        this->entityPoses.erase(_entity);
-        this->actorAnimationData.erase(_entity);
-        this->actorTransforms.erase(_entity);
-        this->trajectoryPoses.erase(_entity);
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->staged.entityPoses.erase(_entity);
+        this->staged.actorAnimationData.erase(_entity);
+        this->staged.actorTransforms.erase(_entity);
+        this->staged.trajectoryPoses.erase(_entity);
         return true;
       });
 
   _ecm.EachRemoved<components::Model>(
       [&](const Entity &_entity, const components::Model *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         this->modelToLinkEntities.erase(_entity);
         this->modelToModelEntities.erase(_entity);
         this->matchLinksWithEntities.erase(_entity);
@@ -2494,21 +2855,22 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Link>(
       [&](const Entity &_entity, const components::Link *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         this->linkToVisualEntities.erase(_entity);
         this->linkToCollisionEntities.erase(_entity);
 
         if (this->linkToInertiaVisuals.find(_entity) !=
             this->linkToInertiaVisuals.end())
         {
-          this->removeEntities[this->linkToInertiaVisuals[_entity]] =
+          this->staged.removeEntities[this->linkToInertiaVisuals[_entity]] =
             _info.iterations;
         }
 
         if (this->linkToCOMVisuals.find(_entity) !=
             this->linkToCOMVisuals.end())
         {
-          this->removeEntities[this->linkToCOMVisuals[_entity]] =
+          this->staged.removeEntities[this->linkToCOMVisuals[_entity]] =
             _info.iterations;
         }
 
@@ -2524,7 +2886,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Visual>(
       [&](const Entity &_entity, const components::Visual *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2532,9 +2895,10 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Light>(
       [&](const Entity &_entity, const components::Light *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
-        this->removeEntities[matchLightWithVisuals[_entity]] =
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[matchLightWithVisuals[_entity]] =
           _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         matchLightWithVisuals.erase(_entity);
         return true;
       });
@@ -2543,7 +2907,7 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Joint>(
       [&](const Entity &_entity, const components::Joint *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
         this->entityJoints.erase(_entity);
         this->viewingJoints.erase(_entity);
         return true;
@@ -2553,7 +2917,7 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::ParticleEmitter>(
       [&](const Entity &_entity, const components::ParticleEmitter *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
         return true;
       });
 
@@ -2561,7 +2925,7 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Projector>(
       [&](const Entity &_entity, const components::Projector *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
         return true;
       });
 
@@ -2569,7 +2933,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Camera>(
     [&](const Entity &_entity, const components::Camera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2577,7 +2942,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::DepthCamera>(
     [&](const Entity &_entity, const components::DepthCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2585,7 +2951,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::RgbdCamera>(
     [&](const Entity &_entity, const components::RgbdCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2593,7 +2960,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::GpuLidar>(
     [&](const Entity &_entity, const components::GpuLidar *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2601,7 +2969,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::ThermalCamera>(
     [&](const Entity &_entity, const components::ThermalCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2609,7 +2978,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::SegmentationCamera>(
     [&](const Entity &_entity, const components::SegmentationCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2617,7 +2987,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::BoundingBoxCamera>(
     [&](const Entity &_entity, const components::BoundingBoxCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2625,7 +2996,8 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::WideAngleCamera>(
     [&](const Entity &_entity, const components::WideAngleCamera *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
+        this->lastStagedPoses.erase(_entity);
         return true;
       });
 
@@ -2633,7 +3005,7 @@ void RenderUtilPrivate::RemoveRenderingEntities(
   _ecm.EachRemoved<components::Collision>(
     [&](const Entity &_entity, const components::Collision *)->bool
       {
-        this->removeEntities[_entity] = _info.iterations;
+        this->staged.removeEntities[_entity] = _info.iterations;
         this->viewingCollisions.erase(_entity);
         this->entityCollisions.erase(_entity);
         return true;
@@ -2704,6 +3076,32 @@ void RenderUtil::Init()
     params["headless"] = "1";
   params["winID"] = this->dataPtr->winID;
 
+  // Persistent shader cache, shared between processes so concurrent
+  // simulations on one machine skip redundant shader compilation. Engines
+  // without shader cache support ignore the parameter.
+  std::string shaderCache = this->dataPtr->shaderCachePath;
+  if (shaderCache.empty())
+  {
+    std::string home;
+    if (common::env(GZ_HOMEDIR, home))
+    {
+      shaderCache = common::joinPaths(home, ".gz", "rendering",
+          "shader_cache", this->dataPtr->engineName);
+    }
+  }
+  if (!shaderCache.empty())
+  {
+    if (common::exists(shaderCache) || common::createDirectories(shaderCache))
+    {
+      params["shaderCachePath"] = shaderCache;
+    }
+    else
+    {
+      gzwarn << "Unable to create shader cache directory [" << shaderCache
+             << "], shaders will be recompiled on every run." << std::endl;
+    }
+  }
+
   this->dataPtr->engine = rendering::engine(this->dataPtr->engineName, params);
   if (!this->dataPtr->engine)
   {
@@ -2858,12 +3256,24 @@ void RenderUtil::SetUseCurrentGLContext(bool _enable)
   this->dataPtr->useCurrentGLContext = _enable;
 }
 
+/////////////////////////////////////////////////
+void RenderUtil::SetPoseInterpolation(bool _enable)
+{
+  this->dataPtr->usePoseInterpolation = _enable;
+}
+
 /////////////////////////////////////////////////
 void RenderUtil::SetWinID(const std::string &_winID)
 {
   this->dataPtr->winID = _winID;
 }
 
+/////////////////////////////////////////////////
+void RenderUtil::SetShaderCachePath(const std::string &_path)
+{
+  this->dataPtr->shaderCachePath = _path;
+}
+
 /////////////////////////////////////////////////
 void RenderUtil::SetEnableSensors(bool _enable,
     std::function<std::string(const sim::Entity &, const sdf::Sensor &,
@@ -3845,7 +4255,7 @@ void RenderUtilPrivate::CreateLink(
    sdf::Link link;
    link.SetName(_name->Data());
    link.SetRawPose(_pose->Data());
-   this->newLinks.push_back(
+   this->staged.newLinks.push_back(
        std::make_tuple(_entity, link, _parent->Data()));
    // used for collsions
    this->modelToLinkEntities[_parent->Data()].push_back(_entity);
@@ -3891,13 +4301,13 @@ void RenderUtilPrivate::CreateVisual(
   auto label = _ecm.Component<components::SemanticLabel>(_entity);
   if (label != nullptr)
   {
-    this->entityLabel[_entity] = label->Data();
+    this->staged.entityLabel[_entity] = label->Data();
   }
 
   if (auto temp = _ecm.Component<components::Temperature>(_entity))
   {
     // get the uniform temperature for the entity
-    this->entityTemp[_entity] = std::make_tuple
+    this->staged.entityTemp[_entity] = std::make_tuple
         <float, float, std::string>(temp->Data().Kelvin(), 0.0, "");
   }
   else
@@ -3910,7 +4320,7 @@ void RenderUtilPrivate::CreateVisual(
        _ecm.Component<components::TemperatureRange>(_entity);
     if (heatSignature && tempRange)
     {
-      this->entityTemp[_entity] =
+      this->staged.entityTemp[_entity] =
         std::make_tuple<float, float, std::string>(
             tempRange->Data().min.Kelvin(),
             tempRange->Data().max.Kelvin(),
@@ -3918,22 +4328,33 @@ void RenderUtilPrivate::CreateVisual(
     }
   }
 
-  this->newVisuals.push_back(
+  // Start decoding the visual's mesh file, if any, off the render thread.
+  this->PrefetchMesh(_geom->Data());
+
+  this->staged.newVisuals.push_back(
       std::make_tuple(_entity, visual, _parent->Data()));
 
+  auto visualLod = _ecm.Component<components::VisualLod>(_entity);
+  if (visualLod && !visualLod->Data().empty())
+    this->staged.newVisualLods[_entity] = visualLod->Data();
+
   this->linkToVisualEntities[_parent->Data()].push_back(_entity);
 }
 
 /////////////////////////////////////////////////
 void RenderUtilPrivate::CreateLight(
-    const EntityComponentManager &/*_ecm*/,
+    const EntityComponentManager &_ecm,
     const Entity &_entity,
     const components::Light *_light,
     const components::Name *_name,
     const components::ParentEntity *_parent)
 {
-  this->newLights.push_back(std::make_tuple(_entity, _light->Data(),
+  this->staged.newLights.push_back(std::make_tuple(_entity, _light->Data(),
       _name->Data(), _parent->Data()));
+
+  auto lightLod = _ecm.Component<components::LightLod>(_entity);
+  if (lightLod && lightLod->Data() > 0.0)
+    this->staged.newLightLods[_entity] = lightLod->Data();
 }
 
 //////////////////////////////////////////////////
@@ -16,9 +16,12 @@
  */
 
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <queue>
+#include <sstream>
 #include <unordered_map>
 
 #include <sdf/Box.hh>
@@ -57,6 +60,7 @@
 #include <gz/msgs/Utility.hh>
 
 #include "gz/rendering/Capsule.hh"
+#include <gz/rendering/Camera.hh>
 #include <gz/rendering/COMVisual.hh>
 #include <gz/rendering/Geometry.hh>
 #include <gz/rendering/Heightmap.hh>
@@ -147,6 +151,94 @@ class gz::sim::SceneManagerPrivate
 
   /// \brief Holds the spherical coordinates from the world.
   public: math::SphericalCoordinates sphericalCoordinates;
+
+  /// \brief Source materials loaded from SDF, keyed by their full
+  /// description. Repeated visuals with identical materials, e.g. many
+  /// copies of the same model, resolve to one cached source material
+  /// instead of re-parsing colors and texture paths per visual.
+  public: std::unordered_map<std::string, rendering::MaterialPtr>
+      materialCache;
+
+  /// \brief Build the material cache key for an SDF material. The key
+  /// covers every property read by SceneManager::LoadMaterial, so two
+  /// materials with the same key load identically.
+  /// \param[in] _material Material sdf dom
+  /// \return Cache key string
+  public: static std::string MaterialCacheKey(const sdf::Material &_material);
+
+  /// \brief Levels of detail registered for one visual
+  public: struct VisualLodData
+  {
+    /// \brief Level definitions, ordered finest to coarsest
+    public: std::vector<components::VisualLodLevel> levels;
+
+    /// \brief One child visual per level, with the authored geometry at
+    /// index 0. A null entry hides the visual at that level.
+    public: std::vector<rendering::VisualPtr> levelVisuals;
+
+    /// \brief Radius of the authored geometry's bounding sphere, in
+    /// local units
+    public: double radius{0.0};
+
+    /// \brief Index into levelVisuals of the currently visible level
+    public: int activeLevel{0};
+  };
+
+  /// \brief Map of visual entity to its registered levels of detail
+  public: std::unordered_map<Entity, VisualLodData> visualLods;
+
+  /// \brief Distance-based activation state for one light
+  public: struct LightLodData
+  {
+    /// \brief Distance from the closest camera beyond which the light
+    /// is deactivated
+    public: double maxDistance{0.0};
+
+    /// \brief Intensity to restore when the light is reactivated
+    public: double intensity{1.0};
+
+    /// \brief True while the light is active
+    public: bool active{true};
+  };
+
+  /// \brief Map of light entity to its distance-based activation state
+  public: std::unordered_map<Entity, LightLodData> lightLods;
+
+  /// \brief Cached skeleton transforms for one actor
+  public: struct ActorPoseCache
+  {
+    /// \brief True once frames holds a sampled pose
+    public: bool valid{false};
+
+    /// \brief Animation time at which the skeleton was last sampled
+    public: std::chrono::steady_clock::duration sampledTime{0};
+
+    /// \brief Skeleton transforms computed at sampledTime
+    public: std::map<std::string, math::Matrix4d> frames;
+  };
+
+  /// \brief Map of actor entity to its cached skeleton transforms
+  public: std::unordered_map<Entity, ActorPoseCache> actorPoseCaches;
+
+  /// \brief Cached bounding sphere radius for one actor, in local units.
+  /// Computed lazily from the actor's bounding box and used for the
+  /// conservative frustum test in ActorSampleInterval.
+  public: std::unordered_map<Entity, double> actorBoundingRadii;
+
+  /// \brief Compute how often an actor's skeleton needs to be resampled.
+  /// An actor whose bounding sphere is outside every camera's view
+  /// frustum is not resampled at all; a visible one is sampled based on
+  /// its distance to the closest camera. Nearby actors are sampled every
+  /// call; distant ones are decimated since sub-frame limb motion is not
+  /// resolvable at their projected size. Visibility is re-evaluated on
+  /// every call, so an actor entering view resamples on its first
+  /// visible frame.
+  /// \param[in] _id Actor entity's unique id
+  /// \return Minimum duration between skeleton samples; zero means
+  /// sample on every call and the maximum duration means do not
+  /// resample
+  public: std::chrono::steady_clock::duration ActorSampleInterval(
+      Entity _id);
 };
 
 
@@ -353,13 +445,34 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
 
     // set material
     rendering::MaterialPtr material{nullptr};
+    bool materialCached = false;
     if (_visual.Geom()->Type() == sdf::GeometryType::HEIGHTMAP)
     {
       // Heightmap's material is loaded together with it.
     }
     else if (_visual.Material())
     {
-      material = this->LoadMaterial(*_visual.Material());
+      // Repeated visuals commonly share one material definition, e.g.
+      // many instances of the same model. Cache the loaded source
+      // material so identical definitions are parsed once and cloned
+      // per visual by SetMaterial below.
+      const std::string key =
+          SceneManagerPrivate::MaterialCacheKey(*_visual.Material());
+      auto cacheIt = this->dataPtr->materialCache.find(key);
+      if (cacheIt != this->dataPtr->materialCache.end())
+      {
+        material = cacheIt->second;
+        materialCached = true;
+      }
+      else
+      {
+        material = this->LoadMaterial(*_visual.Material());
+        if (material)
+        {
+          this->dataPtr->materialCache[key] = material;
+          materialCached = true;
+        }
+      }
     }
     // Don't set a default material for meshes because they
     // may have their own
@@ -417,7 +530,10 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
       // but does not take ownership of it so we need to destroy it here.
       // This is not ideal. We should let gz-rendering handle the lifetime
       // of this material
-      this->dataPtr->scene->DestroyMaterial(material);
+      // Cached source materials are kept alive so later visuals with the
+      // same definition can reuse them; they are destroyed in Clear.
+      if (!materialCached)
+        this->dataPtr->scene->DestroyMaterial(material);
     }
   }
   else
@@ -436,6 +552,235 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
   return visualVis;
 }
 
+/////////////////////////////////////////////////
+void SceneManager::SetVisualLod(Entity _id,
+    const std::vector<components::VisualLodLevel> &_levels)
+{
+  if (!this->dataPtr->scene || _levels.empty())
+    return;
+
+  auto it = this->dataPtr->visuals.find(_id);
+  if (it == this->dataPtr->visuals.end())
+  {
+    gzerr << "Unable to set levels of detail for visual with Id: [" << _id
+           << "]: visual not found" << std::endl;
+    return;
+  }
+  rendering::VisualPtr visualVis = it->second;
+
+  SceneManagerPrivate::VisualLodData data;
+  data.levels = _levels;
+
+  // Move the authored geometry into a child visual so every level,
+  // including the authored one, can be toggled through node visibility.
+  rendering::VisualPtr lod0 =
+      this->dataPtr->scene->CreateVisual(visualVis->Name() + "_lod0");
+  while (visualVis->GeometryCount() > 0u)
+  {
+    auto geom = visualVis->GeometryByIndex(0u);
+    visualVis->RemoveGeometry(geom);
+    lod0->AddGeometry(geom);
+  }
+  visualVis->AddChild(lod0);
+  data.radius = lod0->LocalBoundingBox().Size().Length() * 0.5;
+  data.levelVisuals.push_back(lod0);
+
+  for (auto i = 0u; i < _levels.size(); ++i)
+  {
+    const auto &level = _levels[i];
+    if (level.meshUri.empty())
+    {
+      // An empty URI hides the visual at this level
+      data.levelVisuals.push_back(rendering::VisualPtr());
+      continue;
+    }
+
+    sdf::Mesh meshSdf;
+    meshSdf.SetUri(level.meshUri);
+    meshSdf.SetSubmesh(level.submesh);
+    sdf::Geometry geomSdf;
+    geomSdf.SetType(sdf::GeometryType::MESH);
+    geomSdf.SetMeshShape(meshSdf);
+
+    math::Vector3d scale;
+    math::Pose3d localPose;
+    auto geom = this->LoadGeometry(geomSdf, scale, localPose);
+    if (!geom)
+    {
+      gzerr << "Failed to load level of detail mesh [" << level.meshUri
+             << "] for visual with Id: [" << _id << "]" << std::endl;
+      data.levelVisuals.push_back(rendering::VisualPtr());
+      continue;
+    }
+
+    rendering::VisualPtr lodVis = this->dataPtr->scene->CreateVisual(
+        visualVis->Name() + "_lod" + std::to_string(i + 1));
+    lodVis->AddGeometry(geom);
+    lodVis->SetLocalScale(level.scale);
+    lodVis->SetVisible(false);
+    visualVis->AddChild(lodVis);
+    data.levelVisuals.push_back(lodVis);
+  }
+
+  this->dataPtr->visualLods[_id] = std::move(data);
+}
+
+/////////////////////////////////////////////////
+void SceneManager::UpdateVisualLods()
+{
+  if (this->dataPtr->visualLods.empty() || !this->dataPtr->scene)
+    return;
+
+  std::vector<rendering::CameraPtr> cameras;
+  for (auto i = 0u; i < this->dataPtr->scene->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+        this->dataPtr->scene->SensorByIndex(i));
+    if (camera)
+      cameras.push_back(camera);
+  }
+  if (cameras.empty())
+    return;
+
+  for (auto &[entity, data] : this->dataPtr->visualLods)
+  {
+    auto it = this->dataPtr->visuals.find(entity);
+    if (it == this->dataPtr->visuals.end())
+      continue;
+    rendering::VisualPtr visualVis = it->second;
+
+    // Fraction of the viewport height covered by the visual's bounding
+    // sphere. The scene is shared by all cameras, so take the largest
+    // fraction over them: the finest level required by any camera wins.
+    double screenSize = 0.0;
+    math::Vector3d worldPos = visualVis->WorldPosition();
+    double radius = data.radius * visualVis->WorldScale().Max();
+    for (const auto &camera : cameras)
+    {
+      double dist = worldPos.Distance(camera->WorldPosition());
+      if (dist < radius)
+      {
+        screenSize = 1.0;
+        break;
+      }
+      // Vertical field of view from the horizontal one
+      double vfov = 2.0 * std::atan(
+          std::tan(camera->HFOV().Radian() / 2.0) / camera->AspectRatio());
+      screenSize = std::max(screenSize,
+          radius / (dist * std::tan(vfov / 2.0)));
+    }
+
+    // The authored geometry is used while the screen fraction is at or
+    // above the first declared threshold. Each declared level takes over
+    // once the fraction drops below the thresholds of all finer levels.
+    int level = 0;
+    for (auto i = 0u; i < data.levels.size(); ++i)
+    {
+      if (screenSize < data.levels[i].minScreenSize)
+        level = static_cast<int>(i) + 1;
+    }
+
+    if (level == data.activeLevel)
+      continue;
+
+    if (data.levelVisuals[data.activeLevel])
+      data.levelVisuals[data.activeLevel]->SetVisible(false);
+    if (data.levelVisuals[level])
+      data.levelVisuals[level]->SetVisible(true);
+    data.activeLevel = level;
+  }
+}
+
+/////////////////////////////////////////////////
+void SceneManager::SetLightLod(Entity _id, double _maxDistance)
+{
+  if (!this->dataPtr->scene || _maxDistance <= 0.0)
+    return;
+
+  auto it = this->dataPtr->lights.find(_id);
+  if (it == this->dataPtr->lights.end())
+  {
+    gzerr << "Unable to set level of detail for light with Id: [" << _id
+           << "]: light not found" << std::endl;
+    return;
+  }
+
+  if (std::dynamic_pointer_cast<rendering::DirectionalLight>(it->second))
+  {
+    gzwarn << "Ignoring level of detail for directional light with Id: ["
+            << _id << "]: directional lights illuminate the scene "
+            << "regardless of position" << std::endl;
+    return;
+  }
+
+  SceneManagerPrivate::LightLodData data;
+  data.maxDistance = _maxDistance;
+  data.intensity = it->second->Intensity();
+  this->dataPtr->lightLods[_id] = data;
+}
+
+/////////////////////////////////////////////////
+void SceneManager::UpdateLightLods()
+{
+  if (this->dataPtr->lightLods.empty() || !this->dataPtr->scene)
+    return;
+
+  std::vector<math::Vector3d> cameraPositions;
+  for (auto i = 0u; i < this->dataPtr->scene->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+        this->dataPtr->scene->SensorByIndex(i));
+    if (camera)
+      cameraPositions.push_back(camera->WorldPosition());
+  }
+  if (cameraPositions.empty())
+    return;
+
+  for (auto &[entity, data] : this->dataPtr->lightLods)
+  {
+    auto it = this->dataPtr->lights.find(entity);
+    if (it == this->dataPtr->lights.end())
+      continue;
+    rendering::LightPtr light = it->second;
+
+    // The scene is shared by all cameras, so a light within range of any
+    // of them has to stay active.
+    math::Vector3d lightPos = light->WorldPosition();
+    bool inRange = false;
+    for (const auto &cameraPos : cameraPositions)
+    {
+      if (lightPos.Distance(cameraPos) <= data.maxDistance)
+      {
+        inRange = true;
+        break;
+      }
+    }
+
+    if (data.active)
+    {
+      if (!inRange)
+      {
+        data.intensity = light->Intensity();
+        light->SetIntensity(0.0);
+        data.active = false;
+      }
+    }
+    else if (inRange)
+    {
+      light->SetIntensity(data.intensity);
+      data.active = true;
+    }
+    else if (!math::equal(light->Intensity(), 0.0))
+    {
+      // A light command changed the intensity while the light was
+      // deactivated. Adopt the new value as the one to restore and keep
+      // the light off until a camera comes back into range.
+      data.intensity = light->Intensity();
+      light->SetIntensity(0.0);
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 std::vector<rendering::NodePtr> SceneManager::Filter(const std::string &_node,
     std::function<bool(const rendering::NodePtr _nodeToFilter)> _filter) const
@@ -711,8 +1056,6 @@ rendering::GeometryPtr SceneManager::LoadGeometry(const sdf::Geometry &_geom,
          common::basename(_geom.MeshShape()->Uri()) :
          asFullPath(_geom.MeshShape()->Uri(),
                     _geom.MeshShape()->FilePath());
-    auto a =     asFullPath(_geom.MeshShape()->Uri(),
-                    _geom.MeshShape()->FilePath());
 
     descriptor.meshName = meshUri;
     descriptor.subMeshName = _geom.MeshShape()->Submesh();
@@ -825,6 +1168,43 @@ rendering::GeometryPtr SceneManager::LoadGeometry(const sdf::Geometry &_geom,
   return geom;
 }
 
+/////////////////////////////////////////////////
+std::string SceneManagerPrivate::MaterialCacheKey(
+    const sdf::Material &_material)
+{
+  std::ostringstream key;
+  key << _material.Ambient() << ";" << _material.Diffuse() << ";"
+      << _material.Specular() << ";" << _material.Emissive() << ";"
+      << _material.Shininess() << ";" << _material.RenderOrder() << ";"
+      << _material.DoubleSided();
+
+  const sdf::Pbr *pbr = _material.PbrMaterial();
+  if (pbr)
+  {
+    const sdf::PbrWorkflow *workflow =
+        pbr->Workflow(sdf::PbrWorkflowType::METAL);
+    if (!workflow)
+      workflow = pbr->Workflow(sdf::PbrWorkflowType::SPECULAR);
+    if (workflow)
+    {
+      // Texture paths are resolved relative to the material's file path,
+      // so it has to be part of the key.
+      key << ";" << _material.FilePath()
+          << ";" << workflow->Roughness()
+          << ";" << workflow->Metalness()
+          << ";" << workflow->RoughnessMap()
+          << ";" << workflow->MetalnessMap()
+          << ";" << workflow->AlbedoMap()
+          << ";" << workflow->NormalMap()
+          << ";" << workflow->EnvironmentMap()
+          << ";" << workflow->EmissiveMap()
+          << ";" << workflow->LightMap()
+          << ";" << workflow->LightMapTexCoordSet();
+    }
+  }
+  return key.str();
+}
+
 /////////////////////////////////////////////////
 rendering::MaterialPtr SceneManager::LoadMaterial(
     const sdf::Material &_material)
@@ -1931,6 +2311,34 @@ std::map<std::string, math::Matrix4d> SceneManager::ActorSkeletonTransformsAt(
     return allFrames;
   }
 
+  auto &cache = this->dataPtr->actorPoseCaches[_id];
+  if (cache.valid)
+  {
+    // Same animation time, same pose
+    if (_time == cache.sampledTime)
+      return cache.frames;
+
+    auto interval = this->dataPtr->ActorSampleInterval(_id);
+    if (interval > std::chrono::steady_clock::duration::zero() &&
+        _time > cache.sampledTime && _time - cache.sampledTime < interval)
+    {
+      // Reuse the limb poses but re-evaluate the trajectory root, so a
+      // decimated actor keeps moving along its path between skeleton
+      // samples instead of freezing in place.
+      AnimationUpdateData cachedTraj =
+          this->dataPtr->ActorTrajectoryAt(_id, _time);
+      if (cachedTraj.followTrajectory)
+      {
+        common::PoseKeyFrame rootFrame(0.0);
+        cachedTraj.trajectory.Waypoints()->InterpolatedKeyFrame(rootFrame);
+        math::Matrix4d rootTf(rootFrame.Rotation());
+        rootTf.SetTranslation(rootFrame.Translation());
+        cache.frames["actorPose"] = rootTf;
+      }
+      return cache.frames;
+    }
+  }
+
   // get the trajectory at input time
   AnimationUpdateData animData = this->dataPtr->ActorTrajectoryAt(_id, _time);
   bool followTraj = animData.followTrajectory;
@@ -2003,6 +2411,10 @@ std::map<std::string, math::Matrix4d> SceneManager::ActorSkeletonTransformsAt(
   }
 
   allFrames[skel->RootNode()->Name()].SetTranslation(math::Vector3d::Zero);
+
+  cache.valid = true;
+  cache.sampledTime = _time;
+  cache.frames = allFrames;
   return allFrames;
 }
 
@@ -2033,6 +2445,8 @@ void SceneManager::RemoveEntity(Entity _id)
       this->dataPtr->actorSkeletons.erase(it);
     }
   }
+  this->dataPtr->actorPoseCaches.erase(_id);
+  this->dataPtr->actorBoundingRadii.erase(_id);
 
   {
     auto it = this->dataPtr->visuals.find(_id);
@@ -2051,6 +2465,7 @@ void SceneManager::RemoveEntity(Entity _id)
         this->dataPtr->originalDepthWrite.erase(geom->Name());
       }
 
+      this->dataPtr->visualLods.erase(_id);
       this->dataPtr->scene->DestroyVisual(it->second);
       this->dataPtr->visuals.erase(it);
       return;
@@ -2061,6 +2476,7 @@ void SceneManager::RemoveEntity(Entity _id)
     auto it = this->dataPtr->lights.find(_id);
     if (it != this->dataPtr->lights.end())
     {
+      this->dataPtr->lightLods.erase(_id);
       this->dataPtr->scene->DestroyLight(it->second);
       this->dataPtr->lights.erase(it);
       return;
@@ -2259,6 +2675,88 @@ Entity SceneManager::UniqueId() const
   }
 }
 
+/////////////////////////////////////////////////
+std::chrono::steady_clock::duration SceneManagerPrivate::ActorSampleInterval(
+    Entity _id)
+{
+  auto it = this->visuals.find(_id);
+  if (it == this->visuals.end() || !this->scene)
+    return std::chrono::steady_clock::duration::zero();
+
+  // Bounding sphere radius, cached since the bounding box walks the
+  // visual's geometry. The animated mesh can swing outside the bind-pose
+  // box, so pad it generously; the test below only has to be
+  // conservative, not tight.
+  auto radiusIt = this->actorBoundingRadii.find(_id);
+  if (radiusIt == this->actorBoundingRadii.end())
+  {
+    double radius = std::max(1.0,
+        it->second->LocalBoundingBox().Size().Length());
+    radiusIt = this->actorBoundingRadii.insert({_id, radius}).first;
+  }
+  double radius = radiusIt->second * it->second->WorldScale().Max();
+
+  bool hasCamera = false;
+  bool visible = false;
+  double dist = std::numeric_limits<double>::max();
+  math::Vector3d actorPos = it->second->WorldPosition();
+  for (auto i = 0u; i < this->scene->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+        this->scene->SensorByIndex(i));
+    if (!camera)
+      continue;
+    hasCamera = true;
+    math::Vector3d toActor = actorPos - camera->WorldPosition();
+    double d = toActor.Length();
+    dist = std::min(dist, d);
+    if (visible)
+      continue;
+    if (d <= radius)
+    {
+      visible = true;
+      continue;
+    }
+
+    // Conservative frustum test: a cone around the camera's view
+    // direction that bounds the frustum, widened by the actor's angular
+    // radius. Cameras look down their +X axis.
+    double halfH = camera->HFOV().Radian() / 2.0;
+    double halfV = std::atan(std::tan(halfH) / camera->AspectRatio());
+    double halfDiag = std::atan(std::hypot(std::tan(halfH),
+        std::tan(halfV)));
+    math::Vector3d forward =
+        camera->WorldRotation().RotateVector(math::Vector3d::UnitX);
+    double angle = std::acos(std::clamp(forward.Dot(toActor) / d,
+        -1.0, 1.0));
+    if (angle <= halfDiag + std::asin(std::min(1.0, radius / d)))
+      visible = true;
+  }
+
+  // Without a camera there is nothing to decimate against
+  if (!hasCamera)
+    return std::chrono::steady_clock::duration::zero();
+
+  // An actor outside every frustum keeps its last sampled limb poses;
+  // the trajectory root still advances so it reappears in the right
+  // place, and the per-call visibility check resamples it on the first
+  // frame it comes back into view.
+  if (!visible)
+    return std::chrono::steady_clock::duration::max();
+
+  // Full-rate sampling near a camera, stepping down to 30, 15 and 5 Hz
+  // as the actor recedes. At those distances the per-limb motion between
+  // samples projects to less than a pixel for typical sensor
+  // resolutions.
+  if (dist < 10.0)
+    return std::chrono::steady_clock::duration::zero();
+  if (dist < 25.0)
+    return std::chrono::milliseconds(33);
+  if (dist < 50.0)
+    return std::chrono::milliseconds(66);
+  return std::chrono::milliseconds(200);
+}
+
 /////////////////////////////////////////////////
 AnimationUpdateData SceneManagerPrivate::ActorTrajectoryAt(
     Entity _id,
@@ -2556,9 +3054,19 @@ void SceneManager::Clear()
   this->dataPtr->actors.clear();
   this->dataPtr->actorSkeletons.clear();
   this->dataPtr->actorTrajectories.clear();
+  this->dataPtr->actorPoseCaches.clear();
+  this->dataPtr->actorBoundingRadii.clear();
   this->dataPtr->lights.clear();
   this->dataPtr->particleEmitters.clear();
   this->dataPtr->sensors.clear();
+  if (this->dataPtr->scene)
+  {
+    for (const auto &[key, material] : this->dataPtr->materialCache)
+      this->dataPtr->scene->DestroyMaterial(material);
+  }
+  this->dataPtr->materialCache.clear();
+  this->dataPtr->visualLods.clear();
+  this->dataPtr->lightLods.clear();
   this->dataPtr->scene.reset();
   this->dataPtr->originalTransparency.clear();
   this->dataPtr->originalDepthWrite.clear();
@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "gz/sim/rendering/VideoCapture.hh"
+
+#include <gz/msgs/time.pb.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/VideoEncoder.hh>
+#include <gz/math/Helpers.hh>
+#include <gz/rendering/PixelFormat.hh>
+#include <gz/transport/Node.hh>
+
+using namespace gz;
+using namespace sim;
+
+/// \brief A rendered frame queued for encoding.
+struct PendingFrame
+{
+  /// \brief Raw image data copied from the camera.
+  std::vector<unsigned char> data;
+
+  /// \brief Image width in pixels.
+  unsigned int width{0};
+
+  /// \brief Image height in pixels.
+  unsigned int height{0};
+
+  /// \brief Capture timestamp passed to the encoder.
+  std::chrono::steady_clock::time_point stamp;
+};
+
+/// \brief Private data class for VideoCapture
+class gz::sim::VideoCapturePrivate
+{
+  /// \brief Loop run by the encoder thread. Pops frames off the queue
+  /// and feeds them to the video encoder until recording stops and the
+  /// queue drains.
+  public: void EncoderLoop();
+
+  /// \brief Transport node for the statistics publisher
+  public: transport::Node node;
+
+  /// \brief Recording statistics publisher
+  public: transport::Node::Publisher statsPub;
+
+  /// \brief Video encoder
+  public: common::VideoEncoder videoEncoder;
+
+  /// \brief Filename of the video being encoded, used in log messages
+  public: std::string filename;
+
+  /// \brief Thread that runs the video encoder
+  public: std::thread encoderThread;
+
+  /// \brief Protects frameQueue, spareBuffers, encoderRunning and
+  /// droppedFrames
+  public: std::mutex frameMutex;
+
+  /// \brief Signals the encoder thread that frames arrived or recording
+  /// stopped
+  public: std::condition_variable frameCv;
+
+  /// \brief Signals a blocked AddFrame caller that queue space freed up
+  public: std::condition_variable spaceCv;
+
+  /// \brief Frames waiting to be encoded
+  public: std::deque<PendingFrame> frameQueue;
+
+  /// \brief Recycled frame buffers, to avoid a heap allocation per
+  /// frame
+  public: std::vector<std::vector<unsigned char>> spareBuffers;
+
+  /// \brief Whether the encoder thread should keep running. The thread
+  /// drains the remaining queue before exiting.
+  public: bool encoderRunning{false};
+
+  /// \brief True to drop frames when the queue is full, false to block
+  /// the caller of AddFrame
+  public: bool dropOnOverflow{true};
+
+  /// \brief Number of frames dropped because the encoder fell behind
+  public: uint64_t droppedFrames{0};
+
+  /// \brief Time at which the first frame was encoded
+  public: std::chrono::steady_clock::time_point startTime;
+
+  /// \brief Maximum number of frames held in the queue before new
+  /// frames are dropped, or the caller blocked, instead of growing the
+  /// queue without bound
+  public: static constexpr std::size_t kMaxPendingFrames{8};
+};
+
+//////////////////////////////////////////////////
+void VideoCapturePrivate::EncoderLoop()
+{
+  while (true)
+  {
+    PendingFrame frame;
+    {
+      std::unique_lock<std::mutex> lock(this->frameMutex);
+      this->frameCv.wait(lock, [this]
+          {
+            return !this->frameQueue.empty() || !this->encoderRunning;
+          });
+      if (this->frameQueue.empty())
+        break;
+      frame = std::move(this->frameQueue.front());
+      this->frameQueue.pop_front();
+    }
+    this->spaceCv.notify_one();
+
+    bool frameAdded = this->videoEncoder.AddFrame(
+        frame.data.data(), frame.width, frame.height, frame.stamp);
+
+    if (frameAdded && this->statsPub)
+    {
+      // start time, i.e. time when first frame is added
+      if (this->startTime ==
+          std::chrono::steady_clock::time_point(
+            std::chrono::duration(std::chrono::seconds(0))))
+      {
+        this->startTime = frame.stamp;
+      }
+
+      std::chrono::steady_clock::duration dt;
+      dt = frame.stamp - this->startTime;
+      int64_t sec, nsec;
+      std::tie(sec, nsec) = math::durationToSecNsec(dt);
+      msgs::Time msg;
+      msg.set_sec(sec);
+      msg.set_nsec(nsec);
+      this->statsPub.Publish(msg);
+    }
+
+    // recycle the frame buffer
+    {
+      std::lock_guard<std::mutex> lock(this->frameMutex);
+      this->spareBuffers.push_back(std::move(frame.data));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+VideoCapture::VideoCapture()
+  : dataPtr(std::make_unique<VideoCapturePrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+VideoCapture::~VideoCapture()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->frameMutex);
+    this->dataPtr->frameQueue.clear();
+    this->dataPtr->encoderRunning = false;
+  }
+  this->dataPtr->frameCv.notify_one();
+  this->dataPtr->spaceCv.notify_all();
+  if (this->dataPtr->encoderThread.joinable())
+    this->dataPtr->encoderThread.join();
+}
+
+//////////////////////////////////////////////////
+void VideoCapture::SetStatsTopic(const std::string &_topic)
+{
+  if (_topic.empty())
+  {
+    this->dataPtr->statsPub = transport::Node::Publisher();
+    return;
+  }
+  this->dataPtr->statsPub =
+      this->dataPtr->node.Advertise<msgs::Time>(_topic);
+}
+
+//////////////////////////////////////////////////
+void VideoCapture::SetDropOnOverflow(bool _drop)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->frameMutex);
+  this->dataPtr->dropOnOverflow = _drop;
+}
+
+//////////////////////////////////////////////////
+bool VideoCapture::Start(const std::string &_format,
+    const std::string &_filename, unsigned int _width,
+    unsigned int _height, unsigned int _fps, unsigned int _bitrate)
+{
+  if (this->dataPtr->videoEncoder.IsEncoding())
+  {
+    gzerr << "Video capture is already encoding to ["
+           << this->dataPtr->filename << "]" << std::endl;
+    return false;
+  }
+
+  if (!this->dataPtr->videoEncoder.Start(_format, _filename, _width,
+      _height, _fps, _bitrate))
+  {
+    return false;
+  }
+
+  this->dataPtr->filename = _filename;
+  this->dataPtr->startTime = std::chrono::steady_clock::time_point(
+      std::chrono::duration(std::chrono::seconds(0)));
+
+  // Start the encoder thread. It is joined when recording stops, so it
+  // can never still be running here.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->frameMutex);
+    this->dataPtr->droppedFrames = 0;
+    this->dataPtr->encoderRunning = true;
+  }
+  this->dataPtr->encoderThread =
+      std::thread(&VideoCapturePrivate::EncoderLoop, this->dataPtr.get());
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool VideoCapture::Encoding() const
+{
+  return this->dataPtr->videoEncoder.IsEncoding();
+}
+
+//////////////////////////////////////////////////
+void VideoCapture::AddFrame(const rendering::Image &_image,
+    const std::chrono::steady_clock::time_point &_stamp)
+{
+  const unsigned char *imageData = _image.Data<unsigned char>();
+  const unsigned int memSize = rendering::PixelUtil::MemorySize(
+      _image.Format(), _image.Width(), _image.Height());
+
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->frameMutex);
+    if (!this->dataPtr->encoderRunning)
+      return;
+
+    if (this->dataPtr->frameQueue.size() >=
+        VideoCapturePrivate::kMaxPendingFrames)
+    {
+      if (this->dataPtr->dropOnOverflow)
+      {
+        if (this->dataPtr->droppedFrames++ == 0)
+        {
+          gzwarn << "Video encoder for [" << this->dataPtr->filename
+                  << "] is falling behind, dropping frames." << std::endl;
+        }
+        return;
+      }
+      // Lockstep recording keeps every frame, so wait for the encoder
+      // instead of dropping.
+      this->dataPtr->spaceCv.wait(lock, [this]
+          {
+            return this->dataPtr->frameQueue.size() <
+                VideoCapturePrivate::kMaxPendingFrames ||
+                !this->dataPtr->encoderRunning;
+          });
+      if (!this->dataPtr->encoderRunning)
+        return;
+    }
+
+    PendingFrame frame;
+    if (!this->dataPtr->spareBuffers.empty())
+    {
+      frame.data = std::move(this->dataPtr->spareBuffers.back());
+      this->dataPtr->spareBuffers.pop_back();
+    }
+    frame.data.assign(imageData, imageData + memSize);
+    frame.width = _image.Width();
+    frame.height = _image.Height();
+    frame.stamp = _stamp;
+    this->dataPtr->frameQueue.push_back(std::move(frame));
+  }
+  this->dataPtr->frameCv.notify_one();
+}
+
+//////////////////////////////////////////////////
+bool VideoCapture::Stop()
+{
+  // let the encoder thread drain the pending frames and exit before
+  // finalizing the file
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->frameMutex);
+    this->dataPtr->encoderRunning = false;
+  }
+  this->dataPtr->frameCv.notify_one();
+  this->dataPtr->spaceCv.notify_all();
+  if (this->dataPtr->encoderThread.joinable())
+    this->dataPtr->encoderThread.join();
+
+  if (this->dataPtr->droppedFrames > 0)
+  {
+    gzwarn << "Video recording to [" << this->dataPtr->filename
+            << "] dropped " << this->dataPtr->droppedFrames
+            << " frames because the encoder could not keep up."
+            << std::endl;
+  }
+
+  return this->dataPtr->videoEncoder.Stop();
+}
+
+//////////////////////////////////////////////////
+uint64_t VideoCapture::DroppedFrames() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->frameMutex);
+  return this->dataPtr->droppedFrames;
+}
@@ -72,6 +72,12 @@ class AcousticComms::Implementation
   /// computer-science/underwater-acoustic-signal
   public: double sourcePower = 2000;
 
+  /// \brief Source level term of the sonar equation, derived from the
+  /// source power. Computed once when the plugin is loaded so it isn't
+  /// re-derived for every packet. The constant 170.8 comes from reference
+  /// intensity measured 1m from the source.
+  public: double sourceLevel = 0.0;
+
   /// \brief Ratio of the noise intensity at the
   /// receiver to the same reference intensity used for source level.
   public: double noiseLevel = 1;
@@ -103,13 +109,10 @@ bool AcousticComms::Implementation::propagationModel(
   // TL : Transmission loss (dB)
   // NL : Noise level.
 
-  // The constant 170.8 comes from reference intensity measured
-  // 1m from the source.
-  double sl = 170.8 + 10 * std::log10(this->sourcePower);
   double tl = 20 * std::log10(_distToSource);
 
   // Calculate SNR.
-  auto snr = sl - tl - this->noiseLevel;
+  auto snr = this->sourceLevel - tl - this->noiseLevel;
 
   // References : https://www.montana.edu/aolson/ee447/EB%20and%20NO.pdf
   // https://en.wikipedia.org/wiki/Eb/N0
@@ -166,6 +169,8 @@ void AcousticComms::Load(
     sdf::ElementPtr propElement = _sdf->Clone()->
                                    GetElement("propagation_model");
     this->dataPtr->sourcePower = propElement->Get<double>("source_power");
+    this->dataPtr->sourceLevel =
+      170.8 + 10 * std::log10(this->dataPtr->sourcePower);
     this->dataPtr->noiseLevel = propElement->Get<double>("noise_level");
     this->dataPtr->spectralEfficiency =
       propElement->Get<double>("spectral_efficiency");
@@ -201,6 +206,24 @@ void AcousticComms::Step(
     }
   }
 
+  const std::chrono::steady_clock::time_point currTime(_info.simTime);
+  const auto currTimestamp =
+    std::chrono::nanoseconds(currTime.time_since_epoch());
+
+  // World positions resolved during this step, shared across messages so
+  // that a vehicle exchanging many packets walks the entity tree only once.
+  std::unordered_map<Entity, math::Vector3d> posCache;
+  auto worldPos = [&posCache, &_ecm](const Entity _entity)
+    -> const math::Vector3d &
+  {
+    auto it = posCache.find(_entity);
+    if (it == posCache.end())
+    {
+      it = posCache.emplace(_entity, worldPose(_entity, _ecm).Pos()).first;
+    }
+    return it->second;
+  };
+
   for (auto & [address, content] : _currentRegistry)
   {
     // Reference to the outbound queue for this address.
@@ -240,28 +263,11 @@ void AcousticComms::Step(
         // If it has reached neither the destination nor the maxRange,
         // it is considered in transit.
 
-        if (this->dataPtr->poseSrcAtMsgTimestamp.count(msg) == 0)
-        {
-          // This message is being processed for the first time.
-          // Record the current position of the sender and use it
-          // for distance calculations.
-          this->dataPtr->poseSrcAtMsgTimestamp[msg] =
-            worldPose(itSrc->second.entity, _ecm).Pos();
-        }
-
-        const auto& poseSrc =
-          this->dataPtr->poseSrcAtMsgTimestamp[msg];
-
-        // Calculate distance between the bodies.
-        const auto poseDst = worldPose(itDst->second.entity, _ecm).Pos();
-        const auto distanceToTransmitter = (poseSrc - poseDst).Length();
-
-        // Calculate distance covered by the message.
-        const std::chrono::steady_clock::time_point currTime(_info.simTime);
+        // Calculate distance covered by the message. This needs no pose
+        // lookups, so messages that exceeded the maxRange are discarded
+        // before any entity tree walks.
         const auto timeOfTransmission = msg->mutable_header()->stamp();
 
-        const auto currTimestamp =
-          std::chrono::nanoseconds(currTime.time_since_epoch());
         const auto packetTimestamp =
           std::chrono::seconds(timeOfTransmission.sec()) +
           std::chrono::nanoseconds(timeOfTransmission.nsec());
@@ -271,90 +277,101 @@ void AcousticComms::Step(
         const double distanceCoveredByMessage = deltaT.count() *
           this->dataPtr->speedOfSound;
 
-        // Check the msgs that haven't exceeded the maxRange.
-        if (distanceCoveredByMessage <= this->dataPtr->maxRange)
+        if (distanceCoveredByMessage > this->dataPtr->maxRange)
+        {
+          // This message exceeded the maxRange.
+          // Stop keeping track of the position of its source.
+          this->dataPtr->poseSrcAtMsgTimestamp.erase(msg);
+          continue;
+        }
+
+        auto poseSrcIt = this->dataPtr->poseSrcAtMsgTimestamp.find(msg);
+        if (poseSrcIt == this->dataPtr->poseSrcAtMsgTimestamp.end())
+        {
+          // This message is being processed for the first time.
+          // Record the current position of the sender and use it
+          // for distance calculations.
+          poseSrcIt = this->dataPtr->poseSrcAtMsgTimestamp.emplace(
+              msg, worldPos(itSrc->second.entity)).first;
+        }
+        const auto &poseSrc = poseSrcIt->second;
+
+        // Calculate distance between the bodies.
+        const auto &poseDst = worldPos(itDst->second.entity);
+        const auto distanceToTransmitter = (poseSrc - poseDst).Length();
+
+        if (distanceCoveredByMessage >= distanceToTransmitter)
         {
-          if (distanceCoveredByMessage >= distanceToTransmitter)
+          // This message has effectively reached the destination.
+          bool receivedSuccessfully = false;
+
+          // Check for time collision
+          auto lastMsgIt =
+            this->dataPtr->lastMsgReceivedInfo.find(msg->dst_address());
+          if (lastMsgIt == this->dataPtr->lastMsgReceivedInfo.end())
+          {
+            // This is the first message received by this address.
+            receivedSuccessfully = true;
+          }
+          else
           {
-            // This message has effectively reached the destination.
-            bool receivedSuccessfully = false;
-
-            // Check for time collision
-            if (this->dataPtr->lastMsgReceivedInfo.count(
-                  msg->dst_address()) == 0)
-            {
-              // This is the first message received by this address.
+            // A previous msg was already received at this address.
+            // time gap = current time - time at which last msg was received.
+            std::chrono::duration<double> timeGap = currTimestamp -
+              std::get<0>(lastMsgIt->second);
+
+            // drop interval = collision time interval per byte *
+            //                 length of last msg received.
+            auto dropInterval = std::get<1>(lastMsgIt->second);
+
+            if (timeGap >= dropInterval)
               receivedSuccessfully = true;
-            }
-            else
-            {
-              // A previous msg was already received at this address.
-              // time gap = current time - time at which last msg was received.
-              std::chrono::duration<double> timeGap = currTimestamp -
-                std::get<0>(this->dataPtr->lastMsgReceivedInfo[
-                            msg->dst_address()]);
-
-              // drop interval = collision time interval per byte *
-              //                 length of last msg received.
-              auto dropInterval = std::chrono::duration<double>(
-                  std::get<1>(this->dataPtr->lastMsgReceivedInfo[
-                              msg->dst_address()]));
-
-              if (timeGap >= dropInterval)
-                receivedSuccessfully = true;
-            }
-
-            // Packet has survived collisions, check if the propagation model
-            // should be run on this packet.
-            if (this->dataPtr->usePropagationModel)
-            {
-              receivedSuccessfully = receivedSuccessfully &&
-                this->dataPtr->propagationModel(distanceCoveredByMessage,
-                                                msg->data().length());
-            }
-
-            // This message needs to be processed.
-            // Push the msg to inbound of the destination if
-            // receivedSuccessfully is true, else it is dropped.
-            if (receivedSuccessfully)
-            {
-              _newRegistry[msg->dst_address()].inboundMsgs.push_back(msg);
-              // Update the (receive time, length of msg) tuple
-              // for the last msg for this address.
-              auto blockingTime = std::chrono::duration<double>(
-                this->dataPtr->collisionTimePerByte *
-                msg->data().length());
-
-              this->dataPtr->lastMsgReceivedInfo[msg->dst_address()] =
-                std::make_tuple(currTimestamp, blockingTime);
-            }
-            else
-            {
-              // Packet was dropped due to collision.
-              auto blockingTime = std::chrono::duration<double>(
-                  this->dataPtr->collisionTimePacketDrop
-                );
-
-              std::get<1>(this->dataPtr->lastMsgReceivedInfo[
-                          msg->dst_address()]) += blockingTime;
-            }
-
-            // Stop keeping track of the position of its source.
-            this->dataPtr->poseSrcAtMsgTimestamp.erase(msg);
+          }
+
+          // Packet has survived collisions, check if the propagation model
+          // should be run on this packet.
+          if (this->dataPtr->usePropagationModel)
+          {
+            receivedSuccessfully = receivedSuccessfully &&
+              this->dataPtr->propagationModel(distanceCoveredByMessage,
+                                              msg->data().length());
+          }
+
+          // This message needs to be processed.
+          // Push the msg to inbound of the destination if
+          // receivedSuccessfully is true, else it is dropped.
+          if (receivedSuccessfully)
+          {
+            _newRegistry[msg->dst_address()].inboundMsgs.push_back(msg);
+            // Update the (receive time, length of msg) tuple
+            // for the last msg for this address.
+            auto blockingTime = std::chrono::duration<double>(
+              this->dataPtr->collisionTimePerByte *
+              msg->data().length());
+
+            this->dataPtr->lastMsgReceivedInfo[msg->dst_address()] =
+              std::make_tuple(currTimestamp, blockingTime);
           }
           else
           {
-            // This message is still in transit, should be kept in the
-            // outbound buffer of source and not moved to inbound of
-            // the destination.
-            newOutbound.push_back(msg);
+            // Packet was dropped due to collision.
+            auto blockingTime = std::chrono::duration<double>(
+                this->dataPtr->collisionTimePacketDrop
+              );
+
+            std::get<1>(this->dataPtr->lastMsgReceivedInfo[
+                        msg->dst_address()]) += blockingTime;
           }
+
+          // Stop keeping track of the position of its source.
+          this->dataPtr->poseSrcAtMsgTimestamp.erase(poseSrcIt);
         }
         else
         {
-          // This message exceeded the maxRange.
-          // Stop keeping track of the position of its source.
-          this->dataPtr->poseSrcAtMsgTimestamp.erase(msg);
+          // This message is still in transit, should be kept in the
+          // outbound buffer of source and not moved to inbound of
+          // the destination.
+          newOutbound.push_back(msg);
         }
       }
     }
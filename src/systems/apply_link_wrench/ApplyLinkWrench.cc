@@ -19,6 +19,7 @@
 #include <mutex>
 #include <string>
 #include <queue>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -41,6 +42,24 @@ using namespace gz;
 using namespace sim;
 using namespace systems;
 
+/// \brief A persistent wrench with its target resolved ahead of time, so
+/// applying it every step doesn't repeat the by-name entity lookup.
+struct PersistentWrench
+{
+  /// \brief Original message, kept for re-resolving the target entity.
+  msgs::EntityWrench msg;
+
+  /// \brief Force decomposed from the message.
+  math::Vector3d force;
+
+  /// \brief Torque decomposed from the message.
+  math::Vector3d torque;
+
+  /// \brief Resolved target link. Invalid until the target entity exists;
+  /// re-resolved whenever the ECM's structure changes.
+  Link link{kNullEntity};
+};
+
 class gz::sim::systems::ApplyLinkWrenchPrivate
 {
   /// \brief Callback for wrench subscription
@@ -62,16 +81,28 @@ class gz::sim::systems::ApplyLinkWrenchPrivate
   /// \brief Queue of incoming instantaneous wrenches
   public: std::queue<msgs::EntityWrench> newWrenches;
 
-  /// \brief All persistent wrenches
-  public: std::vector<msgs::EntityWrench> persistentWrenches;
+  /// \brief Newly received persistent wrenches, waiting to be adopted by
+  /// the update loop
+  public: std::vector<msgs::EntityWrench> newPersistentWrenches;
+
+  /// \brief All persistent wrenches. Owned by the update loop; additions
+  /// arrive through newPersistentWrenches
+  public: std::vector<PersistentWrench> persistentWrenches;
 
   /// \brief Entities whose wrenches should be cleared
   public: std::queue<msgs::Entity> clearWrenches;
 
+  /// \brief ECM the persistent wrench targets were resolved against
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Value of EntityComponentManager::StructuralEpoch when the
+  /// persistent wrench targets were resolved
+  public: uint64_t cacheEpoch{0};
+
   /// \brief Communication node.
   public: transport::Node node;
 
-  /// \brief A mutex to protect wrenches
+  /// \brief A mutex to protect incoming wrenches
   public: std::mutex mutex;
 };
 
@@ -233,18 +264,36 @@ void ApplyLinkWrench::PreUpdate(const UpdateInfo &_info,
 {
   GZ_PROFILE("ApplyLinkWrench::PreUpdate");
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  // Move pending messages out under a briefly held lock; the ECM work below
+  // then runs without blocking subscribers
+  std::vector<msgs::EntityWrench> newPersistent;
+  std::queue<msgs::Entity> clearWrenches;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    std::swap(newPersistent, this->dataPtr->newPersistentWrenches);
+    std::swap(clearWrenches, this->dataPtr->clearWrenches);
+  }
+
+  // Adopt new persistent wrenches, decomposing each message once instead of
+  // on every step
+  for (auto &msg : newPersistent)
+  {
+    PersistentWrench wrench;
+    wrench.link = decomposeMessage(_ecm, msg, wrench.force, wrench.torque);
+    wrench.msg = std::move(msg);
+    this->dataPtr->persistentWrenches.push_back(std::move(wrench));
+  }
 
   // Clear persistent wrenches
-  while (!this->dataPtr->clearWrenches.empty())
+  while (!clearWrenches.empty())
   {
-    auto clearMsg = this->dataPtr->clearWrenches.front();
+    auto clearMsg = clearWrenches.front();
     auto clearEntity = entityFromMsg(_ecm, clearMsg);
 
     for (auto msgIt = this->dataPtr->persistentWrenches.begin();
          msgIt != this->dataPtr->persistentWrenches.end(); msgIt++)
     {
-      auto persistentEntity = entityFromMsg(_ecm, msgIt->entity());
+      auto persistentEntity = entityFromMsg(_ecm, msgIt->msg.entity());
       if (persistentEntity == clearEntity)
       {
         this->dataPtr->persistentWrenches.erase(msgIt--);
@@ -257,7 +306,7 @@ void ApplyLinkWrench::PreUpdate(const UpdateInfo &_info,
       }
     }
 
-    this->dataPtr->clearWrenches.pop();
+    clearWrenches.pop();
   }
 
   // Only apply wrenches when not paused
@@ -265,9 +314,14 @@ void ApplyLinkWrench::PreUpdate(const UpdateInfo &_info,
     return;
 
   // Apply instantaneous wrenches
-  while (!this->dataPtr->newWrenches.empty())
+  std::queue<msgs::EntityWrench> newWrenches;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    std::swap(newWrenches, this->dataPtr->newWrenches);
+  }
+  while (!newWrenches.empty())
   {
-    auto msg = this->dataPtr->newWrenches.front();
+    const auto &msg = newWrenches.front();
 
     math::Vector3d force;
     math::Vector3d torque;
@@ -276,7 +330,7 @@ void ApplyLinkWrench::PreUpdate(const UpdateInfo &_info,
     {
       gzerr << "Entity not found." << std::endl
             << msg.DebugString() << std::endl;
-      this->dataPtr->newWrenches.pop();
+      newWrenches.pop();
       continue;
     }
 
@@ -288,23 +342,32 @@ void ApplyLinkWrench::PreUpdate(const UpdateInfo &_info,
             << link.Entity() << "] for 1 time step." << std::endl;
     }
 
-    this->dataPtr->newWrenches.pop();
+    newWrenches.pop();
   }
 
-  // Apply persistent wrenches at every time step
-  for (auto msg : this->dataPtr->persistentWrenches)
+  // Apply persistent wrenches at every time step. Targets are re-resolved
+  // only when the ECM's structure changed; entity insertion bumps the
+  // structural epoch, so wrenches sent preemptively still attach once their
+  // target appears
+  const bool resolveTargets = this->dataPtr->cacheEcm != &_ecm ||
+      this->dataPtr->cacheEpoch != _ecm.StructuralEpoch();
+  for (auto &wrench : this->dataPtr->persistentWrenches)
   {
-    math::Vector3d force;
-    math::Vector3d torque;
-    auto link = decomposeMessage(_ecm, msg, force, torque);
-    if (!link.Valid(_ecm))
+    if (resolveTargets)
+    {
+      wrench.link = decomposeMessage(_ecm, wrench.msg, wrench.force,
+          wrench.torque);
+    }
+    if (wrench.link.Entity() == kNullEntity)
     {
       // Not an error, persistent wrenches can be applied preemptively before
       // an entity is inserted
       continue;
     }
-    link.AddWorldWrench(_ecm, force, torque);
+    wrench.link.AddWorldWrench(_ecm, wrench.force, wrench.torque);
   }
+  this->dataPtr->cacheEcm = &_ecm;
+  this->dataPtr->cacheEpoch = _ecm.StructuralEpoch();
 }
 
 //////////////////////////////////////////////////
@@ -340,7 +403,7 @@ void ApplyLinkWrenchPrivate::OnWrenchPersistent(const msgs::EntityWrench &_msg)
           << _msg.DebugString() << std::endl;
   }
 
-  this->persistentWrenches.push_back(_msg);
+  this->newPersistentWrenches.push_back(_msg);
 }
 
 //////////////////////////////////////////////////
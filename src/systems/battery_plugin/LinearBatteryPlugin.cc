@@ -157,6 +157,25 @@ class gz::sim::systems::LinearBatteryPluginPrivate
   /// \brief Simulation time handled during a single update.
   public: std::chrono::steady_clock::duration stepSize;
 
+  /// \brief Battery update period calculated from <update_frequency>.
+  /// Zero (the default) updates the battery every simulation step.
+  public: std::chrono::steady_clock::duration updatePeriod{0};
+
+  /// \brief Last sim time the battery model was integrated.
+  public: std::chrono::steady_clock::duration lastUpdateTime{0};
+
+  /// \brief Simulation time accumulated since the last battery update.
+  public: std::chrono::steady_clock::duration accumulatedDt{0};
+
+  /// \brief Integral of the total power draw (W·s) over the steps since
+  /// the last battery update. Dividing by the accumulated time gives the
+  /// average draw, so the charge drawn over the whole window is
+  /// integrated exactly even when steps are skipped.
+  public: double drawPowerDtIntegral{0.0};
+
+  /// \brief Whether the battery state changed since the last publish.
+  public: bool statePublishPending{true};
+
   /// \brief Flag on whether the battery should start draining
   public: bool startDraining = false;
 
@@ -365,6 +384,14 @@ void LinearBatteryPlugin::Configure(const Entity &_entity,
   if (_sdf->HasElement("start_draining"))
     this->dataPtr->startDraining = _sdf->Get<bool>("start_draining");
 
+  double updateFreq = _sdf->Get<double>("update_frequency", 0.0).first;
+  if (updateFreq > 0)
+  {
+    std::chrono::duration<double> period{1 / updateFreq};
+    this->dataPtr->updatePeriod =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+  }
+
   // Subscribe to power draining topics, if any.
   if (_sdf->HasElement("power_draining_topic"))
   {
@@ -435,6 +462,9 @@ void LinearBatteryPluginPrivate::Reset()
   this->ismooth = 0.0;
   this->q = this->q0;
   this->startDraining = false;
+  this->accumulatedDt = std::chrono::steady_clock::duration::zero();
+  this->drawPowerDtIntegral = 0.0;
+  this->statePublishPending = true;
 }
 
 /////////////////////////////////////////////////
@@ -449,6 +479,7 @@ void LinearBatteryPluginPrivate::OnEnableRecharge(
 {
   gzdbg << "Request for start charging received" << std::endl;
   this->startCharging = true;
+  this->statePublishPending = true;
 }
 
 //////////////////////////////////////////////////
@@ -457,6 +488,7 @@ void LinearBatteryPluginPrivate::OnDisableRecharge(
 {
   gzdbg << "Request for stop charging received" << std::endl;
   this->startCharging = false;
+  this->statePublishPending = true;
 }
 
 //////////////////////////////////////////////////
@@ -464,6 +496,7 @@ void LinearBatteryPluginPrivate::OnBatteryDrainingMsg(
   const char *, const size_t, const gz::transport::MessageInfo &)
 {
   this->startDraining = true;
+  this->statePublishPending = true;
 }
 
 //////////////////////////////////////////////////
@@ -471,6 +504,7 @@ void LinearBatteryPluginPrivate::OnBatteryStopDrainingMsg(
   const char *, const size_t, const gz::transport::MessageInfo &)
 {
   this->startDraining = false;
+  this->statePublishPending = true;
 }
 
 //////////////////////////////////////////////////
@@ -575,8 +609,32 @@ void LinearBatteryPlugin::Update(const UpdateInfo &_info,
       " minutes passed.\n";
   }
 
+  // Accumulate the power drawn this step so a slower battery update can
+  // still integrate the exact energy drawn over the skipped steps.
+  if (this->dataPtr->startDraining && this->dataPtr->battery)
+  {
+    double stepDt = (std::chrono::duration_cast<std::chrono::nanoseconds>(
+      _info.dt).count()) * 1e-9;
+    double stepPower = 0.0;
+    for (const auto &powerLoad : this->dataPtr->battery->PowerLoads())
+      stepPower += powerLoad.second;
+    this->dataPtr->drawPowerDtIntegral += stepPower * stepDt;
+  }
+  this->dataPtr->accumulatedDt += _info.dt;
+
+  // Integrate the battery model at the configured rate. Battery dynamics
+  // evolve over minutes, so per-step integration is needless work.
+  auto sinceLastUpdate = _info.simTime - this->dataPtr->lastUpdateTime;
+  if (sinceLastUpdate > std::chrono::steady_clock::duration::zero() &&
+      sinceLastUpdate < this->dataPtr->updatePeriod)
+  {
+    return;
+  }
+  this->dataPtr->lastUpdateTime = _info.simTime;
+
   // Update actual battery
-  this->dataPtr->stepSize = _info.dt;
+  this->dataPtr->stepSize = this->dataPtr->accumulatedDt;
+  this->dataPtr->accumulatedDt = std::chrono::steady_clock::duration::zero();
 
   // Sanity check: tau should be between [dt, +inf).
   double dt = (std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -592,6 +650,8 @@ void LinearBatteryPlugin::Update(const UpdateInfo &_info,
   if (this->dataPtr->battery)
   {
     this->dataPtr->battery->Update();
+    this->dataPtr->drawPowerDtIntegral = 0.0;
+    this->dataPtr->statePublishPending = true;
 
     // Update component
     auto *batteryComp =
@@ -610,6 +670,12 @@ void LinearBatteryPlugin::PostUpdate(const UpdateInfo &_info,
   if (_info.paused || !this->dataPtr->statePub)
     return;
 
+  // Only publish when the battery state changed since the last publish;
+  // subscribers don't need identical messages every step.
+  if (!this->dataPtr->statePublishPending)
+    return;
+  this->dataPtr->statePublishPending = false;
+
   // Publish battery state
   msgs::BatteryState msg;
   msg.mutable_header()->mutable_stamp()->CopyFrom(
@@ -654,10 +720,11 @@ double LinearBatteryPlugin::OnUpdateVoltage(
   double totalpower = 0.0;
   double k = dt / this->dataPtr->tau;
 
-  if (this->dataPtr->startDraining)
+  if (dt > 0.0)
   {
-    for (auto powerLoad : _battery->PowerLoads())
-      totalpower += powerLoad.second;
+    // Average draw over the accumulated window, which equals the
+    // instantaneous draw when the battery updates every step.
+    totalpower = this->dataPtr->drawPowerDtIntegral / dt;
   }
 
   this->dataPtr->iraw = totalpower / _battery->Voltage();
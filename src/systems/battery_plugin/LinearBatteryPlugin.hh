@@ -68,6 +68,13 @@ namespace systems
   /// - `<stop_power_draining_topic>` A topic that is used to stop battery
   /// discharge. Any message on the specified topic will cause the battery to
   /// stop draining.
+  /// - `<update_frequency>` Frequency (Hz) at which the battery model is
+  /// integrated. Battery dynamics evolve over minutes, so the model can be
+  /// updated much slower than the physics step; the power drawn during the
+  /// skipped steps is accumulated and integrated exactly when the update
+  /// runs. The period (1 / frequency) should not exceed
+  /// `<smooth_current_tau>`. By default the battery is updated every
+  /// simulation step.
 
   class LinearBatteryPlugin
       : public System,
@@ -41,6 +41,7 @@
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/Performer.hh"
 #include "gz/sim/components/Pose.hh"
+#include "gz/sim/components/PoseCmd.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/Util.hh"
 
@@ -74,6 +75,10 @@ void Breadcrumbs::Configure(const Entity &_entity,
   this->allowRenaming =
       _sdf->Get<bool>("allow_renaming", this->allowRenaming).first;
 
+  this->poolSize = _sdf->Get<int>("pool_size", this->poolSize).first;
+  if (this->maxDeployments >= 0)
+    this->poolSize = std::min(this->poolSize, this->maxDeployments);
+
   this->model = Model(_entity);
   if (!this->model.Valid(_ecm))
   {
@@ -196,6 +201,9 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
       return;
     }
 
+    if (this->poolSize > 0 && !this->poolCreated)
+      this->CreatePool(_ecm);
+
     auto poseComp = _ecm.Component<components::Pose>(this->model.Entity());
 
     for (std::size_t i = 0; i < cmds.size(); ++i)
@@ -203,77 +211,90 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
       if (this->maxDeployments < 0 ||
           this->numDeployments < this->maxDeployments)
       {
-        sdf::Model modelToSpawn = *this->modelRoot.Model();
-        std::string desiredName =
-            modelToSpawn.Name() + "_" + std::to_string(this->numDeployments);
-
-        std::vector<std::string> modelNames;
-        _ecm.Each<components::Name, components::Model>(
-            [&modelNames](const Entity &, const components::Name *_name,
-                          const components::Model *)
-            {
-              modelNames.push_back(_name->Data());
-              return true;
-            });
-
-        // Check if there's a model with the same name.
-        auto it = std::find(modelNames.begin(), modelNames.end(), desiredName);
-        if (it != modelNames.end())
+        // Deploy a parked instance when one is available: a pose command
+        // plus anchor release instead of entity creation.
+        if (!this->pool.empty())
         {
-          if (!this->allowRenaming)
+          PooledInstance parked = this->pool.front();
+          this->pool.erase(this->pool.begin());
+          this->DeployPooledInstance(parked, poseComp->Data(), _info, _ecm);
+          ++this->numDeployments;
+        }
+        else
+        {
+          sdf::Model modelToSpawn = *this->modelRoot.Model();
+          std::string desiredName =
+              modelToSpawn.Name() + "_" + std::to_string(this->numDeployments);
+
+          std::vector<std::string> modelNames;
+          _ecm.Each<components::Name, components::Model>(
+              [&modelNames](const Entity &, const components::Name *_name,
+                            const components::Model *)
+              {
+                modelNames.push_back(_name->Data());
+                return true;
+              });
+
+          // Check if there's a model with the same name.
+          auto it = std::find(modelNames.begin(), modelNames.end(),
+              desiredName);
+          if (it != modelNames.end())
           {
-            gzwarn << "Entity named [" << desiredName
-                    << "] already exists and "
-                    << "[allow_renaming] is false. Entity not spawned."
-                    << std::endl;
-            return;
+            if (!this->allowRenaming)
+            {
+              gzwarn << "Entity named [" << desiredName
+                      << "] already exists and "
+                      << "[allow_renaming] is false. Entity not spawned."
+                      << std::endl;
+              return;
+            }
+
+            std::string newName = desiredName;
+            int counter = 0;
+            while (std::find(modelNames.begin(), modelNames.end(), newName) !=
+                   modelNames.end())
+            {
+              newName = desiredName + "_" + std::to_string(++counter);
+            }
+            desiredName = newName;
           }
 
-          std::string newName = desiredName;
-          int counter = 0;
-          while (std::find(modelNames.begin(), modelNames.end(), newName) !=
-                 modelNames.end())
+          modelToSpawn.SetName(desiredName);
+          modelToSpawn.SetRawPose(poseComp->Data() * modelToSpawn.RawPose());
+          gzmsg << "Deploying " << modelToSpawn.Name() << " at "
+                 << modelToSpawn.RawPose() << std::endl;
+          Entity entity = this->creator->CreateEntities(&modelToSpawn);
+          this->creator->SetParent(entity, this->worldEntity);
+
+          // keep track of entities that are set to auto disable
+          if (!modelToSpawn.Static() &&
+              this->disablePhysicsTime >
+              std::chrono::steady_clock::duration::zero())
           {
-            newName = desiredName + "_" + std::to_string(++counter);
+            this->autoStaticEntities[entity] = _info.simTime;
           }
-          desiredName = newName;
-        }
 
-        modelToSpawn.SetName(desiredName);
-        modelToSpawn.SetRawPose(poseComp->Data() * modelToSpawn.RawPose());
-        gzmsg << "Deploying " << modelToSpawn.Name() << " at "
-               << modelToSpawn.RawPose() << std::endl;
-        Entity entity = this->creator->CreateEntities(&modelToSpawn);
-        this->creator->SetParent(entity, this->worldEntity);
-
-        // keep track of entities that are set to auto disable
-        if (!modelToSpawn.Static() &&
-            this->disablePhysicsTime >
-            std::chrono::steady_clock::duration::zero())
-        {
-          this->autoStaticEntities[entity] = _info.simTime;
-        }
-
-        if (this->isPerformer)
-        {
-          auto worldName =
-              _ecm.Component<components::Name>(this->worldEntity)->Data();
-          msgs::StringMsg req;
-          req.set_data(modelToSpawn.Name());
-          this->node.Request<msgs::StringMsg, msgs::Boolean>(
-              "/world/" + worldName + "/level/set_performer", req,
-              [](const msgs::Boolean &, const bool)
-              {
-              });
+          if (this->isPerformer)
+          {
+            auto worldName =
+                _ecm.Component<components::Name>(this->worldEntity)->Data();
+            msgs::StringMsg req;
+            req.set_data(modelToSpawn.Name());
+            this->node.Request<msgs::StringMsg, msgs::Boolean>(
+                "/world/" + worldName + "/level/set_performer", req,
+                [](const msgs::Boolean &, const bool)
+                {
+                });
+
+            // When using the set_performer service, the performer gets a
+            // default geometry for its bounding volume. To update the
+            // geometry, we make a list of performer breadcrumbs and process
+            // them as we detect that they have become performers
+            this->pendingGeometryUpdate.insert(entity);
+          }
 
-          // When using the set_performer service, the performer gets a default
-          // geometry for its bounding volume. To update the geometry, we make a
-          // list of performer breadcrumbs and process them as we detect that
-          // they have become performers
-          this->pendingGeometryUpdate.insert(entity);
+          ++this->numDeployments;
         }
-
-        ++this->numDeployments;
       }
       else
       {
@@ -328,7 +349,9 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
       if (td > this->disablePhysicsTime)
       {
         auto name = _ecm.Component<components::Name>(it->first)->Data();
-        if (!this->MakeStatic(it->first, _ecm))
+        Entity holderModel{kNullEntity};
+        Entity holderJoint{kNullEntity};
+        if (!this->MakeStatic(it->first, _ecm, holderModel, holderJoint))
         {
           gzerr << "Failed to make breadcrumb '" << name
                  << "' static." << std::endl;
@@ -348,8 +371,12 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
 }
 
 //////////////////////////////////////////////////
-bool Breadcrumbs::MakeStatic(Entity _entity, EntityComponentManager &_ecm)
+bool Breadcrumbs::MakeStatic(Entity _entity, EntityComponentManager &_ecm,
+    Entity &_holderModel, Entity &_holderJoint)
 {
+  _holderModel = kNullEntity;
+  _holderJoint = kNullEntity;
+
   // make breadcrumb static by spawning a static model and attaching the
   // breadcrumb to the static model
   // todo(anyone) Add a feature in gz-physics to support making a model
@@ -395,9 +422,108 @@ bool Breadcrumbs::MakeStatic(Entity _entity, EntityComponentManager &_ecm)
       components::DetachableJoint(
       {parentLinkEntity, childLinkEntity, "fixed"}));
 
+  _holderModel = staticEntity;
+  _holderJoint = detachableJointEntity;
+
   return true;
 }
 
+//////////////////////////////////////////////////
+void Breadcrumbs::CreatePool(EntityComponentManager &_ecm)
+{
+  this->poolCreated = true;
+
+  // Park the instances in a row far below the world, spaced out so they
+  // don't collide with each other.
+  const math::Pose3d parkOrigin(0, 0, -1000, 0, 0, 0);
+  const double parkSpacing{10.0};
+
+  for (int i = 0; i < this->poolSize; ++i)
+  {
+    sdf::Model modelToSpawn = *this->modelRoot.Model();
+    modelToSpawn.SetName(
+        modelToSpawn.Name() + "_" + std::to_string(this->numDeployments + i));
+    modelToSpawn.SetRawPose(parkOrigin *
+        math::Pose3d(i * parkSpacing, 0, 0, 0, 0, 0));
+
+    PooledInstance parked;
+    parked.entity = this->creator->CreateEntities(&modelToSpawn);
+    this->creator->SetParent(parked.entity, this->worldEntity);
+
+    // Anchor the instance so physics doesn't integrate it while parked.
+    // Static models don't need an anchor.
+    if (!modelToSpawn.Static() &&
+        !this->MakeStatic(parked.entity, _ecm, parked.holderModel,
+        parked.holderJoint))
+    {
+      gzwarn << "Unable to park breadcrumb '" << modelToSpawn.Name()
+              << "'; it will stay dynamic until deployed." << std::endl;
+    }
+
+    this->pool.push_back(parked);
+  }
+
+  gzmsg << "Pre-instantiated " << this->pool.size() << " breadcrumb "
+         << "instance(s) of " << this->modelRoot.Model()->Name()
+         << std::endl;
+}
+
+//////////////////////////////////////////////////
+void Breadcrumbs::DeployPooledInstance(const PooledInstance &_instance,
+    const math::Pose3d &_basePose, const UpdateInfo &_info,
+    EntityComponentManager &_ecm)
+{
+  math::Pose3d pose = _basePose * this->modelRoot.Model()->RawPose();
+  auto name = _ecm.Component<components::Name>(_instance.entity)->Data();
+
+  // Command the new pose and release the parking anchor; both are
+  // processed by the physics system on this step.
+  auto poseCmdComp =
+      _ecm.Component<components::WorldPoseCmd>(_instance.entity);
+  if (!poseCmdComp)
+  {
+    _ecm.CreateComponent(_instance.entity, components::WorldPoseCmd(pose));
+  }
+  else
+  {
+    poseCmdComp->SetData(pose,
+        [](const math::Pose3d &, const math::Pose3d &) -> bool
+        {
+          return true;
+        });
+    _ecm.SetChanged(_instance.entity, components::WorldPoseCmd::typeId,
+        ComponentState::OneTimeChange);
+  }
+
+  if (_instance.holderJoint != kNullEntity)
+    _ecm.RequestRemoveEntity(_instance.holderJoint, false);
+  if (_instance.holderModel != kNullEntity)
+    _ecm.RequestRemoveEntity(_instance.holderModel);
+
+  gzmsg << "Deploying " << name << " from pool at " << pose << std::endl;
+
+  // keep track of entities that are set to auto disable
+  if (!this->modelRoot.Model()->Static() &&
+      this->disablePhysicsTime > std::chrono::steady_clock::duration::zero())
+  {
+    this->autoStaticEntities[_instance.entity] = _info.simTime;
+  }
+
+  if (this->isPerformer)
+  {
+    auto worldName =
+        _ecm.Component<components::Name>(this->worldEntity)->Data();
+    msgs::StringMsg req;
+    req.set_data(name);
+    this->node.Request<msgs::StringMsg, msgs::Boolean>(
+        "/world/" + worldName + "/level/set_performer", req,
+        [](const msgs::Boolean &, const bool)
+        {
+        });
+    this->pendingGeometryUpdate.insert(_instance.entity);
+  }
+}
+
 
 //////////////////////////////////////////////////
 void Breadcrumbs::OnDeploy(const msgs::Empty &)
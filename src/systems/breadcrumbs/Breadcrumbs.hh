@@ -85,6 +85,13 @@ namespace systems
   /// `<topic_statistics>`: If true, then topic statistics are enabled on
   /// `<topic>` and error messages will be generated when messages are
   /// dropped. Default to false.
+  /// - `<pool_size>`: Number of breadcrumb instances to pre-instantiate
+  /// when simulation starts. Pooled instances are parked below the world,
+  /// anchored to a static holder model, and deploying one reduces to a
+  /// pose command plus releasing the anchor instead of entity creation,
+  /// avoiding the spawn hitch. Once the pool is exhausted, deployments
+  /// fall back to spawning. Bounded by `<max_deployments>`. Defaults to
+  /// zero (no pooling).
   class Breadcrumbs
       : public System,
         public ISystemConfigure,
@@ -107,11 +114,46 @@ namespace systems
     /// \brief Callback to deployment topic
     private: void OnDeploy(const msgs::Empty &_msg);
 
-    /// \brief Make an entity static
+    /// \brief Make an entity static by anchoring it to a spawned static
+    /// holder model with a detachable joint.
     /// \param[in] _entity Entity to make static
     /// \param[in] _ecm Entity component manager
+    /// \param[out] _holderModel Static holder model the entity is anchored
+    /// to, kNullEntity on failure.
+    /// \param[out] _holderJoint Detachable joint holding the entity,
+    /// kNullEntity on failure.
     /// \return True if operation is successful, false otherwise
-    public: bool MakeStatic(Entity _entity, EntityComponentManager &_ecm);
+    public: bool MakeStatic(Entity _entity, EntityComponentManager &_ecm,
+                Entity &_holderModel, Entity &_holderJoint);
+
+    /// \brief A parked breadcrumb instance ready for deployment.
+    private: struct PooledInstance
+    {
+      /// \brief The breadcrumb model entity.
+      Entity entity{kNullEntity};
+
+      /// \brief Static holder model the instance is anchored to while
+      /// parked.
+      Entity holderModel{kNullEntity};
+
+      /// \brief Detachable joint anchoring the instance while parked.
+      Entity holderJoint{kNullEntity};
+    };
+
+    /// \brief Pre-instantiate the configured number of pooled instances,
+    /// parked below the world.
+    /// \param[in] _ecm Entity component manager
+    private: void CreatePool(EntityComponentManager &_ecm);
+
+    /// \brief Deploy a parked instance: command its pose and release its
+    /// static anchor.
+    /// \param[in] _instance Parked instance to deploy.
+    /// \param[in] _basePose Pose of the model this system is attached to.
+    /// \param[in] _info Current update info.
+    /// \param[in] _ecm Entity component manager
+    private: void DeployPooledInstance(const PooledInstance &_instance,
+                const math::Pose3d &_basePose, const UpdateInfo &_info,
+                EntityComponentManager &_ecm);
 
     /// \brief Set to true after initialization with valid parameters
     private: bool initialized{false};
@@ -167,6 +209,16 @@ namespace systems
     /// \brief SDF DOM of a static model with empty link
     private: sdf::Model staticModelToSpawn;
 
+    /// \brief Number of instances to pre-instantiate, from <pool_size>.
+    private: int poolSize{0};
+
+    /// \brief True once the pool has been created.
+    private: bool poolCreated{false};
+
+    /// \brief Parked instances that have not been deployed yet, in
+    /// deployment order.
+    private: std::vector<PooledInstance> pool;
+
     /// \brief Publishes remaining deployments.
     public: transport::Node::Publisher remainingPub;
 
@@ -30,8 +30,10 @@
 
 #include <gz/plugin/Register.hh>
 
+#include <gz/math/Box.hh>
 #include <gz/math/Helpers.hh>
 #include <gz/math/Pose3.hh>
+#include <gz/math/Sphere.hh>
 #include <gz/math/Vector3.hh>
 
 #include <gz/msgs/Utility.hh>
@@ -160,6 +162,38 @@ class gz::sim::systems::BuoyancyPrivate
 
   /// \brief Volumes to be added on the next.
   public: std::unordered_map<Entity, double> volumes;
+
+  /// \brief Precomputed data for one collision shape used by the graded
+  /// buoyancy calculation.
+  public: struct GradedBuoyancyShape
+  {
+    /// \brief Pose of the collision relative to its link.
+    math::Pose3d poseInLink;
+
+    /// \brief Geometry type. Only BOX and SPHERE are supported.
+    sdf::GeometryType type;
+
+    /// \brief Box shape, valid when type is BOX.
+    math::Boxd box;
+
+    /// \brief Sphere shape, valid when type is SPHERE.
+    math::Sphered sphere;
+  };
+
+  /// \brief Supported collision shapes of each link, gathered once so the
+  /// per-step graded buoyancy loop doesn't re-derive the collision
+  /// children and geometry dispatch.
+  public: std::unordered_map<Entity, std::vector<GradedBuoyancyShape>>
+      gradedShapes;
+
+  /// \brief Gather the supported collision shapes of a link for the
+  /// graded buoyancy calculation and cache them.
+  /// \param[in] _entity Link entity.
+  /// \param[in] _ecm The Entity Component Manager.
+  /// \return Iterator to the cached entry for _entity.
+  public: std::unordered_map<Entity,
+      std::vector<GradedBuoyancyShape>>::iterator
+      CollectGradedShapes(Entity _entity, const EntityComponentManager &_ecm);
 };
 
 //////////////////////////////////////////////////
@@ -269,9 +303,73 @@ std::pair<math::Vector3d, math::Vector3d> BuoyancyPrivate::ResolveForces(
   return {force, torque};
 }
 
+//////////////////////////////////////////////////
+std::unordered_map<Entity,
+    std::vector<BuoyancyPrivate::GradedBuoyancyShape>>::iterator
+BuoyancyPrivate::CollectGradedShapes(Entity _entity,
+    const EntityComponentManager &_ecm)
+{
+  std::vector<GradedBuoyancyShape> shapes;
+
+  std::vector<Entity> collisions = _ecm.ChildrenByComponents(
+      _entity, components::Collision());
+
+  for (auto e : collisions)
+  {
+    const components::CollisionElement *coll =
+      _ecm.Component<components::CollisionElement>(e);
+
+    if (!coll)
+    {
+      gzerr << "Invalid collision pointer. This shouldn't happen\n";
+      continue;
+    }
+
+    GradedBuoyancyShape shape;
+    shape.type = coll->Data().Geom()->Type();
+
+    auto poseComp = _ecm.Component<components::Pose>(e);
+    if (poseComp)
+      shape.poseInLink = poseComp->Data();
+
+    switch (shape.type)
+    {
+      case sdf::GeometryType::BOX:
+        shape.box = coll->Data().Geom()->BoxShape()->Shape();
+        shapes.push_back(shape);
+        break;
+      case sdf::GeometryType::SPHERE:
+        shape.sphere = coll->Data().Geom()->SphereShape()->Shape();
+        shapes.push_back(shape);
+        break;
+      default:
+      {
+        static bool warned{false};
+        if (!warned)
+        {
+          gzwarn << "Only <box> and <sphere> collisions are supported "
+            << "by the graded buoyancy option." << std::endl;
+          warned = true;
+        }
+        break;
+      }
+    }
+  }
+
+  return this->gradedShapes.insert({_entity, std::move(shapes)}).first;
+}
+
 //////////////////////////////////////////////////
 void BuoyancyPrivate::CheckForNewEntities(const EntityComponentManager &_ecm)
 {
+  // Drop cached collision shapes of removed links.
+  _ecm.EachRemoved<components::Link>(
+      [&](const Entity &_entity, const components::Link *) -> bool
+  {
+    this->gradedShapes.erase(_entity);
+    return true;
+  });
+
   // Compute the volume and center of volume for each new link
   _ecm.EachNew<components::Link, components::Inertial>(
       [&](const Entity &_entity,
@@ -577,48 +675,28 @@ void Buoyancy::PreUpdate(const UpdateInfo &_info,
       else if (this->dataPtr->buoyancyType
         == BuoyancyPrivate::BuoyancyType::GRADED_BUOYANCY)
       {
-        std::vector<Entity> collisions = _ecm.ChildrenByComponents(
-          _entity, components::Collision());
+        auto shapesIt = this->dataPtr->gradedShapes.find(_entity);
+        if (shapesIt == this->dataPtr->gradedShapes.end())
+        {
+          shapesIt = this->dataPtr->CollectGradedShapes(_entity, _ecm);
+        }
         this->dataPtr->buoyancyForces.clear();
 
-        for (auto e : collisions)
+        for (const auto &shape : shapesIt->second)
         {
-          const components::CollisionElement *coll =
-            _ecm.Component<components::CollisionElement>(e);
-
-          auto pose = worldPose(e, _ecm);
+          // Compose the collision world pose from the link pose instead
+          // of walking the pose hierarchy again.
+          auto pose = linkWorldPose * shape.poseInLink;
 
-          if (!coll)
+          if (shape.type == sdf::GeometryType::BOX)
           {
-            gzerr << "Invalid collision pointer. This shouldn't happen\n";
-            continue;
+            this->dataPtr->GradedFluidDensity<math::Boxd>(
+              pose, shape.box, gravity->Data());
           }
-
-          switch (coll->Data().Geom()->Type())
+          else
           {
-            case sdf::GeometryType::BOX:
-              this->dataPtr->GradedFluidDensity<math::Boxd>(
-                pose,
-                coll->Data().Geom()->BoxShape()->Shape(),
-                gravity->Data());
-              break;
-            case sdf::GeometryType::SPHERE:
-              this->dataPtr->GradedFluidDensity<math::Sphered>(
-                pose,
-                coll->Data().Geom()->SphereShape()->Shape(),
-                gravity->Data());
-              break;
-            default:
-            {
-              static bool warned{false};
-              if (!warned)
-              {
-                gzwarn << "Only <box> and <sphere> collisions are supported "
-                  << "by the graded buoyancy option." << std::endl;
-                warned = true;
-              }
-              break;
-            }
+            this->dataPtr->GradedFluidDensity<math::Sphered>(
+              pose, shape.sphere, gravity->Data());
           }
         }
         auto [force, torque] = this->dataPtr->ResolveForces(linkWorldPose);
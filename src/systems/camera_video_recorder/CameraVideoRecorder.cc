@@ -15,13 +15,14 @@
  *
 */
 
+#include <chrono>
+#include <mutex>
 #include <regex>
 #include <set>
 #include <string>
 #include <unordered_map>
 
 #include <gz/common/Profiler.hh>
-#include <gz/common/VideoEncoder.hh>
 #include <gz/plugin/Register.hh>
 #include <gz/transport/Node.hh>
 
@@ -33,6 +34,7 @@
 #include "gz/sim/rendering/RenderUtil.hh"
 #include "gz/sim/rendering/Events.hh"
 #include "gz/sim/rendering/MarkerManager.hh"
+#include "gz/sim/rendering/VideoCapture.hh"
 
 #include "gz/sim/components/Camera.hh"
 #include "gz/sim/components/Model.hh"
@@ -93,8 +95,9 @@ class gz::sim::systems::CameraVideoRecorderPrivate
   /// \brief Image from user camera
   public: rendering::Image cameraImage;
 
-  /// \brief Video encoder
-  public: common::VideoEncoder videoEncoder;
+  /// \brief Worker-thread video capture shared with the GUI recorder,
+  /// so encoding does not stall the rendering thread.
+  public: VideoCapture videoCapture;
 
   /// \brief Video encoding format
   public: std::string recordVideoFormat;
@@ -111,12 +114,6 @@ class gz::sim::systems::CameraVideoRecorderPrivate
   /// \brief Topic that the sensor publishes to
   public: std::string sensorTopic;
 
-  /// \brief Video recording statistics publisher
-  public: transport::Node::Publisher recorderStatsPub;
-
-  /// \brief Start time of video recording.
-  public: std::chrono::steady_clock::time_point recordStartTime;
-
   /// \brief Current simulation time.
   public: std::chrono::steady_clock::duration simTime{0};
 
@@ -266,8 +263,7 @@ void CameraVideoRecorder::Configure(
 
   // recorder stats topic
   std::string recorderStatsTopic = this->dataPtr->sensorTopic + "/stats";
-  this->dataPtr->recorderStatsPub =
-    this->dataPtr->node.Advertise<msgs::Time>(recorderStatsTopic);
+  this->dataPtr->videoCapture.SetStatsTopic(recorderStatsTopic);
   gzmsg << "Camera Video recorder stats topic advertised on ["
     << recorderStatsTopic << "]" << std::endl;
 }
@@ -329,7 +325,7 @@ void CameraVideoRecorderPrivate::OnPostRender()
     }
 
     // Video recorder is on. Add more frames to it
-    if (this->videoEncoder.IsEncoding())
+    if (this->videoCapture.Encoding())
     {
       this->camera->Copy(this->cameraImage);
       std::chrono::steady_clock::time_point t;
@@ -338,29 +334,9 @@ void CameraVideoRecorderPrivate::OnPostRender()
       else
         t = std::chrono::steady_clock::now();
 
-      bool frameAdded = this->videoEncoder.AddFrame(
-          this->cameraImage.Data<unsigned char>(), width, height, t);
-
-      if (frameAdded)
-      {
-        // publish recorder stats
-        if (this->recordStartTime ==
-            std::chrono::steady_clock::time_point(
-              std::chrono::duration(std::chrono::seconds(0))))
-        {
-          // start time, i.e. time when first frame is added
-          this->recordStartTime = t;
-        }
-
-        std::chrono::steady_clock::duration dt;
-        dt = t - this->recordStartTime;
-        int64_t sec, nsec;
-        std::tie(sec, nsec) = math::durationToSecNsec(dt);
-        msgs::Time msg;
-        msg.set_sec(sec);
-        msg.set_nsec(nsec);
-        this->recorderStatsPub.Publish(msg);
-      }
+      // Hand the frame to the encoder thread; encoding on the rendering
+      // thread would stall all sensors sharing the scene.
+      this->videoCapture.AddFrame(this->cameraImage, t);
     }
     // Video recorder is idle. Start recording.
     else
@@ -373,26 +349,23 @@ void CameraVideoRecorderPrivate::OnPostRender()
       this->node.Subscribe(this->sensorTopic,
           &CameraVideoRecorderPrivate::OnImage, this);
 
-      this->videoEncoder.Start(this->recordVideoFormat,
+      this->videoCapture.Start(this->recordVideoFormat,
           this->tmpVideoFilename, width, height, this->fps,
           this->recordVideoBitrate);
 
-      this->recordStartTime = std::chrono::steady_clock::time_point(
-            std::chrono::duration(std::chrono::seconds(0)));
-
       gzmsg << "Start video recording on [" << this->service << "]. "
              << "Encoding to tmp file: ["
              << this->tmpVideoFilename << "]" << std::endl;
     }
   }
-  else if (this->videoEncoder.IsEncoding())
+  else if (this->videoCapture.Encoding())
   {
     // unsubscribe to let the sensor become inactive if there are no
     // other connections
     this->node.Unsubscribe(this->sensorTopic);
 
     // stop encoding
-    this->videoEncoder.Stop();
+    this->videoCapture.Stop();
 
     gzmsg << "Stop video recording on [" << this->service << "]." << std::endl;
 
@@ -16,6 +16,7 @@
  */
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/plugin/Register.hh>
@@ -44,6 +45,7 @@
 #include <gz/common/Mesh.hh>
 #include <gz/common/SubMesh.hh>
 
+#include <gz/math/Helpers.hh>
 #include <gz/math/Matrix4.hh>
 
 #include <gz/common/ColladaExporter.hh>
@@ -72,6 +74,13 @@ class gz::sim::systems::ColladaWorldExporterPrivate
     common::Mesh worldMesh;
     std::vector<math::Matrix4d> subMeshMatrix;
 
+    // Materials built from visual components, deduplicated by value. Large
+    // worlds instance the same few colors across thousands of visuals, and
+    // adding one material library entry per instance bloats the exported
+    // file. Materials that come from mesh files are already deduplicated by
+    // pointer since the MeshManager caches each mesh asset.
+    std::vector<std::pair<common::MaterialPtr, int>> visualMaterials;
+
     _ecm.Each<components::World, components::Name>(
       [&](const Entity /*& _entity*/,
         const components::World *,
@@ -128,7 +137,24 @@ class gz::sim::systems::ColladaWorldExporterPrivate
         }
         else
         {
-          newMatIndex = worldMesh.AddMaterial(mat);
+          newMatIndex = -1;
+          for (const auto &[cachedMat, cachedIndex] : visualMaterials)
+          {
+            if (cachedMat->Diffuse() == mat->Diffuse() &&
+                cachedMat->Ambient() == mat->Ambient() &&
+                cachedMat->Emissive() == mat->Emissive() &&
+                cachedMat->Specular() == mat->Specular() &&
+                math::equal(cachedMat->Transparency(), mat->Transparency()))
+            {
+              newMatIndex = cachedIndex;
+              break;
+            }
+          }
+          if (newMatIndex < 0)
+          {
+            newMatIndex = worldMesh.AddMaterial(mat);
+            visualMaterials.emplace_back(mat, newMatIndex);
+          }
         }
 
         subm.lock()->SetMaterialIndex(newMatIndex);
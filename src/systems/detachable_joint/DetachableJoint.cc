@@ -120,6 +120,18 @@ void DetachableJoint::PreUpdate(
   GZ_PROFILE("DetachableJoint::PreUpdate");
   if (this->validConfig && !this->initialized)
   {
+    // New entities only appear through structural changes in the ECM, so
+    // repeat the search for the child model only when the structure changed
+    // since the last failed attempt. Idle instances waiting for a child
+    // that never spawns then do no per-step work.
+    if (this->searchedEcm == &_ecm &&
+        this->searchedEpoch == _ecm.StructuralEpoch())
+    {
+      return;
+    }
+    this->searchedEcm = &_ecm;
+    this->searchedEpoch = _ecm.StructuralEpoch();
+
     // Look for the child model and link
     Entity modelEntity{kNullEntity};
 
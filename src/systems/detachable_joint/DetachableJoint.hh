@@ -20,6 +20,7 @@
 
 #include <gz/msgs/empty.pb.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <gz/transport/Node.hh>
@@ -100,6 +101,15 @@ namespace systems
     /// \brief Entity of the detachable joint created by this system
     private: Entity detachableJointEntity{kNullEntity};
 
+    /// \brief ECM for which the last failed child model search was
+    /// performed.
+    private: const EntityComponentManager *searchedEcm{nullptr};
+
+    /// \brief Structural epoch of the ECM at the last failed child model
+    /// search. The missing child can only appear through a structural
+    /// change, so the search is repeated only when the epoch advances.
+    private: uint64_t searchedEpoch{0};
+
     /// \brief Whether detachment has been requested
     private: std::atomic<bool> detachRequested{false};
 
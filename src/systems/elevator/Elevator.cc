@@ -20,8 +20,9 @@
  * \date January 2021
  */
 
-#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <regex>
 #include <string>
@@ -161,6 +162,16 @@ class ElevatorPrivate : public ElevatorCommonPrivate
 
   /// \brief Elevator state machine
   public: std::unique_ptr<ElevatorStateMachine> stateMachine;
+
+  /// \brief ECM the cached cabin joint position component was resolved
+  /// against
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Structural epoch of the ECM when the cache was last refreshed
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached joint position component of the cabin joint
+  public: const components::JointPosition *cabinJointPosComp{nullptr};
 };
 
 //////////////////////////////////////////////////
@@ -397,14 +408,30 @@ void ElevatorPrivate::UpdateState(const gz::sim::UpdateInfo &_info,
                                   const EntityComponentManager &_ecm)
 {
   // Update state
-  double pos =
-      _ecm.ComponentData<components::JointPosition>(this->cabinJoint)->front();
-  std::vector<int32_t> diffs(this->cabinTargets.size());
-  std::transform(this->cabinTargets.begin(), this->cabinTargets.end(),
-                 diffs.begin(),
-                 [&pos](auto target) { return std::fabs(target - pos); });
-  auto it = std::min_element(diffs.begin(), diffs.end());
-  this->state = static_cast<int32_t>(std::distance(diffs.begin(), it));
+  // ComponentData would copy the whole joint position vector, so go through
+  // a component pointer that stays valid while the ECM structure is
+  // unchanged
+  if (this->cacheEcm != &_ecm || this->cacheEpoch != _ecm.StructuralEpoch())
+  {
+    this->cabinJointPosComp =
+        _ecm.Component<components::JointPosition>(this->cabinJoint);
+    this->cacheEcm = &_ecm;
+    this->cacheEpoch = _ecm.StructuralEpoch();
+  }
+  double pos = this->cabinJointPosComp->Data().front();
+
+  // Find the closest floor target in place instead of building a temporary
+  // vector of distances on every update
+  int32_t minDiff = std::numeric_limits<int32_t>::max();
+  for (size_t i = 0; i < this->cabinTargets.size(); ++i)
+  {
+    int32_t diff = std::fabs(this->cabinTargets[i] - pos);
+    if (diff < minDiff)
+    {
+      minDiff = diff;
+      this->state = static_cast<int32_t>(i);
+    }
+  }
 
   // Throttle publish rate
   auto elapsed = _info.simTime - this->lastStatePubTime;
@@ -17,6 +17,9 @@
 #include "EnvironmentPreload.hh"
 
 #include <array>
+#include <chrono>
+#include <fstream>
+#include <future>
 #include <string>
 #include <utility>
 #include <vector>
@@ -41,6 +44,11 @@ class gz::sim::systems::EnvironmentPreloadPrivate
   public: bool loaded{false};
 
   public: std::shared_ptr<const sdf::Element> sdf;
+
+  /// \brief Pending result of the data parse, which runs on a worker
+  /// thread so a large dataset doesn't stall the first simulation steps.
+  public: std::future<std::shared_ptr<components::EnvironmentalData>>
+      dataFuture;
 };
 
 //////////////////////////////////////////////////
@@ -160,16 +168,31 @@ void EnvironmentPreload::PreUpdate(
       }
     }
 
+    // Parse on a worker thread so simulation startup isn't serialized
+    // behind a large dataset; the component appears once the parse is
+    // done.
+    gzmsg << "Loading Environment Data\n";
+    this->dataPtr->dataFuture = std::async(std::launch::async,
+        [dataFile = std::move(dataFile), timeColumnName, ignoreTime,
+         spatialColumnNames, spatialReference, unit]() mutable
+        {
+          using ComponentDataT = components::EnvironmentalData;
+          return ComponentDataT::MakeShared(
+              common::IO<ComponentDataT::FrameT>::ReadFrom(
+                  common::CSVIStreamIterator(dataFile),
+                  common::CSVIStreamIterator(),
+                  timeColumnName, spatialColumnNames),
+              spatialReference, unit, ignoreTime);
+        });
+  }
+
+  if (this->dataPtr->dataFuture.valid() &&
+      this->dataPtr->dataFuture.wait_for(std::chrono::seconds(0)) ==
+      std::future_status::ready)
+  {
     try
     {
-      gzmsg << "Loading Environment Data\n";
-      using ComponentDataT = components::EnvironmentalData;
-      auto data = ComponentDataT::MakeShared(
-          common::IO<ComponentDataT::FrameT>::ReadFrom(
-              common::CSVIStreamIterator(dataFile),
-              common::CSVIStreamIterator(),
-              timeColumnName, spatialColumnNames),
-          spatialReference, unit, ignoreTime);
+      auto data = this->dataPtr->dataFuture.get();
 
       using ComponentT = components::Environment;
       auto component = ComponentT{std::move(data)};
@@ -170,6 +170,21 @@ class EnvironmentalSensor : public gz::sensors::Sensor
       this->frameId = _sdf.Element()->Get<std::string>("frame_id");
     }
 
+    // Prebuild the constant frame_id header data; Update only fills in
+    // the stamp and the sampled values.
+    if (this->numberOfFields == 1)
+    {
+      auto frame = this->scalarMsg.mutable_header()->add_data();
+      frame->set_key("frame_id");
+      frame->add_value((this->frameId == "") ? this->Name() : this->frameId);
+    }
+    else if (this->numberOfFields == 3)
+    {
+      auto frame = this->vectorMsg.mutable_header()->add_data();
+      frame->set_key("frame_id");
+      frame->add_value((this->frameId == "") ? this->Name() : this->frameId);
+    }
+
     if (this->numberOfFields == 1)
     {
       gzdbg << "Loaded environmental sensor for " << this->fieldName[0]
@@ -195,6 +210,16 @@ class EnvironmentalSensor : public gz::sensors::Sensor
   {
     if (!this->ready) return false;
 
+    // Without subscribers nothing consumes the sample, so skip the grid
+    // lookups entirely. Sessions step to the current time on demand, so
+    // catching up once a subscriber connects is handled by StepTo below.
+    if (!this->pub.HasConnections())
+      return true;
+
+    // A data table that is static in time yields the same sample while
+    // the sensor does not move, so reuse the previous lookup then.
+    const bool reuseSample = this->gridField->staticTime &&
+        this->hasSample && this->position == this->lastSamplePosition;
 
     std::optional<double> dataPoints[3];
     for (std::size_t i = 0; i < this->numberOfFields; ++i)
@@ -208,6 +233,12 @@ class EnvironmentalSensor : public gz::sensors::Sensor
 
       if (!this->session[i].has_value()) return false;
 
+      if (reuseSample)
+      {
+        dataPoints[i] = this->lastSample[i];
+        continue;
+      }
+
       // Step time if its not static
       if (!this->gridField->staticTime)
         this->session[i] = this->gridField->frame[this->fieldName[i]].StepTo(
@@ -220,12 +251,25 @@ class EnvironmentalSensor : public gz::sensors::Sensor
         this->session[i].value(), this->position);
     }
 
+    if (this->gridField->staticTime && !reuseSample)
+    {
+      bool complete = true;
+      for (std::size_t i = 0; i < this->numberOfFields; ++i)
+      {
+        if (!dataPoints[i].has_value())
+        {
+          complete = false;
+          break;
+        }
+        this->lastSample[i] = dataPoints[i].value();
+      }
+      this->lastSamplePosition = this->position;
+      this->hasSample = complete;
+    }
+
     if (this->numberOfFields == 1) {
-      gz::msgs::Double msg;
+      gz::msgs::Double &msg = this->scalarMsg;
       *msg.mutable_header()->mutable_stamp() = gz::msgs::Convert(_now);
-      auto frame = msg.mutable_header()->add_data();
-      frame->set_key("frame_id");
-      frame->add_value((this->frameId == "") ? this->Name() : this->frameId);
       auto data = dataPoints[0];
       if (!data.has_value())
       {
@@ -238,11 +282,8 @@ class EnvironmentalSensor : public gz::sensors::Sensor
     }
     else if (this->numberOfFields == 3)
     {
-      gz::msgs::Vector3d msg;
+      gz::msgs::Vector3d &msg = this->vectorMsg;
       *msg.mutable_header()->mutable_stamp() = gz::msgs::Convert(_now);
-      auto frame = msg.mutable_header()->add_data();
-      frame->set_key("frame_id");
-      frame->add_value((this->frameId == "") ? this->Name() : this->frameId);
 
       if (!dataPoints[0].has_value() || !dataPoints[1].has_value()
         || !dataPoints[2].has_value())
@@ -289,6 +330,7 @@ class EnvironmentalSensor : public gz::sensors::Sensor
     }
 
     this->gridField = data;
+    this->hasSample = false;
     for (std::size_t i = 0; i < this->numberOfFields; ++i)
     {
       if (this->fieldName[i] == "")
@@ -359,6 +401,17 @@ class EnvironmentalSensor : public gz::sensors::Sensor
   private: std::shared_ptr<gz::sim::v7::components::EnvironmentalData>
     gridField;
   private: TransformType transformType{TransformType::GLOBAL};
+
+  /// \brief Lookup position and values of the last sample. Only used for
+  /// data tables that are static in time; valid while hasSample is true.
+  private: math::Vector3d lastSamplePosition;
+  private: double lastSample[3]{0.0, 0.0, 0.0};
+  private: bool hasSample{false};
+
+  /// \brief Messages reused across updates, with the constant frame_id
+  /// header data prebuilt in Load().
+  private: gz::msgs::Double scalarMsg;
+  private: gz::msgs::Vector3d vectorMsg;
 };
 
 class gz::sim::EnvironmentalSensorSystemPrivate {
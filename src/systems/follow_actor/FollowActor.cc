@@ -15,6 +15,7 @@
  *
  */
 
+#include <cstdint>
 #include <string>
 
 #include <gz/plugin/Register.hh>
@@ -62,6 +63,21 @@ class gz::sim::systems::FollowActorPrivate
 
   /// \brief True if currently following
   public: bool following{true};
+
+  /// \brief ECM the cached component pointers below were resolved against.
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Structural epoch of the ECM when the cache was last refreshed.
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached trajectory pose component of the actor.
+  public: components::TrajectoryPose *trajPoseComp{nullptr};
+
+  /// \brief Cached animation time component of the actor.
+  public: components::AnimationTime *animTimeComp{nullptr};
+
+  /// \brief Cached pose component of the target.
+  public: const components::Pose *targetPoseComp{nullptr};
 };
 
 //////////////////////////////////////////////////
@@ -212,28 +228,41 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
   if (this->dataPtr->targetEntity == kNullEntity)
     return;
 
+  // Refresh the cached component pointers only when the ECM structure
+  // changed; this runs every step for every actor
+  if (this->dataPtr->cacheEcm != &_ecm ||
+      this->dataPtr->cacheEpoch != _ecm.StructuralEpoch())
+  {
+    this->dataPtr->trajPoseComp = _ecm.Component<components::TrajectoryPose>(
+        this->dataPtr->actorEntity);
+    this->dataPtr->animTimeComp = _ecm.Component<components::AnimationTime>(
+        this->dataPtr->actorEntity);
+    this->dataPtr->targetPoseComp = _ecm.Component<components::Pose>(
+        this->dataPtr->targetEntity);
+    this->dataPtr->cacheEcm = &_ecm;
+    this->dataPtr->cacheEpoch = _ecm.StructuralEpoch();
+  }
+
   // Current world pose
-  auto trajPoseComp = _ecm.Component<components::TrajectoryPose>(
-      this->dataPtr->actorEntity);
-  auto actorPose = trajPoseComp->Data();
+  auto actorPose = this->dataPtr->trajPoseComp->Data();
   auto initialPose = actorPose;
 
   // Current target
-  auto targetPose = _ecm.Component<components::Pose>(
-      this->dataPtr->targetEntity)->Data();
+  const auto &targetPose = this->dataPtr->targetPoseComp->Data();
 
   // Direction to target
   auto dir = targetPose.Pos() - actorPose.Pos();
   dir.Z(0);
+  const double targetDistance = dir.Length();
 
   // Stop if too close to target
-  if (dir.Length() <= this->dataPtr->minDistance)
+  if (targetDistance <= this->dataPtr->minDistance)
   {
     return;
   }
 
   // Stop following if too far from target
-  if (dir.Length() > this->dataPtr->maxDistance)
+  if (targetDistance > this->dataPtr->maxDistance)
   {
     if (this->dataPtr->following)
     {
@@ -267,20 +296,17 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
   double distanceTraveled = (actorPose.Pos() - initialPose.Pos()).Length();
 
   // Update actor root pose
-  *trajPoseComp = components::TrajectoryPose(actorPose);
+  this->dataPtr->trajPoseComp->Data() = actorPose;
   // Mark as a one-time-change so that the change is propagated to the GUI
   _ecm.SetChanged(this->dataPtr->actorEntity,
       components::TrajectoryPose::typeId, ComponentState::OneTimeChange);
 
   // Update actor bone trajectories based on animation time
-  auto animTimeComp = _ecm.Component<components::AnimationTime>(
-      this->dataPtr->actorEntity);
-
-  auto animTime = animTimeComp->Data() +
+  auto animTime = this->dataPtr->animTimeComp->Data() +
     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
     std::chrono::duration<double>(distanceTraveled *
     this->dataPtr->animationXVel));
-  *animTimeComp = components::AnimationTime(animTime);
+  this->dataPtr->animTimeComp->Data() = animTime;
   // Mark as a one-time-change so that the change is propagated to the GUI
   _ecm.SetChanged(this->dataPtr->actorEntity,
       components::AnimationTime::typeId, ComponentState::OneTimeChange);
@@ -74,13 +74,15 @@ class gz::sim::systems::HydrodynamicsPrivateData
 
   /// \brief Added mass of vehicle;
   /// See: https://en.wikipedia.org/wiki/Added_mass
-  public: Eigen::MatrixXd Ma;
+  /// Fixed-size so the per-step products stay on the stack and Eigen can
+  /// vectorize them.
+  public: Eigen::Matrix<double, 6, 6> Ma;
 
   /// \brief Previous state.
-  public: Eigen::VectorXd prevState;
+  public: Eigen::Matrix<double, 6, 1> prevState;
 
   /// \brief Previous derivative of the state
-  public: Eigen::VectorXd prevStateDot;
+  public: Eigen::Matrix<double, 6, 1> prevStateDot;
 
   /// \brief Use current table if true
   public: bool useCurrentTable {false};
@@ -350,7 +352,7 @@ void Hydrodynamics::Configure(
   }
 
   // Added mass according to Fossen's equations (p 37)
-  this->dataPtr->Ma = Eigen::MatrixXd::Zero(6, 6);
+  this->dataPtr->Ma = Eigen::Matrix<double, 6, 6>::Zero();
   for(auto i = 0; i < 6; i++)
   {
     for(auto j = 0; j < 6; j++)
@@ -401,7 +403,7 @@ void Hydrodynamics::Configure(
     this->dataPtr->currentVector = _sdf->Get<math::Vector3d>("default_current");
   }
 
-  this->dataPtr->prevState = Eigen::VectorXd::Zero(6);
+  this->dataPtr->prevState = Eigen::Matrix<double, 6, 1>::Zero();
 
   if(_sdf->HasElement("lookup_current_x"))
   {
@@ -450,10 +452,12 @@ void Hydrodynamics::PreUpdate(
   // `Cmat` corresponds to the Centripetal matrix
   // `Dmat` is the drag matrix
   // `Ma` is the added mass.
-  Eigen::VectorXd stateDot = Eigen::VectorXd(6);
-  Eigen::VectorXd state    = Eigen::VectorXd(6);
-  Eigen::MatrixXd Cmat     = Eigen::MatrixXd::Zero(6, 6);
-  Eigen::MatrixXd Dmat     = Eigen::MatrixXd::Zero(6, 6);
+  // All of these are fixed-size: no heap allocation per step and the
+  // matrix products below compile to vectorized kernels.
+  Eigen::Matrix<double, 6, 1> stateDot;
+  Eigen::Matrix<double, 6, 1> state;
+  Eigen::Matrix<double, 6, 6> Cmat = Eigen::Matrix<double, 6, 6>::Zero();
+  Eigen::Matrix<double, 6, 6> Dmat = Eigen::Matrix<double, 6, 6>::Zero();
 
   // Get vehicle state
   gz::sim::Link baseLink(this->dataPtr->linkEntity);
@@ -507,7 +511,7 @@ void Hydrodynamics::PreUpdate(
 
   // The added mass
   // Negative sign signifies the behaviour change
-  const Eigen::VectorXd kAmassVec = - this->dataPtr->Ma * stateDot;
+  const Eigen::Matrix<double, 6, 1> kAmassVec = - this->dataPtr->Ma * stateDot;
 
   // Coriolis and Centripetal forces for under water vehicles (Fossen P. 37)
   // Note: this is significantly different from VRX because we need to account
@@ -533,7 +537,7 @@ void Hydrodynamics::PreUpdate(
   Cmat(5, 1) =   this->dataPtr->Ma(0, 0) * state(0);
   Cmat(5, 3) = - this->dataPtr->Ma(4, 4) * state(4);
   Cmat(5, 4) =   this->dataPtr->Ma(3, 3) * state(3);
-  const Eigen::VectorXd kCmatVec = - Cmat * state;
+  const Eigen::Matrix<double, 6, 1> kCmatVec = - Cmat * state;
 
   // Damping forces
   for(int i = 0; i < 6; i++)
@@ -556,9 +560,9 @@ void Hydrodynamics::PreUpdate(
     }
   }
 
-  const Eigen::VectorXd kDvec = Dmat * state;
+  const Eigen::Matrix<double, 6, 1> kDvec = Dmat * state;
 
-  Eigen::VectorXd kTotalWrench = kDvec;
+  Eigen::Matrix<double, 6, 1> kTotalWrench = kDvec;
 
   if (!this->dataPtr->disableAddedMass)
   {
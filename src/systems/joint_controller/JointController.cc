@@ -49,6 +49,11 @@ class gz::sim::systems::JointControllerPrivate
   /// \param[in] _msg Velocity message
   public: void OnActuatorVel(const msgs::Actuators &_msg);
 
+  /// \brief Re-resolve the cached component pointers below if the ECM's
+  /// structure changed since they were last resolved.
+  /// \param[in] _ecm Entity component manager to resolve against.
+  public: void UpdateCache(EntityComponentManager &_ecm);
+
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
@@ -79,8 +84,49 @@ class gz::sim::systems::JointControllerPrivate
 
   /// \brief Velocity PID controller.
   public: math::PID velPid;
+
+  /// \brief ECM the cached component pointers were resolved against.
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Value of EntityComponentManager::StructuralEpoch when the
+  /// cached component pointers were resolved.
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached velocity component of the first controlled joint, or
+  /// nullptr if it hasn't been created yet.
+  public: components::JointVelocity *jointVelComp{nullptr};
+
+  /// \brief Cached force command components, one per controlled joint.
+  /// Entries are nullptr until the component has been created.
+  public: std::vector<components::JointForceCmd *> forceCmdComps;
+
+  /// \brief Cached velocity command components, one per controlled joint.
+  /// Entries are nullptr until the component has been created.
+  public: std::vector<components::JointVelocityCmd *> velCmdComps;
 };
 
+//////////////////////////////////////////////////
+void JointControllerPrivate::UpdateCache(EntityComponentManager &_ecm)
+{
+  if (this->cacheEcm == &_ecm && this->cacheEpoch == _ecm.StructuralEpoch())
+    return;
+
+  this->jointVelComp =
+      _ecm.Component<components::JointVelocity>(this->jointEntities[0]);
+  this->forceCmdComps.clear();
+  this->velCmdComps.clear();
+  for (Entity joint : this->jointEntities)
+  {
+    this->forceCmdComps.push_back(
+        _ecm.Component<components::JointForceCmd>(joint));
+    this->velCmdComps.push_back(
+        _ecm.Component<components::JointVelocityCmd>(joint));
+  }
+
+  this->cacheEcm = &_ecm;
+  this->cacheEpoch = _ecm.StructuralEpoch();
+}
+
 //////////////////////////////////////////////////
 JointController::JointController()
   : dataPtr(std::make_unique<JointControllerPrivate>())
@@ -294,10 +340,12 @@ void JointController::PreUpdate(const UpdateInfo &_info,
   if (_info.paused)
     return;
 
+  // Component pointers are looked up again only when the ECM's structure
+  // changed; in the steady state each update reuses the cached pointers.
+  this->dataPtr->UpdateCache(_ecm);
+
   // Create joint velocity component if one doesn't exist
-  auto jointVelComp = _ecm.Component<components::JointVelocity>(
-      this->dataPtr->jointEntities[0]);
-  if (!jointVelComp)
+  if (!this->dataPtr->jointVelComp)
   {
     _ecm.CreateComponent(this->dataPtr->jointEntities[0],
         components::JointVelocity());
@@ -305,7 +353,8 @@ void JointController::PreUpdate(const UpdateInfo &_info,
 
   // We just created the joint velocity component, give one iteration for the
   // physics system to update its size
-  if (jointVelComp == nullptr || jointVelComp->Data().empty())
+  if (this->dataPtr->jointVelComp == nullptr ||
+      this->dataPtr->jointVelComp->Data().empty())
     return;
 
   double targetVel;
@@ -314,46 +363,46 @@ void JointController::PreUpdate(const UpdateInfo &_info,
     targetVel = this->dataPtr->jointVelCmd;
   }
 
-  double error = jointVelComp->Data().at(0) - targetVel;
+  double error = this->dataPtr->jointVelComp->Data().at(0) - targetVel;
 
   // Force mode.
-  if ((this->dataPtr->useForceCommands) &&
-      (!jointVelComp->Data().empty()))
+  if (this->dataPtr->useForceCommands)
   {
-    for (Entity joint : this->dataPtr->jointEntities)
-    {
-      // Update force command.
-      double force = this->dataPtr->velPid.Update(error, _info.dt);
+    // The PID carries integral state, so it's stepped once per update
+    // rather than once per joint; every controlled joint gets the same
+    // force command.
+    double force = this->dataPtr->velPid.Update(error, _info.dt);
 
-      auto forceComp =
-          _ecm.Component<components::JointForceCmd>(joint);
+    for (std::size_t i = 0; i < this->dataPtr->jointEntities.size(); ++i)
+    {
+      auto forceComp = this->dataPtr->forceCmdComps[i];
       if (forceComp == nullptr)
       {
-        _ecm.CreateComponent(joint,
+        _ecm.CreateComponent(this->dataPtr->jointEntities[i],
                             components::JointForceCmd({force}));
       }
       else
       {
-        *forceComp = components::JointForceCmd({force});
+        forceComp->Data().assign(1, force);
       }
     }
   }
   // Velocity mode.
-  else if (!this->dataPtr->useForceCommands)
+  else
   {
     // Update joint velocity
-    for (Entity joint : this->dataPtr->jointEntities)
+    for (std::size_t i = 0; i < this->dataPtr->jointEntities.size(); ++i)
     {
-      auto vel = _ecm.Component<components::JointVelocityCmd>(joint);
+      auto vel = this->dataPtr->velCmdComps[i];
 
       if (vel == nullptr)
       {
-        _ecm.CreateComponent(
-            joint, components::JointVelocityCmd({targetVel}));
+        _ecm.CreateComponent(this->dataPtr->jointEntities[i],
+            components::JointVelocityCmd({targetVel}));
       }
       else
       {
-        *vel = components::JointVelocityCmd({targetVel});
+        vel->Data().assign(1, targetVel);
       }
     }
   }
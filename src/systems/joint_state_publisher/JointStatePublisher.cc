@@ -101,6 +101,14 @@ void JointStatePublisher::Configure(
     this->topic = _sdf->Get<std::string>("topic");
   }
 
+  // An optional publish rate decoupled from the physics rate.
+  double updateFrequency = _sdf->Get<double>("update_frequency", -1).first;
+  if (updateFrequency > 0)
+  {
+    std::chrono::duration<double> period{1 / updateFrequency};
+    this->updatePeriod =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -136,10 +144,64 @@ void JointStatePublisher::CreateComponents(EntityComponentManager &_ecm,
   }
 }
 
+//////////////////////////////////////////////////
+void JointStatePublisher::InitializeMessage(const EntityComponentManager &_ecm)
+{
+  // Fill the fields that never change between publishes once, so each
+  // publish only rewrites numeric fields in place. The per-joint order of
+  // the message matches the iteration order of this->joints, which both
+  // this function and PostUpdate use.
+  this->msg.set_name(this->model.Name(_ecm));
+  this->msg.set_id(this->model.Entity());
+
+  for (const Entity &joint : this->joints)
+  {
+    msgs::Joint *jointMsg = this->msg.add_joint();
+    jointMsg->set_name(_ecm.Component<components::Name>(joint)->Data());
+    jointMsg->set_id(joint);
+
+    auto child = _ecm.Component<components::ChildLinkName>(joint);
+    if (child)
+    {
+      jointMsg->set_child(child->Data());
+    }
+
+    auto parent = _ecm.Component<components::ParentLinkName>(joint);
+    if (parent)
+    {
+      jointMsg->set_parent(parent->Data());
+    }
+
+    // The axis parameters don't change at runtime either.
+    auto jointAxis = _ecm.Component<components::JointAxis>(joint);
+    if (jointAxis)
+    {
+      msgs::Set(
+        jointMsg->mutable_axis1()->mutable_xyz(),
+        jointAxis->Data().Xyz());
+      jointMsg->mutable_axis1()->set_limit_upper(
+        jointAxis->Data().Upper());
+      jointMsg->mutable_axis1()->set_limit_lower(
+        jointAxis->Data().Lower());
+      jointMsg->mutable_axis1()->set_damping(
+        jointAxis->Data().Damping());
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
                                 const EntityComponentManager &_ecm)
 {
+  // Throttle to the configured publish rate. If time went backward,
+  // publish and let the time reset.
+  auto diff = _info.simTime - this->lastPublishTime;
+  if ((diff > std::chrono::steady_clock::duration::zero()) &&
+      (diff < this->updatePeriod))
+  {
+    return;
+  }
+
   // Create the model state publisher. This can't be done in ::Configure
   // because the World is not guaranteed to be accessible.
   if (!this->modelPub)
@@ -183,48 +245,38 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
   if (!this->modelPub)
     return;
 
-  // Create the message
-  msgs::Model msg;
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  this->lastPublishTime = _info.simTime;
 
-  // Set the name and ID.
-  msg.set_name(this->model.Name(_ecm));
-  msg.set_id(this->model.Entity());
+  // Build the message skeleton once, then only rewrite the numeric fields
+  // below.
+  if (!this->msgInitialized)
+  {
+    this->InitializeMessage(_ecm);
+    this->msgInitialized = true;
+  }
+
+  this->msg.mutable_header()->mutable_stamp()->CopyFrom(
+      convert<msgs::Time>(_info.simTime));
 
   // Set the model pose
   const auto *pose = _ecm.Component<components::Pose>(
       this->model.Entity());
   if (pose)
-    msgs::Set(msg.mutable_pose(), pose->Data());
+    msgs::Set(this->msg.mutable_pose(), pose->Data());
 
   static bool hasWarned {false};
 
   // Process each joint
+  int jointIndex = 0;
   for (const Entity &joint : this->joints)
   {
-    // Add a joint message.
-    msgs::Joint *jointMsg = msg.add_joint();
-    jointMsg->set_name(_ecm.Component<components::Name>(joint)->Data());
-    jointMsg->set_id(joint);
+    msgs::Joint *jointMsg = this->msg.mutable_joint(jointIndex++);
 
     // Set the joint pose
     pose = _ecm.Component<components::Pose>(joint);
     if (pose)
       msgs::Set(jointMsg->mutable_pose(), pose->Data());
 
-    auto child = _ecm.Component<components::ChildLinkName>(joint);
-    if (child)
-    {
-      jointMsg->set_child(child->Data());
-    }
-
-    auto parent = _ecm.Component<components::ParentLinkName>(joint);
-    if (parent)
-    {
-      jointMsg->set_parent(parent->Data());
-    }
-
     // Set the joint position
     const auto *jointPositions  =
       _ecm.Component<components::JointPosition>(joint);
@@ -235,19 +287,6 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
         if (i == 0)
         {
           jointMsg->mutable_axis1()->set_position(jointPositions->Data()[i]);
-          auto jointAxis = _ecm.Component<components::JointAxis>(joint);
-          if (jointAxis)
-          {
-            msgs::Set(
-              jointMsg->mutable_axis1()->mutable_xyz(),
-              jointAxis->Data().Xyz());
-            jointMsg->mutable_axis1()->set_limit_upper(
-              jointAxis->Data().Upper());
-            jointMsg->mutable_axis1()->set_limit_lower(
-              jointAxis->Data().Lower());
-            jointMsg->mutable_axis1()->set_damping(
-              jointAxis->Data().Damping());
-          }
         }
         else if (i == 1)
         {
@@ -309,7 +348,7 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
   }
 
   // Publish the message.
-  this->modelPub->Publish(msg);
+  this->modelPub->Publish(this->msg);
 }
 
 GZ_ADD_PLUGIN(JointStatePublisher,
@@ -18,9 +18,11 @@
 #ifndef GZ_SIM_SYSTEMS_STATE_PUBLISHER_HH_
 #define GZ_SIM_SYSTEMS_STATE_PUBLISHER_HH_
 
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
+#include <gz/msgs/model.pb.h>
 #include <gz/sim/Model.hh>
 #include <gz/transport/Node.hh>
 #include <gz/sim/System.hh>
@@ -49,6 +51,9 @@ namespace systems
   /// `<joint_name>`: Name of a joint to publish. This parameter can be
   /// specified multiple times, and is optional. All joints in a model will
   /// be published if joint names are not specified.
+  /// `<update_frequency>`: Rate at which to publish the joint state, in
+  /// Hertz. This parameter is optional, and if not provided or not
+  /// positive, the joint state is published every simulation step.
   class JointStatePublisher
       : public System,
         public ISystemConfigure,
@@ -75,6 +80,13 @@ namespace systems
     private: void CreateComponents(EntityComponentManager &_ecm,
                                    sim::Entity _joint);
 
+    /// \brief Fill the skeleton of the cached message: names, IDs, child
+    /// and parent link names, and joint axis parameters, which don't
+    /// change between publishes. Numeric fields are updated in place by
+    /// PostUpdate.
+    /// \param[in] _ecm The EntityComponentManager.
+    private: void InitializeMessage(const EntityComponentManager &_ecm);
+
     /// \brief The model
     private: Model model;
 
@@ -89,6 +101,20 @@ namespace systems
 
     /// \brief The topic
     private: std::string topic;
+
+    /// \brief Cached message, built once by InitializeMessage and reused
+    /// for every publish to avoid re-allocating the string fields.
+    private: msgs::Model msg;
+
+    /// \brief True once the cached message skeleton has been built.
+    private: bool msgInitialized{false};
+
+    /// \brief Update period calculated from `<update_frequency>`. Zero
+    /// publishes every simulation step.
+    private: std::chrono::steady_clock::duration updatePeriod{0};
+
+    /// \brief Last simulation time the joint state was published.
+    private: std::chrono::steady_clock::duration lastPublishTime{0};
   };
   }
 }
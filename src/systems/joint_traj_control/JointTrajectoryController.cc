@@ -35,8 +35,11 @@
 #include <gz/transport/Publisher.hh>
 #include <gz/transport/TopicUtils.hh>
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "JointTrajectoryController.hh"
@@ -289,12 +292,32 @@ class gz::sim::systems::JointTrajectoryControllerPrivate
   /// of the joint
   public: std::map<std::string, ActuatedJoint> actuatedJoints;
 
-  /// \brief Mutex projecting trajectory
-  public: std::mutex trajectoryMutex;
+  /// \brief Mutex protecting pendingTrajectory
+  public: std::mutex pendingTrajectoryMutex;
 
-  /// \brief Information about trajectory that should be followed
+  /// \brief Newly received trajectory waiting to be adopted by the update
+  /// loop. Only valid while hasPendingTrajectory is set
+  public: Trajectory pendingTrajectory;
+
+  /// \brief True if pendingTrajectory holds a trajectory that the update
+  /// loop hasn't adopted yet. Checked before taking the mutex, so the
+  /// steady state of following a trajectory is lock-free
+  public: std::atomic<bool> hasPendingTrajectory{false};
+
+  /// \brief True while a trajectory is being executed. Only used by the
+  /// subscriber thread to warn about preempted trajectories
+  public: std::atomic<bool> trajectoryActive{false};
+
+  /// \brief Information about trajectory that should be followed. Owned by
+  /// the update loop; the subscriber thread hands over new trajectories
+  /// through pendingTrajectory instead of touching this directly
   public: Trajectory trajectory;
 
+  /// \brief Actuated joints of the current trajectory, resolved once per
+  /// trajectory in the order of its joint names. Joints that are not
+  /// configured for this controller are stored as nullptr
+  public: std::vector<ActuatedJoint *> trajectoryJoints;
+
   /// \brief Flag that determines whether to use message header timestamp as
   /// the trajectory start, where simulation time at the beginning of execution
   /// is used otherwise
@@ -440,13 +463,41 @@ void JointTrajectoryController::PreUpdate(
     return;
   }
 
+  // Adopt a newly received trajectory, if any. The pending flag is checked
+  // before taking the mutex, so iterations that just follow the current
+  // trajectory never block on the subscriber thread
+  if (this->dataPtr->hasPendingTrajectory)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->pendingTrajectoryMutex);
+      this->dataPtr->trajectory = std::move(this->dataPtr->pendingTrajectory);
+      this->dataPtr->hasPendingTrajectory = false;
+    }
+
+    // Resolve the trajectory's joint names once, so point switches don't
+    // repeat the by-name lookups
+    this->dataPtr->trajectoryJoints.clear();
+    for (const auto &jointName : this->dataPtr->trajectory.jointNames)
+    {
+      auto jointIt = this->dataPtr->actuatedJoints.find(jointName);
+      if (jointIt == this->dataPtr->actuatedJoints.end())
+      {
+        gzwarn << "[JointTrajectoryController] Joint [" << jointName
+                << "] of the received trajectory is not configured for this"
+                   " controller and will be ignored.\n";
+        this->dataPtr->trajectoryJoints.push_back(nullptr);
+      }
+      else
+      {
+        this->dataPtr->trajectoryJoints.push_back(&jointIt->second);
+      }
+    }
+  }
+
   // Update joint targets based on the current trajectory
   {
     auto isTargetUpdateRequired = false;
 
-    // Lock mutex before accessing trajectory
-    std::lock_guard<std::mutex> lock(this->dataPtr->trajectoryMutex);
-
     if (this->dataPtr->trajectory.status == Trajectory::New)
     {
       // Set trajectory start time if not set before
@@ -481,20 +532,19 @@ void JointTrajectoryController::PreUpdate(
     if (isTargetUpdateRequired &&
         this->dataPtr->trajectory.status != Trajectory::Reached)
     {
-      const auto targetPoint =
+      const auto &targetPoint =
           this->dataPtr->trajectory.points[this->dataPtr->trajectory
                                                .pointIndex];
       for (auto jointIndex = 0u;
-           jointIndex < this->dataPtr->trajectory.jointNames.size();
+           jointIndex < this->dataPtr->trajectoryJoints.size();
            ++jointIndex)
       {
-        const auto jointName = this->dataPtr->trajectory.jointNames[jointIndex];
-        if (this->dataPtr->actuatedJoints.count(jointName) == 0)
+        auto *joint = this->dataPtr->trajectoryJoints[jointIndex];
+        if (nullptr == joint)
         {
           // Warning about unconfigured joint is already logged above
           continue;
         }
-        auto *joint = &this->dataPtr->actuatedJoints[jointName];
         joint->SetTarget(targetPoint, jointIndex);
       }
 
@@ -510,6 +560,9 @@ void JointTrajectoryController::PreUpdate(
       progressMsg.set_data(this->dataPtr->trajectory.ComputeProgress());
       this->dataPtr->progressPub.Publish(progressMsg);
     }
+
+    this->dataPtr->trajectoryActive =
+        this->dataPtr->trajectory.status == Trajectory::Active;
   }
 
   // Control loop
@@ -648,15 +701,18 @@ void JointTrajectoryControllerPrivate::JointTrajectoryCallback(
                " acceleration commands, which are currently ignored.\n";
   }
 
-  // Lock mutex guarding the trajectory
-  std::lock_guard<std::mutex> lock(this->trajectoryMutex);
-
-  if (this->trajectory.status != Trajectory::Reached)
+  if (this->trajectoryActive)
   {
     gzwarn << "[JointTrajectoryController] A new JointTrajectory message was"
                " received while executing a previous trajectory.\n";
   }
 
+  // Build the new trajectory locally and hand it over in a single swap, so
+  // the update loop never waits on message processing
+  Trajectory newTrajectory;
+  newTrajectory.Reset();
+  newTrajectory.startTime = std::chrono::nanoseconds(0);
+
   // Get start time of the trajectory from message header if desired
   // If not enabled or there is no header, set start time to 0 and determine
   // it later from simTime
@@ -665,26 +721,30 @@ void JointTrajectoryControllerPrivate::JointTrajectoryCallback(
     if (_msg.header().has_stamp())
     {
       const auto stamp = _msg.header().stamp();
-      this->trajectory.startTime = std::chrono::seconds(stamp.sec()) +
-                                   std::chrono::nanoseconds(stamp.nsec());
+      newTrajectory.startTime = std::chrono::seconds(stamp.sec()) +
+                                std::chrono::nanoseconds(stamp.nsec());
     }
   }
   else
   {
-    this->trajectory.startTime = std::chrono::nanoseconds(0);
+    newTrajectory.startTime = std::chrono::nanoseconds(0);
   }
 
-  // Reset for a new trajectory
-  this->trajectory.Reset();
-
   // Extract joint names and points
   for (const auto &joint_name : _msg.joint_names())
   {
-    this->trajectory.jointNames.push_back(joint_name);
+    newTrajectory.jointNames.push_back(joint_name);
   }
   for (const auto &point : _msg.points())
   {
-    this->trajectory.points.push_back(point);
+    newTrajectory.points.push_back(point);
+  }
+
+  // Publish the trajectory to the update loop
+  {
+    std::lock_guard<std::mutex> lock(this->pendingTrajectoryMutex);
+    this->pendingTrajectory = std::move(newTrajectory);
+    this->hasPendingTrajectory = true;
   }
 }
 
@@ -702,6 +762,8 @@ void JointTrajectoryControllerPrivate::Reset()
 
   // Reset trajectory
   this->trajectory.Reset();
+  this->trajectoryJoints.clear();
+  this->trajectoryActive = false;
 }
 
 ///////////////////////
@@ -28,6 +28,7 @@
 
 #include <gz/msgs/double.pb.h>
 
+#include <optional>
 #include <string>
 
 #include <gz/sim/components/AngularVelocity.hh>
@@ -59,6 +60,10 @@ class gz::sim::systems::KineticEnergyMonitorPrivate
   /// \brief Link of the model.
   public: Entity linkEntity;
 
+  /// \brief The link this plugin monitors. Kept as a member so its
+  /// component cache persists across steps.
+  public: Link link{kNullEntity};
+
   /// \brief Name of the model this plugin is attached to.
   public: std::string modelName;
 
@@ -138,8 +143,8 @@ void KineticEnergyMonitor::Configure(const Entity &_entity,
   transport::Node node;
   this->dataPtr->pub = node.Advertise<msgs::Double>(topic);
 
-  Link link(this->dataPtr->linkEntity);
-  link.EnableVelocityChecks(_ecm, true);
+  this->dataPtr->link = Link(this->dataPtr->linkEntity);
+  this->dataPtr->link.EnableVelocityChecks(_ecm, true);
 
   // Create a default inertia in case the link doesn't have it
   enableComponent<components::Inertial>(_ecm, this->dataPtr->linkEntity, true);
@@ -156,10 +161,25 @@ void KineticEnergyMonitor::PostUpdate(const UpdateInfo &_info,
 
   if (this->dataPtr->linkEntity != kNullEntity)
   {
-    Link link(this->dataPtr->linkEntity);
-    if (std::nullopt != link.WorldKineticEnergy(_ecm))
+    // Dormancy gate: a link at rest this step with no energy left to lose
+    // cannot cross the threshold, so skip the inertia math. The velocities
+    // are read from the current step, so a link that wakes up is processed
+    // on the same step it starts moving.
+    if (this->dataPtr->prevKineticEnergy == 0.0)
+    {
+      auto worldAngVel = this->dataPtr->link.WorldAngularVelocity(_ecm);
+      auto worldLinVel = this->dataPtr->link.WorldLinearVelocity(_ecm);
+      if (worldAngVel && worldLinVel &&
+          *worldAngVel == math::Vector3d::Zero &&
+          *worldLinVel == math::Vector3d::Zero)
+        return;
+    }
+
+    std::optional<double> kineticEnergy =
+        this->dataPtr->link.WorldKineticEnergy(_ecm);
+    if (std::nullopt != kineticEnergy)
     {
-      double currKineticEnergy = *link.WorldKineticEnergy(_ecm);
+      double currKineticEnergy = *kineticEnergy;
 
       // We only care about positive values of this (the links looses energy)
       double deltaKE = this->dataPtr->prevKineticEnergy - currKineticEnergy;
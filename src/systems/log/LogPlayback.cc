@@ -29,6 +29,7 @@
 #include <gz/math/Pose3.hh>
 #include <gz/msgs/Utility.hh>
 #include <gz/plugin/RegisterMore.hh>
+#include <gz/transport/TopicUtils.hh>
 #include <gz/transport/log/QueryOptions.hh>
 #include <gz/transport/log/Log.hh>
 #include <gz/transport/log/Message.hh>
@@ -43,6 +44,7 @@
 #include "gz/sim/components/Geometry.hh"
 #include "gz/sim/components/LogPlaybackStatistics.hh"
 #include "gz/sim/components/Material.hh"
+#include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParticleEmitter.hh"
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/World.hh"
@@ -85,9 +87,36 @@ class gz::sim::systems::LogPlaybackPrivate
   public: void Parse(EntityComponentManager &_ecm,
       const msgs::SerializedStateMap &_msg);
 
+  /// \brief Restore the newest keyframe recorded within the given span.
+  /// \param[in] _ecm Mutable ECM.
+  /// \param[in] _from Start of the span to search.
+  /// \param[in] _to End of the span to search.
+  /// \param[in, out] _entitiesToRemove Set of current entities; the ones
+  /// present in the keyframe are erased from it, leaving the entities
+  /// that were created after the keyframe.
+  /// \param[out] _restoredTime Time of the restored keyframe.
+  /// \return True if a keyframe was found and applied.
+  public: bool RestoreKeyframe(EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_from,
+      const std::chrono::steady_clock::duration &_to,
+      std::set<Entity> &_entitiesToRemove,
+      std::chrono::steady_clock::duration &_restoredTime);
+
   /// \brief A batch of data from log file, of all pose messages
   public: transport::log::Batch batch;
 
+  /// \brief Cursor into the batch, kept across updates. Streaming one
+  /// query forward replaces the per-step ranged query, which re-ran the
+  /// database lookup every update.
+  public: transport::log::Batch::iterator batchIter;
+
+  /// \brief Reused message for parsing, so steady-state playback reuses
+  /// its allocations instead of building a fresh protobuf per message.
+  public: msgs::SerializedState parsedState;
+
+  /// \brief Reused message for parsing map states.
+  public: msgs::SerializedStateMap parsedStateMap;
+
   /// \brief Pointer to gz-transport Log
   public: std::unique_ptr<transport::log::Log> log;
 
@@ -115,6 +144,11 @@ class gz::sim::systems::LogPlaybackPrivate
 
   // \brief Saves which particle emitter emitting components have changed
   public: std::unordered_map<Entity, bool> prevParticleEmitterCmds;
+
+  /// \brief Topic the recorder used for full-state keyframes. Seeking
+  /// restores the nearest keyframe at or before the target time and
+  /// replays only the changed states after it.
+  public: std::string keyframeTopic;
 };
 
 bool LogPlaybackPrivate::started{false};
@@ -150,6 +184,39 @@ void LogPlaybackPrivate::Parse(EntityComponentManager &_ecm,
   _ecm.SetState(_msg);
 }
 
+//////////////////////////////////////////////////
+bool LogPlaybackPrivate::RestoreKeyframe(EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_from,
+    const std::chrono::steady_clock::duration &_to,
+    std::set<Entity> &_entitiesToRemove,
+    std::chrono::steady_clock::duration &_restoredTime)
+{
+  auto kfBatch = this->log->QueryMessages(
+      transport::log::TopicList(this->keyframeTopic, {_from, _to}));
+
+  std::string kfData;
+  std::chrono::steady_clock::duration kfTime{0};
+  for (auto kfIter = kfBatch.begin(); kfIter != kfBatch.end(); ++kfIter)
+  {
+    kfData = kfIter->Data();
+    kfTime = std::chrono::duration_cast<
+        std::chrono::steady_clock::duration>(kfIter->TimeReceived());
+  }
+
+  msgs::SerializedStateMap kfMsg;
+  if (kfData.empty() || !kfMsg.ParseFromString(kfData))
+    return false;
+
+  // Entities absent from the keyframe did not exist at its time and
+  // must go; the replay after it keeps adjusting the set.
+  for (const auto &entIt : kfMsg.entities())
+    _entitiesToRemove.erase(Entity(entIt.second.id()));
+
+  this->Parse(_ecm, kfMsg);
+  _restoredTime = kfTime;
+  return true;
+}
+
 //////////////////////////////////////////////////
 void LogPlayback::Configure(const Entity &,
     const std::shared_ptr<const sdf::Element> &_sdf,
@@ -239,27 +306,72 @@ bool LogPlaybackPrivate::Start(EntityComponentManager &_ecm)
     gzerr << "No messages found in log file [" << dbPath << "]" << std::endl;
   }
 
-  // Look for the first SerializedState message and use it to set the initial
-  // state of the world. Messages received before this are ignored.
-  for (; iter != this->batch.end(); ++iter)
+  auto worldEntity = _ecm.EntityByComponents(components::World());
+  if (kNullEntity == worldEntity)
   {
-    auto msgType = iter->Type();
-    if (msgType == "gz.msgs.SerializedState")
+    gzerr << "Missing world entity." << std::endl;
+    return false;
+  }
+
+  // Topic the recorder used for keyframes, if the log has any.
+  auto worldName = _ecm.Component<components::Name>(worldEntity)->Data();
+  this->keyframeTopic = transport::TopicUtils::AsValidTopic(
+      "/world/" + worldName + "/keyframe_state");
+
+  // Prefer the snapshot keyframe the recorder writes at log start: it
+  // restores the complete starting scene with a single SetState. Only a
+  // keyframe from the very beginning of the log qualifies, since a later
+  // one would skip over the changed states recorded before it. Logs
+  // recorded without keyframes fall back to scanning the mixed batch for
+  // the first state message.
+  bool initialStateRestored{false};
+  {
+    auto kfBatch = this->log->QueryMessages(
+        transport::log::TopicList(this->keyframeTopic));
+    auto kfIter = kfBatch.begin();
+    if (kfIter != kfBatch.end() &&
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        kfIter->TimeReceived()) <=
+        this->log->StartTime() + std::chrono::seconds(1))
     {
-      msgs::SerializedState msg;
-      msg.ParseFromString(iter->Data());
-      this->Parse(_ecm, msg);
-      break;
+      msgs::SerializedStateMap msg;
+      if (msg.ParseFromString(kfIter->Data()))
+      {
+        this->Parse(_ecm, msg);
+        initialStateRestored = true;
+      }
     }
-    else if (msgType == "gz.msgs.SerializedStateMap")
+  }
+
+  // Look for the first SerializedState message and use it to set the initial
+  // state of the world. Messages received before this are ignored.
+  if (!initialStateRestored)
+  {
+    for (; iter != this->batch.end(); ++iter)
     {
-      msgs::SerializedStateMap msg;
-      msg.ParseFromString(iter->Data());
-      this->Parse(_ecm, msg);
-      break;
+      auto msgType = iter->Type();
+      if (msgType == "gz.msgs.SerializedState")
+      {
+        msgs::SerializedState msg;
+        msg.ParseFromString(iter->Data());
+        this->Parse(_ecm, msg);
+        break;
+      }
+      else if (msgType == "gz.msgs.SerializedStateMap")
+      {
+        msgs::SerializedStateMap msg;
+        msg.ParseFromString(iter->Data());
+        this->Parse(_ecm, msg);
+        break;
+      }
     }
   }
 
+  // Re-open the full query and keep its cursor across updates; playback
+  // streams it forward instead of issuing one ranged query per step.
+  this->batch = this->log->QueryMessages();
+  this->batchIter = this->batch.begin();
+
   msgs::LogPlaybackStatistics logStats;
   auto startTime = convert<msgs::Time>(this->log->StartTime());
   auto endTime = convert<msgs::Time>(this->log->EndTime());
@@ -269,13 +381,6 @@ bool LogPlaybackPrivate::Start(EntityComponentManager &_ecm)
   logStats.mutable_end_time()->set_nsec(endTime.nsec());
   components::LogPlaybackStatistics newLogStatComp(logStats);
 
-  auto worldEntity = _ecm.EntityByComponents(components::World());
-  if (kNullEntity == worldEntity)
-  {
-    gzerr << "Missing world entity." << std::endl;
-    return false;
-  }
-
   auto currLogStatComp =
     _ecm.Component<components::LogPlaybackStatistics>(worldEntity);
 
@@ -483,14 +588,9 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
   std::set<Entity> entitiesToRemove;
   if (_info.dt < std::chrono::steady_clock::duration::zero())
   {
-    // Detected jumping back in time. This can be expensive.
-    // To rewind / seek backward in time, we also need to play every single
-    // step from the beginning so we don't miss insertions and deletions
-    // This is because each serialized state is a changed state and not an
-    // absolute state.
-    // todo(anyone) Record absolute states during recording, i.e. key frames,
-    // so that playback can jump to these states without the need to
-    // incrementally build the states from the beginning
+    // Detected jumping back in time. Each serialized state is a changed
+    // state and not an absolute state, so the state at the target time
+    // has to be rebuilt by replaying from a known absolute state.
 
     // Create a list of entities to be removed. The list will be updated later
     // as the log steps forward below
@@ -500,13 +600,58 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
       entitiesToRemove.insert(Entity(entity.first));
 
     startTime = std::chrono::steady_clock::duration::zero();
+
+    // Restore the nearest keyframe at or before the target time and
+    // replay only the changed states after it. Logs recorded without
+    // keyframes replay from the beginning as before.
+    std::chrono::steady_clock::duration kfTime{0};
+    if (!this->dataPtr->keyframeTopic.empty() &&
+        this->dataPtr->RestoreKeyframe(_ecm, startTime, endTime,
+        entitiesToRemove, kfTime))
+    {
+      startTime = kfTime;
+    }
+
+    // Seeking is the only case where the streaming cursor has to be
+    // re-positioned with a new query.
+    this->dataPtr->batch = this->dataPtr->log->QueryMessages(
+        transport::log::AllTopics(
+        transport::log::QualifiedTimeRange::From(startTime)));
+    this->dataPtr->batchIter = this->dataPtr->batch.begin();
   }
+  else if (!this->dataPtr->keyframeTopic.empty() &&
+      _info.dt > std::chrono::seconds(1))
+  {
+    // Detected a long jump forward (seek). If a keyframe lies inside the
+    // skipped span, restoring it is cheaper than replaying every changed
+    // state across the span, but entities removed in that span then need
+    // the same bookkeeping as a rewind.
+    const auto &entities = _ecm.Entities().Vertices();
+    for (const auto &entity : entities)
+      entitiesToRemove.insert(Entity(entity.first));
 
-  this->dataPtr->batch = this->dataPtr->log->QueryMessages(
-      transport::log::AllTopics({startTime, endTime}));
+    std::chrono::steady_clock::duration kfTime{0};
+    if (this->dataPtr->RestoreKeyframe(_ecm, startTime, endTime,
+        entitiesToRemove, kfTime))
+    {
+      seekRewind = true;
+      startTime = kfTime;
+
+      this->dataPtr->batch = this->dataPtr->log->QueryMessages(
+          transport::log::AllTopics(
+          transport::log::QualifiedTimeRange::From(startTime)));
+      this->dataPtr->batchIter = this->dataPtr->batch.begin();
+    }
+    else
+    {
+      // No keyframe in the span; replay it message by message as before.
+      entitiesToRemove.clear();
+    }
+  }
 
-  auto iter = this->dataPtr->batch.begin();
-  while (iter != this->dataPtr->batch.end())
+  auto &iter = this->dataPtr->batchIter;
+  while (iter != this->dataPtr->batch.end() &&
+      iter->TimeReceived() <= endTime)
   {
     auto msgType = iter->Type();
 
@@ -521,7 +666,7 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
 
     if (msgType == "gz.msgs.SerializedState")
     {
-      msgs::SerializedState msg;
+      auto &msg = this->dataPtr->parsedState;
       msg.ParseFromString(iter->Data());
 
       // For seeking back in time only:
@@ -547,7 +692,7 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
     }
     else if (msgType == "gz.msgs.SerializedStateMap")
     {
-      msgs::SerializedStateMap msg;
+      auto &msg = this->dataPtr->parsedStateMap;
       msg.ParseFromString(iter->Data());
 
       // For seeking back in time only:
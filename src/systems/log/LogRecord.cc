@@ -20,11 +20,16 @@
 #include <sys/stat.h>
 #include <gz/msgs/stringmsg.pb.h>
 
+#include <condition_variable>
 #include <string>
 #include <fstream>
 #include <ctime>
+#include <mutex>
 #include <set>
 #include <list>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -48,6 +53,7 @@
 #include <sdf/Visual.hh>
 #include <sdf/World.hh>
 
+#include "gz/sim/components/Factory.hh"
 #include "gz/sim/components/Geometry.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
@@ -64,6 +70,45 @@ using namespace gz;
 using namespace gz::sim;
 using namespace gz::sim::systems;
 
+namespace
+{
+/// \brief Minimal glob matcher supporting '*' and '?'.
+/// \param[in] _pattern Pattern to match against.
+/// \param[in] _text Text to match.
+/// \return True if the whole text matches the pattern.
+bool globMatch(const std::string &_pattern, const std::string &_text)
+{
+  size_t p = 0, t = 0;
+  size_t star = std::string::npos, mark = 0;
+  while (t < _text.size())
+  {
+    if (p < _pattern.size() &&
+        (_pattern[p] == '?' || _pattern[p] == _text[t]))
+    {
+      ++p;
+      ++t;
+    }
+    else if (p < _pattern.size() && _pattern[p] == '*')
+    {
+      star = p++;
+      mark = t;
+    }
+    else if (star != std::string::npos)
+    {
+      p = star + 1;
+      t = ++mark;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  while (p < _pattern.size() && _pattern[p] == '*')
+    ++p;
+  return p == _pattern.size();
+}
+}  // namespace
+
 // Private data class.
 class gz::sim::systems::LogRecordPrivate
 {
@@ -104,6 +149,27 @@ class gz::sim::systems::LogRecordPrivate
   /// \brief Compress model resource files and state file into one file.
   public: void CompressStateAndResources();
 
+  /// \brief Queue a state message for the recording thread to publish.
+  /// Blocks when the queue is full, so a slow recorder applies
+  /// backpressure to the step instead of silently dropping state.
+  /// \param[in] _msg State message, consumed by the queue.
+  /// \param[in] _keyframe True if the message is a full keyframe, which
+  /// goes out on the keyframe topic instead of the changed-state topic.
+  public: void QueueState(msgs::SerializedStateMap &_msg,
+      bool _keyframe = false);
+
+  /// \brief Worker loop publishing queued state messages. Publishing
+  /// serializes the message, so running it here keeps that cost off the
+  /// step; the recorder then writes on its own subscriber thread.
+  public: void RecordLoop();
+
+  /// \brief Recompute which entities match the entity filters. Each
+  /// entity's "::"-delimited scoped name is matched on its own, so a
+  /// pattern like "robot1*" selects a model along with everything
+  /// under it.
+  /// \param[in] _ecm Immutable reference to the ECM.
+  public: void RefreshEntityFilter(const EntityComponentManager &_ecm);
+
   /// \brief Indicator of whether any recorder instance has ever been started.
   /// Currently, only one instance is allowed. This enforcement may be removed
   /// in the future.
@@ -143,6 +209,11 @@ class gz::sim::systems::LogRecordPrivate
   /// \brief Publisher for state changes
   public: transport::Node::Publisher statePub;
 
+  /// \brief Publisher for periodic full-state keyframes. Playback can
+  /// seek by restoring the nearest keyframe and replaying only the
+  /// changed states after it, instead of replaying from the beginning.
+  public: transport::Node::Publisher keyframePub;
+
   /// \brief Message holding SDF string of world
   public: msgs::StringMsg sdfMsg;
 
@@ -163,6 +234,75 @@ class gz::sim::systems::LogRecordPrivate
 
   /// \brief Last time states are recorded
   public: std::chrono::steady_clock::duration lastRecordSimTime{0};
+
+  /// \brief Sim time period between full-state keyframes, zero to
+  /// disable them.
+  public: std::chrono::steady_clock::duration keyframePeriod{0};
+
+  /// \brief Last time a keyframe was recorded
+  public: std::chrono::steady_clock::duration lastKeyframeSimTime{0};
+
+  /// \brief True once the full-state snapshot at log start was recorded.
+  /// The snapshot is written on the first recorded update, independent of
+  /// the keyframe period, so playback can restore the complete starting
+  /// scene with a single state message instead of replaying the initial
+  /// messages sequentially.
+  public: bool startKeyframeRecorded{false};
+
+  /// \brief One queued message and the topic family it belongs to.
+  public: struct QueuedState
+  {
+    /// \brief The state message.
+    msgs::SerializedStateMap msg;
+
+    /// \brief True for full keyframes, false for changed states.
+    bool keyframe{false};
+  };
+
+  /// \brief Thread publishing queued state messages.
+  public: std::thread recordThread;
+
+  /// \brief Whether the recording thread should keep running.
+  public: bool recordRunning{false};
+
+  /// \brief State messages waiting to be published, oldest first.
+  public: std::list<QueuedState> stateQueue;
+
+  /// \brief Maximum number of queued state messages. Bounding the queue
+  /// also bounds how far the recorded time stamps can lag behind
+  /// capture when the recorder falls behind.
+  public: size_t maxQueueSize{128};
+
+  /// \brief Protects the state queue.
+  public: std::mutex queueMutex;
+
+  /// \brief Signals the queue changing in either direction.
+  public: std::condition_variable queueCv;
+
+  /// \brief Total state messages queued, for the end-of-run summary.
+  public: uint64_t queuedStates{0};
+
+  /// \brief Deepest the queue has been, a backpressure metric.
+  public: size_t peakQueueDepth{0};
+
+  /// \brief Times the step had to wait for the queue to drain, the
+  /// clearest sign that recording can't keep up.
+  public: uint64_t recordStalls{0};
+
+  /// \brief Scoped-name globs selecting which entities to record, from
+  /// <record_filter><entity>. Empty records all entities.
+  public: std::vector<std::string> entityFilters;
+
+  /// \brief Component types to record, from <record_filter><component>.
+  /// Empty records all types. Filtered components are never serialized
+  /// at all.
+  public: std::unordered_set<ComponentTypeId> componentFilter;
+
+  /// \brief Entities currently matching the entity filters.
+  public: std::unordered_set<Entity> filteredEntities;
+
+  /// \brief Whether filteredEntities reflects the current world.
+  public: bool entityFilterFresh{false};
 };
 
 bool LogRecordPrivate::started{false};
@@ -191,6 +331,21 @@ LogRecord::~LogRecord()
 {
   if (this->dataPtr->instStarted)
   {
+    // Drain and stop the recording thread before stopping the recorder.
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->queueMutex);
+      this->dataPtr->recordRunning = false;
+    }
+    this->dataPtr->queueCv.notify_all();
+    if (this->dataPtr->recordThread.joinable())
+      this->dataPtr->recordThread.join();
+
+    gzmsg << "Recorded " << this->dataPtr->queuedStates
+           << " state messages, peak queue depth "
+           << this->dataPtr->peakQueueDepth << ", stalled "
+           << this->dataPtr->recordStalls
+           << " times waiting for the recorder." << std::endl;
+
     // Use gz-transport directly
     this->dataPtr->recorder.Stop();
 
@@ -220,9 +375,62 @@ void LogRecord::Configure(const Entity &_entity,
     std::chrono::duration<double>(
     _sdf->Get<double>("record_period", 0.0).first));
 
+  this->dataPtr->keyframePeriod =
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<double>(
+    _sdf->Get<double>("keyframe_period", 60.0).first));
+
   this->dataPtr->compress = _sdf->Get<bool>("compress", false).first;
   this->dataPtr->cmpPath = _sdf->Get<std::string>("compress_path", "").first;
 
+  // Optional record filters: entity scoped-name globs and a component
+  // type allowlist, applied before serialization.
+  if (_sdf->HasElement("record_filter"))
+  {
+    auto ptr = const_cast<sdf::Element *>(_sdf.get());
+    sdf::ElementPtr filterElem = ptr->GetElement("record_filter");
+
+    if (filterElem->HasElement("entity"))
+    {
+      sdf::ElementPtr entityElem = filterElem->GetElement("entity");
+      while (entityElem)
+      {
+        this->dataPtr->entityFilters.push_back(
+            entityElem->Get<std::string>());
+        entityElem = entityElem->GetNextElement("entity");
+      }
+    }
+
+    if (filterElem->HasElement("component"))
+    {
+      sdf::ElementPtr compElem = filterElem->GetElement("component");
+      while (compElem)
+      {
+        auto compName = compElem->Get<std::string>();
+        ComponentTypeId compId = kComponentTypeIdInvalid;
+        for (const auto &[typeId, typeName] :
+            components::Factory::Instance()->namesById)
+        {
+          if (typeName == compName)
+          {
+            compId = typeId;
+            break;
+          }
+        }
+        if (compId != kComponentTypeIdInvalid)
+        {
+          this->dataPtr->componentFilter.insert(compId);
+        }
+        else
+        {
+          gzwarn << "Unknown component type [" << compName
+                  << "] in <record_filter>, ignoring." << std::endl;
+        }
+        compElem = compElem->GetNextElement("component");
+      }
+    }
+  }
+
   // If plugin is specified in both the SDF tag and on command line, only
   //   activate one recorder.
   if (!LogRecordPrivate::started)
@@ -320,6 +528,19 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
            << stateTopic << "]." << std::endl;
   }
 
+  std::string keyframeTopic = "/world/" + this->worldName + "/keyframe_state";
+  auto validKeyframeTopic = transport::TopicUtils::AsValidTopic(keyframeTopic);
+  if (!validKeyframeTopic.empty())
+  {
+    this->keyframePub = this->node.Advertise<msgs::SerializedStateMap>(
+        validKeyframeTopic);
+  }
+  else
+  {
+    gzerr << "Failed to generate valid topic to publish keyframes. Tried ["
+           << keyframeTopic << "]." << std::endl;
+  }
+
   // Append file name
   std::string dbPath = common::joinPaths(this->logPath, "state.tlog");
   if (common::exists(dbPath))
@@ -332,8 +553,10 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   // Add default topics if no topics were specified.
   gzdbg << "Recording default topic[" << sdfTopic << "].\n";
   gzdbg << "Recording default topic[" << stateTopic << "].\n";
+  gzdbg << "Recording default topic[" << keyframeTopic << "].\n";
   this->recorder.AddTopic(sdfTopic);
   this->recorder.AddTopic(stateTopic);
+  this->recorder.AddTopic(keyframeTopic);
 
   // Get the topics to record, if any.
   if (this->sdf->HasElement("record_topic"))
@@ -372,6 +595,9 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   if (this->recorder.Start(dbPath) ==
       transport::log::RecorderError::SUCCESS)
   {
+    this->recordRunning = true;
+    this->recordThread = std::thread(&LogRecordPrivate::RecordLoop, this);
+
     this->instStarted = true;
     return true;
   }
@@ -379,6 +605,81 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
     return false;
 }
 
+//////////////////////////////////////////////////
+void LogRecordPrivate::QueueState(msgs::SerializedStateMap &_msg,
+    bool _keyframe)
+{
+  std::unique_lock<std::mutex> lock(this->queueMutex);
+  if (this->stateQueue.size() >= this->maxQueueSize)
+  {
+    ++this->recordStalls;
+    this->queueCv.wait(lock, [this]
+        {
+          return this->stateQueue.size() < this->maxQueueSize ||
+              !this->recordRunning;
+        });
+  }
+
+  this->stateQueue.push_back({std::move(_msg), _keyframe});
+  ++this->queuedStates;
+  this->peakQueueDepth =
+      std::max(this->peakQueueDepth, this->stateQueue.size());
+  lock.unlock();
+  this->queueCv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::RecordLoop()
+{
+  while (true)
+  {
+    std::list<QueuedState> batch;
+    {
+      std::unique_lock<std::mutex> lock(this->queueMutex);
+      this->queueCv.wait(lock, [this]
+          {
+            return !this->stateQueue.empty() || !this->recordRunning;
+          });
+      if (this->stateQueue.empty() && !this->recordRunning)
+        return;
+
+      // Take everything that accumulated in one go, so a backlog drains
+      // in large batches instead of one lock round trip per message.
+      batch.splice(batch.end(), this->stateQueue);
+    }
+    this->queueCv.notify_all();
+
+    for (auto &queued : batch)
+    {
+      if (queued.keyframe)
+        this->keyframePub.Publish(queued.msg);
+      else
+        this->statePub.Publish(queued.msg);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::RefreshEntityFilter(const EntityComponentManager &_ecm)
+{
+  this->filteredEntities.clear();
+  _ecm.Each<components::Name>(
+      [&](const Entity &_entity, const components::Name *) -> bool
+      {
+        auto name = scopedName(_entity, _ecm, "::", false);
+        for (const auto &pattern : this->entityFilters)
+        {
+          if (globMatch(pattern, name))
+          {
+            this->filteredEntities.insert(_entity);
+            break;
+          }
+        }
+        return true;
+      });
+  this->entityFilterFresh = true;
+}
+
 //////////////////////////////////////////////////
 bool LogRecordPrivate::RecordResources() const
 {
@@ -716,18 +1017,61 @@ void LogRecord::PostUpdate(const UpdateInfo &_info,
     }
   }
 
+  // Keep the entity filter in sync with the world.
+  const bool haveFilters = !this->dataPtr->entityFilters.empty() ||
+      !this->dataPtr->componentFilter.empty();
+  if (!this->dataPtr->entityFilters.empty() &&
+      (!this->dataPtr->entityFilterFresh || _ecm.HasNewEntities() ||
+      _ecm.HasEntitiesMarkedForRemoval()))
+  {
+    this->dataPtr->RefreshEntityFilter(_ecm);
+  }
+
+  // When entity filters are set but match nothing, there is nothing to
+  // record; an empty entity set would mean "all entities" below.
+  const bool filtersSelectNothing = !this->dataPtr->entityFilters.empty() &&
+      this->dataPtr->filteredEntities.empty();
+
   // TODO(louise) Use the SceneBroadcaster's topic once that publishes
   // the changed state
-  // \todo(anyone) A potential enhancement here is have a keyframe mechanism
-  // to store complete state periodically, and then store incremental from
-  // that. It would reduce some of the compute on replaying
-  // (especially in tools like plotting or seeking through logs).
-  if (record)
+  if (record && !filtersSelectNothing)
   {
     msgs::SerializedStateMap stateMsg;
-    _ecm.ChangedState(stateMsg);
+    if (haveFilters)
+    {
+      // Filters are applied at serialization, so excluded entities and
+      // components are never serialized at all.
+      _ecm.State(stateMsg, this->dataPtr->filteredEntities,
+          this->dataPtr->componentFilter, false);
+    }
+    else
+    {
+      _ecm.ChangedState(stateMsg);
+    }
     if (!stateMsg.entities().empty())
-      this->dataPtr->statePub.Publish(stateMsg);
+      this->dataPtr->QueueState(stateMsg);
+  }
+
+  // Periodically record the complete state as a keyframe, so playback
+  // can seek by restoring it and replaying only the changed states
+  // after it instead of starting from the beginning. Keyframes cover
+  // the same filtered universe as the deltas. The first keyframe goes
+  // out immediately as the ready-to-apply snapshot of the log's starting
+  // scene.
+  if (!filtersSelectNothing &&
+      (!this->dataPtr->startKeyframeRecorded ||
+      (this->dataPtr->keyframePeriod >
+      std::chrono::steady_clock::duration::zero() &&
+      (_info.simTime - this->dataPtr->lastKeyframeSimTime) >=
+      this->dataPtr->keyframePeriod)))
+  {
+    this->dataPtr->startKeyframeRecorded = true;
+    this->dataPtr->lastKeyframeSimTime = _info.simTime;
+
+    msgs::SerializedStateMap keyframeMsg;
+    _ecm.State(keyframeMsg, this->dataPtr->filteredEntities,
+        this->dataPtr->componentFilter, true);
+    this->dataPtr->QueueState(keyframeMsg, true);
   }
 
   // If there are new models loaded, save meshes and textures
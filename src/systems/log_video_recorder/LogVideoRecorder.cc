@@ -50,6 +50,11 @@ class gz::sim::systems::LogVideoRecorderPrivate
   /// \brief Rewind the log
   public: void Rewind();
 
+  /// \brief Seek log playback to the configured start time, so each
+  /// recording pass skips the span before <start_time> instead of
+  /// replaying it in real time.
+  public: void SeekToStart();
+
   /// \brief Play the log
   public: void Play();
 
@@ -100,6 +105,10 @@ class gz::sim::systems::LogVideoRecorderPrivate
   /// \brief Request to stop video recording
   public: bool recordStopRequested{false};
 
+  /// \brief Whether a seek to <start_time> has been requested for the
+  /// current recording pass. Reset after every rewind.
+  public: bool seekToStartRequested{false};
+
   /// \brief Time when video recording stop request is made
   public: std::chrono::time_point<std::chrono::system_clock> recordStopTime;
 
@@ -131,6 +140,14 @@ class gz::sim::systems::LogVideoRecorderPrivate
   /// \brief Sim time to stop recording
   public: std::chrono::steady_clock::duration endTime;
 
+  /// \brief Wall-clock time to let playback and the GUI come up before
+  /// driving them
+  public: std::chrono::milliseconds warmupTime{5000};
+
+  /// \brief Wall-clock time to wait for the video encoder to finalize
+  /// the file after a stop request
+  public: std::chrono::milliseconds encoderFinalizeTime{5000};
+
   /// \brief Auto exit when log playback recording ends
   public: bool exitOnFinish = false;
 };
@@ -217,6 +234,20 @@ void LogVideoRecorder::Configure(
     }
   }
 
+  if (_sdf->HasElement("warmup_time"))
+  {
+    auto t = ptr->Get<double>("warmup_time");
+    this->dataPtr->warmupTime =
+        std::chrono::milliseconds(static_cast<int64_t>(t * 1000.0));
+  }
+
+  if (_sdf->HasElement("encoder_finalize_time"))
+  {
+    auto t = ptr->Get<double>("encoder_finalize_time");
+    this->dataPtr->encoderFinalizeTime =
+        std::chrono::milliseconds(static_cast<int64_t>(t * 1000.0));
+  }
+
   if (_sdf->HasElement("exit_on_finish"))
   {
     this->dataPtr->exitOnFinish = ptr->Get<bool>("exit_on_finish");
@@ -259,7 +290,7 @@ void LogVideoRecorder::PostUpdate(const UpdateInfo &_info,
   // play for a few seconds before doing anything
   std::chrono::time_point<std::chrono::system_clock> t =
       std::chrono::system_clock::now();
-  if (t - this->dataPtr->loadTime < std::chrono::seconds(5))
+  if (t - this->dataPtr->loadTime < this->dataPtr->warmupTime)
     return;
 
   // start sim
@@ -269,6 +300,7 @@ void LogVideoRecorder::PostUpdate(const UpdateInfo &_info,
       this->dataPtr->Play();
 
     this->dataPtr->rewindRequested = false;
+    this->dataPtr->seekToStartRequested = false;
     return;
   }
   else if (this->dataPtr->rewindRequested)
@@ -277,9 +309,15 @@ void LogVideoRecorder::PostUpdate(const UpdateInfo &_info,
   }
 
   // do not start recording until start time is reached.
-  // todo(anyone) use seek to fast forward to start time?
+  // Seek there so the span before <start_time> is not replayed in real
+  // time; playback restores the nearest recorded keyframe instead.
   if (_info.simTime < this->dataPtr->startTime)
   {
+    if (!this->dataPtr->seekToStartRequested)
+    {
+      this->dataPtr->SeekToStart();
+      return;
+    }
     if (_info.paused)
     {
       gzdbg << "Warning: Playback is either manually paused or <start_time> "
@@ -295,7 +333,8 @@ void LogVideoRecorder::PostUpdate(const UpdateInfo &_info,
     // give it some time for video encording to write the finalize encoding
     std::chrono::time_point<std::chrono::system_clock> now =
       std::chrono::system_clock::now();
-    if (now - this->dataPtr->recordStopTime < std::chrono::seconds(5))
+    if (now - this->dataPtr->recordStopTime <
+        this->dataPtr->encoderFinalizeTime)
       return;
 
     if (common::exists(this->dataPtr->tmpVideoFilename))
@@ -389,6 +428,28 @@ void LogVideoRecorderPrivate::Rewind()
   }
 }
 
+//////////////////////////////////////////////////
+void LogVideoRecorderPrivate::SeekToStart()
+{
+  std::function<void(const msgs::Boolean &, const bool)> cb =
+      [](const msgs::Boolean &/*_rep*/, const bool _result)
+  {
+    if (!_result)
+      gzerr << "Error sending seek request" << std::endl;
+  };
+
+  auto time = convert<msgs::Time>(this->startTime);
+
+  msgs::LogPlaybackControl req;
+  req.mutable_seek()->set_sec(time.sec());
+  req.mutable_seek()->set_nsec(time.nsec());
+  if (this->node.Request(this->playbackControlService, req, cb))
+  {
+    gzdbg << "Seek playback to start time" << std::endl;
+    this->seekToStartRequested = true;
+  }
+}
+
 //////////////////////////////////////////////////
 void LogVideoRecorderPrivate::Play()
 {
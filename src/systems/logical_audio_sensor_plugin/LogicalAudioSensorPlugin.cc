@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/double.pb.h>
@@ -206,6 +207,9 @@ void LogicalAudioSensorPlugin::PreUpdate(const UpdateInfo &_info,
 void LogicalAudioSensorPlugin::PostUpdate(const UpdateInfo &_info,
                 const EntityComponentManager &_ecm)
 {
+  if (this->dataPtr->micEntities.empty())
+    return;
+
   // get the current sim time so that it can be placed in the header
   // of microphone detection messages
   const auto simSeconds =
@@ -214,48 +218,94 @@ void LogicalAudioSensorPlugin::PostUpdate(const UpdateInfo &_info,
     std::chrono::duration_cast<std::chrono::nanoseconds>(_info.simTime);
   const auto nanosecondOffset = (simNanoseconds - simSeconds).count();
 
+  // Snapshot the playing sources once so that their world poses, attenuation
+  // parameters and scoped names are not re-derived for every microphone.
+  struct SourceSnapshot
+  {
+    /// \brief The source entity.
+    Entity entity;
+
+    /// \brief The source's attenuation and volume properties.
+    const logical_audio::Source *source;
+
+    /// \brief The source's world pose.
+    math::Pose3d pose;
+
+    /// \brief Squared falloff distance, used to prune microphones that are
+    /// out of the source's audible range.
+    double falloffDistSquared;
+
+    /// \brief The source's scoped name, resolved on first detection.
+    std::string name;
+  };
+  std::vector<SourceSnapshot> playingSources;
+  _ecm.Each<components::LogicalAudioSource,
+            components::LogicalAudioSourcePlayInfo>(
+    [&](const Entity &_entity,
+        const components::LogicalAudioSource *_source,
+        const components::LogicalAudioSourcePlayInfo *_playInfo)
+    {
+      // sources that aren't playing can't be detected by any microphone
+      if (!_playInfo->Data().playing)
+        return true;
+
+      SourceSnapshot snapshot;
+      snapshot.entity = _entity;
+      snapshot.source = &_source->Data();
+      snapshot.pose = worldPose(_entity, _ecm);
+      snapshot.falloffDistSquared = _source->Data().falloffDistance *
+          _source->Data().falloffDistance;
+      playingSources.push_back(std::move(snapshot));
+      return true;
+    });
+
+  if (playingSources.empty())
+    return;
+
   for (auto & [micEntity, detectionPub] : this->dataPtr->micEntities)
   {
     const auto micPose = worldPose(micEntity, _ecm);
-    const auto micInfo = _ecm.Component<components::LogicalMicrophone>(
+    const auto &micInfo = _ecm.Component<components::LogicalMicrophone>(
         micEntity)->Data();
 
-    _ecm.Each<components::LogicalAudioSource,
-              components::LogicalAudioSourcePlayInfo>(
-      [&, &publisher = detectionPub](const Entity &_entity,
-          const components::LogicalAudioSource *_source,
-          const components::LogicalAudioSourcePlayInfo *_playInfo)
+    for (auto &snapshot : playingSources)
+    {
+      // beyond the falloff distance the attenuated volume is always zero,
+      // so skip the attenuation math for out-of-range pairs
+      if ((micPose.Pos() - snapshot.pose.Pos()).SquaredLength() >=
+          snapshot.falloffDistSquared)
+        continue;
+
+      const auto vol = logical_audio::computeVolume(
+          true,
+          snapshot.source->attFunc,
+          snapshot.source->attShape,
+          snapshot.source->emissionVolume,
+          snapshot.source->innerRadius,
+          snapshot.source->falloffDistance,
+          snapshot.pose,
+          micPose);
+
+      if (logical_audio::detect(vol, micInfo.volumeDetectionThreshold))
       {
-        const auto sourcePose = worldPose(_entity, _ecm);
-        const auto vol = logical_audio::computeVolume(
-            _playInfo->Data().playing,
-            _source->Data().attFunc,
-            _source->Data().attShape,
-            _source->Data().emissionVolume,
-            _source->Data().innerRadius,
-            _source->Data().falloffDistance,
-            sourcePose,
-            micPose);
-
-        if (logical_audio::detect(vol, micInfo.volumeDetectionThreshold))
-        {
-          // publish the source that the microphone heard, along with the
-          // volume level the microphone detected. The detected source's
-          // ID is embedded in the message's header
-          msgs::Double msg;
-          auto header = msg.mutable_header();
-          auto timeStamp = header->mutable_stamp();
-          timeStamp->set_sec(simSeconds.count());
-          timeStamp->set_nsec(nanosecondOffset);
-          auto headerData = header->add_data();
-          headerData->set_key(scopedName(_entity, _ecm));
-          msg.set_data(vol);
-
-          publisher.Publish(msg);
-        }
-
-        return true;
-      });
+        if (snapshot.name.empty())
+          snapshot.name = scopedName(snapshot.entity, _ecm);
+
+        // publish the source that the microphone heard, along with the
+        // volume level the microphone detected. The detected source's
+        // ID is embedded in the message's header
+        msgs::Double msg;
+        auto header = msg.mutable_header();
+        auto timeStamp = header->mutable_stamp();
+        timeStamp->set_sec(simSeconds.count());
+        timeStamp->set_nsec(nanosecondOffset);
+        auto headerData = header->add_data();
+        headerData->set_key(snapshot.name);
+        msg.set_data(vol);
+
+        detectionPub.Publish(msg);
+      }
+    }
   }
 }
 
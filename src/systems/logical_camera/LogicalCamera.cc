@@ -91,6 +91,17 @@ class gz::sim::systems::LogicalCameraPrivate
   /// from simulation.
   /// \param[in] _ecm Immutable reference to ECM.
   public: void RemoveLogicalCameraEntities(const EntityComponentManager &_ecm);
+
+  /// \brief Cached model poses handed to the sensors. Updated
+  /// incrementally so unchanged entries aren't rewritten every step, and
+  /// only copied into the sensors when something actually changed.
+  public: std::map<std::string, math::Pose3d> modelPoses;
+
+  /// \brief True when the cached poses may be out of date because an
+  /// update step was skipped, which also discards that step's component
+  /// change flags. The next update then compares values instead of
+  /// trusting the flags.
+  public: bool modelPosesStale{true};
 };
 
 //////////////////////////////////////////////////
@@ -160,7 +171,10 @@ void LogicalCamera::PostUpdate(const UpdateInfo &_info,
       }
     }
     if (!needsUpdate)
+    {
+      this->dataPtr->modelPosesStale = true;
       return;
+    }
 
     this->dataPtr->UpdateLogicalCameras(_ecm);
 
@@ -253,20 +267,54 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("LogicalCameraPrivate::UpdateLogicalCameras");
-  std::map<std::string, math::Pose3d> modelPoses;
+
+  // Refresh the cached model poses incrementally: only entries whose pose
+  // changed this step are rewritten.
+  bool modelPosesChanged = false;
+  const bool forceRefresh = this->modelPosesStale;
+  this->modelPosesStale = false;
 
   _ecm.Each<components::Model, components::Name, components::Pose>(
-      [&](const Entity &,
+      [&](const Entity &_entity,
         const components::Model *,
         const components::Name *_name,
         const components::Pose *_pose)->bool
       {
         /// todo(anyone) We currently assume there are only top level models
         /// Update to retrieve world pose when nested models are supported.
-        modelPoses[_name->Data()] = _pose->Data();
+        auto poseIt = this->modelPoses.find(_name->Data());
+        if (poseIt == this->modelPoses.end())
+        {
+          this->modelPoses[_name->Data()] = _pose->Data();
+          modelPosesChanged = true;
+        }
+        else if (forceRefresh ||
+            _ecm.ComponentState(_entity, components::Pose::typeId) !=
+            ComponentState::NoChange)
+        {
+          if (poseIt->second != _pose->Data())
+          {
+            poseIt->second = _pose->Data();
+            modelPosesChanged = true;
+          }
+        }
+        return true;
+      });
+
+  _ecm.EachRemoved<components::Model>(
+      [&](const Entity &_entity, const components::Model *)->bool
+      {
+        auto nameComp = _ecm.Component<components::Name>(_entity);
+        if (nameComp && this->modelPoses.erase(nameComp->Data()) > 0)
+        {
+          modelPosesChanged = true;
+        }
         return true;
       });
 
+  // Sensors created this step don't have any model poses yet.
+  if (!this->newSensors.empty())
+    modelPosesChanged = true;
 
   _ecm.Each<components::LogicalCamera, components::WorldPose>(
     [&](const Entity &_entity,
@@ -278,9 +326,15 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
         {
           const math::Pose3d &worldPose = _worldPose->Data();
           it->second->SetPose(worldPose);
-          // Make a copy of modelPoses s.t. SetModelPoses can take ownership
-          auto modelPoses_ = modelPoses;
-          it->second->SetModelPoses(std::move(modelPoses_));
+          // The sensors keep the poses they were last given, so the copy
+          // is only needed when something changed.
+          if (modelPosesChanged)
+          {
+            // Make a copy of modelPoses s.t. SetModelPoses can take
+            // ownership
+            auto modelPoses_ = this->modelPoses;
+            it->second->SetModelPoses(std::move(modelPoses_));
+          }
         }
         else
         {
@@ -17,6 +17,7 @@
 
 #include "Magnetometer.hh"
 
+#include <cmath>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +40,7 @@
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/Sensor.hh"
+#include "gz/sim/components/SphericalCoordinates.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/Util.hh"
@@ -131,6 +133,13 @@ class gz::sim::systems::MagnetometerPrivate
   /// `PreUpdate`.
   public: std::unordered_set<Entity> newSensors;
 
+  /// \brief Last spherical position (lat/lon/elevation, degrees and
+  /// meters) and the world magnetic field computed for it, per sensor.
+  /// Lets Update skip the declination/inclination/strength table lookups
+  /// and trigonometry while a sensor stays in the same neighborhood.
+  public: std::unordered_map<Entity,
+      std::pair<math::Vector3d, math::Vector3d>> fieldCache;
+
   /// True if the rendering component is initialized
   public: bool initialized = false;
 
@@ -413,6 +422,19 @@ void MagnetometerPrivate::Update(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("MagnetometerPrivate::Update");
+
+  // The spherical coordinates are a world property: look them up once
+  // instead of once per sensor inside the loop below.
+  auto worldEntity = _ecm.EntityByComponents(components::World());
+  auto sphericalCoordinatesComp =
+      _ecm.Component<components::SphericalCoordinates>(worldEntity);
+
+  // Movement below this threshold, in degrees of latitude/longitude
+  // (roughly 100 m), has no measurable effect on the interpolated
+  // geomagnetic field, which is tabulated at a 10 degree resolution. The
+  // cached field is reused in that case.
+  constexpr double updateThreshold = 1e-3;
+
   _ecm.Each<components::Magnetometer,
             components::WorldPose>(
     [&](const Entity &_entity,
@@ -426,30 +448,47 @@ void MagnetometerPrivate::Update(
           const math::Pose3d &magnetometerWorldPose = _worldPose->Data();
           it->second->SetWorldPose(magnetometerWorldPose);
 
-          // Position
-          auto latLonEle = sphericalCoordinates(_entity, _ecm);
-          if (!latLonEle)
+          if (nullptr == sphericalCoordinatesComp)
+          {
+            gzwarn << "Failed to update magnetometer sensor enity ["
+                    << _entity << "]. Spherical coordinates not set."
+                    << std::endl;
+            return true;
+          }
+
+          // Position. Use the physics-maintained world pose rather than
+          // recomputing it from the pose hierarchy.
+          auto rad = sphericalCoordinatesComp->Data().PositionTransform(
+              magnetometerWorldPose.Pos(),
+              math::SphericalCoordinates::LOCAL2,
+              math::SphericalCoordinates::SPHERICAL);
+          math::Vector3d latLonEle(
+              GZ_RTOD(rad.X()), GZ_RTOD(rad.Y()), rad.Z());
+
+          // Reuse the cached field if the sensor hasn't moved enough for
+          // the field to change.
+          auto cached = this->fieldCache.find(_entity);
+          if (cached != this->fieldCache.end() &&
+              std::fabs(cached->second.first.X() - latLonEle.X()) <
+                  updateThreshold &&
+              std::fabs(cached->second.first.Y() - latLonEle.Y()) <
+                  updateThreshold)
           {
-            gzwarn << "Failed to update NavSat sensor enity [" << _entity
-                    << "]. Spherical coordinates not set." << std::endl;
+            it->second->SetWorldMagneticField(cached->second.second);
             return true;
           }
 
-          auto lat_rad = GZ_DTOR(latLonEle.value().X());
-          auto lon_rad = GZ_DTOR(latLonEle.value().Y());
+          float lat_deg = static_cast<float>(latLonEle.X());
+          float lon_deg = static_cast<float>(latLonEle.Y());
 
           // Magnetic declination and inclination (radians)
           float declination_rad =
-            get_mag_declination(
-              lat_rad * 180 / GZ_PI, lon_rad * 180 / GZ_PI) * GZ_PI / 180;
+            get_mag_declination(lat_deg, lon_deg) * GZ_PI / 180;
           float inclination_rad =
-            get_mag_inclination(
-              lat_rad * 180 / GZ_PI, lon_rad * 180 / GZ_PI) * GZ_PI / 180;
+            get_mag_inclination(lat_deg, lon_deg) * GZ_PI / 180;
 
           // Magnetic strength (10^5xnanoTesla)
-          float strength_ga =
-            0.01f *
-            get_mag_strength(lat_rad * 180 / GZ_PI, lon_rad * 180 / GZ_PI);
+          float strength_ga = 0.01f * get_mag_strength(lat_deg, lon_deg);
 
           // Magnetic filed components are calculated by http://geomag.nrcan.gc.ca/mag_fld/comp-en.php
           float H = strength_ga * cosf(inclination_rad);
@@ -458,6 +497,8 @@ void MagnetometerPrivate::Update(
           float Y = H * sinf(declination_rad);
 
           math::Vector3d magnetic_field_I(X, Y, Z);
+          this->fieldCache[_entity] =
+              std::make_pair(latLonEle, magnetic_field_I);
           it->second->SetWorldMagneticField(magnetic_field_I);
         }
         else
@@ -488,6 +529,7 @@ void MagnetometerPrivate::RemoveMagnetometerEntities(
         }
 
         this->entitySensorMap.erase(sensorId);
+        this->fieldCache.erase(_entity);
 
         return true;
       });
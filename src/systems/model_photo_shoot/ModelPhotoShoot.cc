@@ -16,8 +16,10 @@
  */
 #include "ModelPhotoShoot.hh"
 
+#include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gz/common/Image.hh>
@@ -45,13 +47,16 @@ using namespace systems;
 /// \brief Private ModelPhotoShoot data class.
 class gz::sim::systems::ModelPhotoShootPrivate
 {
+  /// \brief Destructor. Waits for the pending image saves to finish.
+  public: ~ModelPhotoShootPrivate();
+
   /// \brief Callback for pos rendering operations.
   public: void PerformPostRenderingOperations();
 
   /// \brief Save a pitcture with the camera from the given pose.
   public: void SavePicture (const gz::rendering::CameraPtr _camera,
                     const gz::math::Pose3d &_pose,
-                    const std::string &_fileName) const;
+                    const std::string &_fileName);
 
   /// \brief Name of the loaded model.
   public: std::string modelName;
@@ -73,8 +78,25 @@ class gz::sim::systems::ModelPhotoShootPrivate
 
   /// \brief File to save translation and scaling info.
   public: std::ofstream savingFile;
+
+  /// \brief Capture buffer reused across the views.
+  public: gz::rendering::Image cameraImage;
+
+  /// \brief Threads writing the captured images to disk, so PNG encoding
+  /// does not block the rendering thread.
+  public: std::vector<std::thread> saveThreads;
 };
 
+//////////////////////////////////////////////////
+ModelPhotoShootPrivate::~ModelPhotoShootPrivate()
+{
+  for (auto &thread : this->saveThreads)
+  {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
 //////////////////////////////////////////////////
 ModelPhotoShoot::ModelPhotoShoot()
     : System(), dataPtr(std::make_unique<ModelPhotoShootPrivate>())
@@ -282,28 +304,51 @@ void ModelPhotoShootPrivate::PerformPostRenderingOperations()
       }
     }
   }
+
+  // All views are captured; wait for the image writers, which ran
+  // overlapped with the captures, and stop receiving render events.
+  if (!this->takePicture)
+  {
+    for (auto &thread : this->saveThreads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+    this->saveThreads.clear();
+    this->connection.reset();
+  }
 }
 
 //////////////////////////////////////////////////
 void ModelPhotoShootPrivate::SavePicture(
                                   const gz::rendering::CameraPtr _camera,
                                   const gz::math::Pose3d &_pose,
-                                  const std::string &_fileName) const
+                                  const std::string &_fileName)
 {
   unsigned int width = _camera->ImageWidth();
   unsigned int height = _camera->ImageHeight();
-  gz::common::Image image;
 
   _camera->SetWorldPose(_pose);
-  auto cameraImage = _camera->CreateImage();
-  _camera->Capture(cameraImage);
+  if (this->cameraImage.Width() != width ||
+      this->cameraImage.Height() != height)
+  {
+    this->cameraImage = _camera->CreateImage();
+  }
+  _camera->Capture(this->cameraImage);
   auto formatStr =
       gz::rendering::PixelUtil::Name(_camera->ImageFormat());
   auto format = gz::common::Image::ConvertPixelFormat(formatStr);
-  image.SetFromData(cameraImage.Data<unsigned char>(), width, height, format);
-  image.SavePNG(_fileName);
 
-  gzdbg << "Saved image to [" << _fileName << "]" << std::endl;
+  // SetFromData copies the buffer, so the capture image can be reused for
+  // the next view while the file is written in the background.
+  auto image = std::make_shared<gz::common::Image>();
+  image->SetFromData(
+      this->cameraImage.Data<unsigned char>(), width, height, format);
+  this->saveThreads.emplace_back([image, _fileName]()
+      {
+        image->SavePNG(_fileName);
+        gzdbg << "Saved image to [" << _fileName << "]" << std::endl;
+      });
 }
 
 GZ_ADD_PLUGIN(ModelPhotoShoot, gz::sim::System,
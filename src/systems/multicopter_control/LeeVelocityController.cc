@@ -103,11 +103,13 @@ void LeeVelocityController::CalculateRotorVelocities(
   angularAccelerationThrust.block<3, 1>(0, 0) = angularAcceleration;
   angularAccelerationThrust(3) = thrust;
 
-  _rotorVelocities =
+  // noalias() evaluates the product straight into the caller's preallocated
+  // vector, and clamping against the scalar zero avoids the temporary zero
+  // vector; steady-state calls are free of heap allocations.
+  _rotorVelocities.noalias() =
       this->angularAccToRotorVelocities * angularAccelerationThrust;
 
-  _rotorVelocities =
-      _rotorVelocities.cwiseMax(Eigen::VectorXd::Zero(_rotorVelocities.rows()));
+  _rotorVelocities = _rotorVelocities.cwiseMax(0.0);
   _rotorVelocities = _rotorVelocities.cwiseSqrt();
 }
 
@@ -127,6 +127,11 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   /// \brief Apply link forces and moments based on propeller state.
   public: void UpdateForcesAndMoments(EntityComponentManager &_ecm);
 
+  /// \brief Re-resolve the cached component pointers below if the ECM's
+  /// structure changed since they were last resolved.
+  /// \param[in] _ecm Entity component manager to resolve against.
+  public: void UpdateCache(EntityComponentManager &_ecm);
+
   /// \brief Joint Entity
   public: Entity jointEntity;
 
@@ -220,8 +225,85 @@ class gz::sim::systems::MulticopterMotorModelPrivate
 
   /// \brief Gazebo communication node.
   public: transport::Node node;
+
+  /// \brief Link interface for the rotor link. Kept as a member so its
+  /// internal component cache survives across updates.
+  public: Link link{kNullEntity};
+
+  /// \brief Link interface for the parent link.
+  public: Link parentLink{kNullEntity};
+
+  /// \brief Entity of the wind, resolved once instead of scanning the ECM
+  /// every update.
+  public: Entity windEntity{kNullEntity};
+
+  /// \brief ECM the cached component pointers were resolved against.
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Value of EntityComponentManager::StructuralEpoch when the
+  /// cached component pointers were resolved.
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached velocity component of the joint.
+  public: components::JointVelocity *jointVelocityComp{nullptr};
+
+  /// \brief Cached velocity command component of the joint.
+  public: components::JointVelocityCmd *jointVelocityCmdComp{nullptr};
+
+  /// \brief Cached pose component of the joint.
+  public: components::Pose *jointPoseComp{nullptr};
+
+  /// \brief Cached axis component of the joint.
+  public: components::JointAxis *jointAxisComp{nullptr};
+
+  /// \brief Cached world pose component of the rotor link.
+  public: components::WorldPose *linkWorldPoseComp{nullptr};
+
+  /// \brief Cached world linear velocity component of the rotor link.
+  public: components::WorldLinearVelocity *linkWorldLinearVelComp{nullptr};
+
+  /// \brief Cached world pose component of the parent link.
+  public: components::WorldPose *parentWorldPoseComp{nullptr};
+
+  /// \brief Cached wrench command component of the parent link.
+  public: components::ExternalWorldWrenchCmd *parentWrenchComp{nullptr};
+
+  /// \brief Cached world linear velocity component of the wind.
+  public: components::WorldLinearVelocity *windLinearVelComp{nullptr};
 };
 
+//////////////////////////////////////////////////
+void MulticopterMotorModelPrivate::UpdateCache(EntityComponentManager &_ecm)
+{
+  if (this->cacheEcm == &_ecm && this->cacheEpoch == _ecm.StructuralEpoch())
+    return;
+
+  this->jointVelocityComp =
+      _ecm.Component<components::JointVelocity>(this->jointEntity);
+  this->jointVelocityCmdComp =
+      _ecm.Component<components::JointVelocityCmd>(this->jointEntity);
+  this->jointPoseComp = _ecm.Component<components::Pose>(this->jointEntity);
+  this->jointAxisComp =
+      _ecm.Component<components::JointAxis>(this->jointEntity);
+  this->linkWorldPoseComp =
+      _ecm.Component<components::WorldPose>(this->linkEntity);
+  this->linkWorldLinearVelComp =
+      _ecm.Component<components::WorldLinearVelocity>(this->linkEntity);
+  this->parentWorldPoseComp =
+      _ecm.Component<components::WorldPose>(this->parentLinkEntity);
+  this->parentWrenchComp =
+      _ecm.Component<components::ExternalWorldWrenchCmd>(
+          this->parentLinkEntity);
+
+  if (this->windEntity == kNullEntity)
+    this->windEntity = _ecm.EntityByComponents(components::Wind());
+  this->windLinearVelComp =
+      _ecm.Component<components::WorldLinearVelocity>(this->windEntity);
+
+  this->cacheEcm = &_ecm;
+  this->cacheEpoch = _ecm.StructuralEpoch();
+}
+
 //////////////////////////////////////////////////
 MulticopterMotorModel::MulticopterMotorModel()
   : dataPtr(std::make_unique<MulticopterMotorModelPrivate>())
@@ -418,12 +500,14 @@ void MulticopterMotorModel::PreUpdate(const UpdateInfo &_info,
   {
     this->dataPtr->linkEntity =
         this->dataPtr->model.LinkByName(_ecm, this->dataPtr->linkName);
+    this->dataPtr->link = Link(this->dataPtr->linkEntity);
   }
 
   if (this->dataPtr->parentLinkEntity == kNullEntity)
   {
     this->dataPtr->parentLinkEntity =
         this->dataPtr->model.LinkByName(_ecm, this->dataPtr->parentLinkName);
+    this->dataPtr->parentLink = Link(this->dataPtr->parentLinkEntity);
   }
 
   if (this->dataPtr->jointEntity == kNullEntity ||
@@ -431,44 +515,44 @@ void MulticopterMotorModel::PreUpdate(const UpdateInfo &_info,
       this->dataPtr->parentLinkEntity == kNullEntity)
     return;
 
+  // Component pointers are looked up again only when the ECM's structure
+  // changed; in the steady state each update reuses the cached pointers.
+  this->dataPtr->UpdateCache(_ecm);
+
   // skip UpdateForcesAndMoments if needed components are missing
   bool doUpdateForcesAndMoments = true;
 
-  const auto jointVelocity = _ecm.Component<components::JointVelocity>(
-      this->dataPtr->jointEntity);
-  if (!jointVelocity)
+  if (!this->dataPtr->jointVelocityComp)
   {
     _ecm.CreateComponent(this->dataPtr->jointEntity,
         components::JointVelocity());
     doUpdateForcesAndMoments = false;
   }
-  else if (jointVelocity->Data().empty())
+  else if (this->dataPtr->jointVelocityComp->Data().empty())
   {
     doUpdateForcesAndMoments = false;
   }
 
-  if (!_ecm.Component<components::JointVelocityCmd>(
-      this->dataPtr->jointEntity))
+  if (!this->dataPtr->jointVelocityCmdComp)
   {
     _ecm.CreateComponent(this->dataPtr->jointEntity,
         components::JointVelocityCmd({0}));
     doUpdateForcesAndMoments = false;
   }
 
-  if (!_ecm.Component<components::WorldPose>(this->dataPtr->linkEntity))
+  if (!this->dataPtr->linkWorldPoseComp)
   {
     _ecm.CreateComponent(this->dataPtr->linkEntity, components::WorldPose());
     doUpdateForcesAndMoments = false;
   }
-  if (!_ecm.Component<components::WorldLinearVelocity>(
-      this->dataPtr->linkEntity))
+  if (!this->dataPtr->linkWorldLinearVelComp)
   {
     _ecm.CreateComponent(this->dataPtr->linkEntity,
         components::WorldLinearVelocity());
     doUpdateForcesAndMoments = false;
   }
 
-  if (!_ecm.Component<components::WorldPose>(this->dataPtr->parentLinkEntity))
+  if (!this->dataPtr->parentWorldPoseComp)
   {
     _ecm.CreateComponent(this->dataPtr->parentLinkEntity,
         components::WorldPose());
@@ -501,46 +585,51 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
 {
   GZ_PROFILE("MulticopterMotorModelPrivate::UpdateForcesAndMoments");
 
-  std::optional<msgs::Actuators> msg;
   auto actuatorMsgComp =
       _ecm.Component<components::Actuators>(this->model.Entity());
 
-  // Actuators messages can come in from transport or via a component. If a
-  // component is available, it takes precedence.
-  if (actuatorMsgComp)
-  {
-    msg = actuatorMsgComp->Data();
-  }
-  else
-  {
-    std::lock_guard<std::mutex> lock(this->recvdActuatorsMsgMutex);
-    if (this->recvdActuatorsMsg.has_value())
-    {
-      msg = *this->recvdActuatorsMsg;
-      this->recvdActuatorsMsg.reset();
-    }
-  }
-
-  if (msg.has_value())
+  // Read the commanded velocity for this rotor without copying the whole
+  // Actuators message.
+  auto applyActuatorsMsg = [this](const msgs::Actuators &_msg) -> bool
   {
-    if (this->actuatorNumber > msg->velocity_size() - 1)
+    if (this->actuatorNumber > _msg.velocity_size() - 1)
     {
       gzerr << "You tried to access index " << this->actuatorNumber
         << " of the Actuator velocity array which is of size "
-        << msg->velocity_size() << std::endl;
-      return;
+        << _msg.velocity_size() << std::endl;
+      return false;
     }
 
     if (this->motorType == MotorType::kVelocity)
     {
       this->refMotorInput = std::min(
-          static_cast<double>(msg->velocity(this->actuatorNumber)),
+          static_cast<double>(_msg.velocity(this->actuatorNumber)),
           static_cast<double>(this->maxRotVelocity));
     }
     //  else if (this->motorType == MotorType::kPosition)
     else  // if (this->motorType == MotorType::kForce) {
     {
-      this->refMotorInput = msg->velocity(this->actuatorNumber);
+      this->refMotorInput = _msg.velocity(this->actuatorNumber);
+    }
+    return true;
+  };
+
+  // Actuators messages can come in from transport or via a component. If a
+  // component is available, it takes precedence.
+  if (actuatorMsgComp)
+  {
+    if (!applyActuatorsMsg(actuatorMsgComp->Data()))
+      return;
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lock(this->recvdActuatorsMsgMutex);
+    if (this->recvdActuatorsMsg.has_value())
+    {
+      const bool validIndex = applyActuatorsMsg(*this->recvdActuatorsMsg);
+      this->recvdActuatorsMsg.reset();
+      if (!validIndex)
+        return;
     }
   }
 
@@ -560,9 +649,7 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
     }
     default:  // MotorType::kVelocity
     {
-      const auto jointVelocity = _ecm.Component<components::JointVelocity>(
-          this->jointEntity);
-      double motorRotVel = jointVelocity->Data()[0];
+      double motorRotVel = this->jointVelocityComp->Data()[0];
       if (motorRotVel / (2 * GZ_PI) > 1 / (2 * this->samplingTime))
       {
         gzerr << "Aliasing on motor [" << this->actuatorNumber
@@ -582,15 +669,13 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
       using Pose = math::Pose3d;
       using Vector3 = math::Vector3d;
 
-      Link link(this->linkEntity);
-      const auto worldPose = link.WorldPose(_ecm);
+      const auto worldPose = this->link.WorldPose(_ecm);
 
       // Apply a force to the link.
-      link.AddWorldForce(_ecm,
+      this->link.AddWorldForce(_ecm,
                          worldPose->Rot().RotateVector(Vector3(0, 0, thrust)));
 
-      const auto jointPose = _ecm.Component<components::Pose>(
-          this->jointEntity);
+      const auto jointPose = this->jointPoseComp;
       if (!jointPose)
       {
         gzerr << "joint " << this->jointName << " has no Pose"
@@ -601,8 +686,7 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
       // with joint Pose
       Pose jointWorldPose = *worldPose * jointPose->Data();
 
-      const auto jointAxisComp = _ecm.Component<components::JointAxis>(
-          this->jointEntity);
+      const auto jointAxisComp = this->jointAxisComp;
       if (!jointAxisComp)
       {
         gzerr << "joint " << this->jointName << " has no JointAxis"
@@ -610,12 +694,9 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
         return;
       }
 
-      const auto worldLinearVel = link.WorldLinearVelocity(_ecm);
+      const auto worldLinearVel = this->link.WorldLinearVelocity(_ecm);
 
-      Entity windEntity = _ecm.EntityByComponents(components::Wind());
-      auto windLinearVel =
-          _ecm.Component<components::WorldLinearVelocity>(windEntity);
-      Vector3 windSpeedWorld = windLinearVel->Data();
+      Vector3 windSpeedWorld = this->windLinearVelComp->Data();
 
       // Forces from Philppe Martin's and Erwan Salaun's
       // 2010 IEEE Conference on Robotics and Automation paper
@@ -633,19 +714,16 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
                                bodyVelocityPerpendicular;
 
       // Apply air drag to link.
-      link.AddWorldForce(_ecm, airDrag);
+      this->link.AddWorldForce(_ecm, airDrag);
       // Moments get the parent link, such that the resulting torques can be
       // applied.
       Vector3 parentWorldTorque;
-      auto parentWrenchComp =
-        _ecm.Component<components::ExternalWorldWrenchCmd>(
-          this->parentLinkEntity);
+      auto parentWrenchComp = this->parentWrenchComp;
       // gazebo_motor_model.cpp subtracts the GetWorldCoGPose() of the
       // child link from the parent but only uses the rotation component.
       // Since GetWorldCoGPose() uses the link frame orientation, it
       // is equivalent to use WorldPose().Rot().
-      Link parentLink(this->parentLinkEntity);
-      const auto parentWorldPose = parentLink.WorldPose(_ecm);
+      const auto parentWorldPose = this->parentLink.WorldPose(_ecm);
       // The transformation from the parent_link to the link_.
       // Pose poseDifference =
       //  parent_links.at(0)->GetWorldCoGPose().Inverse()
@@ -682,11 +760,9 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
       refMotorRotVel = this->rotorVelocityFilter->UpdateFilter(
           this->refMotorInput, this->samplingTime);
 
-      const auto jointVelCmd = _ecm.Component<components::JointVelocityCmd>(
-          this->jointEntity);
-      *jointVelCmd = components::JointVelocityCmd(
-          {this->turningDirection * refMotorRotVel
-                              / this->rotorVelocitySlowdownSim});
+      this->jointVelocityCmdComp->Data().assign(1,
+          this->turningDirection * refMotorRotVel
+                              / this->rotorVelocitySlowdownSim);
     }
   }
 }
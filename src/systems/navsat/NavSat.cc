@@ -41,6 +41,7 @@
 #include "gz/sim/components/NavSat.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/Sensor.hh"
+#include "gz/sim/components/SphericalCoordinates.hh"
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/Util.hh"
 
@@ -237,6 +238,19 @@ void NavSat::Implementation::Update(const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("NavSat::Update");
 
+  // Resolve the world's spherical coordinates once and share the transform
+  // across all navsat sensors, instead of walking up to the world entity and
+  // fetching the component again for every sensor.
+  auto sphericalCoordsComp =
+      _ecm.Component<components::SphericalCoordinates>(worldEntity(_ecm));
+  if (nullptr == sphericalCoordsComp)
+  {
+    gzwarn << "Failed to update NavSat sensors. "
+            << "Spherical coordinates not set." << std::endl;
+    return;
+  }
+  const auto &sphericalCoords = sphericalCoordsComp->Data();
+
   _ecm.Each<components::NavSat, components::WorldLinearVelocity>(
     [&](const Entity &_entity,
         const components::NavSat * /*_navsat*/,
@@ -252,18 +266,15 @@ void NavSat::Implementation::Update(const EntityComponentManager &_ecm)
           return true;
         }
 
-        // Position
-        auto latLonEle = sphericalCoordinates(_entity, _ecm);
-        if (!latLonEle)
-        {
-          gzwarn << "Failed to update NavSat sensor enity [" << _entity
-                  << "]. Spherical coordinates not set." << std::endl;
-          return true;
-        }
+        // Position, in rad / rad / m
+        auto rad = sphericalCoords.PositionTransform(
+            worldPose(_entity, _ecm).Pos(),
+            math::SphericalCoordinates::LOCAL2,
+            math::SphericalCoordinates::SPHERICAL);
 
-        it->second->SetLatitude(GZ_DTOR(latLonEle.value().X()));
-        it->second->SetLongitude(GZ_DTOR(latLonEle.value().Y()));
-        it->second->SetAltitude(latLonEle.value().Z());
+        it->second->SetLatitude(rad.X());
+        it->second->SetLongitude(rad.Y());
+        it->second->SetAltitude(rad.Z());
 
         // Velocity in ENU frame
         it->second->SetVelocity(_worldLinearVel->Data());
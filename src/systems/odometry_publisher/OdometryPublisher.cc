@@ -19,6 +19,7 @@
 
 #include <gz/msgs/odometry.pb.h>
 #include <gz/msgs/odometry_with_covariance.pb.h>
+#include <gz/msgs/pose_v.pb.h>
 
 #include <limits>
 #include <string>
@@ -53,6 +54,11 @@ class gz::sim::systems::OdometryPublisherPrivate
   public: void UpdateOdometry(const gz::sim::UpdateInfo &_info,
     const gz::sim::EntityComponentManager &_ecm);
 
+  /// \brief Fill in the constant parts of the published messages: the
+  /// header frame ids and the covariance matrices. Called once at the end
+  /// of Configure, after the frames and noise have been parsed.
+  public: void InitializeMessages();
+
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
@@ -106,6 +112,19 @@ class gz::sim::systems::OdometryPublisherPrivate
 
   /// \brief Gaussian noise
   public: double gaussianNoise = 0.0;
+
+  /// \brief Odometry message reused across publishes. The frame ids in
+  /// the header are set once; only the stamp, pose and twist fields
+  /// change between updates.
+  public: msgs::Odometry odomMsg;
+
+  /// \brief Odometry with covariance message reused across publishes.
+  /// The covariance matrices only depend on the configured noise, so
+  /// they are filled in once instead of on every publish.
+  public: msgs::OdometryWithCovariance odomCovMsg;
+
+  /// \brief Pose vector (TF) message reused across publishes.
+  public: msgs::Pose_V tfMsg;
 };
 
 //////////////////////////////////////////////////
@@ -145,6 +164,11 @@ void OdometryPublisher::Configure(const Entity &_entity,
     return;
   }
 
+  // Cache the model's kinematic topology so the per-step world pose
+  // lookup composes along the cached chain; shared with any other system
+  // on this model that uses the cache.
+  enableKinematicsCache(_entity, _ecm);
+
   this->dataPtr->odomFrame = this->dataPtr->model.Name(_ecm) + "/" + "odom";
   if (!_sdf->HasElement("odom_frame"))
   {
@@ -268,6 +292,37 @@ void OdometryPublisher::Configure(const Entity &_entity,
     gzmsg << "OdometryPublisher publishing Pose_V (TF) on ["
            << tfTopicValid << "]" << std::endl;
   }
+
+  this->dataPtr->InitializeMessages();
+}
+
+//////////////////////////////////////////////////
+void OdometryPublisherPrivate::InitializeMessages()
+{
+  // Set the frame ids once; only the stamp changes between publishes.
+  auto header = this->odomMsg.mutable_header();
+  auto frame = header->add_data();
+  frame->set_key("frame_id");
+  frame->add_value(this->odomFrame);
+  auto childFrame = header->add_data();
+  childFrame->set_key("child_frame_id");
+  childFrame->add_value(this->robotBaseFrame);
+
+  this->odomCovMsg.mutable_header()->CopyFrom(*header);
+
+  // Populate the covariance matrix.
+  // Should the matrix me populated for pose as well ?
+  auto gn2 = this->gaussianNoise * this->gaussianNoise;
+  for (int i = 0; i < 36; i++)
+  {
+    double value = (i % 7 == 0) ? gn2 : 0.0;
+    this->odomCovMsg.mutable_pose_with_covariance()->
+      mutable_covariance()->add_data(value);
+    this->odomCovMsg.mutable_twist_with_covariance()->
+      mutable_covariance()->add_data(value);
+  }
+
+  this->tfMsg.add_pose();
 }
 
 //////////////////////////////////////////////////
@@ -320,8 +375,8 @@ void OdometryPublisherPrivate::UpdateOdometry(
     return;
   }
 
-  // Construct the odometry message and publish it.
-  msgs::Odometry msg;
+  // Update the preallocated odometry message and publish it.
+  msgs::Odometry &msg = this->odomMsg;
 
   const std::chrono::duration<double> dt =
     std::chrono::steady_clock::time_point(_info.simTime) - lastUpdateTime;
@@ -331,7 +386,7 @@ void OdometryPublisherPrivate::UpdateOdometry(
     return;
 
   // Get and set robotBaseFrame to odom transformation.
-  const math::Pose3d rawPose = worldPose(this->model.Entity(), _ecm);
+  const math::Pose3d rawPose = cachedWorldPose(this->model.Entity(), _ecm);
   math::Pose3d pose = rawPose * this->offset;
   msg.mutable_pose()->mutable_position()->set_x(pose.Pos().X());
   msg.mutable_pose()->mutable_position()->set_y(pose.Pos().Y());
@@ -423,19 +478,10 @@ void OdometryPublisherPrivate::UpdateOdometry(
     std::get<2>(this->angularMean).Mean() +
     gz::math::Rand::DblNormal(0, this->gaussianNoise));
 
-  // Set the time stamp in the header.
-  msgs::Header header;
-  header.mutable_stamp()->CopyFrom(convert<msgs::Time>(_info.simTime));
-
-  // Set the frame ids.
-  auto frame = header.add_data();
-  frame->set_key("frame_id");
-  frame->add_value(odomFrame);
-  auto childFrame = header.add_data();
-  childFrame->set_key("child_frame_id");
-  childFrame->add_value(robotBaseFrame);
-
-  msg.mutable_header()->CopyFrom(header);
+  // Set the time stamp in the header. The frame ids were set once in
+  // InitializeMessages.
+  msg.mutable_header()->mutable_stamp()->CopyFrom(
+    convert<msgs::Time>(_info.simTime));
 
   this->lastUpdatePose = pose;
   this->lastUpdateTime = std::chrono::steady_clock::time_point(_info.simTime);
@@ -448,77 +494,59 @@ void OdometryPublisherPrivate::UpdateOdometry(
     return;
   }
   this->lastOdomPubTime = _info.simTime;
-  if (this->odomPub.Valid())
+  if (this->odomPub.Valid() && this->odomPub.HasConnections())
   {
     this->odomPub.Publish(msg);
   }
 
-  // Generate odometry with covariance message and publish it.
-  msgs::OdometryWithCovariance msgCovariance;
-
-  // Set the time stamp in the header.
-  msgCovariance.mutable_header()->CopyFrom(header);
-
-  // Copy position from odometry msg.
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_x(msg.pose().position().x());
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_y(msg.pose().position().y());
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_z(msg.pose().position().z());
-
-  // Copy orientation from odometry msg.
-  msgs::Set(msgCovariance.mutable_pose_with_covariance()->mutable_pose()->
-    mutable_orientation(), pose.Rot());
-
-  // Copy twist from odometry msg.
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_x(msg.twist().angular().x());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_y(msg.twist().angular().y());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_z(msg.twist().angular().z());
-
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_x(msg.twist().linear().x());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_y(msg.twist().linear().y());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_z(msg.twist().linear().z());
-
-  // Populate the covariance matrix.
-  // Should the matrix me populated for pose as well ?
-  auto gn2 = this->gaussianNoise * this->gaussianNoise;
-  for (int i = 0; i < 36; i++)
-  {
-    if (i % 7 == 0)
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-    }
-    else
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(0);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(0);
-    }
-  }
-  if (this->odomCovPub.Valid())
+  // Update the odometry with covariance message and publish it. The
+  // covariance matrices are constant and were filled in once, so the
+  // message is only touched when someone is listening.
+  if (this->odomCovPub.Valid() && this->odomCovPub.HasConnections())
   {
+    msgs::OdometryWithCovariance &msgCovariance = this->odomCovMsg;
+
+    // Set the time stamp in the header.
+    msgCovariance.mutable_header()->mutable_stamp()->CopyFrom(
+      msg.header().stamp());
+
+    // Copy position from odometry msg.
+    msgCovariance.mutable_pose_with_covariance()->
+      mutable_pose()->mutable_position()->set_x(msg.pose().position().x());
+    msgCovariance.mutable_pose_with_covariance()->
+      mutable_pose()->mutable_position()->set_y(msg.pose().position().y());
+    msgCovariance.mutable_pose_with_covariance()->
+      mutable_pose()->mutable_position()->set_z(msg.pose().position().z());
+
+    // Copy orientation from odometry msg.
+    msgs::Set(msgCovariance.mutable_pose_with_covariance()->mutable_pose()->
+      mutable_orientation(), pose.Rot());
+
+    // Copy twist from odometry msg.
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_angular()->set_x(msg.twist().angular().x());
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_angular()->set_y(msg.twist().angular().y());
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_angular()->set_z(msg.twist().angular().z());
+
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_linear()->set_x(msg.twist().linear().x());
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_linear()->set_y(msg.twist().linear().y());
+    msgCovariance.mutable_twist_with_covariance()->
+      mutable_twist()->mutable_linear()->set_z(msg.twist().linear().z());
+
     this->odomCovPub.Publish(msgCovariance);
   }
 
-  if (this->tfPub.Valid())
+  if (this->tfPub.Valid() && this->tfPub.HasConnections())
   {
-    msgs::Pose_V tfMsg;
-    auto tfMsgPose = tfMsg.add_pose();
+    auto tfMsgPose = this->tfMsg.mutable_pose(0);
     tfMsgPose->CopyFrom(msg.pose());
-    tfMsgPose->mutable_header()->CopyFrom(header);
+    tfMsgPose->mutable_header()->CopyFrom(msg.header());
 
-    this->tfPub.Publish(tfMsg);
+    this->tfPub.Publish(this->tfMsg);
   }
 }
 
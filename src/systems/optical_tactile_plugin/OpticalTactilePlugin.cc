@@ -165,6 +165,10 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   /// \brief Flag for checking the data type returned by the DepthCamera
   public: bool checkDepthCameraData{true};
 
+  /// \brief Whether the sensor reported contacts in the previous step.
+  /// Used to run one last normal-force update when the contact ends.
+  public: bool hadContacts{false};
+
   /// \brief Flag for allowing the plugin to output error/warning only once
   public: bool initErrorPrinted{false};
 
@@ -421,23 +425,25 @@ void OpticalTactilePlugin::PostUpdate(
   if (_info.paused || !this->dataPtr->initialized || !this->dataPtr->enabled)
     return;
 
+  auto *contacts =
+    _ecm.Component<components::ContactSensorData>(
+      this->dataPtr->sensorCollisionEntity);
+  const bool hasContacts =
+    nullptr != contacts && contacts->Data().contact_size() > 0;
+
   // TODO(anyone) Get ContactSensor data and merge it with DepthCamera data
-  if (this->dataPtr->visualizeContacts)
+  if (this->dataPtr->visualizeContacts && nullptr != contacts)
   {
-    auto *contacts =
-      _ecm.Component<components::ContactSensorData>(
-        this->dataPtr->sensorCollisionEntity);
-
-    if (nullptr != contacts)
-    {
-      this->dataPtr->visualizePtr->RequestContactsMarkerMsg(contacts);
-    }
+    this->dataPtr->visualizePtr->RequestContactsMarkerMsg(contacts);
   }
 
-  // Process camera message if it's new
+  // Process camera message if it's new. Contact-free steps skip the
+  // normal-force grid computation entirely; one more update runs when the
+  // last contact ends so subscribers see the sensor return to rest.
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
-    if (this->dataPtr->newCameraMsg)
+    if (this->dataPtr->newCameraMsg &&
+        (hasContacts || this->dataPtr->hadContacts))
     {
       this->dataPtr->ComputeNormalForces(this->dataPtr->cameraMsg,
         this->dataPtr->visualizeForces);
@@ -445,6 +451,7 @@ void OpticalTactilePlugin::PostUpdate(
       this->dataPtr->newCameraMsg = false;
     }
   }
+  this->dataPtr->hadContacts = hasContacts;
 
   // Publish sensor marker if required and sensor pose has changed
   if (this->dataPtr->visualizeSensor &&
@@ -18,6 +18,7 @@
 #include <gz/msgs/particle_emitter.pb.h>
 #include <gz/msgs/particle_emitter_v.pb.h>
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <string>
@@ -60,6 +61,10 @@ class gz::sim::systems::ParticleEmitter2Private
   /// \brief Map of Entity to particle emitter command requested externally.
   public: std::map<Entity, gz::msgs::ParticleEmitter> userCmd;
 
+  /// \brief Whether new user commands arrived since the last PreUpdate.
+  /// Checked before taking the mutex so steady-state updates are lock-free.
+  public: std::atomic<bool> hasNewCmd{false};
+
   /// \brief A mutex to protect the user command.
   public: std::mutex mutex;
 
@@ -80,6 +85,7 @@ void ParticleEmitter2Private::OnCmd(const msgs::ParticleEmitter &_msg,
   if (iter != this->emitterTopicMap.end())
   {
     this->userCmd[iter->second].CopyFrom(_msg);
+    this->hasNewCmd = true;
   }
   else
   {
@@ -140,11 +146,9 @@ void ParticleEmitter2::PreUpdate(const gz::sim::UpdateInfo &_info,
 {
   GZ_PROFILE("ParticleEmitter2::PreUpdate");
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-
-  // Create particle emitters
+  // Create particle emitters. The mutexes are taken per new emitter inside
+  // the lambda, so steps without new emitters or commands stay lock-free.
   {
-    std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
     _ecm.EachNew<components::ParticleEmitter, components::ParentEntity,
       components::Pose>(
       [&](const Entity &_entity,
@@ -186,10 +190,14 @@ void ParticleEmitter2::PreUpdate(const gz::sim::UpdateInfo &_info,
 
           // Store the topic name so that we can apply user commands
           // correctly.
-          this->dataPtr->emitterTopicMap[topic] = _entity;
+          {
+            std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+            this->dataPtr->emitterTopicMap[topic] = _entity;
+          }
 
           // Store the emitter information in the service message, which
           // can then be used in the particle_emitters service.
+          std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
           msgs::ParticleEmitter *emitterMsg =
             this->dataPtr->serviceMsg.add_particle_emitter();
           emitterMsg->CopyFrom(_emitter->Data());
@@ -214,9 +222,11 @@ void ParticleEmitter2::PreUpdate(const gz::sim::UpdateInfo &_info,
         });
   }
 
-  if (this->dataPtr->userCmd.empty() || _info.paused)
+  if (!this->dataPtr->hasNewCmd || _info.paused)
     return;
 
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
   // Process each command
   for (const auto &cmd : this->dataPtr->userCmd)
   {
@@ -244,6 +254,7 @@ void ParticleEmitter2::PreUpdate(const gz::sim::UpdateInfo &_info,
     }
   }
   this->dataPtr->userCmd.clear();
+  this->dataPtr->hasNewCmd = false;
 }
 
 GZ_ADD_PLUGIN(ParticleEmitter2,
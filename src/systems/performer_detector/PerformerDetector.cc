@@ -154,6 +154,13 @@ void PerformerDetector::PostUpdate(
   auto modelPose =
       _ecm.Component<components::Pose>(this->model.Entity())->Data();
 
+  // If the detector itself hasn't moved since the last update, performers
+  // whose pose also didn't change this step can't have changed detection
+  // state, so they are skipped below.
+  const bool detectorMoved =
+      !this->lastModelPose || *this->lastModelPose != modelPose;
+  this->lastModelPose = modelPose;
+
   // Double negative because AxisAlignedBox does not currently have operator+
   // that takes a position
   auto region = this->detectorGeometry -
@@ -165,9 +172,14 @@ void PerformerDetector::PostUpdate(
           const components::Geometry *_geometry,
           const components::ParentEntity *_parent) -> bool
       {
+        if (!detectorMoved &&
+            _ecm.ComponentState(_parent->Data(), components::Pose::typeId) ==
+            ComponentState::NoChange)
+        {
+          return true;
+        }
+
         auto pose = _ecm.Component<components::Pose>(_parent->Data())->Data();
-        auto name = _ecm.Component<components::Name>(_parent->Data())->Data();
-        const math::Pose3d relPose = modelPose.Inverse() * pose;
 
         // We assume the geometry contains a box.
         auto perfBox = _geometry->Data().BoxShape();
@@ -182,15 +194,20 @@ void PerformerDetector::PostUpdate(
                                              pose.Pos() + perfBox->Size() / 2};
 
         bool alreadyDetected = this->IsAlreadyDetected(_entity);
-        if (region.Intersects(performerVolume))
+        bool inRegion = region.Intersects(performerVolume);
+        if (inRegion == alreadyDetected)
+          return true;
+
+        // Only state transitions need the name and relative pose.
+        auto name = _ecm.Component<components::Name>(_parent->Data())->Data();
+        const math::Pose3d relPose = modelPose.Inverse() * pose;
+
+        if (inRegion)
         {
-          if (!alreadyDetected)
-          {
-            this->AddToDetected(_entity);
-            this->Publish(_entity, name, true, relPose, _info.simTime);
-          }
+          this->AddToDetected(_entity);
+          this->Publish(_entity, name, true, relPose, _info.simTime);
         }
-        else if (alreadyDetected)
+        else
         {
           this->RemoveFromDetected(_entity);
           this->Publish(_entity, name, false, relPose, _info.simTime);
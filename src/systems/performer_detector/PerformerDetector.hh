@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -144,6 +145,12 @@ namespace systems
     /// \brief Additional pose offset for the plugin.
     private: math::Pose3d poseOffset;
 
+    /// \brief Pose of the containing model during the previous update.
+    /// Unset until the first update after initialization. When the
+    /// detector hasn't moved, performers whose pose also didn't change
+    /// are skipped since their detection state can't have changed.
+    private: std::optional<math::Pose3d> lastModelPose;
+
     /// \brief Optional extra header data.
     private: std::map<std::string, std::string> extraHeaderData;
   };
@@ -23,9 +23,12 @@
 #include <gz/msgs/Utility.hh>
 
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <sstream>
 #include <deque>
-#include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -39,7 +42,6 @@
 #include <gz/common/Profiler.hh>
 #include <gz/common/StringUtils.hh>
 #include <gz/common/SystemPaths.hh>
-#include <gz/common/Uuid.hh>
 #include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/eigen3/Conversions.hh>
 #include <gz/math/Vector3.hh>
@@ -259,34 +261,40 @@ class gz::sim::systems::PhysicsPrivate
   public: gz::physics::ForwardStep::Output Step(
               const std::chrono::steady_clock::duration &_dt);
 
-  /// \brief Get data of links that were updated in the latest physics step.
+  /// \brief Collect data of links that were updated in the latest physics
+  /// step into the reusable changedLinkFrames buffer.
   /// \param[in] _ecm Mutable reference to ECM.
   /// \param[in] _updatedLinks Updated link poses from the latest physics step
   /// that were written to by the physics engine (some physics engines may
   /// not write this data to ForwardStep::Output. If not, _ecm is used to get
   /// this updated link pose data).
-  /// \return A map of gazebo link entities to their updated pose data.
-  /// std::map is used because canonical links must be in topological order
-  /// to ensure that nested models with multiple canonical links are updated
-  /// properly (models must be updated in topological order).
-  public: std::map<Entity, physics::FrameData3d> ChangedLinks(
+  public: void ChangedLinks(
               EntityComponentManager &_ecm,
               const gz::physics::ForwardStep::Output &_updatedLinks);
 
-  /// \brief Helper function to update the pose of a model.
+  /// \brief Append a link to the changedLinkFrames buffer unless it's
+  /// already present.
+  /// \param[in] _entity The link entity.
+  /// \param[in] _frameData The link's updated frame data.
+  /// \return True if the link was appended, false if it was already in the
+  /// buffer.
+  public: bool AppendLinkFrame(const Entity _entity,
+              const physics::FrameData3d &_frameData);
+
+  /// \brief Helper function to update the pose of a model. The canonical
+  /// links of _model's nested models are appended to the changedLinkFrames
+  /// buffer to ensure that all of _model's nested models are marked as
+  /// models to be updated (if a parent model's pose changes, all nested
+  /// model poses must be updated since nested model poses are saved w.r.t.
+  /// the parent model).
   /// \param[in] _model The model to update.
   /// \param[in] _canonicalLink The canonical link of _model.
   /// \param[in] _ecm The entity component manager.
-  /// \param[in, out] _linkFrameData Links that experienced a pose change in the
-  /// most recent physics step. The key is the entity of the link, and the
-  /// value is the updated frame data corresponding to that entity. The
-  /// canonical links of _model's nested models are added to _linkFrameData to
-  /// ensure that all of _model's nested models are marked as models to be
-  /// updated (if a parent model's pose changes, all nested model poses must be
-  /// updated since nested model poses are saved w.r.t. the parent model).
+  /// \param[in] _canonicalLinkFrame Updated frame data of _canonicalLink
+  /// from the most recent physics step.
   public: void UpdateModelPose(const Entity _model,
               const Entity _canonicalLink, EntityComponentManager &_ecm,
-              std::map<Entity, physics::FrameData3d> &_linkFrameData);
+              const physics::FrameData3d &_canonicalLinkFrame);
 
   /// \brief Get an entity's frame data relative to world from physics.
   /// \param[in] _entity The entity.
@@ -298,11 +306,7 @@ class gz::sim::systems::PhysicsPrivate
 
   /// \brief Update components from physics simulation
   /// \param[in] _ecm Mutable reference to ECM.
-  /// \param[in, out] _linkFrameData Links that experienced a pose change in the
-  /// most recent physics step. The key is the entity of the link, and the
-  /// value is the updated frame data corresponding to that entity.
-  public: void UpdateSim(EntityComponentManager &_ecm,
-              std::map<Entity, physics::FrameData3d> &_linkFrameData);
+  public: void UpdateSim(EntityComponentManager &_ecm);
 
   /// \brief Update collision components from physics simulation
   /// \param[in] _ecm Mutable reference to ECM.
@@ -331,36 +335,72 @@ class gz::sim::systems::PhysicsPrivate
   /// \param[in] _world The world to disable it for.
   public: void DisableContactSurfaceCustomization(const Entity &_world);
 
-  /// \brief Cache the top-level model for each entity.
-  /// The key is an entity and the value is its top level model.
-  public: std::unordered_map<Entity, Entity> topLevelModelMap;
+  /// \brief Per-entity bookkeeping that used to be spread over several
+  /// entity-keyed maps. Consolidating the fields into one record means the
+  /// hot per-step loops resolve a single lookup per entity and then work
+  /// on adjacent fields.
+  public: struct EntityState
+  {
+    /// \brief The entity's top level model.
+    public: Entity topLevelModel{kNullEntity};
+
+    /// \brief Most recent world pose, for links attached to non-static
+    /// models. This allows for skipping pose updates if a link's pose
+    /// didn't change after a physics step.
+    public: std::optional<math::Pose3d> linkWorldPose;
+
+    /// \brief Most recent world pose, for non-static models. Since
+    /// non-static models may not move on a given iteration, we want to
+    /// keep track of the most recent model world pose change that took
+    /// place.
+    public: std::optional<math::Pose3d> modelWorldPose;
+
+    /// \brief Pose of the model's canonical link w.r.t. the model frame,
+    /// for model entities. The model frame is rigidly attached to its
+    /// canonical link, so this is computed once and reused instead of
+    /// walking the parent chain every time the model moves.
+    public: std::optional<math::Pose3d> canonicalLinkPoseFromModel;
+
+    /// \brief Whether the model's battery has drained.
+    public: bool off{false};
+
+    /// \brief Consecutive steps this link's pose has been observed
+    /// unchanged. Used to back off frame data queries for resting links
+    /// when skip_resting_links is enabled.
+    public: uint16_t restingSteps{0};
+
+    /// \brief Remaining steps to skip before querying this link's frame
+    /// data again.
+    public: uint16_t skipSteps{0};
+  };
+
+  /// \brief State record for each entity known to the physics system.
+  public: std::unordered_map<Entity, EntityState> entityStateMap;
 
   /// \brief Keep track of what entities are static (models and links).
   public: std::unordered_set<Entity> staticEntities;
 
-  /// \brief Keep track of poses for links attached to non-static models.
-  /// This allows for skipping pose updates if a link's pose didn't change
-  /// after a physics step.
-  public: std::unordered_map<Entity, gz::math::Pose3d> linkWorldPoses;
-
   /// \brief Keep a mapping of canonical links to models that have this
   /// canonical link. Useful for updating model poses efficiently after a
   /// physics step
   public: CanonicalLinkModelTracker canonicalLinkModelTracker;
 
-  /// \brief Keep track of non-static model world poses. Since non-static
-  /// models may not move on a given iteration, we want to keep track of the
-  /// most recent model world pose change that took place.
-  public: std::unordered_map<Entity, math::Pose3d> modelWorldPoses;
-
-  /// \brief A map between model entity ids in the ECM to whether its battery
-  /// has drained.
-  public: std::unordered_map<Entity, bool> entityOffMap;
-
   /// \brief Entities whose pose commands have been processed and should be
   /// deleted the following iteration.
   public: std::unordered_set<Entity> worldPoseCmdsToRemove;
 
+  /// \brief Links that experienced a pose change in the most recent physics
+  /// step, with their updated frame data. This buffer (and its companion
+  /// membership set) is reused across steps, so after warm-up the per-step
+  /// collection of changed links doesn't allocate. Entries are sorted in
+  /// ascending entity id order pass by pass while UpdateSim processes them,
+  /// which yields the topological order model pose updates require.
+  public: std::vector<std::pair<Entity, physics::FrameData3d>>
+          changedLinkFrames;
+
+  /// \brief Entities currently present in changedLinkFrames.
+  public: std::unordered_set<Entity> changedLinkSet;
+
   /// \brief IDs of the ContactSurfaceHandler callbacks registered for worlds
   public: std::unordered_map<Entity, std::string> worldContactCallbackIDs;
 
@@ -528,6 +568,19 @@ class gz::sim::systems::PhysicsPrivate
           CollisionFeatureList,
           physics::CollisionFilterMaskFeature>{};
 
+  /// \brief Register a collision entity with the precomputed collision
+  /// filter table and push filter masks to the engine for the shapes that
+  /// need one.
+  /// \param[in] _entity Collision entity.
+  /// \param[in] _bitmask collide_bitmask of the collision.
+  public: void RegisterCollisionFilter(const Entity _entity,
+              const uint16_t _bitmask);
+
+  /// \brief Unregister a removed collision entity from the collision
+  /// filter table.
+  /// \param[in] _entity Collision entity.
+  public: void UnregisterCollisionFilter(const Entity _entity);
+
   //////////////////////////////////////////////////
   // Link force
   /// \brief Feature list for applying forces to links.
@@ -704,6 +757,35 @@ class gz::sim::systems::PhysicsPrivate
   /// gz-physics.
   public: EntityCollisionMap entityCollisionMap;
 
+  /// \brief One collision group per distinct collide_bitmask value.
+  public: struct CollisionGroup
+  {
+    /// \brief collide_bitmask shared by all members of the group.
+    public: uint16_t bitmask;
+
+    /// \brief Allow table row: allows[h] is true when this group and
+    /// group h may collide. The precomputed form of the pairwise bitmask
+    /// test; there are only a handful of rows even when a scene has
+    /// thousands of collisions.
+    public: std::vector<bool> allows;
+
+    /// \brief Collision entities in the group.
+    public: std::unordered_set<Entity> members;
+
+    /// \brief Whether the members' masks were pushed to the engine.
+    public: bool masksPushed{false};
+  };
+
+  /// \brief Precomputed collision filter table, indexed by group id.
+  /// Masks are pushed to the engine only for groups with at least one
+  /// disallowed pairing, so shapes of allow-all groups stay out of the
+  /// engine's per-pair filter map. Emptied groups keep their row so group
+  /// ids stay stable.
+  public: std::vector<CollisionGroup> collisionGroups;
+
+  /// \brief Group id of each collision entity in collisionGroups.
+  public: std::unordered_map<Entity, std::size_t> collisionGroupIds;
+
   /// \brief FreeGroup EntityFeatureMap
   public: using EntityFreeGroupMap = EntityFeatureMap3d<
             physics::FreeGroup,
@@ -724,6 +806,14 @@ class gz::sim::systems::PhysicsPrivate
   public: std::unordered_map<Entity, std::unordered_set<Entity>>
     customContactSurfaceEntities;
 
+  /// \brief Physics engine IDs of the collision shapes in
+  /// customContactSurfaceEntities, kept per world. The contact properties
+  /// callback runs for every contact in the world, so it consults this set
+  /// to reject uninvolved contacts by their raw physics IDs without
+  /// resolving any Gazebo entities.
+  public: std::unordered_map<Entity, std::unordered_set<std::size_t>>
+    customContactSurfacePhysicsIds;
+
   /// \brief Set of links that were added to an existing model. This set
   /// is used to track links that were added to an existing model, such as
   /// through the GUI model editor, so that we can avoid premature creation
@@ -740,6 +830,12 @@ class gz::sim::systems::PhysicsPrivate
   /// \brief Flag to store whether the names of colliding entities should
   /// be populated in the contact points.
   public: bool contactsEntityNames = true;
+
+  /// \brief True if frame data queries should back off for links whose
+  /// pose has been stable for a while. Resting links are then re-checked
+  /// every few steps instead of every step, at the cost of reacting to a
+  /// wake-up with a few steps of delay. Off by default.
+  public: bool skipRestingLinks = false;
 };
 
 //////////////////////////////////////////////////
@@ -804,6 +900,10 @@ void Physics::Configure(const Entity &_entity,
       "include_entity_names", true).first;
   }
 
+  // Check if frame data queries should back off for resting links.
+  this->dataPtr->skipRestingLinks = _sdf->Get<bool>(
+      "skip_resting_links", this->dataPtr->skipRestingLinks).first;
+
   // Find engine shared library
   // Look in:
   // * Paths from environment variable
@@ -923,8 +1023,8 @@ void Physics::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
     {
       stepOutput = this->dataPtr->Step(_info.dt);
     }
-    auto changedLinks = this->dataPtr->ChangedLinks(_ecm, stepOutput);
-    this->dataPtr->UpdateSim(_ecm, changedLinks);
+    this->dataPtr->ChangedLinks(_ecm, stepOutput);
+    this->dataPtr->UpdateSim(_ecm);
 
     // Entities scheduled to be removed should be removed from physics after the
     // simulation step. Otherwise, since the to-be-removed entity still shows up
@@ -1143,8 +1243,8 @@ void PhysicsPrivate::CreateModelEntities(const EntityComponentManager &_ecm,
             if (modelPtrPhys)
             {
               this->entityModelMap.AddEntity(_entity, modelPtrPhys);
-              this->topLevelModelMap.insert(std::make_pair(_entity,
-                  topLevelModel(_entity, _ecm)));
+              this->entityStateMap[_entity].topLevelModel =
+                  topLevelModel(_entity, _ecm);
             }
           }
           else
@@ -1153,8 +1253,8 @@ void PhysicsPrivate::CreateModelEntities(const EntityComponentManager &_ecm,
             if (modelPtrPhys)
             {
               this->entityModelMap.AddEntity(_entity, modelPtrPhys);
-              this->topLevelModelMap.insert(std::make_pair(_entity,
-                  topLevelModel(_entity, _ecm)));
+              this->entityStateMap[_entity].topLevelModel =
+                  topLevelModel(_entity, _ecm);
             }
           }
         }
@@ -1194,8 +1294,8 @@ void PhysicsPrivate::CreateModelEntities(const EntityComponentManager &_ecm,
             if (modelPtrPhys)
             {
               this->entityModelMap.AddEntity(_entity, modelPtrPhys);
-              this->topLevelModelMap.insert(std::make_pair(_entity,
-                  topLevelModel(_entity, _ecm)));
+              this->entityStateMap[_entity].topLevelModel =
+                  topLevelModel(_entity, _ecm);
             }
             else
             {
@@ -1269,8 +1369,8 @@ void PhysicsPrivate::CreateLinkEntities(const EntityComponentManager &_ecm,
           // parsing the model (links in models are required to have unique
           // names). Instead we will register its existence and move along.
           this->entityLinkMap.AddEntity(_entity, existingLink);
-          this->topLevelModelMap.insert(
-            std::make_pair(_entity, topLevelModel(_entity, _ecm)));
+          this->entityStateMap[_entity].topLevelModel =
+              topLevelModel(_entity, _ecm);
           return true;
         }
 
@@ -1323,8 +1423,8 @@ void PhysicsPrivate::CreateLinkEntities(const EntityComponentManager &_ecm,
 
         auto linkPtrPhys = constructLinkFeature->ConstructLink(link);
         this->entityLinkMap.AddEntity(_entity, linkPtrPhys);
-        this->topLevelModelMap.insert(std::make_pair(_entity,
-            topLevelModel(_entity, _ecm)));
+        this->entityStateMap[_entity].topLevelModel =
+            topLevelModel(_entity, _ecm);
 
         return true;
       });
@@ -1382,8 +1482,8 @@ void PhysicsPrivate::CreateCollisionEntities(const EntityComponentManager &_ecm,
                   _parent->Data());
           this->entityCollisionMap.AddEntity(
             _entity, linkCollisionFeature->GetShape(_name->Data()));
-          this->topLevelModelMap.insert(
-            std::make_pair(_entity, topLevelModel(_entity, _ecm)));
+          this->entityStateMap[_entity].topLevelModel =
+              topLevelModel(_entity, _ecm);
           return true;
         }
 
@@ -1528,10 +1628,26 @@ void PhysicsPrivate::CreateCollisionEntities(const EntityComponentManager &_ecm,
             vertices.push_back(polyline.Points());
           }
 
-          std::string name("POLYLINE_" + common::Uuid().String());
+          // Identical polylines extrude to identical meshes, so key the
+          // mesh by a content hash: N instances of the same geometry share
+          // one mesh in the MeshManager instead of each extruding (and
+          // permanently registering) its own copy under a random name.
+          std::ostringstream contentKey;
+          contentKey << _geom->Data().PolylineShape()[0].Height();
+          for (const auto &polyline : _geom->Data().PolylineShape())
+          {
+            for (const auto &point : polyline.Points())
+              contentKey << "," << point;
+          }
+          const std::string name = "POLYLINE_" + std::to_string(
+              std::hash<std::string>{}(contentKey.str()));
+
           auto meshManager = common::MeshManager::Instance();
-          meshManager->CreateExtrudedPolyline(name, vertices,
-              _geom->Data().PolylineShape()[0].Height());
+          if (!meshManager->HasMesh(name))
+          {
+            meshManager->CreateExtrudedPolyline(name, vertices,
+                _geom->Data().PolylineShape()[0].Height());
+          }
 
           auto polyline = meshManager->MeshByName(name);
           if (nullptr == polyline)
@@ -1594,33 +1710,112 @@ void PhysicsPrivate::CreateCollisionEntities(const EntityComponentManager &_ecm,
 
         this->entityCollisionMap.AddEntity(_entity, collisionPtrPhys);
 
-        // Check that the physics engine has a filter mask feature
-        // Set the collide_bitmask if it does
-        auto filterMaskFeature =
-            this->entityCollisionMap.EntityCast<CollisionMaskFeatureList>(
-                _entity);
-        if (filterMaskFeature)
-        {
-          filterMaskFeature->SetCollisionFilterMask(collideBitmask);
-        }
-        else
-        {
-          static bool informed{false};
-          if (!informed)
-          {
-            gzdbg << "Attempting to set collision bitmasks, but the physics "
-                   << "engine doesn't support feature [CollisionFilterMask]. "
-                   << "Collision bitmasks will be ignored." << std::endl;
-            informed = true;
-          }
-        }
+        // Resolve the collide_bitmask through the precomputed filter
+        // table, which only pushes masks to the engine for shapes that
+        // can actually filter out a pair.
+        this->RegisterCollisionFilter(_entity, collideBitmask);
 
-        this->topLevelModelMap.insert(std::make_pair(_entity,
-            topLevelModel(_entity, _ecm)));
+        this->entityStateMap[_entity].topLevelModel =
+            topLevelModel(_entity, _ecm);
         return true;
       });
 }
 
+//////////////////////////////////////////////////
+void PhysicsPrivate::RegisterCollisionFilter(const Entity _entity,
+    const uint16_t _bitmask)
+{
+  // Find or create the group for this bitmask value.
+  std::size_t group = this->collisionGroups.size();
+  for (std::size_t i = 0; i < this->collisionGroups.size(); ++i)
+  {
+    if (this->collisionGroups[i].bitmask == _bitmask)
+    {
+      group = i;
+      break;
+    }
+  }
+
+  if (group == this->collisionGroups.size())
+  {
+    // New group: extend every row of the allow table with the pairwise
+    // bitmask test. This is the only place pair decisions are evaluated.
+    CollisionGroup newGroup;
+    newGroup.bitmask = _bitmask;
+    for (auto &other : this->collisionGroups)
+    {
+      const bool allowed = (other.bitmask & _bitmask) != 0;
+      other.allows.push_back(allowed);
+      newGroup.allows.push_back(allowed);
+    }
+    // Self pairing.
+    newGroup.allows.push_back(_bitmask != 0);
+    this->collisionGroups.push_back(std::move(newGroup));
+  }
+
+  this->collisionGroups[group].members.insert(_entity);
+  this->collisionGroupIds[_entity] = group;
+
+  // Late members of an already filtered group get their mask right away.
+  if (this->collisionGroups[group].masksPushed)
+  {
+    auto filterMaskFeature =
+        this->entityCollisionMap.EntityCast<CollisionMaskFeatureList>(
+            _entity);
+    if (filterMaskFeature)
+      filterMaskFeature->SetCollisionFilterMask(_bitmask);
+    return;
+  }
+
+  // Push masks for every group whose row gained a disallowed pairing.
+  // Shapes of allow-all groups, notably the default bitmask, stay out of
+  // the engine's filter map so broadphase never evaluates their pairs.
+  for (auto &candidate : this->collisionGroups)
+  {
+    if (candidate.masksPushed ||
+        std::find(candidate.allows.begin(), candidate.allows.end(), false)
+        == candidate.allows.end())
+    {
+      continue;
+    }
+
+    for (const auto member : candidate.members)
+    {
+      auto filterMaskFeature =
+          this->entityCollisionMap.EntityCast<CollisionMaskFeatureList>(
+              member);
+      if (filterMaskFeature)
+      {
+        filterMaskFeature->SetCollisionFilterMask(candidate.bitmask);
+      }
+      else
+      {
+        static bool informed{false};
+        if (!informed)
+        {
+          gzdbg << "Attempting to set collision bitmasks, but the physics "
+                 << "engine doesn't support feature [CollisionFilterMask]. "
+                 << "Collision bitmasks will be ignored." << std::endl;
+          informed = true;
+        }
+        return;
+      }
+    }
+    candidate.masksPushed = true;
+  }
+}
+
+//////////////////////////////////////////////////
+void PhysicsPrivate::UnregisterCollisionFilter(const Entity _entity)
+{
+  auto groupIt = this->collisionGroupIds.find(_entity);
+  if (groupIt == this->collisionGroupIds.end())
+    return;
+
+  this->collisionGroups[groupIt->second].members.erase(_entity);
+  this->collisionGroupIds.erase(groupIt);
+}
+
 //////////////////////////////////////////////////
 void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
                                          bool _warnIfEntityExists)
@@ -1695,8 +1890,8 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
           // No need to create this joint because it was already created when
           // parsing the model.
           this->entityJointMap.AddEntity(_entity, existingJoint);
-          this->topLevelModelMap.insert(
-            std::make_pair(_entity, topLevelModel(_entity, _ecm)));
+          this->entityStateMap[_entity].topLevelModel =
+              topLevelModel(_entity, _ecm);
           return true;
         }
 
@@ -1739,8 +1934,8 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
           // Some joints may not be supported, so only add them to the map if
           // the physics entity is valid
           this->entityJointMap.AddEntity(_entity, jointPtrPhys);
-          this->topLevelModelMap.insert(std::make_pair(_entity,
-              topLevelModel(_entity, _ecm)));
+          this->entityStateMap[_entity].topLevelModel =
+              topLevelModel(_entity, _ecm);
         }
         return true;
       });
@@ -1826,8 +2021,8 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
           gzdbg << "Creating detachable joint [" << _entity << "]"
                  << std::endl;
           this->entityJointMap.AddEntity(_entity, jointPtrPhys);
-          this->topLevelModelMap.insert(std::make_pair(_entity,
-              topLevelModel(_entity, _ecm)));
+          this->entityStateMap[_entity].topLevelModel =
+              topLevelModel(_entity, _ecm);
         }
         else
         {
@@ -1853,6 +2048,11 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
             this->EnableContactSurfaceCustomization(world);
           }
           this->customContactSurfaceEntities[world].insert(_entity);
+          if (auto collPtrPhys = this->entityCollisionMap.Get(_entity))
+          {
+            this->customContactSurfacePhysicsIds[world].insert(
+              collPtrPhys->EntityID());
+          }
           gzmsg << "Enabling contact surface customization for collision ["
                  << _name->Data() << "]" << std::endl;
         }
@@ -1860,6 +2060,11 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
         {
           if (this->customContactSurfaceEntities[world].erase(_entity) > 0)
           {
+            if (auto collPtrPhys = this->entityCollisionMap.Get(_entity))
+            {
+              this->customContactSurfacePhysicsIds[world].erase(
+                collPtrPhys->EntityID());
+            }
             gzmsg << "Disabling contact surface customization for collision ["
                    << _name->Data() << "]" << std::endl;
             if (this->customContactSurfaceEntities[world].empty())
@@ -1879,8 +2084,7 @@ void PhysicsPrivate::CreateBatteryEntities(const EntityComponentManager &_ecm)
       [&](const Entity & _entity, const components::BatterySoC *)->bool
       {
         // Parent entity of battery is model entity
-        this->entityOffMap.insert(std::make_pair(
-          _ecm.ParentEntity(_entity), false));
+        this->entityStateMap[_ecm.ParentEntity(_entity)].off = false;
         return true;
       });
 }
@@ -1910,11 +2114,15 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
             for (const auto &childCollision :
                  _ecm.ChildrenByComponents(childLink, components::Collision()))
             {
-              this->entityCollisionMap.Remove(childCollision);
-              this->topLevelModelMap.erase(childCollision);
               if (this->customContactSurfaceEntities[world].erase(
                 childCollision))
               {
+                if (auto collPtrPhys =
+                  this->entityCollisionMap.Get(childCollision))
+                {
+                  this->customContactSurfacePhysicsIds[world].erase(
+                    collPtrPhys->EntityID());
+                }
                 // if this was the last collision with contact customization,
                 // disable the whole feature in the physics engine
                 if (this->customContactSurfaceEntities[world].empty())
@@ -1922,12 +2130,14 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
                   this->DisableContactSurfaceCustomization(world);
                 }
               }
+              this->UnregisterCollisionFilter(childCollision);
+              this->entityCollisionMap.Remove(childCollision);
+              this->entityStateMap.erase(childCollision);
             }
             this->entityLinkMap.Remove(childLink);
             this->entityFreeGroupMap.Remove(childLink);
-            this->topLevelModelMap.erase(childLink);
+            this->entityStateMap.erase(childLink);
             this->staticEntities.erase(childLink);
-            this->linkWorldPoses.erase(childLink);
             this->canonicalLinkModelTracker.RemoveLink(childLink);
           }
 
@@ -1935,16 +2145,15 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
                _ecm.ChildrenByComponents(_entity, components::Joint()))
           {
             this->entityJointMap.Remove(childJoint);
-            this->topLevelModelMap.erase(childJoint);
+            this->entityStateMap.erase(childJoint);
           }
 
           this->entityFreeGroupMap.Remove(_entity);
           // Remove the model from the physics engine
           modelPtrPhys->Remove();
           this->entityModelMap.Remove(_entity);
-          this->topLevelModelMap.erase(_entity);
+          this->entityStateMap.erase(_entity);
           this->staticEntities.erase(_entity);
-          this->modelWorldPoses.erase(_entity);
         }
         return true;
       });
@@ -1993,9 +2202,9 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
       [&](const Entity & _entity, const components::BatterySoC *_bat)
       {
         if (_bat->Data() <= 0)
-          entityOffMap[_ecm.ParentEntity(_entity)] = true;
+          this->entityStateMap[_ecm.ParentEntity(_entity)].off = true;
         else
-          entityOffMap[_ecm.ParentEntity(_entity)] = false;
+          this->entityStateMap[_ecm.ParentEntity(_entity)].off = false;
         return true;
       });
 
@@ -2008,21 +2217,21 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
         if (nullptr == jointPhys)
           return true;
 
-        auto jointVelFeature =
-          this->entityJointMap.EntityCast<JointVelocityCommandFeatureList>(
-              _entity);
-
-        auto jointPosLimitsFeature =
-          this->entityJointMap.EntityCast<JointPositionLimitsCommandFeatureList>
-              (_entity);
-
-        auto jointVelLimitsFeature =
-          this->entityJointMap.EntityCast<JointVelocityLimitsCommandFeatureList>
-              (_entity);
-
-        auto jointEffLimitsFeature =
-          this->entityJointMap.EntityCast<JointEffortLimitsCommandFeatureList>(
-              _entity);
+        // Look up the command and reset components first. Most joints carry
+        // none of them, and skipping those joints early keeps the per-joint
+        // feature casts below off the common path.
+        auto posLimits = _ecm.Component<components::JointPositionLimitsCmd>(
+            _entity);
+        auto velLimits = _ecm.Component<components::JointVelocityLimitsCmd>(
+            _entity);
+        auto effLimits = _ecm.Component<components::JointEffortLimitsCmd>(
+            _entity);
+        auto posReset = _ecm.Component<components::JointPositionReset>(
+            _entity);
+        auto velReset = _ecm.Component<components::JointVelocityReset>(
+            _entity);
+        auto force = _ecm.Component<components::JointForceCmd>(_entity);
+        auto velCmd = _ecm.Component<components::JointVelocityCmd>(_entity);
 
         auto haltMotionComp = _ecm.Component<components::HaltMotion>(
             _ecm.ParentEntity(_entity));
@@ -2033,8 +2242,12 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
         }
 
         // Model is out of battery or halt motion has been triggered.
-        if (this->entityOffMap[_ecm.ParentEntity(_entity)] || haltMotion)
+        if (this->entityStateMap[_ecm.ParentEntity(_entity)].off ||
+            haltMotion)
         {
+          auto jointVelFeature =
+            this->entityJointMap.EntityCast<JointVelocityCommandFeatureList>(
+                _entity);
           std::size_t nDofs = jointPhys->GetDegreesOfFreedom();
           for (std::size_t i = 0; i < nDofs; ++i)
           {
@@ -2049,8 +2262,12 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           return true;
         }
 
-        auto posLimits = _ecm.Component<components::JointPositionLimitsCmd>(
-            _entity);
+        if (!posLimits && !velLimits && !effLimits && !posReset &&
+            !velReset && !force && !velCmd)
+        {
+          return true;
+        }
+
         if (posLimits && !posLimits->Data().empty())
         {
           const auto& limits = posLimits->Data();
@@ -2066,6 +2283,8 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
             << limits.size() << ".\n";
           }
 
+          auto jointPosLimitsFeature = this->entityJointMap
+              .EntityCast<JointPositionLimitsCommandFeatureList>(_entity);
           if (jointPosLimitsFeature)
           {
             std::size_t nDofs = std::min(
@@ -2080,8 +2299,6 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           }
         }
 
-        auto velLimits = _ecm.Component<components::JointVelocityLimitsCmd>(
-            _entity);
         if (velLimits && !velLimits->Data().empty())
         {
           const auto& limits = velLimits->Data();
@@ -2097,6 +2314,8 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
             << limits.size() << ".\n";
           }
 
+          auto jointVelLimitsFeature = this->entityJointMap
+              .EntityCast<JointVelocityLimitsCommandFeatureList>(_entity);
           if (jointVelLimitsFeature)
           {
             std::size_t nDofs = std::min(
@@ -2111,8 +2330,6 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           }
         }
 
-        auto effLimits = _ecm.Component<components::JointEffortLimitsCmd>(
-            _entity);
         if (effLimits && !effLimits->Data().empty())
         {
           const auto& limits = effLimits->Data();
@@ -2128,6 +2345,8 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
             << limits.size() << ".\n";
           }
 
+          auto jointEffLimitsFeature = this->entityJointMap
+              .EntityCast<JointEffortLimitsCommandFeatureList>(_entity);
           if (jointEffLimitsFeature)
           {
             std::size_t nDofs = std::min(
@@ -2142,11 +2361,6 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           }
         }
 
-        auto posReset = _ecm.Component<components::JointPositionReset>(
-            _entity);
-        auto velReset = _ecm.Component<components::JointVelocityReset>(
-            _entity);
-
         // Reset the velocity
         if (velReset)
         {
@@ -2195,9 +2409,6 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
             }
         }
 
-        auto force = _ecm.Component<components::JointForceCmd>(_entity);
-        auto velCmd = _ecm.Component<components::JointVelocityCmd>(_entity);
-
         if (force)
         {
           if (force->Data().size() != jointPhys->GetDegreesOfFreedom())
@@ -2242,6 +2453,9 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
                     << velocityCmd.size() << ".\n";
           }
 
+          auto jointVelFeature =
+            this->entityJointMap.EntityCast<JointVelocityCommandFeatureList>(
+                _entity);
           if (!jointVelFeature)
           {
             return true;
@@ -2312,8 +2526,20 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
         if (nullptr == modelPtrPhys)
           return true;
 
+        // A commanded pose moves the model regardless of engine dynamics,
+        // so stop backing off frame data queries for its links.
+        for (const auto &linkEnt : sim::Model(_entity).Links(_ecm))
+        {
+          auto stateIt = this->entityStateMap.find(linkEnt);
+          if (stateIt != this->entityStateMap.end())
+          {
+            stateIt->second.restingSteps = 0;
+            stateIt->second.skipSteps = 0;
+          }
+        }
+
         // world pose cmd currently not supported for nested models
-        if (_entity != this->topLevelModelMap[_entity])
+        if (_entity != this->entityStateMap[_entity].topLevelModel)
         {
           gzerr << "Unable to set world pose for nested models."
                  << std::endl;
@@ -2411,7 +2637,7 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           return true;
 
         // angular vel cmd currently not supported for nested models
-        if (_entity != this->topLevelModelMap[_entity])
+        if (_entity != this->entityStateMap[_entity].topLevelModel)
         {
           gzerr << "Unable to set angular velocity for nested models."
                  << std::endl;
@@ -2460,7 +2686,7 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           return true;
 
         // linear vel cmd currently not supported for nested models
-        if (_entity != this->topLevelModelMap[_entity])
+        if (_entity != this->entityStateMap[_entity].topLevelModel)
         {
           gzerr << "Unable to set linear velocity for nested models."
                  << std::endl;
@@ -2656,9 +2882,15 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
   GZ_PROFILE("PhysicsPrivate::ResetPhysics");
   // Clear worldPoseCmdsToRemove because pose commands that were issued before
   // the reset will be ignored.
-  this->linkWorldPoses.clear();
+  // Cached link and model world poses are invalid after a reset; the
+  // top level model records and battery state remain valid.
+  for (auto &[entity, state] : this->entityStateMap)
+  {
+    state.linkWorldPose.reset();
+    state.modelWorldPose.reset();
+    state.canonicalLinkPoseFromModel.reset();
+  }
   this->canonicalLinkModelTracker = CanonicalLinkModelTracker();
-  this->modelWorldPoses.clear();
   this->worldPoseCmdsToRemove.clear();
 
   this->RemovePhysicsEntities(_ecm);
@@ -2758,18 +2990,19 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
         return true;
       });
 
-  // Also update modelWorldPoses. This is a workaround to the problem that we
-  // don't have a way to reset the physics engine and clear its internal cache
-  // of link poses. In the event that a model's canonical link's pose hasn't
-  // changed after reset, the parent model's world pose won't be recorded in
-  // the modelWorldPoses map. If any of the model's other links have changed,
-  // however, we try to look for the parent model's world pose in
-  // modelWorldPoses and fail. So the workaround here is to update the world
+  // Also update the cached model world poses. This is a workaround to the
+  // problem that we don't have a way to reset the physics engine and clear
+  // its internal cache of link poses. In the event that a model's canonical
+  // link's pose hasn't changed after reset, the parent model's world pose
+  // won't be recorded in its entity state. If any of the model's other links
+  // have changed, however, we try to look for the parent model's cached
+  // world pose and fail. So the workaround here is to update the world
   // poses of all models.
   _ecm.Each<components::Model>(
       [&](const Entity &_entity, const components::Model *)
       {
-        this->modelWorldPoses[_entity] = sim::worldPose(_entity, _ecm);
+        this->entityStateMap[_entity].modelWorldPose =
+            sim::worldPose(_entity, _ecm);
         return true;
       });
 }
@@ -2785,9 +3018,50 @@ gz::physics::ForwardStep::Output PhysicsPrivate::Step(
 
   input.Get<std::chrono::steady_clock::duration>() = _dt;
 
-  for (const auto &world : this->entityWorldMap.Map())
+  const auto &worlds = this->entityWorldMap.Map();
+
+  if (worlds.size() > 1)
+  {
+    // Multiple physics worlds are dynamically independent of each other, so
+    // they can step concurrently. Each world gets its own output and state;
+    // the changed-pose entries are merged afterwards so downstream
+    // processing sees one combined result (the serial loop used to let each
+    // world overwrite the shared output).
+    std::vector<physics::ForwardStep::Output> outputs(worlds.size());
+    std::vector<physics::ForwardStep::State> states(worlds.size());
+    std::vector<std::future<void>> futures;
+    futures.reserve(worlds.size());
+
+    std::size_t index = 0;
+    for (const auto &world : worlds)
+    {
+      futures.push_back(std::async(std::launch::async,
+          [worldPtr = world.second, &input, &outputs, &states, index]()
+          {
+            worldPtr->Step(outputs[index], states[index], input);
+          }));
+      ++index;
+    }
+    for (auto &future : futures)
+      future.wait();
+
+    for (auto &worldOutput : outputs)
+    {
+      auto *changed = worldOutput.Query<physics::ChangedWorldPoses>();
+      if (nullptr == changed)
+        continue;
+
+      auto &merged = output.Get<physics::ChangedWorldPoses>();
+      merged.entries.insert(merged.entries.end(),
+          changed->entries.begin(), changed->entries.end());
+    }
+  }
+  else
   {
-    world.second->Step(output, state, input);
+    for (const auto &world : worlds)
+    {
+      world.second->Step(output, state, input);
+    }
   }
 
   return output;
@@ -2830,13 +3104,14 @@ math::Pose3d PhysicsPrivate::RelativePose(const Entity &_from,
 }
 
 //////////////////////////////////////////////////
-std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
+void PhysicsPrivate::ChangedLinks(
     EntityComponentManager &_ecm,
     const gz::physics::ForwardStep::Output &_updatedLinks)
 {
   GZ_PROFILE("Links Frame Data");
 
-  std::map<Entity, physics::FrameData3d> linkFrameData;
+  this->changedLinkFrames.clear();
+  this->changedLinkSet.clear();
 
   // Check to see if the physics engine gave a list of changed poses. If not, we
   // will iterate through all of the links via the ECM to see which ones changed
@@ -2862,7 +3137,7 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
       }
 
       auto frameData = linkPhys->FrameDataRelativeToWorld();
-      linkFrameData[entity] = frameData;
+      this->AppendLinkFrame(entity, frameData);
     }
   }
   else
@@ -2896,6 +3171,17 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
           return true;
         }
 
+        auto &linkState = this->entityStateMap[_entity];
+
+        // When enabled, back off frame data queries for resting links:
+        // a link whose pose has been stable for a while is re-checked
+        // every few steps instead of every step.
+        if (this->skipRestingLinks && linkState.skipSteps > 0)
+        {
+          --linkState.skipSteps;
+          return true;
+        }
+
         auto frameData = linkPhys->FrameDataRelativeToWorld();
 
         // update the link pose if this is the first update,
@@ -2903,41 +3189,59 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
         // (if the link pose hasn't changed, there's no need for a pose update)
         const auto worldPoseMath3d = gz::math::eigen3::convert(
             frameData.pose);
-        if ((this->linkWorldPoses.find(_entity) == this->linkWorldPoses.end())
-            || !this->pose3Eql(this->linkWorldPoses[_entity], worldPoseMath3d))
+        if (!linkState.linkWorldPose ||
+            !this->pose3Eql(*linkState.linkWorldPose, worldPoseMath3d))
         {
           // cache the updated link pose to check if the link pose has changed
           // during the next iteration
-          this->linkWorldPoses[_entity] = worldPoseMath3d;
+          linkState.linkWorldPose = worldPoseMath3d;
+          linkState.restingSteps = 0;
 
-          linkFrameData[_entity] = frameData;
+          this->AppendLinkFrame(_entity, frameData);
+        }
+        else if (this->skipRestingLinks)
+        {
+          // The longer a link has rested, the more steps are skipped
+          // before it is checked again, up to one check every 8 steps.
+          if (linkState.restingSteps < 256)
+            ++linkState.restingSteps;
+          linkState.skipSteps = static_cast<uint16_t>(
+              std::min<uint16_t>(linkState.restingSteps / 8u, 7u));
         }
 
         return true;
       });
   }
+}
 
-  return linkFrameData;
+//////////////////////////////////////////////////
+bool PhysicsPrivate::AppendLinkFrame(const Entity _entity,
+    const physics::FrameData3d &_frameData)
+{
+  if (!this->changedLinkSet.insert(_entity).second)
+    return false;
+
+  this->changedLinkFrames.emplace_back(_entity, _frameData);
+  return true;
 }
 
 //////////////////////////////////////////////////
 void PhysicsPrivate::UpdateModelPose(const Entity _model,
     const Entity _canonicalLink, EntityComponentManager &_ecm,
-    std::map<Entity, physics::FrameData3d> &_linkFrameData)
+    const physics::FrameData3d &_canonicalLinkFrame)
 {
   std::optional<math::Pose3d> parentWorldPose;
 
   // If this model is nested, the pose of the parent model has already
   // been updated since we iterate through the modified links in
   // topological order. We expect to find the updated pose in
-  // this->modelWorldPoses. If not found, this must not be nested, so this
+  // its entity state record. If not found, this must not be nested, so this
   // model's pose component would reflect it's absolute pose.
-  auto parentModelPoseIt =
-    this->modelWorldPoses.find(
-        _ecm.Component<components::ParentEntity>(_model)->Data());
-  if (parentModelPoseIt != this->modelWorldPoses.end())
+  auto parentStateIt = this->entityStateMap.find(
+      _ecm.Component<components::ParentEntity>(_model)->Data());
+  if (parentStateIt != this->entityStateMap.end())
   {
-    parentWorldPose = parentModelPoseIt->second;
+    parentWorldPose = parentStateIt->second.modelWorldPose;
   }
 
   // Given the following frame names:
@@ -2961,12 +3265,21 @@ void PhysicsPrivate::UpdateModelPose(const Entity _model,
   //
   // And X_WM is calculated from X_WL, which is obtained from physics as:
   //   X_WM = X_WL * (X_ML)^-1
-  auto linkPoseFromModel = this->RelativePose(_model, _canonicalLink, _ecm);
-  const auto &linkWorldPose = _linkFrameData[_canonicalLink].pose;
+  //
+  // X_ML is rigid: the model frame is attached to the canonical link, so
+  // the parent-chain walk computing it runs once per model, not per step.
+  auto &modelState = this->entityStateMap[_model];
+  if (!modelState.canonicalLinkPoseFromModel)
+  {
+    modelState.canonicalLinkPoseFromModel =
+        this->RelativePose(_model, _canonicalLink, _ecm);
+  }
+  const auto &linkPoseFromModel = *modelState.canonicalLinkPoseFromModel;
+  const auto &linkWorldPose = _canonicalLinkFrame.pose;
   const auto &modelWorldPose =
       math::eigen3::convert(linkWorldPose) * linkPoseFromModel.Inverse();
 
-  this->modelWorldPoses[_model] = modelWorldPose;
+  modelState.modelWorldPose = modelWorldPose;
 
   // update model's pose
   auto modelPose = _ecm.Component<components::Pose>(_model);
@@ -2992,14 +3305,14 @@ void PhysicsPrivate::UpdateModelPose(const Entity _model,
   for (const auto &childLink : model.Links(_ecm))
   {
     // skip links that are already marked as a link to be updated
-    if (_linkFrameData.find(childLink) != _linkFrameData.end())
+    if (this->changedLinkSet.find(childLink) != this->changedLinkSet.end())
       continue;
 
     physics::FrameData3d childLinkFrameData;
     if (!this->GetFrameDataRelativeToWorld(childLink, childLinkFrameData))
       continue;
 
-    _linkFrameData[childLink] = childLinkFrameData;
+    this->AppendLinkFrame(childLink, childLinkFrameData);
   }
 
   // since nested model poses are saved w.r.t. the nested model's parent
@@ -3021,7 +3334,8 @@ void PhysicsPrivate::UpdateModelPose(const Entity _model,
 
     // skip links that are already marked as a link to be updated
     if (nestedCanonicalLink == _canonicalLink ||
-        _linkFrameData.find(nestedCanonicalLink) != _linkFrameData.end())
+        this->changedLinkSet.find(nestedCanonicalLink) !=
+        this->changedLinkSet.end())
       continue;
 
     // mark this canonical link as one that needs to be updated so that all of
@@ -3031,7 +3345,7 @@ void PhysicsPrivate::UpdateModelPose(const Entity _model,
           canonicalLinkFrameData))
       continue;
 
-    _linkFrameData[nestedCanonicalLink] = canonicalLinkFrameData;
+    this->AppendLinkFrame(nestedCanonicalLink, canonicalLinkFrameData);
   }
 }
 
@@ -3056,8 +3370,7 @@ bool PhysicsPrivate::GetFrameDataRelativeToWorld(const Entity _entity,
 }
 
 //////////////////////////////////////////////////
-void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
-    std::map<Entity, physics::FrameData3d> &_linkFrameData)
+void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm)
 {
   GZ_PROFILE("PhysicsPrivate::UpdateSim");
 
@@ -3102,33 +3415,52 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
   // make sure we have an up-to-date mapping of canonical links to their models
   this->canonicalLinkModelTracker.AddNewModels(_ecm);
 
-  for (const auto &[linkEntity, frameData] : _linkFrameData)
+  // The changed links are processed in passes. Each pass is sorted in
+  // ascending entity id order, which is topological order since entity ids
+  // are created in ascending order, so this properly handles pose updates
+  // for nested models that share the same canonical link. Links appended to
+  // the buffer by UpdateModelPose while a pass runs form the next pass, so
+  // nested models marked for update are handled after the parent model that
+  // marked them.
+  //
+  // Nested models that don't share the same canonical link also need to
+  // be updated since these nested models have their pose saved w.r.t. their
+  // parent model, which just experienced a pose update. The UpdateModelPose
+  // method also handles this case.
+  std::size_t passStart = 0;
+  while (passStart < this->changedLinkFrames.size())
   {
-    // get a topological ordering of the models that have linkEntity as the
-    // model's canonical link. If linkEntity isn't a canonical link for any
-    // models, canonicalLinkModels will be empty
-    auto canonicalLinkModels =
-      this->canonicalLinkModelTracker.CanonicalLinkModels(linkEntity);
-
-    // Update poses for all of the models that have this changed canonical link
-    // (linkEntity). Since we have the models in topological order and
-    // _linkFrameData stores links in topological order thanks to the ordering
-    // of std::map (entity IDs are created in ascending order), this should
-    // properly handle pose updates for nested models that share the same
-    // canonical link.
-    //
-    // Nested models that don't share the same canonical link will also need to
-    // be updated since these nested models have their pose saved w.r.t. their
-    // parent model, which just experienced a pose update. The UpdateModelPose
-    // method also handles this case.
-    for (auto &modelEnt : canonicalLinkModels)
-      this->UpdateModelPose(modelEnt, linkEntity, _ecm, _linkFrameData);
+    const std::size_t passEnd = this->changedLinkFrames.size();
+    std::sort(this->changedLinkFrames.begin() + passStart,
+        this->changedLinkFrames.begin() + passEnd,
+        [](const auto &_a, const auto &_b)
+        {
+          return _a.first < _b.first;
+        });
+
+    for (std::size_t i = passStart; i < passEnd; ++i)
+    {
+      const Entity linkEntity = this->changedLinkFrames[i].first;
+      // Copy the frame data: UpdateModelPose may append to the buffer,
+      // which would invalidate a reference into it.
+      const physics::FrameData3d frameData = this->changedLinkFrames[i].second;
+
+      // get a topological ordering of the models that have linkEntity as
+      // the model's canonical link. If linkEntity isn't a canonical link
+      // for any models, canonicalLinkModels will be empty
+      auto canonicalLinkModels =
+        this->canonicalLinkModelTracker.CanonicalLinkModels(linkEntity);
+
+      for (auto &modelEnt : canonicalLinkModels)
+        this->UpdateModelPose(modelEnt, linkEntity, _ecm, frameData);
+    }
+    passStart = passEnd;
   }
   GZ_PROFILE_END();
 
   // Link poses, velocities...
   GZ_PROFILE_BEGIN("Links");
-  for (const auto &[entity, frameData] : _linkFrameData)
+  for (const auto &[entity, frameData] : this->changedLinkFrames)
   {
     GZ_PROFILE_BEGIN("Local pose");
     auto canonicalLink =
@@ -3140,15 +3472,17 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
     if (!canonicalLink)
     {
       // Compute the relative pose of this link from the parent model
-      auto parentModelPoseIt = this->modelWorldPoses.find(parentEntity);
-      if (parentModelPoseIt == this->modelWorldPoses.end())
+      auto parentStateIt = this->entityStateMap.find(parentEntity);
+      if (parentStateIt == this->entityStateMap.end() ||
+          !parentStateIt->second.modelWorldPose)
       {
         gzerr << "Internal error: parent model [" << parentEntity
               << "] does not have a world pose available for child entity["
               << entity << "]" << std::endl;
         continue;
       }
-      const math::Pose3d &parentWorldPose = parentModelPoseIt->second;
+      const math::Pose3d &parentWorldPose =
+          *parentStateIt->second.modelWorldPose;
 
       // Unlike canonical links, pose of regular links can move relative.
       // to the parent. Same for links inside nested models.
@@ -3742,6 +4076,25 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
     return;
   }
 
+  // Collision entities that consume contact data. Contact sensors register
+  // interest by creating a ContactSensorData component on their collision
+  // entity, so only contacts that involve at least one of these entities
+  // need to be marshaled; everything else the physics engine reports can be
+  // skipped without building message structures for it.
+  std::unordered_set<Entity> interestedEntities;
+  _ecm.Each<components::Collision, components::ContactSensorData>(
+      [&](const Entity &_entity, components::Collision *,
+          components::ContactSensorData *) -> bool
+      {
+        interestedEntities.insert(_entity);
+        return true;
+      });
+
+  // HasComponentType reports true for component types that have ever been
+  // created, so all contact sensors may be gone by now.
+  if (interestedEntities.empty())
+    return;
+
   // Each contact object we get from gz-physics contains the EntityPtrs of the
   // two colliding entities and other data about the contact such as the
   // position. This map groups contacts so that it is easy to query all the
@@ -3751,7 +4104,8 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
 
   // This data structure is essentially a mapping between a pair of entities and
   // a list of pointers to their contact object. We use a map inside a map to
-  // create msgs::Contact objects conveniently later on.
+  // create msgs::Contact objects conveniently later on. Only entities a
+  // contact sensor consumes are added to it.
   std::unordered_map<Entity, EntityContactMap> entityContactMap;
 
   // Note that we are temporarily storing pointers to elements in this
@@ -3769,8 +4123,10 @@ void PhysicsPrivate::UpdateCollisions(EntityComponentManager &_ecm)
 
     if (coll1Entity != kNullEntity && coll2Entity != kNullEntity)
     {
-      entityContactMap[coll1Entity][coll2Entity].push_back(&contact);
-      entityContactMap[coll2Entity][coll1Entity].push_back(&contact);
+      if (interestedEntities.find(coll1Entity) != interestedEntities.end())
+        entityContactMap[coll1Entity][coll2Entity].push_back(&contact);
+      if (interestedEntities.find(coll2Entity) != interestedEntities.end())
+        entityContactMap[coll2Entity][coll1Entity].push_back(&contact);
     }
   }
 
@@ -3856,29 +4212,37 @@ void PhysicsPrivate::EnableContactSurfaceCustomization(const Entity &_world)
   using ContactPoint = GCFeatureWorld::ContactPoint;
   using ExtraContactData = GCFeature::ExtraContactDataT<Policy>;
 
+  // Resolve the per-world set of customized physics IDs once; references
+  // into the unordered_map values stay valid while the callback is
+  // installed.
+  const auto &customPhysicsIds = this->customContactSurfacePhysicsIds[_world];
+
   const auto callbackID = "gz::sim::systems::Physics";
   setContactPropertiesCallbackFeature->AddContactPropertiesCallback(
     callbackID,
-    [this, _world](const GCFeatureWorld::Contact &_contact,
+    [this, &customPhysicsIds](const GCFeatureWorld::Contact &_contact,
       const size_t _numContactsOnCollision,
       Feature::ContactSurfaceParams<Policy> &_params)
       {
         const auto &contact = _contact.Get<ContactPoint>();
-        auto coll1Entity = this->entityCollisionMap.GetByPhysicsId(
-          contact.collision1->EntityID());
-        auto coll2Entity = this->entityCollisionMap.GetByPhysicsId(
-          contact.collision2->EntityID());
 
         // check if at least one of the entities wants contact surface
-        // customization
-        if (this->customContactSurfaceEntities[_world].find(coll1Entity) ==
-          this->customContactSurfaceEntities[_world].end() &&
-          this->customContactSurfaceEntities[_world].find(coll2Entity) ==
-          this->customContactSurfaceEntities[_world].end())
+        // customization; this callback runs for every contact in the world,
+        // so bail out for uninvolved contacts before resolving any Gazebo
+        // entities
+        if (customPhysicsIds.find(contact.collision1->EntityID()) ==
+          customPhysicsIds.end() &&
+          customPhysicsIds.find(contact.collision2->EntityID()) ==
+          customPhysicsIds.end())
         {
           return;
         }
 
+        auto coll1Entity = this->entityCollisionMap.GetByPhysicsId(
+          contact.collision1->EntityID());
+        auto coll2Entity = this->entityCollisionMap.GetByPhysicsId(
+          contact.collision2->EntityID());
+
         std::optional<math::Vector3d> force;
         std::optional<math::Vector3d> normal;
         std::optional<double> depth;
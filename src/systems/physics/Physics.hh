@@ -76,6 +76,20 @@ namespace systems
   ///    </contacts>
   ///  </plugin>
   ///  ```
+  /// Includes optional parameter : <skip_resting_links>. When set to
+  /// true, pose queries for links whose pose has been stable for a while
+  /// are backed off to every few steps instead of every step, which
+  /// reduces per-step cost in worlds with many resting bodies at the
+  /// price of reacting to a wake-up with a few steps of delay. False by
+  /// default.
+  ///
+  /// Broadphase collision candidate generation is owned by the physics
+  /// engine, not by this system. For worlds with large amounts of static
+  /// geometry (e.g. terrain), select a collision detector with a
+  /// hierarchical broadphase through the world's `<physics><dart>`
+  /// element, e.g. `<collision_detector>bullet</collision_detector>`, so
+  /// dynamic bodies are paired against a tree over the static world
+  /// instead of the full collision set.
 
   class Physics:
     public System,
@@ -132,12 +132,12 @@ class gz::sim::systems::PosePublisherPrivate
   /// static_update_frequency parameter
   public: std::chrono::steady_clock::duration staticUpdatePeriod{0};
 
-  /// \brief Cache of entities, their frame names and their child frame names.
-  /// The key is the entity whose pose is to be published.
-  /// The frame name is the scoped name of the parent entity.
-  /// The child frame name is the scoped name of the entity (the key)
-  public: std::unordered_map<Entity, std::pair<std::string, std::string>>
-              entitiesToPublish;
+  /// \brief Cache of entities whose poses are to be published. The key is
+  /// the entity and the value is a prototype pose message carrying the
+  /// constant parts: the name and the frame_id (scoped name of the parent
+  /// entity) and child_frame_id (scoped name of the entity) header data.
+  /// Publishing copies the prototype and only fills in the stamp and pose.
+  public: std::unordered_map<Entity, msgs::Pose> entitiesToPublish;
 
   /// \brief Entities with pose that can change over time, i.e. links connected
   /// by joints
@@ -429,7 +429,21 @@ void PosePublisherPrivate::InitializeEntitiesToPublish(
               scopedName(parent->Data(), _ecm, "::", false), "::");
         }
       }
-      this->entitiesToPublish[entity] = std::make_pair(frame, childFrame);
+
+      // Prebuild the constant parts of the pose msg:
+      // frame_id: parent entity name
+      // child_frame_id: entity name
+      // pose is the transform from frame_id to child_frame_id
+      msgs::Pose prototype;
+      auto header = prototype.mutable_header();
+      auto frameData = header->add_data();
+      frameData->set_key("frame_id");
+      frameData->add_value(frame);
+      auto childFrameData = header->add_data();
+      childFrameData->set_key("child_frame_id");
+      childFrameData->add_value(childFrame);
+      prototype.set_name(childFrame);
+      this->entitiesToPublish[entity] = std::move(prototype);
     }
 
     // get dynamic entities
@@ -546,31 +560,17 @@ void PosePublisherPrivate::PublishPoses(
     }
     else
     {
-      this->poseMsg.Clear();
       msg = &this->poseMsg;
     }
 
-    // fill pose msg
-    // frame_id: parent entity name
-    // child_frame_id = entity name
-    // pose is the transform from frame_id to child_frame_id
+    // The prototype carries the constant name and frame_id /
+    // child_frame_id header data, so only the stamp and the pose itself
+    // remain to be filled in. Copying into a reused message keeps its
+    // string capacity, making the steady state allocation-free.
     GZ_ASSERT(msg != nullptr, "Pose msg is null");
-    auto header = msg->mutable_header();
-
-    header->mutable_stamp()->CopyFrom(_stampMsg);
-    const std::string &frameId = entityIt->second.first;
-    const std::string &childFrameId = entityIt->second.second;
-    const math::Pose3d &transform = pose;
-    auto frame = header->add_data();
-    frame->set_key("frame_id");
-    frame->add_value(frameId);
-    auto childFrame = header->add_data();
-    childFrame->set_key("child_frame_id");
-    childFrame->add_value(childFrameId);
-
-    // set pose
-    msg->set_name(childFrameId);
-    msgs::Set(msg, transform);
+    msg->CopyFrom(entityIt->second);
+    msg->mutable_header()->mutable_stamp()->CopyFrom(_stampMsg);
+    msgs::Set(msg, pose);
 
     // publish individual pose msgs
     if (!this->usePoseV)
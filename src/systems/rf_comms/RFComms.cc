@@ -24,6 +24,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <sdf/sdf.hh>
 #include <gz/common/Profiler.hh>
@@ -163,13 +164,21 @@ class gz::sim::systems::RFComms::Implementation
   ///
   /// \param[in out] _txState Current state of the transmitter.
   /// \param[in out] _rxState Current state of the receiver.
+  /// \param[in] _rxPowerDist Received power distribution for this pair,
+  /// taken from the channel cache.
   /// \param[in] _numBytes Size of the packet.
   /// \return std::tuple<bool, double> reporting if the packet should be
   /// delivered and the received signal strength (in dBm).
   public: std::tuple<bool, double> AttemptSend(RadioState &_txState,
                                                RadioState &_rxState,
+                                               const RFPower &_rxPowerDist,
                                                const uint64_t &_numBytes);
 
+  /// \brief Recompute the pairwise channel cache from the current radio
+  /// poses. Pairs beyond the maximum range are rejected on squared distance
+  /// alone, before any path loss math, and don't enter the cache.
+  public: void UpdateChannelCache();
+
   /// \brief Convert from dBm to power.
   /// \param[in] _dBm Input in dBm.
   /// \return Power in watts (W).
@@ -183,15 +192,6 @@ class gz::sim::systems::RFComms::Implementation
   private: double QPSKPowerToBER(double _power,
                                  double _noise) const;
 
-  /// \brief Function to compute the pathloss between two antenna poses.
-  /// \param[in] _txPower Tx power.
-  /// \param[in] _txState Radio state of the transmitter.
-  /// \param[in] _rxState Radio state of the receiver.
-  /// \return The RFPower pathloss distribution of the two antenna poses.
-  private: RFPower LogNormalReceivedPower(const double &_txPower,
-                                          const RadioState &_txState,
-                                          const RadioState &_rxState) const;
-
   /// \brief Range configuration.
   public: RangeConfiguration rangeConfig;
 
@@ -201,6 +201,20 @@ class gz::sim::systems::RFComms::Implementation
   /// \brief A map where the key is the address and the value its radio state.
   public: std::unordered_map<std::string, RadioState> radioStates;
 
+  /// \brief Mean received power (dBm) for each pair of addresses within
+  /// range. The outer key is the transmitter address and the inner key the
+  /// receiver address. Pairs absent from the cache are out of range.
+  public: std::unordered_map<std::string,
+      std::unordered_map<std::string, double>> channelCache;
+
+  /// \brief Period (seconds) between channel cache updates. 0 refreshes
+  /// the cache on every step.
+  public: double channelUpdatePeriod = 0.0;
+
+  /// \brief Simulation time of the last channel cache update. Negative
+  /// until the first update.
+  public: double lastChannelUpdateTime = -1.0;
+
   /// \brief Duration of an epoch (seconds).
   public: double epochDuration = 1.0;
 
@@ -225,24 +239,57 @@ double RFComms::Implementation::QPSKPowerToBER(
 }
 
 /////////////////////////////////////////////
-RFPower RFComms::Implementation::LogNormalReceivedPower(
-  const double &_txPower, const RadioState &_txState,
-  const RadioState &_rxState) const
+void RFComms::Implementation::UpdateChannelCache()
 {
-  const double kRange = _txState.pose.Pos().Distance(_rxState.pose.Pos());
+  this->channelCache.clear();
+
+  // Snapshot addresses and positions into contiguous arrays so the
+  // pairwise distance pass below stays cache-friendly and is easy for the
+  // compiler to vectorize.
+  std::vector<const std::string *> addresses;
+  std::vector<math::Vector3d> positions;
+  addresses.reserve(this->radioStates.size());
+  positions.reserve(this->radioStates.size());
+  for (const auto &[address, state] : this->radioStates)
+  {
+    addresses.push_back(&address);
+    positions.push_back(state.pose.Pos());
+  }
 
-  if (this->rangeConfig.maxRange > 0.0 && kRange > this->rangeConfig.maxRange)
-    return {-std::numeric_limits<double>::infinity(), 0.0};
+  const double kMaxRangeSquared =
+    this->rangeConfig.maxRange * this->rangeConfig.maxRange;
+
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    for (size_t j = i + 1; j < positions.size(); ++j)
+    {
+      const double kRangeSquared =
+        (positions[i] - positions[j]).SquaredLength();
+
+      // Early rejection on squared distance: out of range pairs don't pay
+      // for any path loss math and don't enter the cache.
+      if (this->rangeConfig.maxRange > 0.0 &&
+          kRangeSquared > kMaxRangeSquared)
+      {
+        continue;
+      }
 
-  const double kPL = this->rangeConfig.l0 +
-    10 * this->rangeConfig.fadingExponent * log10(kRange);
+      const double kPL = this->rangeConfig.l0 +
+        10 * this->rangeConfig.fadingExponent * log10(sqrt(kRangeSquared));
 
-  return {_txPower - kPL, pow(this->rangeConfig.sigma, 2.)};
+      // The mean received power only depends on the distance, so it's the
+      // same in both directions.
+      const double kRxPower = this->radioConfig.txPower - kPL;
+      this->channelCache[*addresses[i]][*addresses[j]] = kRxPower;
+      this->channelCache[*addresses[j]][*addresses[i]] = kRxPower;
+    }
+  }
 }
 
 /////////////////////////////////////////////
 std::tuple<bool, double> RFComms::Implementation::AttemptSend(
-  RadioState &_txState, RadioState &_rxState, const uint64_t &_numBytes)
+  RadioState &_txState, RadioState &_rxState, const RFPower &_rxPowerDist,
+  const uint64_t &_numBytes)
 {
   double now = _txState.timeStamp;
 
@@ -277,14 +324,13 @@ std::tuple<bool, double> RFComms::Implementation::AttemptSend(
   _txState.bytesSent.push_back(std::make_pair(now, _numBytes));
   _txState.bytesSentThisEpoch += _numBytes;
 
-  // Get the received power based on TX power and position of each node.
-  auto rxPowerDist =
-    this->LogNormalReceivedPower(this->radioConfig.txPower, _txState, _rxState);
-
-  double rxPower = rxPowerDist.mean;
-  if (rxPowerDist.variance > 0.0)
+  // The received power distribution comes from the channel cache, which is
+  // recomputed from the radio poses at the configured rate.
+  double rxPower = _rxPowerDist.mean;
+  if (_rxPowerDist.variance > 0.0)
   {
-    std::normal_distribution<> d{rxPowerDist.mean, sqrt(rxPowerDist.variance)};
+    std::normal_distribution<> d{_rxPowerDist.mean,
+      sqrt(_rxPowerDist.variance)};
     rxPower = d(this->rndEngine);
   }
 
@@ -391,6 +437,12 @@ void RFComms::Load(const Entity &/*_entity*/,
         this->dataPtr->radioConfig.noiseFloor).first;
   }
 
+  if (_sdf->HasElement("channel_update_period"))
+  {
+    this->dataPtr->channelUpdatePeriod =
+      _sdf->Get<double>("channel_update_period");
+  }
+
   gzdbg << "Range configuration:" << std::endl
          << this->dataPtr->rangeConfig << std::endl;
 
@@ -425,15 +477,27 @@ void RFComms::Step(
     }
     else
     {
-      // Update radio state.
-      const auto kPose = sim::worldPose(content.entity, _ecm);
-      this->dataPtr->radioStates[address].pose = kPose;
-      this->dataPtr->radioStates[address].timeStamp =
+      // Update radio state. Single lookup per address; this pass runs for
+      // every radio on every step.
+      auto &radioState = this->dataPtr->radioStates[address];
+      radioState.pose = sim::worldPose(content.entity, _ecm);
+      radioState.timeStamp =
         std::chrono::duration<double>(_info.simTime).count();
-      this->dataPtr->radioStates[address].name = content.modelName;
+      radioState.name = content.modelName;
     }
   }
 
+  // Refresh the pairwise channel cache at the configured rate instead of
+  // computing the path loss once per message.
+  const double kNow = std::chrono::duration<double>(_info.simTime).count();
+  if (this->dataPtr->lastChannelUpdateTime < 0.0 ||
+      kNow - this->dataPtr->lastChannelUpdateTime >=
+      this->dataPtr->channelUpdatePeriod)
+  {
+    this->dataPtr->UpdateChannelCache();
+    this->dataPtr->lastChannelUpdateTime = kNow;
+  }
+
   for (auto & [address, content] : _currentRegistry)
   {
     // Reference to the outbound queue for this address.
@@ -443,6 +507,9 @@ void RFComms::Step(
     auto itSrc = this->dataPtr->radioStates.find(address);
     if (itSrc != this->dataPtr->radioStates.end())
     {
+      // Channels out of this transmitter, from the cache.
+      auto itTxChannels = this->dataPtr->channelCache.find(address);
+
       // All these messages need to be processed.
       for (const auto &msg : outbound)
       {
@@ -451,8 +518,22 @@ void RFComms::Step(
         if (itDst == this->dataPtr->radioStates.end())
           continue;
 
+        // Pairs absent from the cache are out of range: the packet is
+        // still attempted so that it counts against the transmitter
+        // bitrate, but it can't be received.
+        RFPower rxPowerDist{-std::numeric_limits<double>::infinity(), 0.0};
+        if (itTxChannels != this->dataPtr->channelCache.end())
+        {
+          auto itRx = itTxChannels->second.find(msg->dst_address());
+          if (itRx != itTxChannels->second.end())
+          {
+            rxPowerDist = {itRx->second,
+              pow(this->dataPtr->rangeConfig.sigma, 2.)};
+          }
+        }
+
         auto [sendPacket, rssi] = this->dataPtr->AttemptSend(
-          itSrc->second, itDst->second, msg->data().size());
+          itSrc->second, itDst->second, rxPowerDist, msg->data().size());
 
         if (sendPacket)
         {
@@ -62,6 +62,13 @@ namespace systems
   ///    * <noise_floor>: Noise floor in dBm.  Default is -90dBm.
   ///    * <modulation>: Supported modulations: ["QPSK"]. Default is "QPSK".
   ///
+  /// <channel_update_period>: Period (seconds) between updates of the
+  ///                          pairwise channel cache. The path loss between
+  ///                          every pair of radios within range is computed
+  ///                          at this rate instead of once per message.
+  ///                          Default is 0, which refreshes the cache on
+  ///                          every step.
+  ///
   /// Here's an example:
   /// <plugin
   ///   filename="gz-sim-rf-comms-system"
@@ -17,16 +17,23 @@
 
 #include "SceneBroadcaster.hh"
 
+#include <gz/msgs/axis_aligned_box.pb.h>
 #include <gz/msgs/scene.pb.h>
+#include <gz/msgs/uint32_v.pb.h>
+#include <gz/msgs/uint64.pb.h>
 
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <list>
 #include <map>
+#include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
+#include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/graph/Graph.hh>
 #include <gz/plugin/Register.hh>
 #include <gz/transport/Node.hh>
@@ -98,6 +105,22 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \return True if successful.
   public: bool SceneGraphService(msgs::StringMsg &_res);
 
+  /// \brief Callback for the scene diff service. Responds with the scene
+  /// graph changes that happened after the version the client reports,
+  /// so reconnecting clients can apply a small diff instead of
+  /// rebuilding the whole scene. The response header carries the
+  /// server's current version under the "version" key and the ids of
+  /// removed entities under the "deletions" key. When the requested
+  /// version is unknown or predates the change log, the full scene is
+  /// returned and the header carries "full" set to "true".
+  /// \param[in] _req Last scene graph version the client has applied.
+  /// Zero requests the full scene.
+  /// \param[out] _res Response containing the changes since that
+  /// version.
+  /// \return True if successful.
+  public: bool SceneDiffService(const msgs::UInt64 &_req,
+              msgs::Scene &_res);
+
   /// \brief Callback for state service.
   /// \param[out] _res Response containing the latest full state.
   /// \return True if successful.
@@ -107,6 +130,20 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \param[out] _res Response containing the last available full state.
   public: void StateAsyncService(const msgs::StringMsg &_req);
 
+  /// \brief Callback for the pose filter service. Registers a world-frame
+  /// axis-aligned region of interest and advertises a topic that only
+  /// carries the poses of models (and their links) inside that region.
+  /// \param[in] _req Region of interest, in world coordinates.
+  /// \param[out] _res Response containing the topic the filtered poses are
+  /// published on.
+  /// \return True if successful.
+  public: bool PoseFilterService(const msgs::AxisAlignedBox &_req,
+              msgs::StringMsg &_res);
+
+  /// \brief Get whether any registered pose region has subscribers.
+  /// \return True if at least one region topic has connections.
+  public: bool HasPoseRegionConnections();
+
   /// \brief Updates the scene graph when entities are added
   /// \param[in] _manager The entity component manager
   public: void SceneGraphAddEntities(const EntityComponentManager &_manager);
@@ -199,6 +236,15 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief Dynamic pose publisher, for non-static model poses
   public: transport::Node::Publisher dyPosePub;
 
+  /// \brief Pose message reused across PoseUpdate calls. Clearing a
+  /// protobuf message keeps its repeated pose elements and their string
+  /// capacity allocated, so refilling it each cycle is allocation-free
+  /// in steady state.
+  public: msgs::Pose_V poseMsg;
+
+  /// \brief Dynamic pose message reused across PoseUpdate calls.
+  public: msgs::Pose_V dyPoseMsg;
+
   /// \brief Rate at which to publish dynamic poses
   public: int dyPoseHertz{60};
 
@@ -212,6 +258,36 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief State publisher
   public: transport::Node::Publisher statePub;
 
+  /// \brief Delta state publisher. Unlike statePub, this stream only
+  /// carries the components that changed since the previous message, with
+  /// full keyframes interleaved every stateKeyframeInterval messages so
+  /// that late joiners and lossy links can resynchronize. The regular state
+  /// topic is unaffected, so existing clients keep getting the full stream.
+  public: transport::Node::Publisher deltaStatePub;
+
+  /// \brief Number of messages published on the delta state stream so far.
+  /// Used to decide when the next keyframe is due.
+  public: uint64_t deltaStatesPublished{0};
+
+  /// \brief Number of messages between two full keyframes on the delta
+  /// state stream.
+  public: uint64_t stateKeyframeInterval{100};
+
+  /// \brief On-change state publisher. Only carries a message when the
+  /// ECM had a change event (new or removed entities, one-time component
+  /// changes), so introspection clients such as dashboards can subscribe
+  /// instead of polling the state service.
+  public: transport::Node::Publisher onChangeStatePub;
+
+  /// \brief Cached response for the full state services, refilled the
+  /// first time the state is requested after a change and reused until
+  /// the ECM changes again. Protected by stateMutex.
+  public: msgs::SerializedStepMap cachedFullState;
+
+  /// \brief Whether cachedFullState still reflects the current ECM.
+  /// Protected by stateMutex.
+  public: bool cachedFullStateValid{false};
+
   /// \brief Graph containing latest information from entities.
   /// The data in each node is the message associated with that entity only.
   /// i.e, a model node only has a message about the model. It will not
@@ -230,6 +306,53 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief Protects scene graph.
   public: std::mutex graphMutex;
 
+  /// \brief Monotonically increasing version of the scene graph.
+  /// Bumped once per batch of additions or removals. Protected by
+  /// graphMutex.
+  public: uint64_t sceneGraphVersion{0};
+
+  /// \brief One batch of scene graph changes for the diff service.
+  public: struct SceneGraphChange
+  {
+    /// \brief Version the scene graph reached with this change.
+    uint64_t version;
+
+    /// \brief Entities added in this change, as a partial scene message.
+    msgs::Scene additions;
+
+    /// \brief Ids of entities removed in this change.
+    msgs::UInt32_V deletions;
+  };
+
+  /// \brief Log of recent scene graph changes, oldest first. Trimmed to
+  /// sceneGraphChangeLogSize entries; diff requests that predate the log
+  /// fall back to a full scene. Protected by graphMutex.
+  public: std::list<SceneGraphChange> sceneGraphChanges;
+
+  /// \brief Maximum number of change batches kept for the diff service.
+  public: size_t sceneGraphChangeLogSize{1000};
+
+  /// \brief Scene message built for the last scene/info request, reused
+  /// verbatim while the scene graph version is unchanged, so a burst of
+  /// connecting GUI clients only pays one scene construction. Protected
+  /// by sceneCacheMutex.
+  public: msgs::Scene cachedScene;
+
+  /// \brief Scene graph version cachedScene was built from, or nullopt
+  /// when nothing has been cached yet.
+  public: std::optional<uint64_t> cachedSceneVersion;
+
+  /// \brief Streamed graph built for the last scene/graph request.
+  /// Protected by sceneCacheMutex.
+  public: std::string cachedGraphStr;
+
+  /// \brief Scene graph version cachedGraphStr was built from, or
+  /// nullopt when nothing has been cached yet.
+  public: std::optional<uint64_t> cachedGraphVersion;
+
+  /// \brief Protects the cached scene responses.
+  public: std::mutex sceneCacheMutex;
+
   /// \brief Protects stepMsg.
   public: std::mutex stateMutex;
 
@@ -268,6 +391,32 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief Flag used to indicate if periodic changes need to be published
   /// This is currently only used in playback mode.
   public: bool pubPeriodicChanges{false};
+
+  /// \brief A region of interest registered through the pose filter
+  /// service.
+  public: struct PoseRegion
+  {
+    /// \brief Region of interest, in world coordinates.
+    math::AxisAlignedBox box;
+
+    /// \brief Publisher for the poses inside the region.
+    transport::Node::Publisher pub;
+
+    /// \brief Filtered pose message reused across PoseUpdate calls.
+    msgs::Pose_V msg;
+  };
+
+  /// \brief Regions registered via PoseFilterService, keyed by the topic
+  /// they publish on.
+  public: std::map<std::string, PoseRegion> poseRegions;
+
+  /// \brief Protects poseRegions, which is modified from transport service
+  /// threads.
+  public: std::mutex poseRegionsMutex;
+
+  /// \brief Number of pose regions registered so far. Used to generate
+  /// unique region topic names.
+  public: uint64_t poseRegionCount{0};
 };
 
 //////////////////////////////////////////////////
@@ -316,6 +465,18 @@ void SceneBroadcaster::Configure(
         "Hz)\n";
   }
 
+  auto keyframeInterval = _sdf->Get<uint64_t>("state_keyframe_interval",
+      this->dataPtr->stateKeyframeInterval);
+  if (keyframeInterval.first > 0)
+  {
+    this->dataPtr->stateKeyframeInterval = keyframeInterval.first;
+  }
+  else
+  {
+    gzerr << "SceneBroadcaster state_keyframe_interval must be positive, "
+      << "using default (" << this->dataPtr->stateKeyframeInterval << ")\n";
+  }
+
   // Add to graph
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->graphMutex);
@@ -343,7 +504,8 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
 
   // Create and send pose update if transport connections exist.
   if (this->dataPtr->dyPosePub.HasConnections() ||
-      this->dataPtr->posePub.HasConnections())
+      this->dataPtr->posePub.HasConnections() ||
+      this->dataPtr->HasPoseRegionConnections())
   {
     this->dataPtr->PoseUpdate(_info, _manager);
   }
@@ -372,8 +534,27 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
       _manager.HasPeriodicComponentChanges();
   auto shouldPublish = this->dataPtr->statePub.HasConnections() &&
        (changeEvent || itsPubTime || pubChanges);
+  auto shouldPublishDelta = this->dataPtr->deltaStatePub.HasConnections() &&
+       (changeEvent || itsPubTime || pubChanges);
+  auto shouldPublishOnChange =
+      this->dataPtr->onChangeStatePub.HasConnections() && changeEvent;
+
+  // Keep the cached full-state response in sync: any ECM change makes it
+  // stale, while a quiet step only needs its statistics refreshed so the
+  // reported sim time stays current.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->stateMutex);
+    if (this->dataPtr->cachedFullStateValid)
+    {
+      if (changeEvent || _manager.HasPeriodicComponentChanges())
+        this->dataPtr->cachedFullStateValid = false;
+      else
+        set(this->dataPtr->cachedFullState.mutable_stats(), _info);
+    }
+  }
 
-  if (this->dataPtr->stateServiceRequest || shouldPublish)
+  if (this->dataPtr->stateServiceRequest || shouldPublish ||
+      shouldPublishDelta || shouldPublishOnChange)
   {
     std::unique_lock<std::mutex> lock(this->dataPtr->stateMutex);
     this->dataPtr->stepMsg.Clear();
@@ -432,6 +613,12 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     // Full state on demand
     if (this->dataPtr->stateServiceRequest)
     {
+      // The state just serialized stays valid until the ECM changes, so
+      // repeated introspection requests between changes are answered from
+      // this copy without another scene walk.
+      this->dataPtr->cachedFullState.CopyFrom(this->dataPtr->stepMsg);
+      this->dataPtr->cachedFullStateValid = true;
+
       this->dataPtr->stateServiceRequest = false;
       this->dataPtr->stateCv.notify_all();
     }
@@ -455,6 +642,46 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
       this->dataPtr->statePub.Publish(this->dataPtr->stepMsg);
       this->dataPtr->lastStatePubTime = now;
     }
+
+    // On-change stream: nothing goes out on quiet or purely periodic
+    // steps, so subscribers only wake up when the scene actually changed.
+    if (shouldPublishOnChange)
+    {
+      GZ_PROFILE("SceneBroadcast::PostUpdate Publish On-Change State");
+      this->dataPtr->onChangeStatePub.Publish(this->dataPtr->stepMsg);
+    }
+
+    // Delta-encoded state stream. A full keyframe goes out every
+    // stateKeyframeInterval messages (or when jumping back in time); in
+    // between, only the components that changed since the last message are
+    // serialized, which keeps the per-message payload proportional to the
+    // amount of change instead of the world size.
+    if (shouldPublishDelta)
+    {
+      GZ_PROFILE("SceneBroadcast::PostUpdate Publish Delta State");
+      msgs::SerializedStepMap deltaMsg;
+      set(deltaMsg.mutable_stats(), _info);
+
+      bool keyframe = this->dataPtr->deltaStatesPublished %
+          this->dataPtr->stateKeyframeInterval == 0;
+      if (keyframe || jumpBackInTime)
+      {
+        _manager.State(*deltaMsg.mutable_state(), {}, {}, true);
+      }
+      else if (changeEvent)
+      {
+        _manager.ChangedState(*deltaMsg.mutable_state());
+      }
+      else
+      {
+        _manager.State(*deltaMsg.mutable_state(), {},
+            _manager.ComponentTypesWithPeriodicChanges());
+      }
+
+      ++this->dataPtr->deltaStatesPublished;
+      this->dataPtr->deltaStatePub.Publish(deltaMsg);
+      this->dataPtr->lastStatePubTime = now;
+    }
   }
 }
 
@@ -473,10 +700,31 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
 {
   GZ_PROFILE("SceneBroadcast::PoseUpdate");
 
-  msgs::Pose_V poseMsg, dyPoseMsg;
+  // Refill the preallocated messages rather than building fresh ones;
+  // Clear() keeps the repeated pose elements allocated for reuse.
+  msgs::Pose_V &poseMsg = this->poseMsg;
+  msgs::Pose_V &dyPoseMsg = this->dyPoseMsg;
+  poseMsg.Clear();
+  dyPoseMsg.Clear();
   bool dyPoseConnections = this->dyPosePub.HasConnections();
   bool poseConnections = this->posePub.HasConnections();
 
+  // Gather the registered regions that have subscribers. Holding the mutex
+  // for the whole update is fine since region registration is rare.
+  std::lock_guard<std::mutex> regionLock(this->poseRegionsMutex);
+  std::vector<PoseRegion *> activeRegions;
+  for (auto &[topic, region] : this->poseRegions)
+  {
+    if (region.pub.HasConnections())
+    {
+      region.msg.Clear();
+      activeRegions.push_back(&region);
+    }
+  }
+  // The models found inside each region, so that their links can be
+  // included as well.
+  std::vector<std::unordered_set<Entity>> regionModels(activeRegions.size());
+
   // Models
   _manager.Each<components::Model, components::Name, components::Pose,
                 components::Static>(
@@ -502,6 +750,21 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           dyPose->set_name(_nameComp->Data());
           dyPose->set_id(_entity);
         }
+
+        // Add to the regions that contain the model. Top-level model poses
+        // are expressed in the world frame, which is also the frame the
+        // regions are registered in.
+        for (std::size_t ii = 0; ii < activeRegions.size(); ++ii)
+        {
+          if (activeRegions[ii]->box.Contains(_poseComp->Data().Pos()))
+          {
+            auto pose = activeRegions[ii]->msg.add_pose();
+            msgs::Set(pose, _poseComp->Data());
+            pose->set_name(_nameComp->Data());
+            pose->set_id(_entity);
+            regionModels[ii].insert(_entity);
+          }
+        }
         return true;
       });
 
@@ -534,6 +797,18 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           dyPose->set_id(_entity);
         }
 
+        // Add to the regions that contain the parent model
+        for (std::size_t ii = 0; ii < activeRegions.size(); ++ii)
+        {
+          if (regionModels[ii].count(_parentComp->Data()))
+          {
+            auto pose = activeRegions[ii]->msg.add_pose();
+            msgs::Set(pose, _poseComp->Data());
+            pose->set_name(_nameComp->Data());
+            pose->set_id(_entity);
+          }
+        }
+
         return true;
       });
 
@@ -546,6 +821,16 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
     this->dyPosePub.Publish(dyPoseMsg);
   }
 
+  // Publish the filtered pose messages, one per region with subscribers.
+  // Empty messages are published too so that subscribers can tell an empty
+  // region from a stalled stream.
+  for (std::size_t ii = 0; ii < activeRegions.size(); ++ii)
+  {
+    activeRegions[ii]->msg.mutable_header()->mutable_stamp()->CopyFrom(
+        convert<msgs::Time>(_info.simTime));
+    activeRegions[ii]->pub.Publish(activeRegions[ii]->msg);
+  }
+
   // Visuals
   if (poseConnections)
   {
@@ -616,6 +901,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Serving graph information on [" << opts.NameSpace() << "/"
          << graphService << "]" << std::endl;
 
+  // Scene diff service
+  std::string diffService{"scene/diff"};
+
+  this->node->Advertise(diffService,
+      &SceneBroadcasterPrivate::SceneDiffService, this);
+
+  gzmsg << "Serving scene changes on [" << opts.NameSpace() << "/"
+         << diffService << "]" << std::endl;
+
   // State service
   // Note: GuiRunner used to call this service but it is now using the async
   // version (state_async)
@@ -636,6 +930,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Serving full state (async) on [" << opts.NameSpace() << "/"
          << stateAsyncService << "]" << std::endl;
 
+  // Pose filter service
+  std::string poseFilterService{"pose/filter"};
+
+  this->node->Advertise(poseFilterService,
+      &SceneBroadcasterPrivate::PoseFilterService, this);
+
+  gzmsg << "Serving pose region registration on [" << opts.NameSpace() << "/"
+         << poseFilterService << "]" << std::endl;
+
   // Scene info topic
   std::string sceneTopic{ns + "/scene/info"};
 
@@ -662,6 +965,24 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Publishing state changes on [" << stateTopic << "]"
       << std::endl;
 
+  // Delta state topic
+  std::string deltaStateTopic{ns + "/state_delta"};
+
+  this->deltaStatePub =
+      this->node->Advertise<msgs::SerializedStepMap>(deltaStateTopic);
+
+  gzmsg << "Publishing delta-encoded state changes on [" << deltaStateTopic
+      << "]" << std::endl;
+
+  // On-change state topic
+  std::string onChangeStateTopic{ns + "/state_on_change"};
+
+  this->onChangeStatePub =
+      this->node->Advertise<msgs::SerializedStepMap>(onChangeStateTopic);
+
+  gzmsg << "Publishing state on change events on [" << onChangeStateTopic
+      << "]" << std::endl;
+
   // Pose info publisher
   std::string poseTopic{"pose/info"};
 
@@ -688,18 +1009,49 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
 //////////////////////////////////////////////////
 bool SceneBroadcasterPrivate::SceneInfoService(msgs::Scene &_res)
 {
-  std::lock_guard<std::mutex> lock(this->graphMutex);
-
   _res.Clear();
 
+  // Snapshot the graph under the lock and build the message outside it,
+  // so that a burst of scene requests from connecting GUI clients can't
+  // stall PostUpdate on graphMutex for the whole message construction.
+  // Copying the graph shares the vertex payload messages, which are not
+  // modified after they are added.
+  SceneGraphType graphSnapshot;
+  sdf::Scene sceneSnapshot;
+  uint64_t version{0};
+  {
+    std::lock_guard<std::mutex> lock(this->graphMutex);
+    version = this->sceneGraphVersion;
+
+    // Serve repeat requests from the cached scene while the graph is
+    // unchanged, without walking the graph or rebuilding the message.
+    {
+      std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+      if (this->cachedSceneVersion && *this->cachedSceneVersion == version)
+      {
+        _res.CopyFrom(this->cachedScene);
+        return true;
+      }
+    }
+
+    graphSnapshot = this->sceneGraph;
+    sceneSnapshot = this->sdfScene;
+  }
+
   // Populate scene message
-  _res.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+  set(&_res, sceneSnapshot);
 
   // Add models
-  AddModels(&_res, this->worldEntity, this->sceneGraph);
+  AddModels(&_res, this->worldEntity, graphSnapshot);
 
   // Add lights
-  AddLights(&_res, this->worldEntity, this->sceneGraph);
+  AddLights(&_res, this->worldEntity, graphSnapshot);
+
+  {
+    std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+    this->cachedScene.CopyFrom(_res);
+    this->cachedSceneVersion = version;
+  }
 
   return true;
 }
@@ -709,6 +1061,15 @@ void SceneBroadcasterPrivate::StateAsyncService(
     const msgs::StringMsg &_req)
 {
   std::unique_lock<std::mutex> lock(this->stateMutex);
+
+  // Answer from the cached response when the ECM hasn't changed since it
+  // was serialized, without waiting for an iteration.
+  if (this->cachedFullStateValid)
+  {
+    this->node->Request(_req.data(), this->cachedFullState);
+    return;
+  }
+
   this->stateServiceRequest = true;
   this->stateRequests.insert(_req.data());
 }
@@ -722,6 +1083,14 @@ bool SceneBroadcasterPrivate::StateService(
   // Lock and wait for an iteration to be run and fill the state
   std::unique_lock<std::mutex> lock(this->stateMutex);
 
+  // Serve repeated introspection requests from the cache while the ECM is
+  // unchanged; only the statistics are refreshed between steps.
+  if (this->cachedFullStateValid)
+  {
+    _res.CopyFrom(this->cachedFullState);
+    return true;
+  }
+
   this->stateServiceRequest = true;
   auto success = this->stateCv.wait_for(lock, 5s, [&]
   {
@@ -739,18 +1108,184 @@ bool SceneBroadcasterPrivate::StateService(
 //////////////////////////////////////////////////
 bool SceneBroadcasterPrivate::SceneGraphService(msgs::StringMsg &_res)
 {
-  std::lock_guard<std::mutex> lock(this->graphMutex);
-
   _res.Clear();
 
+  // Snapshot under the lock, stream outside it. See SceneInfoService.
+  SceneGraphType graphSnapshot;
+  uint64_t version{0};
+  {
+    std::lock_guard<std::mutex> lock(this->graphMutex);
+    version = this->sceneGraphVersion;
+
+    // Serve repeat requests from the cached stream while the graph is
+    // unchanged.
+    {
+      std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+      if (this->cachedGraphVersion && *this->cachedGraphVersion == version)
+      {
+        _res.set_data(this->cachedGraphStr);
+        return true;
+      }
+    }
+
+    graphSnapshot = this->sceneGraph;
+  }
+
   std::stringstream graphStr;
-  graphStr << this->sceneGraph;
+  graphStr << graphSnapshot;
 
   _res.set_data(graphStr.str());
 
+  {
+    std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+    this->cachedGraphStr = _res.data();
+    this->cachedGraphVersion = version;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::SceneDiffService(const msgs::UInt64 &_req,
+    msgs::Scene &_res)
+{
+  _res.Clear();
+
+  const uint64_t fromVersion = _req.data();
+
+  // Hold graphMutex only while reading the change log or snapshotting the
+  // graph; the full-scene fallback message is built outside the lock. See
+  // SceneInfoService.
+  SceneGraphType graphSnapshot;
+  sdf::Scene sceneSnapshot;
+  uint64_t version = 0;
+  bool canDiff = false;
+  msgs::UInt32_V deletions;
+  {
+    std::lock_guard<std::mutex> lock(this->graphMutex);
+    version = this->sceneGraphVersion;
+
+    // The log covers the requested version if its oldest entry is no newer
+    // than the first change the client is missing. A client that reports a
+    // version ahead of the server (e.g. the server restarted) also gets a
+    // full scene.
+    canDiff = fromVersion <= version &&
+        (fromVersion == version ||
+         (!this->sceneGraphChanges.empty() &&
+          this->sceneGraphChanges.front().version <= fromVersion + 1));
+
+    if (canDiff)
+    {
+      for (const auto &change : this->sceneGraphChanges)
+      {
+        if (change.version <= fromVersion)
+          continue;
+        _res.MergeFrom(change.additions);
+        deletions.MergeFrom(change.deletions);
+      }
+    }
+    else
+    {
+      graphSnapshot = this->sceneGraph;
+      sceneSnapshot = this->sdfScene;
+    }
+  }
+
+  if (!canDiff)
+  {
+    // Fall back to the full scene, reusing the scene cached for
+    // scene/info when it matches this version.
+    bool cached{false};
+    {
+      std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+      if (this->cachedSceneVersion && *this->cachedSceneVersion == version)
+      {
+        _res.CopyFrom(this->cachedScene);
+        cached = true;
+      }
+    }
+    if (!cached)
+    {
+      set(&_res, sceneSnapshot);
+      AddModels(&_res, this->worldEntity, graphSnapshot);
+      AddLights(&_res, this->worldEntity, graphSnapshot);
+
+      std::lock_guard<std::mutex> cacheLock(this->sceneCacheMutex);
+      this->cachedScene.CopyFrom(_res);
+      this->cachedSceneVersion = version;
+    }
+
+    auto fullData = _res.mutable_header()->add_data();
+    fullData->set_key("full");
+    fullData->add_value("true");
+  }
+
+  auto versionData = _res.mutable_header()->add_data();
+  versionData->set_key("version");
+  versionData->add_value(std::to_string(version));
+
+  if (deletions.data_size() > 0)
+  {
+    auto deletionData = _res.mutable_header()->add_data();
+    deletionData->set_key("deletions");
+    for (const auto &entity : deletions.data())
+      deletionData->add_value(std::to_string(entity));
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::PoseFilterService(
+    const msgs::AxisAlignedBox &_req, msgs::StringMsg &_res)
+{
+  _res.Clear();
+
+  auto box = convert<math::AxisAlignedBox>(_req);
+  if (box.Min().X() > box.Max().X() || box.Min().Y() > box.Max().Y() ||
+      box.Min().Z() > box.Max().Z())
+  {
+    gzerr << "Failed to register pose region: min corner " << box.Min()
+           << " must not exceed max corner " << box.Max() << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(this->poseRegionsMutex);
+
+  auto topic = transport::TopicUtils::AsValidTopic("/world/" +
+      this->worldName + "/pose/filter/" +
+      std::to_string(this->poseRegionCount));
+  if (topic.empty())
+  {
+    gzerr << "Failed to create valid topic for pose region in world ["
+           << this->worldName << "]" << std::endl;
+    return false;
+  }
+  ++this->poseRegionCount;
+
+  auto &region = this->poseRegions[topic];
+  region.box = box;
+  region.pub = this->node->Advertise<msgs::Pose_V>(topic);
+
+  gzmsg << "Publishing filtered pose messages on [" << topic << "]"
+         << std::endl;
+
+  _res.set_data(topic);
   return true;
 }
 
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::HasPoseRegionConnections()
+{
+  std::lock_guard<std::mutex> lock(this->poseRegionsMutex);
+  for (auto &[topic, region] : this->poseRegions)
+  {
+    if (region.pub.HasConnections())
+      return true;
+  }
+  return false;
+}
+
 //////////////////////////////////////////////////
 void SceneBroadcasterPrivate::SceneGraphAddEntities(
     const EntityComponentManager &_manager)
@@ -837,16 +1372,14 @@ void SceneBroadcasterPrivate::SceneGraphAddEntities(
         auto geometryComp = _manager.Component<components::Geometry>(_entity);
         if (geometryComp)
         {
-          visualMsg->mutable_geometry()->CopyFrom(
-              convert<msgs::Geometry>(geometryComp->Data()));
+          set(visualMsg->mutable_geometry(), geometryComp->Data());
         }
 
         // Material is optional
         auto materialComp = _manager.Component<components::Material>(_entity);
         if (materialComp)
         {
-          visualMsg->mutable_material()->CopyFrom(
-              convert<msgs::Material>(materialComp->Data()));
+          set(visualMsg->mutable_material(), materialComp->Data());
         }
 
         // Add to graph
@@ -1141,13 +1674,27 @@ void SceneBroadcasterPrivate::SceneGraphAddEntities(
 
     msgs::Scene sceneMsg;
     // Populate scene message
-    sceneMsg.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+    set(&sceneMsg, this->sdfScene);
 
     AddModels(&sceneMsg, this->worldEntity, newGraph);
 
     // Add lights
     AddLights(&sceneMsg, this->worldEntity, newGraph);
     this->scenePub.Publish(sceneMsg);
+
+    // Record the batch for the scene diff service. The logged message
+    // carries only the new entities, not the scene preamble, so diffs
+    // can be concatenated.
+    {
+      std::lock_guard<std::mutex> lock(this->graphMutex);
+      SceneGraphChange change;
+      change.version = ++this->sceneGraphVersion;
+      AddModels(&change.additions, this->worldEntity, newGraph);
+      AddLights(&change.additions, this->worldEntity, newGraph);
+      this->sceneGraphChanges.push_back(std::move(change));
+      while (this->sceneGraphChanges.size() > this->sceneGraphChangeLogSize)
+        this->sceneGraphChanges.pop_front();
+    }
   }
 }
 
@@ -1193,6 +1740,14 @@ void SceneBroadcasterPrivate::SceneGraphRemoveEntities(
       deletionMsg.mutable_data()->Add(entity);
     }
     this->deletionPub.Publish(deletionMsg);
+
+    // Record the batch for the scene diff service
+    SceneGraphChange change;
+    change.version = ++this->sceneGraphVersion;
+    change.deletions = deletionMsg;
+    this->sceneGraphChanges.push_back(std::move(change));
+    while (this->sceneGraphChanges.size() > this->sceneGraphChangeLogSize)
+      this->sceneGraphChanges.pop_front();
   }
 }
 
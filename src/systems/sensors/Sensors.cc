@@ -17,14 +17,23 @@
 
 #include "Sensors.hh"
 
+#include <chrono>
+#include <functional>
+#include <queue>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <gz/msgs/boolean.pb.h>
+#include <gz/msgs/uint32.pb.h>
+
 #include <gz/common/Profiler.hh>
+#include <gz/common/StringUtils.hh>
 #include <gz/plugin/Register.hh>
+#include <gz/transport/Node.hh>
 
 #include <sdf/Sensor.hh>
 
@@ -48,6 +57,7 @@
 #include "gz/sim/components/Camera.hh"
 #include "gz/sim/components/DepthCamera.hh"
 #include "gz/sim/components/GpuLidar.hh"
+#include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/RenderEngineServerHeadless.hh"
 #include "gz/sim/components/RenderEngineServerPlugin.hh"
@@ -58,6 +68,7 @@
 #include "gz/sim/components/World.hh"
 #include "gz/sim/Events.hh"
 #include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Util.hh"
 
 #include "gz/sim/rendering/Events.hh"
 #include "gz/sim/rendering/RenderUtil.hh"
@@ -120,6 +131,10 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Thread that rendering will occur in
   public: std::thread renderThread;
 
+  /// \brief Logical CPUs the render thread pins itself to, parsed from
+  /// <render_thread_affinity>. Empty for unpinned.
+  public: std::vector<unsigned int> renderThreadCpus;
+
   /// \brief Mutex to protect rendering data
   public: std::mutex renderMutex;
 
@@ -148,6 +163,19 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Sensors to be updated next
   public: std::set<sensors::SensorId> sensorsToUpdate;
 
+  /// \brief Entry in the sensor scheduling heap: the time a sensor should
+  /// next be examined, paired with its id
+  public: using SensorDueEntry =
+      std::pair<std::chrono::steady_clock::duration, sensors::SensorId>;
+
+  /// \brief Min-heap with one entry per live sensor, ordered by next
+  /// examination time, so scheduling pops only the sensors actually due
+  /// instead of scanning all of them. Removed sensors are dropped lazily
+  /// when popped; sensors without subscribers are parked one period ahead.
+  /// Protected by sensorsMutex.
+  public: std::priority_queue<SensorDueEntry, std::vector<SensorDueEntry>,
+      std::greater<SensorDueEntry>> sensorDueHeap;
+
   /// \brief Mutex to protect sensorMask
   public: std::mutex sensorsMutex;
 
@@ -201,14 +229,61 @@ class gz::sim::systems::SensorsPrivate
   /// \param[in] _ecm Entity component manager
   public: void UpdateBatteryState(const EntityComponentManager &_ecm);
 
-  /// \brief Get the next closest sensor update time
+  /// \brief Advance the scheduling heap past _currentTime and get the
+  /// next closest sensor update time.
+  /// \param[out] _sensorsToUpdate Set filled with the sensors scheduled
+  /// at the returned time.
+  /// \param[in] _currentTime Current simulation time.
+  /// \return Time of the next scheduled sensor update, or
+  /// duration::max() if there are no sensors.
   public: std::chrono::steady_clock::duration NextUpdateTime(
       std::set<sensors::SensorId> &_sensorsToUpdate,
       const std::chrono::steady_clock::duration &_currentTime);
 
-  /// \brief Check if any of the sensors have connections
+  /// \brief Check if any of the rate-scheduled sensors have
+  /// connections. Triggered sensors are ignored since they are woken
+  /// by their trigger topic instead.
   public: bool SensorsHaveConnections();
 
+  /// \brief Service callback requesting sensor frames to be rendered
+  /// without simulation time having to advance. See the class
+  /// documentation of Sensors.
+  /// \param[in] _req Number of frames, zero is treated as one.
+  /// \param[out] _res True when the frames were queued.
+  /// \return True on success.
+  public: bool OnRenderFrames(const msgs::UInt32 &_req, msgs::Boolean &_res);
+
+  /// \brief Queue a single render for a triggered camera. Called from
+  /// the transport thread when the sensor's trigger topic fires.
+  /// \param[in] _id Id of the sensor to render.
+  public: void OnTrigger(const sensors::SensorId _id);
+
+  /// \brief Transport node for the on-demand render service.
+  public: transport::Node node;
+
+  /// \brief Number of on-demand frames still to be served, requested
+  /// through the render service. One frame is rendered per PostUpdate
+  /// iteration.
+  public: std::atomic<uint64_t> pendingRenderFrames{0};
+
+  /// \brief When set, the next rendering iteration updates every sensor
+  /// regardless of its update rate. Set for on-demand frames, which
+  /// bypass the time-based scheduling.
+  public: std::atomic<bool> forceAllSensorsOnce{false};
+
+  /// \brief Ids of sensors in triggered mode. These have no entry in
+  /// the scheduling heap and render only when their trigger topic
+  /// fires. Protected by sensorsMutex.
+  public: std::unordered_set<sensors::SensorId> triggeredSensors;
+
+  /// \brief Triggered sensors whose trigger fired since the last
+  /// rendering iteration. Protected by sensorsMutex.
+  public: std::unordered_set<sensors::SensorId> pendingTriggers;
+
+  /// \brief True while pendingTriggers is non-empty, so PostUpdate can
+  /// check for trigger work without taking sensorsMutex.
+  public: std::atomic<bool> hasPendingTriggers{false};
+
   /// \brief Use to optionally set the background color.
   public: std::optional<math::Color> backgroundColor;
 
@@ -231,6 +306,11 @@ class gz::sim::systems::SensorsPrivate
   /// Affects sensors that are in nested models
   public: bool disableOnDrainedBattery = false;
 
+  /// \brief Number of camera render passes batched into one GPU
+  /// submission, so later cameras render while earlier readbacks
+  /// complete
+  public: unsigned int cameraPassCountPerGpuFlush = 6u;
+
   /// \brief Mutex to protect access to sensorStateChanged
   public: std::mutex sensorStateMutex;
 };
@@ -265,7 +345,8 @@ void SensorsPrivate::WaitForInit()
       // See Sensors::Update.
 #endif
       this->scene = this->renderUtil.Scene();
-      this->scene->SetCameraPassCountPerGpuFlush(6u);
+      this->scene->SetCameraPassCountPerGpuFlush(
+          this->cameraPassCountPerGpuFlush);
       this->initialized = true;
     }
 
@@ -340,15 +421,23 @@ void SensorsPrivate::RunOnce()
       this->scene->PreRender();
     }
 
+    // On-demand frames update every sensor regardless of its rate.
+    const bool forceAllSensors = this->forceAllSensorsOnce.exchange(false);
+
     // disable sensors that have no subscribers to prevent doing unnecessary
-    // work
+    // work. Triggered sensors additionally stay disabled unless they are
+    // part of this iteration's batch, so renders scheduled for other
+    // sensors don't update them.
     std::unordered_set<sensors::RenderingSensor *> tmpDisabledSensors;
     this->sensorsMutex.lock();
     for (auto id : this->sensorIds)
     {
       sensors::Sensor *s = this->sensorManager.Sensor(id);
       auto rs = dynamic_cast<sensors::RenderingSensor *>(s);
-      if (rs->IsActive() && !rs->HasConnections())
+      const bool triggeredIdle = !forceAllSensors &&
+          this->triggeredSensors.count(id) != 0u &&
+          this->activeSensors.count(id) == 0u;
+      if (rs->IsActive() && (!rs->HasConnections() || triggeredIdle))
       {
         rs->SetActive(false);
         tmpDisabledSensors.insert(rs);
@@ -363,7 +452,7 @@ void SensorsPrivate::RunOnce()
     {
       // publish data
       GZ_PROFILE("RunOnce");
-      this->sensorManager.RunOnce(updateTimeApplied);
+      this->sensorManager.RunOnce(updateTimeApplied, forceAllSensors);
       this->eventManager->Emit<events::Render>();
     }
 
@@ -397,6 +486,13 @@ void SensorsPrivate::RenderThread()
 {
   GZ_PROFILE_THREAD_NAME("RenderThread");
 
+  if (!this->renderThreadCpus.empty() &&
+      !setThreadAffinity(this->renderThreadCpus))
+  {
+    gzwarn << "Failed to pin the render thread to the CPUs configured in "
+           << "<render_thread_affinity>" << std::endl;
+  }
+
   gzdbg << "SensorsPrivate::RenderThread started" << std::endl;
 
   // We have to wait for rendering sensors to be available
@@ -453,6 +549,24 @@ void SensorsPrivate::ForceRender()
   this->forceUpdate = true;
 }
 
+//////////////////////////////////////////////////
+bool SensorsPrivate::OnRenderFrames(const msgs::UInt32 &_req,
+    msgs::Boolean &_res)
+{
+  const uint32_t frames = _req.data() == 0u ? 1u : _req.data();
+  this->pendingRenderFrames += frames;
+  _res.set_data(true);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SensorsPrivate::OnTrigger(const sensors::SensorId _id)
+{
+  std::unique_lock<std::mutex> lock(this->sensorsMutex);
+  this->pendingTriggers.insert(_id);
+  this->hasPendingTriggers = true;
+}
+
 //////////////////////////////////////////////////
 void Sensors::RemoveSensor(const Entity &_entity)
 {
@@ -466,6 +580,10 @@ void Sensors::RemoveSensor(const Entity &_entity)
       std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
       this->dataPtr->activeSensors.erase(idIter->second);
       this->dataPtr->sensorsToUpdate.erase(idIter->second);
+      this->dataPtr->triggeredSensors.erase(idIter->second);
+      this->dataPtr->pendingTriggers.erase(idIter->second);
+      // The sensor's scheduling heap entry is dropped lazily the next
+      // time it is popped.
     }
 
     // update cameras list
@@ -520,6 +638,43 @@ void Sensors::Configure(const Entity &/*_id*/,
   if (_sdf->HasElement("ambient_light"))
     this->dataPtr->ambientLight = _sdf->Get<math::Color>("ambient_light");
 
+  // Number of camera passes batched into one GPU submission
+  this->dataPtr->cameraPassCountPerGpuFlush =
+      _sdf->Get<unsigned int>("camera_passes_per_gpu_flush",
+      this->dataPtr->cameraPassCountPerGpuFlush).first;
+
+  // Directory for the engine's persistent shader cache. The default is a
+  // per-user directory keyed by the engine name; point render farm
+  // processes at a shared location to compile each shader only once per
+  // node.
+  if (_sdf->HasElement("shader_cache_path"))
+  {
+    this->dataPtr->renderUtil.SetShaderCachePath(
+        _sdf->Get<std::string>("shader_cache_path"));
+  }
+
+  // Logical CPUs to pin the render thread to, as a space-separated list
+  // of indices. On multi-socket machines this keeps rendering off the
+  // node running physics.
+  if (_sdf->HasElement("render_thread_affinity"))
+  {
+    auto tokens = common::split(
+        _sdf->Get<std::string>("render_thread_affinity"), " ");
+    for (const auto &token : tokens)
+    {
+      try
+      {
+        this->dataPtr->renderThreadCpus.push_back(
+            static_cast<unsigned int>(std::stoul(token)));
+      }
+      catch (const std::exception &)
+      {
+        gzerr << "Invalid <render_thread_affinity> entry [" << token
+              << "], expected a logical CPU index" << std::endl;
+      }
+    }
+  }
+
   this->dataPtr->renderUtil.SetEngineName(engineName);
   this->dataPtr->renderUtil.SetEnableSensors(true,
       std::bind(&Sensors::CreateSensor, this,
@@ -558,6 +713,29 @@ void Sensors::Configure(const Entity &/*_id*/,
       this->dataPtr->renderUtil.SetHeadlessRendering(
         renderEngineServerHeadlessComp->Data());
     }
+
+    // Advertise the on-demand render service. Dataset pipelines pause
+    // physics, reposition entities through the regular services, then
+    // request frames back to back at rendering speed.
+    auto worldName = _ecm.Component<components::Name>(worldEntity);
+    if (worldName)
+    {
+      std::string renderService{"/world/" + worldName->Data() +
+          "/sensors/render_frames"};
+      renderService = transport::TopicUtils::AsValidTopic(renderService);
+      if (!renderService.empty() && this->dataPtr->node.Advertise(
+          renderService, &SensorsPrivate::OnRenderFrames,
+          this->dataPtr.get()))
+      {
+        gzmsg << "On-demand render service on [" << renderService << "]"
+              << std::endl;
+      }
+      else
+      {
+        gzerr << "Failed to advertise on-demand render service ["
+              << renderService << "]" << std::endl;
+      }
+    }
   }
 
   this->dataPtr->eventManager = &_eventMgr;
@@ -585,6 +763,8 @@ void Sensors::Reset(const UpdateInfo &_info, EntityComponentManager &)
       std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
       this->dataPtr->activeSensors.clear();
       this->dataPtr->sensorsToUpdate.clear();
+      this->dataPtr->pendingTriggers.clear();
+      this->dataPtr->hasPendingTriggers = false;
     }
 
     for (auto id : this->dataPtr->sensorIds)
@@ -599,6 +779,16 @@ void Sensors::Reset(const UpdateInfo &_info, EntityComponentManager &)
 
       s->SetNextDataUpdateTime(_info.simTime);
     }
+    // Rebuild the scheduling heap with the rewound update times
+    {
+      std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
+      this->dataPtr->sensorDueHeap = {};
+      for (auto id : this->dataPtr->sensorIds)
+      {
+        if (this->dataPtr->triggeredSensors.count(id) == 0u)
+          this->dataPtr->sensorDueHeap.push({_info.simTime, id});
+      }
+    }
     this->dataPtr->nextUpdateTime =  _info.simTime;
     std::unique_lock<std::mutex> lock(this->dataPtr->renderMutex);
     this->dataPtr->updateTime =  _info.simTime;
@@ -686,12 +876,19 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
         std::chrono::steady_clock::duration::max() &&
         this->dataPtr->SensorsHaveConnections())
     {
+      std::unique_lock<std::mutex> lockSensors(this->dataPtr->sensorsMutex);
       this->dataPtr->nextUpdateTime = this->dataPtr->NextUpdateTime(
           this->dataPtr->sensorsToUpdate, _info.simTime);
     }
 
+    // Serve one on-demand frame per iteration. These are requested
+    // through the render service, typically while simulation is paused,
+    // and bypass the time-based sensor scheduling.
+    const bool triggeredFrame = this->dataPtr->pendingRenderFrames > 0u;
+
     // notify the render thread if updates are available
-    if (hasRenderConnections ||
+    if (triggeredFrame || hasRenderConnections ||
+        this->dataPtr->hasPendingTriggers ||
         this->dataPtr->nextUpdateTime <= _info.simTime ||
         this->dataPtr->renderUtil.PendingSensors() > 0 ||
         this->dataPtr->forceUpdate)
@@ -712,6 +909,22 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
 
       {
         std::unique_lock<std::mutex> lockSensors(this->dataPtr->sensorsMutex);
+
+        // Cameras whose trigger fired join this iteration's batch
+        // directly; they bypass the heap-based scheduling.
+        if (this->dataPtr->hasPendingTriggers.exchange(false))
+        {
+          for (const auto id : this->dataPtr->pendingTriggers)
+          {
+            sensors::Sensor *s = this->dataPtr->sensorManager.Sensor(id);
+            if (nullptr == s)
+              continue;
+            s->SetNextDataUpdateTime(_info.simTime);
+            this->dataPtr->sensorsToUpdate.insert(id);
+          }
+          this->dataPtr->pendingTriggers.clear();
+        }
+
         this->dataPtr->activeSensors =
             std::move(this->dataPtr->sensorsToUpdate);
 
@@ -723,7 +936,12 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
         // sensors to update. Only active sensors will be updated
         this->dataPtr->forceUpdate =
             (this->dataPtr->renderUtil.PendingSensors() > 0) ||
-            hasRenderConnections;
+            hasRenderConnections || triggeredFrame;
+        if (triggeredFrame)
+        {
+          --this->dataPtr->pendingRenderFrames;
+          this->dataPtr->forceAllSensorsOnce = true;
+        }
         this->dataPtr->updateAvailable = true;
       }
       this->dataPtr->renderCv.notify_one();
@@ -856,6 +1074,54 @@ std::string Sensors::CreateSensor(const Entity &_entity,
   this->dataPtr->entityToIdMap.insert({_entity, sensorId});
   this->dataPtr->sensorIds.insert(sensorId);
 
+  // Cameras marked <triggered> in their SDF render only when a message
+  // arrives on their trigger topic; everything else is scheduled by
+  // update rate.
+  bool triggered = false;
+  auto triggerCamSdf = _sdf.CameraSensor();
+  if (nullptr != triggerCamSdf && triggerCamSdf->Triggered())
+  {
+    std::string triggerTopic = triggerCamSdf->TriggerTopic();
+    if (triggerTopic.empty())
+      triggerTopic = sensor->Topic() + "/trigger";
+    triggerTopic = transport::TopicUtils::AsValidTopic(triggerTopic);
+
+    std::function<void(const msgs::Boolean &)> triggerCb =
+        [this, sensorId](const msgs::Boolean &)
+        {
+          this->dataPtr->OnTrigger(sensorId);
+        };
+    if (!triggerTopic.empty() &&
+        this->dataPtr->node.Subscribe(triggerTopic, triggerCb))
+    {
+      triggered = true;
+      gzmsg << "Sensor [" << sensor->Name() << "] renders on trigger ["
+            << triggerTopic << "]" << std::endl;
+    }
+    else
+    {
+      gzerr << "Failed to subscribe to trigger topic [" << triggerTopic
+            << "] for sensor [" << sensor->Name()
+            << "], falling back to rate-based updates." << std::endl;
+    }
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->sensorsMutex);
+    if (triggered)
+    {
+      // No heap entry: the sensor costs no scheduling or render work
+      // until a trigger arrives.
+      this->dataPtr->triggeredSensors.insert(sensorId);
+    }
+    else
+    {
+      // Schedule the new sensor for immediate examination
+      this->dataPtr->sensorDueHeap.push(
+          {std::chrono::steady_clock::duration::zero(), sensorId});
+    }
+  }
+
   // Set the scene so it can create the rendering sensor
   auto renderingSensor = dynamic_cast<sensors::RenderingSensor *>(sensor);
   renderingSensor->SetScene(this->dataPtr->scene);
@@ -937,10 +1203,17 @@ std::chrono::steady_clock::duration SensorsPrivate::NextUpdateTime(
     const std::chrono::steady_clock::duration &_currentTime)
 {
   _sensorsToUpdate.clear();
-  std::chrono::steady_clock::duration minNextUpdateTime =
-      std::chrono::steady_clock::duration::max();
-  for (auto id : this->sensorIds)
+
+  // Re-examine only the entries that have come due. Each pop pushes back
+  // exactly one replacement entry, so every live sensor keeps a single
+  // entry in the heap; entries of removed sensors are dropped here.
+  std::vector<SensorDueEntry> reinsert;
+  while (!this->sensorDueHeap.empty() &&
+      this->sensorDueHeap.top().first <= _currentTime)
   {
+    const auto id = this->sensorDueHeap.top().second;
+    this->sensorDueHeap.pop();
+
     sensors::Sensor *s = this->sensorManager.Sensor(id);
 
     if (nullptr == s)
@@ -955,41 +1228,76 @@ std::chrono::steady_clock::duration SensorsPrivate::NextUpdateTime(
       continue;
     }
 
+    std::chrono::steady_clock::duration period{std::chrono::seconds(1)};
+    if (rs->UpdateRate() > 0)
+    {
+      period =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(1.0 / rs->UpdateRate()));
+    }
+
     if (!rs->HasConnections())
     {
+      // Park sensors without subscribers one period ahead instead of
+      // rescanning them every step; they are reconsidered when popped.
+      reinsert.push_back({_currentTime + period, id});
       continue;
     }
 
-    std::chrono::steady_clock::duration time;
-    // if sensor's next update tims is less or equal to current sim time then
+    // if sensor's next update time is less or equal to current sim time then
     // it's in the process of being updated by the render loop
-    // Set their next update time  to be current time + update period
+    // Set their next update time to be current time + update period
     if (rs->NextDataUpdateTime() <= _currentTime)
     {
-      time = rs->NextDataUpdateTime() +
-          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
-          std::chrono::duration<double>(1.0 / rs->UpdateRate()));
+      reinsert.push_back({rs->NextDataUpdateTime() + period, id});
     }
     else
     {
-      time = rs->NextDataUpdateTime();
+      reinsert.push_back({rs->NextDataUpdateTime(), id});
     }
+  }
 
-    if (time <= minNextUpdateTime)
-    {
-      _sensorsToUpdate.clear();
-      minNextUpdateTime = time;
-    }
-    _sensorsToUpdate.insert(id);
+  for (const auto &entry : reinsert)
+    this->sensorDueHeap.push(entry);
+
+  if (this->sensorDueHeap.empty())
+    return std::chrono::steady_clock::duration::max();
+
+  // All entries scheduled at the new minimum time form the next batch.
+  // Parked sensors are only re-examined then, not rendered, so they don't
+  // join the batch.
+  const auto minNextUpdateTime = this->sensorDueHeap.top().first;
+  reinsert.clear();
+  while (!this->sensorDueHeap.empty() &&
+      this->sensorDueHeap.top().first == minNextUpdateTime)
+  {
+    const auto &entry = this->sensorDueHeap.top();
+    auto rs = dynamic_cast<sensors::RenderingSensor *>(
+        this->sensorManager.Sensor(entry.second));
+    if (nullptr != rs && rs->HasConnections())
+      _sensorsToUpdate.insert(entry.second);
+    reinsert.push_back(entry);
+    this->sensorDueHeap.pop();
   }
+  for (const auto &entry : reinsert)
+    this->sensorDueHeap.push(entry);
+
   return minNextUpdateTime;
 }
 
 //////////////////////////////////////////////////
 bool SensorsPrivate::SensorsHaveConnections()
 {
+  std::unique_lock<std::mutex> lock(this->sensorsMutex);
   for (auto id : this->sensorIds)
   {
+    // Triggered sensors are scheduled by their trigger topic, not by
+    // subscriber count, so they don't warrant a rate-based wake-up.
+    if (this->triggeredSensors.count(id) != 0u)
+    {
+      continue;
+    }
+
     sensors::Sensor *s = this->sensorManager.Sensor(id);
     if (nullptr == s)
     {
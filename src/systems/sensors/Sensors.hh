@@ -50,6 +50,38 @@ namespace systems
   /// - `<disable_on_drained_battery>` Disable sensors if the model's
   /// battery plugin charge reaches zero. Sensors that are in nested
   /// models are also affected.
+  /// - `<camera_passes_per_gpu_flush>` Number of camera render passes
+  /// batched into one GPU submission. Larger values keep the GPU fed
+  /// while earlier cameras' readbacks complete, which helps rigs with
+  /// many cameras sharing a scene; smaller values reduce the latency of
+  /// each individual camera. Defaults to 6.
+  /// - `<render_thread_affinity>` Space-separated list of logical CPU
+  /// indices the render thread is pinned to. On multi-socket machines
+  /// this keeps rendering off the NUMA node running physics; see also
+  /// ServerConfig::SetSteppingThreadAffinity. Unpinned by default.
+  ///
+  /// ## Triggered cameras
+  ///
+  /// Camera-type sensors whose SDF sets `<camera><triggered>` are kept
+  /// out of the rate-based scheduling entirely: they render a single
+  /// frame each time a gz.msgs.Boolean message arrives on their trigger
+  /// topic (`<triggered_topic>`, defaulting to the sensor topic with a
+  /// `/trigger` suffix) and cost no render work otherwise. Intended for
+  /// cameras that exist only for occasional operator checks or scripted
+  /// captures.
+  ///
+  /// ## Services
+  ///
+  /// - `/world/<world>/sensors/render_frames` (gz.msgs.UInt32 ->
+  /// gz.msgs.Boolean) Queues the requested number of sensor frames
+  /// (zero is treated as one) to be rendered without simulation time
+  /// having to advance, one frame per server iteration. Every rendering
+  /// sensor updates regardless of its update rate, and publishes on its
+  /// regular topic with the current simulation time stamp. Intended for
+  /// labeled-dataset generation: pause the simulation, reposition
+  /// cameras or models through the regular services, then harvest
+  /// segmentation, bounding box, RGB and depth output at rendering
+  /// speed.
   ///
   /// \TODO(louise) Have one system for all sensors, or one per
   /// sensor / sensor type?
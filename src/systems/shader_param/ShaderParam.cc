@@ -21,6 +21,7 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -110,9 +111,18 @@ class gz::sim::systems::ShaderParamPrivate
   /// \brief Time params that will be updated every iteration
   public: std::vector<ShaderParamValue> timeParams;
 
+  /// \brief Time params resolved against the material: target shader params
+  /// object and param name, so per-frame updates skip the per-shader and
+  /// per-name lookups.
+  public: std::vector<std::pair<rendering::ShaderParamsPtr, std::string>>
+      resolvedTimeParams;
+
   /// \brief Current sim time
   public: std::chrono::steady_clock::duration currentSimTime;
 
+  /// \brief Sim time of the last time-param upload.
+  public: std::chrono::steady_clock::duration lastParamUpdateTime{-1};
+
   /// \brief Path to model
   public: std::string modelPath;
 
@@ -482,18 +492,42 @@ void ShaderParamPrivate::OnUpdate()
   }
   this->shaderParams.clear();
 
-  // time variables need to be updated every iteration
-  for (const auto & spv : this->timeParams)
+  // nothing left to update per frame; stop receiving render events
+  if (this->timeParams.empty())
   {
-    float floatValue = (std::chrono::duration_cast<std::chrono::nanoseconds>(
-        this->currentSimTime).count()) * 1e-9;
-    rendering::ShaderParamsPtr params;
-    if (spv.shader == "fragment")
-      params = this->material->FragmentShaderParams();
-    else if (spv.shader == "vertex")
-      params = this->material->VertexShaderParams();
-    (*params)[spv.name] = floatValue;
+    this->connection.reset();
+    return;
+  }
+
+  // resolve the target shader params of the time variables once
+  if (this->resolvedTimeParams.empty())
+  {
+    for (const auto & spv : this->timeParams)
+    {
+      if (spv.shader == "fragment")
+      {
+        this->resolvedTimeParams.emplace_back(
+            this->material->FragmentShaderParams(), spv.name);
+      }
+      else if (spv.shader == "vertex")
+      {
+        this->resolvedTimeParams.emplace_back(
+            this->material->VertexShaderParams(), spv.name);
+      }
+    }
   }
+
+  // time variables need to be updated every iteration, but only when sim
+  // time actually advanced; otherwise (e.g. while paused) the same value
+  // would be re-uploaded every frame
+  if (this->currentSimTime == this->lastParamUpdateTime)
+    return;
+  this->lastParamUpdateTime = this->currentSimTime;
+
+  float floatValue = (std::chrono::duration_cast<std::chrono::nanoseconds>(
+      this->currentSimTime).count()) * 1e-9;
+  for (const auto &[params, name] : this->resolvedTimeParams)
+    (*params)[name] = floatValue;
 }
 
 GZ_ADD_PLUGIN(ShaderParam,
@@ -18,7 +18,9 @@
 #include "Thermal.hh"
 
 #include <limits>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <gz/common/URI.hh>
 #include <gz/common/Util.hh>
@@ -73,7 +75,31 @@ void Thermal::Configure(const Entity &_entity,
     auto modelEntity = topLevelModel(_entity, _ecm);
     auto modelPath =
       _ecm.ComponentData<components::SourceFilePath>(modelEntity);
-    auto path = common::findFile(asFullPath(heatSignature, modelPath.value()));
+
+    // Instances of the same model resolve the same signature file, so cache
+    // the result; spawning many copies of a hot object then does not repeat
+    // the resource path search. The resolved path also keys the texture
+    // cache in the render engine, so copies share one loaded texture.
+    static std::mutex pathCacheMutex;
+    static std::unordered_map<std::string, std::string> pathCache;
+
+    std::string path;
+    const std::string cacheKey = modelPath.value() + "::" + heatSignature;
+    {
+      std::lock_guard<std::mutex> lock(pathCacheMutex);
+      auto pathIt = pathCache.find(cacheKey);
+      if (pathIt != pathCache.end())
+        path = pathIt->second;
+    }
+    if (path.empty())
+    {
+      path = common::findFile(asFullPath(heatSignature, modelPath.value()));
+      if (!path.empty())
+      {
+        std::lock_guard<std::mutex> lock(pathCacheMutex);
+        pathCache[cacheKey] = path;
+      }
+    }
 
     // make sure the specified heat signature can be found
     if (path.empty())
@@ -14,10 +14,12 @@
  * limitations under the License.
  *
  */
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <gz/msgs/double.pb.h>
 
@@ -156,6 +158,14 @@ class gz::sim::systems::ThrusterPrivateData
   /// \brief Has the battery consumption being initialized.
   public: bool batteryInitialized = false;
 
+  /// \brief Batteries belonging to this thruster's model. Gathered once
+  /// so the per-step charge check doesn't scan every battery in the
+  /// world.
+  public: std::vector<Entity> modelBatteries;
+
+  /// \brief Whether modelBatteries has been populated.
+  public: bool modelBatteriesInitialized = false;
+
   /// \brief Callback for handling thrust update
   public: void OnCmdThrust(const msgs::Double &_msg);
 
@@ -178,7 +188,7 @@ class gz::sim::systems::ThrusterPrivateData
   /// \brief Returns a boolean if the battery has sufficient charge to continue
   /// \return True if battery is charged, false otherwise. If no battery found,
   /// returns true.
-  public: bool HasSufficientBattery(const EntityComponentManager &_ecm) const;
+  public: bool HasSufficientBattery(const EntityComponentManager &_ecm);
 };
 
 /////////////////////////////////////////////////
@@ -530,23 +540,56 @@ double ThrusterPrivateData::AngularVelToThrust(double _angVel)
 
 /////////////////////////////////////////////////
 bool ThrusterPrivateData::HasSufficientBattery(
-  const EntityComponentManager &_ecm) const
+  const EntityComponentManager &_ecm)
 {
-  bool result = true;
-  _ecm.Each<components::BatterySoC>([&](
-    const Entity &_entity,
-    const components::BatterySoC *_data
-  ){
-    if(_ecm.ParentEntity(_entity) == this->modelEntity)
-    {
-      if(_data->Data() <= 0)
+  // Gather this model's batteries once, then pick up ones added or
+  // removed later, so the per-step check below only touches them instead
+  // of scanning every battery in the world.
+  if (!this->modelBatteriesInitialized)
+  {
+    this->modelBatteriesInitialized = true;
+    _ecm.Each<components::BatterySoC>([&](
+      const Entity &_entity,
+      const components::BatterySoC *
+    ){
+      if (_ecm.ParentEntity(_entity) == this->modelEntity)
       {
-        result = false;
+        this->modelBatteries.push_back(_entity);
       }
-    }
+      return true;
+    });
+  }
+  else
+  {
+    _ecm.EachNew<components::BatterySoC>([&](
+      const Entity &_entity,
+      const components::BatterySoC *
+    ){
+      if (_ecm.ParentEntity(_entity) == this->modelEntity)
+      {
+        this->modelBatteries.push_back(_entity);
+      }
+      return true;
+    });
+    _ecm.EachRemoved<components::BatterySoC>([&](
+      const Entity &_entity,
+      const components::BatterySoC *
+    ){
+      this->modelBatteries.erase(std::remove(this->modelBatteries.begin(),
+          this->modelBatteries.end(), _entity), this->modelBatteries.end());
+      return true;
+    });
+  }
 
-    return true;
-  });
+  bool result = true;
+  for (const Entity &battery : this->modelBatteries)
+  {
+    auto data = _ecm.Component<components::BatterySoC>(battery);
+    if (data && data->Data() <= 0)
+    {
+      result = false;
+    }
+  }
   return result;
 }
 
@@ -611,9 +654,6 @@ void Thruster::PreUpdate(
 
   gz::sim::Link link(this->dataPtr->linkEntity);
 
-
-  auto pose = worldPose(this->dataPtr->linkEntity, _ecm);
-
   // TODO(arjo129): add logic for custom coordinate frame
   // Convert joint axis to the world frame
   const auto linkWorldPose = worldPose(this->dataPtr->linkEntity, _ecm);
@@ -255,7 +255,8 @@ void TouchPluginPrivate::Update(const UpdateInfo &_info,
 
   bool touching{false};
   // Iterate through all the target entities and check if there is a contact
-  // between the target entity and this model
+  // between the target entity and this model. One match is enough, so stop
+  // scanning as soon as it's found.
   for (const Entity colEntity : this->collisionEntities)
   {
     auto *contacts = _ecm.Component<components::ContactSensorData>(colEntity);
@@ -273,9 +274,12 @@ void TouchPluginPrivate::Update(const UpdateInfo &_info,
         if (col1Target || col2Target)
         {
           touching = true;
+          break;
         }
       }
     }
+    if (touching)
+      break;
   }
 
   if (!touching)
@@ -151,6 +151,14 @@ class gz::sim::systems::TrackControllerPrivate
   /// \brief The point around which the track circles (in world coords). Should
   /// be set to +Inf if the track is going straight.
   public: math::Vector3d centerOfRotation {math::Vector3d::Zero * math::INF_D};
+  /// \brief Copy of centerOfRotation taken once per step in PreUpdate so that
+  /// the contact surface callback can read it without locking cmdMutex for
+  /// each contact point.
+  public: math::Vector3d workingCenterOfRotation {
+    math::Vector3d::Zero * math::INF_D};
+  /// \brief Y axis of the track frame in world coordinates, cached once per
+  /// step in PreUpdate for the contact surface callback.
+  public: math::Vector3d trackYAxisGlobal;
   /// \brief protects velocity and centerOfRotation
   public: std::mutex cmdMutex;
 
@@ -398,6 +406,12 @@ void TrackController::PreUpdate(
     this->dataPtr->collisionsWorldPose[collisionEntity] =
       worldPose(collisionEntity, _ecm);
 
+  // The contact surface callback runs once per contact point, so values that
+  // are constant throughout a step are computed here instead
+  this->dataPtr->trackYAxisGlobal =
+    (this->dataPtr->linkWorldPose.Rot() * this->dataPtr->trackOrientation)
+      .RotateVector(math::Vector3d::UnitY);
+
   std::chrono::steady_clock::duration lastCommandTimeCopy;
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->cmdMutex);
@@ -410,6 +424,8 @@ void TrackController::PreUpdate(
 
     // Compute limited velocity command
     this->dataPtr->limitedVelocity = this->dataPtr->velocity;
+
+    this->dataPtr->workingCenterOfRotation = this->dataPtr->centerOfRotation;
   }
 
   if (this->dataPtr->maxCommandAge != std::chrono::steady_clock::duration::max()
@@ -477,25 +493,15 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
   if (contactNormal.Dot(collisionPose.Pos() - _point) < 0)
     contactNormal = -contactNormal;
 
-  const auto trackWorldRot = this->linkWorldPose.Rot() * this->trackOrientation;
-  const auto trackYAxisGlobal =
-    trackWorldRot.RotateVector(math::Vector3d::UnitY);
-
   // Vector tangent to the belt pointing in the belt's movement direction
   // The belt's bottom moves backwards when the robot should move forward!
-  auto beltDirection = contactNormal.Cross(trackYAxisGlobal);
+  auto beltDirection = contactNormal.Cross(this->trackYAxisGlobal);
 
   if (this->limitedVelocity < 0)
     beltDirection = -beltDirection;
 
-  math::Vector3d cor;
-  {
-    std::lock_guard<std::mutex> lock(this->cmdMutex);
-    cor = this->centerOfRotation;
-  }
-
   const auto frictionDirection = this->ComputeFrictionDirection(
-    cor, _point, contactNormal, beltDirection);
+    this->workingCenterOfRotation, _point, contactNormal, beltDirection);
 
   _params.firstFrictionalDirection =
     convert(isCollision1Track ? frictionDirection : -frictionDirection);
@@ -518,8 +524,9 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
     gzdbg << "- surface motion       " << surfaceMotion << std::endl;
     gzdbg << "- contact point        " << convert(_point) << std::endl;
     gzdbg << "- contact normal       " << contactNormal << std::endl;
-    gzdbg << "- track rot            " << trackWorldRot << std::endl;
-    gzdbg << "- track Y              " << trackYAxisGlobal << std::endl;
+    gzdbg << "- track rot            "
+           << this->linkWorldPose.Rot() * this->trackOrientation << std::endl;
+    gzdbg << "- track Y              " << this->trackYAxisGlobal << std::endl;
     gzdbg << "- belt direction       " << beltDirection << std::endl;
 
     this->debugMarker.set_id(++this->markerId);
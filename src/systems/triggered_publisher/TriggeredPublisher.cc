@@ -30,7 +30,9 @@
 #pragma warning(pop)
 #endif
 
+#include <cmath>
 #include <limits>
+#include <unordered_set>
 #include <utility>
 
 #include <gz/common/Profiler.hh>
@@ -97,6 +99,10 @@ class systems::InputMatcher
   /// \brief State of the matcher
   protected: bool valid{false};
 
+  /// \brief Tolerance for float comparisons. Used by the comparator and by
+  /// the direct scalar comparisons in FieldMatcher.
+  protected: double tolerance{1e-8};
+
   /// \brief Field comparator used by MessageDifferencer. This is where
   /// tolerance for float comparisons is set
   protected: google::protobuf::util::DefaultFieldComparator comparator;
@@ -190,6 +196,12 @@ class FieldMatcher : public InputMatcher
   /// \brief Field descriptor of the field compared by this matcher
   protected: std::vector<const google::protobuf::FieldDescriptor *>
                  fieldDescMatcher;
+
+  /// \brief True when the compared field is a non-repeated scalar field.
+  /// The descriptor chain is resolved once at construction, so DoMatch can
+  /// compare those values directly instead of running a MessageDifferencer
+  /// per message.
+  protected: bool directCompare{false};
 };
 
 //////////////////////////////////////////////////
@@ -216,6 +228,7 @@ void InputMatcher::SetTolerance(double _tol)
 {
   this->comparator.SetDefaultFractionAndMargin(
       std::numeric_limits<double>::min(), _tol);
+  this->tolerance = _tol;
 }
 
 //////////////////////////////////////////////////
@@ -306,6 +319,13 @@ FieldMatcher::FieldMatcher(const std::string &_msgType, bool _logicType,
     return;
   }
 
+  // Non-repeated scalar fields can be compared directly in DoMatch; the
+  // differencer is only needed for repeated and message-valued fields.
+  const auto *lastDesc = this->fieldDescMatcher.back();
+  this->directCompare = !lastDesc->is_repeated() &&
+      lastDesc->cpp_type() !=
+      google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE;
+
   this->valid = true;
 }
 
@@ -389,10 +409,6 @@ bool FieldMatcher::FindFieldSubMessage(
 bool FieldMatcher::DoMatch(
     const transport::ProtoMsg &_input) const
 {
-  google::protobuf::util::DefaultFieldComparator comp;
-
-  auto *matcherRefl = this->matchMsg->GetReflection();
-  auto *inputRefl = _input.GetReflection();
   const transport::ProtoMsg *subMsgMatcher = this->matchMsg.get();
   const transport::ProtoMsg *subMsgInput = &_input;
   for (std::size_t i = 0; i < this->fieldDescMatcher.size() - 1; ++i)
@@ -406,15 +422,71 @@ bool FieldMatcher::DoMatch(
     }
     else
     {
-      subMsgMatcher = &matcherRefl->GetMessage(*subMsgMatcher, fieldDesc);
-      subMsgInput = &inputRefl->GetMessage(*subMsgInput, fieldDesc);
+      subMsgMatcher = &subMsgMatcher->GetReflection()->GetMessage(
+          *subMsgMatcher, fieldDesc);
+      subMsgInput = &subMsgInput->GetReflection()->GetMessage(
+          *subMsgInput, fieldDesc);
     }
   }
 
+  const auto *fieldDesc = this->fieldDescMatcher.back();
+
+  // Fast path for non-repeated scalar fields: compare the values through
+  // the pre-resolved descriptor, without a MessageDifferencer pass.
+  if (this->directCompare)
+  {
+    const auto *matcherRefl = subMsgMatcher->GetReflection();
+    const auto *inputRefl = subMsgInput->GetReflection();
+    bool equal = false;
+    switch (fieldDesc->cpp_type())
+    {
+      case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+        equal = std::abs(inputRefl->GetDouble(*subMsgInput, fieldDesc) -
+            matcherRefl->GetDouble(*subMsgMatcher, fieldDesc)) <=
+            this->tolerance;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+        equal = std::abs(inputRefl->GetFloat(*subMsgInput, fieldDesc) -
+            matcherRefl->GetFloat(*subMsgMatcher, fieldDesc)) <=
+            this->tolerance;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        equal = inputRefl->GetInt32(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetInt32(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        equal = inputRefl->GetInt64(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetInt64(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        equal = inputRefl->GetUInt32(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetUInt32(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        equal = inputRefl->GetUInt64(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetUInt64(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        equal = inputRefl->GetBool(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetBool(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+        equal = inputRefl->GetEnumValue(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetEnumValue(*subMsgMatcher, fieldDesc);
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        equal = inputRefl->GetString(*subMsgInput, fieldDesc) ==
+            matcherRefl->GetString(*subMsgMatcher, fieldDesc);
+        break;
+      default:
+        break;
+    }
+    return this->logicType == equal;
+  }
+
   return this->logicType ==
          this->diff.CompareWithFields(*subMsgMatcher, *subMsgInput,
-                                      {this->fieldDescMatcher.back()},
-                                      {this->fieldDescMatcher.back()});
+                                      {fieldDesc}, {fieldDesc});
 }
 
 //////////////////////////////////////////////////
@@ -512,9 +584,15 @@ void TriggeredPublisher::Configure(const Entity &,
 
     if (inputElem->HasElement("match"))
     {
+      std::unordered_set<std::string> matcherConfigs;
       for (auto matchElem = inputElem->GetElement("match"); matchElem;
            matchElem = matchElem->GetNextElement("match"))
       {
+        // Identical <match> elements always agree, so only the first of
+        // each is kept and evaluated per message.
+        if (!matcherConfigs.insert(matchElem->ToString("")).second)
+          continue;
+
         auto matcher = InputMatcher::Create(this->inputMsgType, matchElem);
         if (nullptr != matcher)
         {
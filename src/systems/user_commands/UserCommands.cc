@@ -72,6 +72,7 @@
 #include "gz/sim/Conversions.hh"
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/Model.hh"
+#include "gz/sim/Primitives.hh"
 #include "gz/sim/SdfEntityCreator.hh"
 #include "gz/sim/Util.hh"
 #include "gz/sim/World.hh"
@@ -150,6 +151,21 @@ class CreateCommand : public UserCommandBase
 
   // Documentation inherited
   public: bool Execute() final;
+
+  /// \brief SDF root parsed from the message. Parsing happens in the
+  /// constructor, on the transport service thread, so a burst of spawn
+  /// requests doesn't construct SDF DOMs while the simulation steps.
+  /// Unused when cachedRoot is set.
+  private: sdf::Root root;
+
+  /// \brief Cached primitive template matching the message's SDF string,
+  /// if any. Spawning primitives through the GUI sends the exact strings
+  /// getPrimitive returns, so those spawns skip parsing entirely.
+  private: const sdf::Root *cachedRoot{nullptr};
+
+  /// \brief Errors found while parsing the message's SDF, reported when the
+  /// command executes.
+  private: sdf::Errors errors;
 };
 
 /// \brief Command to remove an entity from simulation.
@@ -732,7 +748,10 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
 
   // TODO(louise) Record current world state for undo
 
-  // Execute pending commands
+  // Execute pending commands. Entity creations are batched so component
+  // registration and view updates are reconciled once for the whole burst
+  // instead of once per command.
+  this->dataPtr->iface->creator->BeginBatch();
   for (auto &cmd : cmds)
   {
     // Execute
@@ -743,6 +762,7 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
 
     // TODO(louise) Move to undo list
   }
+  this->dataPtr->iface->creator->EndBatch();
 
   // TODO(louise) Clear redo list
 }
@@ -1007,6 +1027,29 @@ CreateCommand::CreateCommand(msgs::EntityFactory *_msg,
     std::shared_ptr<UserCommandsInterface> &_iface)
     : UserCommandBase(_msg, _iface)
 {
+  // Parse the SDF payload here, on the service thread, so Execute only has
+  // to create entities. Cases that need the ECM are handled in Execute.
+  switch (_msg->from_case())
+  {
+    case msgs::EntityFactory::kSdf:
+    {
+      // Primitive spawns carry one of a handful of fixed SDF strings;
+      // reuse the parsed template instead of building a new DOM.
+      this->cachedRoot = getPrimitiveRoot(_msg->sdf());
+      if (nullptr == this->cachedRoot)
+        this->errors = this->root.LoadSdfString(_msg->sdf());
+      break;
+    }
+    case msgs::EntityFactory::kSdfFilename:
+    {
+      this->errors = this->root.Load(_msg->sdf_filename());
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -1019,20 +1062,17 @@ bool CreateCommand::Execute()
     return false;
   }
 
-  // Load SDF
-  sdf::Root root;
+  // The SDF cases were parsed at construction time, on the service thread,
+  // or matched against a cached primitive template.
+  const sdf::Root &root =
+      nullptr != this->cachedRoot ? *this->cachedRoot : this->root;
   sdf::Light lightSdf;
-  sdf::Errors errors;
+  sdf::Errors &errors = this->errors;
   switch (createMsg->from_case())
   {
     case msgs::EntityFactory::kSdf:
-    {
-      errors = root.LoadSdfString(createMsg->sdf());
-      break;
-    }
     case msgs::EntityFactory::kSdfFilename:
     {
-      errors = root.Load(createMsg->sdf_filename());
       break;
     }
     case msgs::EntityFactory::kModel:
@@ -15,6 +15,8 @@
  *
  */
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <string>
@@ -65,6 +67,12 @@ class gz::sim::systems::VelocityControlPrivate
   public: void UpdateLinkVelocity(const UpdateInfo &_info,
     const EntityComponentManager &_ecm);
 
+  /// \brief Refresh the cached command component pointers of the model if
+  /// the ECM structure changed since the last update.
+  /// \param[in] _ecm The EntityComponentManager of the given simulation
+  /// instance.
+  public: void UpdateCache(EntityComponentManager &_ecm);
+
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
@@ -80,6 +88,15 @@ class gz::sim::systems::VelocityControlPrivate
   /// \brief Last target velocity requested.
   public: msgs::Twist targetVel;
 
+  /// \brief Whether a new model velocity command arrived since the last
+  /// PostUpdate. Checked before taking the mutex so steady-state updates
+  /// stay lock-free.
+  public: std::atomic<bool> hasNewVel{false};
+
+  /// \brief Whether new link velocity commands arrived since the last
+  /// PostUpdate.
+  public: std::atomic<bool> hasNewLinkVels{false};
+
   /// \brief A mutex to protect the model velocity command.
   public: std::mutex mutex;
 
@@ -97,6 +114,18 @@ class gz::sim::systems::VelocityControlPrivate
 
   /// \brief All link velocites
   public: std::unordered_map<std::string, msgs::Twist> linkVels;
+
+  /// \brief ECM the cached component pointers below were resolved against.
+  public: const EntityComponentManager *cacheEcm{nullptr};
+
+  /// \brief Structural epoch of the ECM when the cache was last refreshed.
+  public: uint64_t cacheEpoch{0};
+
+  /// \brief Cached angular velocity command component of the model.
+  public: components::AngularVelocityCmd *modelAngularVelComp{nullptr};
+
+  /// \brief Cached linear velocity command component of the model.
+  public: components::LinearVelocityCmd *modelLinearVelComp{nullptr};
 };
 
 //////////////////////////////////////////////////
@@ -200,50 +229,47 @@ void VelocityControl::PreUpdate(const UpdateInfo &_info,
   if (_info.paused)
     return;
 
-  // update angular velocity of model
-  auto modelAngularVel =
-    _ecm.Component<components::AngularVelocityCmd>(
-      this->dataPtr->model.Entity());
+  this->dataPtr->UpdateCache(_ecm);
 
-  if (modelAngularVel == nullptr)
+  // update angular velocity of model
+  // The physics system zeroes the command after each step, so only a zero
+  // command can skip the write.
+  if (nullptr == this->dataPtr->modelAngularVelComp)
   {
     _ecm.CreateComponent(
       this->dataPtr->model.Entity(),
       components::AngularVelocityCmd({this->dataPtr->angularVelocity}));
   }
-  else
+  else if (this->dataPtr->modelAngularVelComp->Data() !=
+    this->dataPtr->angularVelocity)
   {
-    *modelAngularVel =
-      components::AngularVelocityCmd({this->dataPtr->angularVelocity});
+    this->dataPtr->modelAngularVelComp->Data() =
+      this->dataPtr->angularVelocity;
   }
 
   // update linear velocity of model
-  auto modelLinearVel =
-    _ecm.Component<components::LinearVelocityCmd>(
-      this->dataPtr->model.Entity());
-
-  if (modelLinearVel == nullptr)
+  if (nullptr == this->dataPtr->modelLinearVelComp)
   {
     _ecm.CreateComponent(
       this->dataPtr->model.Entity(),
       components::LinearVelocityCmd({this->dataPtr->linearVelocity}));
   }
-  else
+  else if (this->dataPtr->modelLinearVelComp->Data() !=
+    this->dataPtr->linearVelocity)
   {
-    *modelLinearVel =
-      components::LinearVelocityCmd({this->dataPtr->linearVelocity});
+    this->dataPtr->modelLinearVelComp->Data() =
+      this->dataPtr->linearVelocity;
   }
 
   // If there are links, create link components
   // If the link hasn't been identified yet, look for it
-  auto modelName = this->dataPtr->model.Name(_ecm);
-
   if (this->dataPtr->linkNames.empty())
     return;
 
   // find all the link entity ids
   if (this->dataPtr->links.size() != this->dataPtr->linkNames.size())
   {
+    auto modelName = this->dataPtr->model.Name(_ecm);
     for (const auto &linkName : this->dataPtr->linkNames)
     {
       if (this->dataPtr->links.find(linkName) == this->dataPtr->links.end())
@@ -273,9 +299,9 @@ void VelocityControl::PreUpdate(const UpdateInfo &_info,
         _ecm.CreateComponent(it->second,
             components::AngularVelocityCmd({angularVel}));
       }
-      else
+      else if (linkAngularVelComp->Data() != angularVel)
       {
-        *linkAngularVelComp = components::AngularVelocityCmd(angularVel);
+        linkAngularVelComp->Data() = angularVel;
       }
     }
     else
@@ -297,9 +323,9 @@ void VelocityControl::PreUpdate(const UpdateInfo &_info,
         _ecm.CreateComponent(it->second,
             components::LinearVelocityCmd({linearVel}));
       }
-      else
+      else if (linkLinearVelComp->Data() != linearVel)
       {
-        *linkLinearVelComp = components::LinearVelocityCmd(linearVel);
+        linkLinearVelComp->Data() = linearVel;
       }
     }
     else
@@ -332,9 +358,13 @@ void VelocityControlPrivate::UpdateVelocity(
 {
   GZ_PROFILE("VeocityControl::UpdateVelocity");
 
+  if (!this->hasNewVel)
+    return;
+
   std::lock_guard<std::mutex> lock(this->mutex);
   this->linearVelocity = msgs::Convert(this->targetVel.linear());
   this->angularVelocity = msgs::Convert(this->targetVel.angular());
+  this->hasNewVel = false;
 }
 
 //////////////////////////////////////////////////
@@ -344,6 +374,9 @@ void VelocityControlPrivate::UpdateLinkVelocity(
 {
   GZ_PROFILE("VelocityControl::UpdateLinkVelocity");
 
+  if (!this->hasNewLinkVels)
+    return;
+
   std::lock_guard<std::mutex> lock(this->mutex);
   for (const auto& [linkName, msg] : this->linkVels)
   {
@@ -353,6 +386,20 @@ void VelocityControlPrivate::UpdateLinkVelocity(
     this->angularVelocities[linkName] = angularVel;
   }
   this->linkVels.clear();
+  this->hasNewLinkVels = false;
+}
+
+//////////////////////////////////////////////////
+void VelocityControlPrivate::UpdateCache(EntityComponentManager &_ecm)
+{
+  if (this->cacheEcm == &_ecm && this->cacheEpoch == _ecm.StructuralEpoch())
+    return;
+  this->modelAngularVelComp =
+    _ecm.Component<components::AngularVelocityCmd>(this->model.Entity());
+  this->modelLinearVelComp =
+    _ecm.Component<components::LinearVelocityCmd>(this->model.Entity());
+  this->cacheEcm = &_ecm;
+  this->cacheEpoch = _ecm.StructuralEpoch();
 }
 
 //////////////////////////////////////////////////
@@ -360,6 +407,7 @@ void VelocityControlPrivate::OnCmdVel(const msgs::Twist &_msg)
 {
   std::lock_guard<std::mutex> lock(this->mutex);
   this->targetVel = _msg;
+  this->hasNewVel = true;
 }
 
 //////////////////////////////////////////////////
@@ -372,6 +420,7 @@ void VelocityControlPrivate::OnLinkCmdVel(const msgs::Twist &_msg,
     if (_info.Topic().find("/" + linkName + "/cmd_vel") != std::string::npos)
     {
       this->linkVels.insert({linkName, _msg});
+      this->hasNewLinkVels = true;
       break;
     }
   }
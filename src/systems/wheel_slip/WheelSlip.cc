@@ -95,6 +95,17 @@ class gz::sim::systems::WheelSlipPrivate
       /// \brief Wheel radius extracted from collision shape if not
       /// specified as xml parameter.
       public: double wheelRadius = 0;
+
+      /// \brief Lateral slip value most recently pushed to the physics
+      /// system, used to skip pushes that wouldn't change it.
+      public: double lastSlip1 = 0;
+
+      /// \brief Longitudinal slip value most recently pushed to the
+      /// physics system.
+      public: double lastSlip2 = 0;
+
+      /// \brief True after the first slip compliance command was pushed.
+      public: bool slipCmdPushed = false;
     };
 
   /// \brief The map relating links to their respective surface parameters.
@@ -305,6 +316,20 @@ void WheelSlipPrivate::Update(EntityComponentManager &_ecm)
     double slip1 = speed / force * params.slipComplianceLateral;
     double slip2 = speed / force * params.slipComplianceLongitudinal;
 
+    // Only push a new command when the computed values differ from the last
+    // pushed ones beyond tolerance. The physics system keeps applying the
+    // previous command, so wheels spinning at steady speed cost no component
+    // writes or change notifications.
+    if (params.slipCmdPushed &&
+        math::equal(slip1, params.lastSlip1, 1e-6) &&
+        math::equal(slip2, params.lastSlip2, 1e-6))
+    {
+      continue;
+    }
+    params.lastSlip1 = slip1;
+    params.lastSlip2 = slip2;
+    params.slipCmdPushed = true;
+
     components::SlipComplianceCmd newSlipCmdComp({slip1, slip2});
 
     auto currSlipCmdComp =
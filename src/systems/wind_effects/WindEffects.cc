@@ -32,6 +32,7 @@
 #include <gz/msgs/entity_factory.pb.h>
 
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -300,6 +301,17 @@ class gz::sim::systems::WindEffectsPrivate
   /// \brief The scaling factor to approximate wind as force on a mass.
   public: PiecewiseScalingFactor forceApproximationScalingFactor;
 
+  /// \brief Distance a link must move before its scaling factor is
+  /// sampled again. A negative value disables the cache.
+  public: double forceApproximationResampleDistance{1e-3};
+
+  /// \brief Position at which the scaling factor was last evaluated and
+  /// the resulting value, per link. Links that haven't moved farther than
+  /// forceApproximationResampleDistance reuse the cached value instead of
+  /// re-evaluating the scalar field.
+  public: std::unordered_map<Entity,
+      std::pair<math::Vector3d, double>> scalingFactorCache;
+
   /// \brief Noise added to magnitude.
   public: sensors::NoisePtr noiseMagnitude;
 
@@ -462,6 +474,12 @@ void WindEffectsPrivate::Load(EntityComponentManager &_ecm,
     return;
   }
 
+  if (_sdf->HasElement("force_approximation_resample_distance"))
+  {
+    this->forceApproximationResampleDistance =
+        _sdf->Get<double>("force_approximation_resample_distance");
+  }
+
   this->validConfig = true;
 }
 
@@ -598,11 +616,27 @@ void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &,
 
         link.ResetEntity(_entity);
 
-        double forceScalingFactor =
-            this->forceApproximationScalingFactor(_linkPose->Data().Pos());
-        if (std::isnan(forceScalingFactor))
+        // Only re-evaluate the scalar field once the link has moved
+        // appreciably; stationary links keep their cached sample.
+        const math::Vector3d &linkPos = _linkPose->Data().Pos();
+        double forceScalingFactor;
+        auto cached = this->scalingFactorCache.find(_entity);
+        if (this->forceApproximationResampleDistance >= 0. &&
+            cached != this->scalingFactorCache.end() &&
+            cached->second.first.Distance(linkPos) <=
+                this->forceApproximationResampleDistance)
         {
-          forceScalingFactor = 0.;
+          forceScalingFactor = cached->second.second;
+        }
+        else
+        {
+          forceScalingFactor = this->forceApproximationScalingFactor(linkPos);
+          if (std::isnan(forceScalingFactor))
+          {
+            forceScalingFactor = 0.;
+          }
+          this->scalingFactorCache[_entity] =
+              std::make_pair(linkPos, forceScalingFactor);
         }
 
         const math::Vector3d windForce =
@@ -739,6 +773,13 @@ void WindEffects::PreUpdate(const UpdateInfo &_info,
     return true;
   });
 
+  _ecm.EachRemoved<components::Link>(
+      [&](const Entity &_entity, components::Link *) -> bool
+  {
+    this->dataPtr->scalingFactorCache.erase(_entity);
+    return true;
+  });
+
   if (_info.paused)
     return;
 
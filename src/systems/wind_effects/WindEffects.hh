@@ -125,6 +125,14 @@ namespace systems
   /// \endverbatim
   /// Regions may not overlap.
   ///
+  /// - `<force_approximation_resample_distance>`
+  /// Distance, in meters, a link must move from the position where its
+  /// scaling factor was last evaluated before the scalar field is sampled
+  /// again. While a link stays within this distance its cached scaling
+  /// factor is reused, which avoids re-evaluating the field every step
+  /// for links that are stationary or nearly so. Defaults to 1 mm; set it
+  /// below zero to re-sample every step.
+  ///
   class WindEffects final:
     public System,
     public ISystemConfigure,
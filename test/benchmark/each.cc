@@ -17,6 +17,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
 #include <memory>
 
 #include "gz/sim/Entity.hh"
@@ -117,6 +118,56 @@ BENCHMARK_DEFINE_F(EntityComponentManagerFixture, EachCache)
   }
 }
 
+BENCHMARK_DEFINE_F(EntityComponentManagerFixture, EachCachedView)
+(benchmark::State &_st)
+{
+  auto view = mgr->CachedView<World, components::Name>();
+  for (auto _ : _st)
+  {
+    auto matchingEntityCount = _st.range(0);
+    for (int eachIter = 0; eachIter < kEachIterations; eachIter++)
+    {
+      int entitiesMatched = 0;
+
+      view.Each(
+          [&](const Entity &, const World *, const components::Name *)->bool
+          {
+            entitiesMatched++;
+            return true;
+          });
+
+      if (entitiesMatched != matchingEntityCount)
+      {
+        _st.SkipWithError("Failed to match correct number of entities");
+      }
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(EntityComponentManagerFixture, EachParallelCache)
+(benchmark::State &_st)
+{
+  for (auto _ : _st)
+  {
+    auto matchingEntityCount = _st.range(0);
+    for (int eachIter = 0; eachIter < kEachIterations; eachIter++)
+    {
+      std::atomic<int> entitiesMatched{0};
+
+      mgr->EachParallel<World, components::Name>(
+          [&](const Entity &, const World *, const components::Name *)
+          {
+            entitiesMatched++;
+          });
+
+      if (entitiesMatched != matchingEntityCount)
+      {
+        _st.SkipWithError("Failed to match correct number of entities");
+      }
+    }
+  }
+}
+
 class ManyComponentFixture: public benchmark::Fixture
 {
   protected: void SetUp(const ::benchmark::State &_state) override
@@ -386,6 +437,14 @@ BENCHMARK_REGISTER_F(EntityComponentManagerFixture, EachCache)
   ->Unit(benchmark::kMillisecond)
   ->Apply(EachTestArgs);
 
+BENCHMARK_REGISTER_F(EntityComponentManagerFixture, EachCachedView)
+  ->Unit(benchmark::kMillisecond)
+  ->Apply(EachTestArgs);
+
+BENCHMARK_REGISTER_F(EntityComponentManagerFixture, EachParallelCache)
+  ->Unit(benchmark::kMillisecond)
+  ->Apply(EachTestArgs);
+
 BENCHMARK_REGISTER_F(ManyComponentFixture, Each1ComponentNoCache)
   ->Arg(10)
   ->Arg(100)
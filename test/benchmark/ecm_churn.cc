@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gz/sim/Entity.hh"
+#include "gz/sim/EntityComponentManager.hh"
+
+#include "gz/sim/components/Name.hh"
+#include "gz/sim/components/Pose.hh"
+
+#include "gz/sim/components/Factory.hh"
+
+
+namespace gz
+{
+namespace sim
+{
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+using IntComponent = components::Component<int, class IntComponentTag>;
+GZ_SIM_REGISTER_COMPONENT("ign_gazebo_components.IntComponent",
+    IntComponent)
+
+using DoubleComponent = components::Component<double, class DoubleComponentTag>;
+GZ_SIM_REGISTER_COMPONENT("ign_gazebo_components.DoubleComponent",
+    DoubleComponent)
+
+using StringComponent =
+    components::Component<std::string, class StringComponentTag>;
+GZ_SIM_REGISTER_COMPONENT("ign_gazebo_components.StringComponent",
+    StringComponent)
+}
+}
+}
+}
+
+
+using namespace gz;
+using namespace sim;
+using namespace components;
+
+/// \brief Expose the protected per-step maintenance calls that
+/// SimulationRunner performs, so the benchmarks can replicate the
+/// bookkeeping cost of a full step.
+class ChurnEntityCompMgr : public EntityComponentManager
+{
+  public: void RunClearNewlyCreatedEntities()
+  {
+    this->ClearNewlyCreatedEntities();
+  }
+  public: void RunProcessEntityRemovals()
+  {
+    this->ProcessRemoveEntityRequests();
+  }
+  public: void RunClearRemovedComponents()
+  {
+    this->ClearRemovedComponents();
+  }
+};
+
+// Repeatedly add and remove one component on a fixed population of
+// entities, as systems toggling command components do every step.
+// NOLINTNEXTLINE
+void BM_ComponentAddRemoveChurn(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+  auto mgr = std::make_unique<ChurnEntityCompMgr>();
+
+  std::vector<Entity> entities;
+  entities.reserve(entityCount);
+  for (int i = 0; i < entityCount; ++i)
+  {
+    auto e = mgr->CreateEntity();
+    mgr->CreateComponent(e, components::Name("entity"));
+    entities.push_back(e);
+  }
+  mgr->RunClearNewlyCreatedEntities();
+
+  for (auto _ : _st)
+  {
+    for (auto e : entities)
+      mgr->CreateComponent(e, IntComponent(1));
+    for (auto e : entities)
+      mgr->RemoveComponent<IntComponent>(e);
+    mgr->RunClearRemovedComponents();
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// Measure the EachNew / EachRemoved traversal and the bookkeeping that
+// clears them, with entity creation and removal requests kept off the
+// clock.
+// NOLINTNEXTLINE
+void BM_EachNewEachRemovedBookkeeping(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto mgr = std::make_unique<ChurnEntityCompMgr>();
+    std::vector<Entity> entities;
+    entities.reserve(entityCount);
+    for (int i = 0; i < entityCount; ++i)
+    {
+      auto e = mgr->CreateEntity();
+      mgr->CreateComponent(e, IntComponent(i));
+      entities.push_back(e);
+    }
+    _st.ResumeTiming();
+
+    int newCount = 0;
+    mgr->EachNew<IntComponent>(
+        [&](const Entity &, const IntComponent *)->bool
+        {
+          newCount++;
+          return true;
+        });
+    mgr->RunClearNewlyCreatedEntities();
+
+    _st.PauseTiming();
+    for (auto e : entities)
+      mgr->RequestRemoveEntity(e);
+    _st.ResumeTiming();
+
+    int removedCount = 0;
+    mgr->EachRemoved<IntComponent>(
+        [&](const Entity &, const IntComponent *)->bool
+        {
+          removedCount++;
+          return true;
+        });
+    mgr->RunProcessEntityRemovals();
+
+    if (newCount != entityCount || removedCount != entityCount)
+    {
+      _st.SkipWithError("Failed to match correct number of entities");
+    }
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// Create a burst of entities with a few components each, then remove
+// them all, timing the full create / request-remove / process cycle.
+// NOLINTNEXTLINE
+void BM_EntityCreationDeletionBurst(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+
+  for (auto _ : _st)
+  {
+    auto mgr = std::make_unique<ChurnEntityCompMgr>();
+    std::vector<Entity> entities;
+    entities.reserve(entityCount);
+    for (int i = 0; i < entityCount; ++i)
+    {
+      auto e = mgr->CreateEntity();
+      mgr->CreateComponent(e, components::Name("entity"));
+      mgr->CreateComponent(e, components::Pose(math::Pose3d::Zero));
+      mgr->CreateComponent(e, IntComponent(i));
+      entities.push_back(e);
+    }
+    mgr->RunClearNewlyCreatedEntities();
+
+    for (auto e : entities)
+      mgr->RequestRemoveEntity(e);
+    mgr->RunProcessEntityRemovals();
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// Walk the descendants of the root of a tree with branching factor 10,
+// the query used for scoped removal and SDF generation.
+// NOLINTNEXTLINE
+void BM_Descendants(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+  auto mgr = std::make_unique<ChurnEntityCompMgr>();
+
+  std::vector<Entity> entities;
+  entities.reserve(entityCount);
+  for (int i = 0; i < entityCount; ++i)
+  {
+    auto e = mgr->CreateEntity();
+    mgr->CreateComponent(e, components::Name("entity"));
+    if (i > 0)
+      mgr->SetParentEntity(e, entities[(i - 1) / 10]);
+    entities.push_back(e);
+  }
+  mgr->RunClearNewlyCreatedEntities();
+
+  for (auto _ : _st)
+  {
+    auto descendants = mgr->Descendants(entities.front());
+    if (static_cast<int>(descendants.size()) != entityCount)
+    {
+      _st.SkipWithError("Failed to match correct number of entities");
+    }
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// Serialize the full state of one manager and apply it to another, the
+// round trip the GUI performs on connection.
+// NOLINTNEXTLINE
+void BM_StateSetStateRoundTrip(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+  auto mgr = std::make_unique<ChurnEntityCompMgr>();
+  for (int i = 0; i < entityCount; ++i)
+  {
+    auto e = mgr->CreateEntity();
+    mgr->CreateComponent(e, components::Name("entity"));
+    mgr->CreateComponent(e, IntComponent(i));
+    mgr->CreateComponent(e, DoubleComponent(i));
+  }
+  mgr->RunClearNewlyCreatedEntities();
+
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto dest = std::make_unique<EntityComponentManager>();
+    _st.ResumeTiming();
+
+    auto stateMsg = mgr->State();
+    dest->SetState(stateMsg);
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// Rebuild all views and repopulate one of them with an Each call, the
+// cost paid after operations that invalidate the view caches.
+// NOLINTNEXTLINE
+void BM_RebuildViews(benchmark::State &_st)
+{
+  auto entityCount = _st.range(0);
+  auto mgr = std::make_unique<ChurnEntityCompMgr>();
+  for (int i = 0; i < entityCount; ++i)
+  {
+    auto e = mgr->CreateEntity();
+    mgr->CreateComponent(e, components::Name("entity"));
+    mgr->CreateComponent(e, IntComponent(i));
+  }
+  mgr->RunClearNewlyCreatedEntities();
+
+  // Warm the view so every iteration rebuilds from the same state.
+  mgr->Each<components::Name, IntComponent>(
+      [&](const Entity &, const components::Name *,
+          const IntComponent *)->bool
+      {
+        return true;
+      });
+
+  for (auto _ : _st)
+  {
+    mgr->RebuildViews();
+
+    int entitiesMatched = 0;
+    mgr->Each<components::Name, IntComponent>(
+        [&](const Entity &, const components::Name *,
+            const IntComponent *)->bool
+        {
+          entitiesMatched++;
+          return true;
+        });
+
+    if (entitiesMatched != entityCount)
+    {
+      _st.SkipWithError("Failed to match correct number of entities");
+    }
+  }
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_ComponentAddRemoveChurn)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_EachNewEachRemovedBookkeeping)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_EntityCreationDeletionBurst)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_Descendants)
+  ->Arg(100)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_StateSetStateRoundTrip)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Arg(100000)
+  ->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_RebuildViews)
+  ->Arg(1000)
+  ->Arg(10000)
+  ->Arg(100000)
+  ->Unit(benchmark::kMillisecond);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+BENCHMARK_MAIN();
+#if !defined(_MSC_VER)
+#pragma GCC diagnostic pop
+#endif
@@ -130,6 +130,42 @@ void BM_Serialize5Component(benchmark::State &_st)
   _st.counters["num_components"] = 5;
 }
 
+// NOLINTNEXTLINE
+void BM_SerializeArena5Component(benchmark::State &_st)
+{
+  size_t serializedSize = 0;
+  auto entityCount = _st.range(0);
+  google::protobuf::Arena arena;
+  for (auto _: _st)
+  {
+    _st.PauseTiming();
+    auto mgr = std::make_unique<EntityComponentManager>();
+    for (int ii = 0; ii < entityCount; ++ii)
+    {
+      auto e = mgr->CreateEntity();
+      mgr->CreateComponent(e, IntComponent(ii));
+      mgr->CreateComponent(e, UIntComponent(ii));
+      mgr->CreateComponent(e, DoubleComponent(ii));
+      mgr->CreateComponent(e, StringComponent("foobar"));
+      mgr->CreateComponent(e, BoolComponent(ii%2));
+    }
+    _st.ResumeTiming();
+
+    // Reuse the arena's memory between serialization passes, as a periodic
+    // publisher would.
+    arena.Reset();
+    auto *stateMsg = mgr->State(arena, {}, {}, true);
+#if GOOGLE_PROTOBUF_VERSION >= 3004000
+    serializedSize = stateMsg->ByteSizeLong();
+#else
+    serializedSize = stateMsg->ByteSize();
+#endif
+  }
+  _st.counters["serialized_size"] = static_cast<double>(serializedSize);
+  _st.counters["num_entities"] = static_cast<double>(entityCount);
+  _st.counters["num_components"] = 5;
+}
+
 // NOLINTNEXTLINE
 BENCHMARK(BM_Serialize1Component)
   ->Arg(10)
@@ -148,6 +184,15 @@ BENCHMARK(BM_Serialize5Component)
   ->Arg(1000)
   ->Unit(benchmark::kMillisecond);
 
+// NOLINTNEXTLINE
+BENCHMARK(BM_SerializeArena5Component)
+  ->Arg(10)
+  ->Arg(50)
+  ->Arg(100)
+  ->Arg(500)
+  ->Arg(1000)
+  ->Unit(benchmark::kMillisecond);
+
 // OSX needs the semicolon, Ubuntu complains that there's an extra ';'
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
@@ -198,6 +198,72 @@ TEST_F(BreadcrumbsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DeployAtOffset))
   this->server->Run(true, iterTestStart + 2001, false);
 }
 
+/////////////////////////////////////////////////
+// The test checks that pooled instances are pre-instantiated, parked below
+// the world, and moved into place on deployment.
+TEST_F(BreadcrumbsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Pooled))
+{
+  // Start server
+  this->LoadWorld(common::joinPaths("test", "worlds", "breadcrumbs.sdf"));
+
+  test::Relay testSystem;
+  transport::Node node;
+  auto deployPooled = node.Advertise<msgs::Empty>(
+      "/model/vehicle_blue/breadcrumbs/B_pooled/deploy");
+
+  testSystem.OnPostUpdate([&](const UpdateInfo &_info,
+                             const EntityComponentManager &_ecm)
+  {
+    if (_info.iterations == 100)
+    {
+      // The pool is created on the first update, parked far below the
+      // world.
+      Entity parked = _ecm.EntityByComponents(components::Model(),
+                                              components::Name("B_pooled_0"));
+      ASSERT_NE(parked, kNullEntity);
+      auto poseParked = _ecm.Component<components::Pose>(parked);
+      ASSERT_NE(poseParked, nullptr);
+      EXPECT_LT(poseParked->Data().Pos().Z(), -900);
+
+      EXPECT_NE(_ecm.EntityByComponents(components::Model(),
+          components::Name("B_pooled_1")), kNullEntity);
+
+      // Deploy the first pooled instance
+      deployPooled.Publish(msgs::Empty());
+    }
+    else if (_info.iterations == 1000)
+    {
+      Entity vehicleBlue = _ecm.EntityByComponents(
+          components::Model(), components::Name("vehicle_blue"));
+      ASSERT_NE(vehicleBlue, kNullEntity);
+      auto poseVehicle = _ecm.Component<components::Pose>(vehicleBlue);
+      ASSERT_NE(poseVehicle, nullptr);
+
+      // The deployed instance was moved from the parking area to the
+      // vehicle, no new entity was created.
+      Entity deployed = _ecm.EntityByComponents(components::Model(),
+                                                components::Name("B_pooled_0"));
+      ASSERT_NE(deployed, kNullEntity);
+      auto poseDeployed = _ecm.Component<components::Pose>(deployed);
+      ASSERT_NE(poseDeployed, nullptr);
+      auto poseDiff = poseVehicle->Data().Inverse() * poseDeployed->Data();
+      EXPECT_NEAR(poseDiff.Pos().X(), -1.2, 1e-1);
+      EXPECT_GT(poseDeployed->Data().Pos().Z(), -1.0);
+
+      // The second instance is still parked
+      Entity parked = _ecm.EntityByComponents(components::Model(),
+                                              components::Name("B_pooled_1"));
+      ASSERT_NE(parked, kNullEntity);
+      auto poseParked = _ecm.Component<components::Pose>(parked);
+      ASSERT_NE(poseParked, nullptr);
+      EXPECT_LT(poseParked->Data().Pos().Z(), -900);
+    }
+  });
+
+  this->server->AddSystem(testSystem.systemPtr);
+  this->server->Run(true, 1001, false);
+}
+
 /////////////////////////////////////////////////
 // The test checks max deployments
 TEST_F(BreadcrumbsTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(MaxDeployments))
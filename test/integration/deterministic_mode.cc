@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Util.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Server.hh"
+#include "gz/sim/ServerConfig.hh"
+#include "test_config.hh"  // NOLINT(build/include)
+
+#include "../helpers/Relay.hh"
+#include "../helpers/EnvTestFixture.hh"
+
+using namespace gz;
+using namespace sim;
+using namespace std::chrono_literals;
+
+class DeterministicModeFixture : public InternalFixture<::testing::Test>
+{
+};
+
+/////////////////////////////////////////////////
+/// \brief Run a world in deterministic mode and record the serialized
+/// full world state after every step.
+/// \param[in] _world Path to the world file.
+/// \param[in] _iterations Number of unpaused iterations to run.
+/// \return One serialized state per step.
+std::vector<std::string> RunStateStream(const std::string &_world,
+    uint64_t _iterations)
+{
+  ServerConfig serverConfig;
+  serverConfig.SetSdfFile(_world);
+  serverConfig.SetUseDeterministicMode(true);
+  serverConfig.SetSeed(42u);
+
+  Server server(serverConfig);
+  server.SetUpdatePeriod(1ns);
+
+  std::vector<std::string> states;
+  test::Relay recorder;
+  recorder.OnPostUpdate(
+      [&states](const UpdateInfo &, const EntityComponentManager &_ecm)
+      {
+        states.push_back(_ecm.State().SerializeAsString());
+      });
+  server.AddSystem(recorder.systemPtr);
+
+  server.Run(true, _iterations, false);
+  return states;
+}
+
+/////////////////////////////////////////////////
+// Conformance test for deterministic mode: running the same world twice
+// must produce bit-identical state streams.
+TEST_F(DeterministicModeFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(BitIdenticalReruns))
+{
+  const auto world = common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+      "test", "worlds", "falling.sdf");
+
+  const uint64_t iterations{100};
+  auto first = RunStateStream(world, iterations);
+  auto second = RunStateStream(world, iterations);
+
+  ASSERT_EQ(iterations, first.size());
+  ASSERT_EQ(first.size(), second.size());
+  for (std::size_t i = 0; i < first.size(); ++i)
+  {
+    ASSERT_EQ(first[i], second[i])
+        << "State streams diverge at step " << i;
+  }
+}
+
+/////////////////////////////////////////////////
+// A world with several shapes exercises more of the default system set.
+TEST_F(DeterministicModeFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(BitIdenticalRerunsShapes))
+{
+  const auto world = common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+      "test", "worlds", "shapes.sdf");
+
+  const uint64_t iterations{50};
+  auto first = RunStateStream(world, iterations);
+  auto second = RunStateStream(world, iterations);
+
+  ASSERT_EQ(iterations, first.size());
+  ASSERT_EQ(first.size(), second.size());
+  for (std::size_t i = 0; i < first.size(); ++i)
+  {
+    ASSERT_EQ(first[i], second[i])
+        << "State streams diverge at step " << i;
+  }
+}
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #include <gz/common/Filesystem.hh>
 #include <gz/utils/ExtraTestMacros.hh>
 
@@ -85,8 +88,13 @@ TEST_F(EnvironmentPreloadTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CanPreload))
 
   server.AddSystem(testSystem.systemPtr);
 
-  // Run server
-  server.RunOnce();
+  // The data file is parsed on a worker thread, so step until the
+  // component appears.
+  for (int sleep = 0; sleep < 30 && !dataLoaded; ++sleep)
+  {
+    server.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
 
   EXPECT_TRUE(dataLoaded);
 }
@@ -143,8 +151,13 @@ TEST_F(EnvironmentPreloadTest,
 
   server.AddSystem(testSystem.systemPtr);
 
-  // Run server
-  server.RunOnce();
+  // The data file is parsed on a worker thread, so step until the
+  // component appears.
+  for (int sleep = 0; sleep < 30 && !dataLoaded; ++sleep)
+  {
+    server.RunOnce();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
 
   EXPECT_TRUE(dataLoaded);
 }
@@ -28,9 +28,15 @@
 #pragma warning(pop)
 #endif
 
+#include <gz/msgs/axis_aligned_box.pb.h>
+#include <gz/msgs/uint64.pb.h>
+
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <gz/common/Console.hh>
+#include <gz/msgs/Utility.hh>
 #include <gz/common/Util.hh>
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
@@ -188,6 +194,66 @@ TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SceneGraph))
   EXPECT_NE(res.data().find("sphere_visual (14)"), std::string::npos);
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SceneDiff))
+{
+  // Start server
+  sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+
+  sim::Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // Run server
+  server.Run(true, 1, false);
+
+  // Create requester
+  transport::Node node;
+
+  bool result{false};
+  unsigned int timeout{5000};
+
+  // A client with no scene yet gets the full scene
+  msgs::UInt64 req;
+  req.set_data(0);
+  msgs::Scene res;
+  EXPECT_TRUE(node.Request("/world/default/scene/diff", req, timeout, res,
+      result));
+  EXPECT_TRUE(result);
+  EXPECT_EQ(5, res.model_size());
+
+  // The header carries the server's scene graph version
+  uint64_t version{0};
+  for (const auto &data : res.header().data())
+  {
+    if (data.key() == "version" && data.value_size() > 0)
+      version = std::stoull(data.value(0));
+  }
+  EXPECT_GT(version, 0u);
+
+  // A client that is up to date gets an empty diff with the same version
+  req.set_data(version);
+  msgs::Scene res2;
+  EXPECT_TRUE(node.Request("/world/default/scene/diff", req, timeout, res2,
+      result));
+  EXPECT_TRUE(result);
+  EXPECT_EQ(0, res2.model_size());
+
+  uint64_t version2{0};
+  bool full{false};
+  for (const auto &data : res2.header().data())
+  {
+    if (data.key() == "version" && data.value_size() > 0)
+      version2 = std::stoull(data.value(0));
+    if (data.key() == "full")
+      full = true;
+  }
+  EXPECT_EQ(version, version2);
+  EXPECT_FALSE(full);
+}
+
 /////////////////////////////////////////////////
 /// Test whether the scene topic is published only when new entities are added
 TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SceneTopic))
@@ -527,6 +593,113 @@ TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(State))
   EXPECT_TRUE(received);
 }
 
+/////////////////////////////////////////////////
+/// Test whether the delta state topic starts with a full keyframe and then
+/// only carries changed components
+TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(StateDelta))
+{
+  // Start server
+  sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+
+  sim::Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(25u, *server.EntityCount());
+  transport::Node node;
+
+  std::mutex countMutex;
+  std::vector<int> entityCounts;
+  std::function<void(const msgs::SerializedStepMap &)> cb =
+      [&](const msgs::SerializedStepMap &_res)
+  {
+    ASSERT_TRUE(_res.has_state());
+    std::lock_guard<std::mutex> lock(countMutex);
+    entityCounts.push_back(_res.state().entities_size());
+  };
+  EXPECT_TRUE(node.Subscribe("/world/default/state_delta", cb));
+
+  // Run server until a keyframe and at least one delta were received
+  unsigned int sleep{0u};
+  unsigned int maxSleep{30u};
+  while (sleep++ < maxSleep)
+  {
+    server.Run(true, 1, false);
+    GZ_SLEEP_MS(100);
+    std::lock_guard<std::mutex> lock(countMutex);
+    if (entityCounts.size() >= 2u)
+      break;
+  }
+
+  std::lock_guard<std::mutex> lock(countMutex);
+  ASSERT_LE(2u, entityCounts.size());
+
+  // The first message is a keyframe holding the full state
+  EXPECT_EQ(25, entityCounts.front());
+
+  // Subsequent messages only hold the entities with changed components:
+  // the 5 models with periodically changing poses
+  EXPECT_EQ(5, entityCounts.back());
+}
+
+/////////////////////////////////////////////////
+/// Test whether a registered pose region only receives the poses of models
+/// inside the region
+TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(PoseFilter))
+{
+  // Start server
+  sim::ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/shapes.sdf");
+
+  sim::Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  transport::Node node;
+
+  // Register a region that only contains the box model, at (1 2 3)
+  msgs::AxisAlignedBox req;
+  msgs::Set(req.mutable_min_corner(), math::Vector3d(0, 0, 0));
+  msgs::Set(req.mutable_max_corner(), math::Vector3d(2, 3, 4));
+
+  msgs::StringMsg res;
+  bool result{false};
+  EXPECT_TRUE(node.Request("/world/default/pose/filter", req, 1000, res,
+      result));
+  EXPECT_TRUE(result);
+  EXPECT_EQ("/world/default/pose/filter/0", res.data());
+
+  // Subscribe to the region's topic
+  std::mutex poseMutex;
+  std::vector<std::string> poseNames;
+  bool received{false};
+  std::function<void(const msgs::Pose_V &)> cb =
+      [&](const msgs::Pose_V &_msg)
+  {
+    std::lock_guard<std::mutex> lock(poseMutex);
+    poseNames.clear();
+    for (const auto &pose : _msg.pose())
+      poseNames.push_back(pose.name());
+    received = true;
+  };
+  EXPECT_TRUE(node.Subscribe(res.data(), cb));
+
+  // Run server
+  unsigned int sleep{0u};
+  unsigned int maxSleep{30u};
+  while (!received && sleep++ < maxSleep)
+  {
+    server.Run(true, 1, false);
+    GZ_SLEEP_MS(100);
+  }
+  EXPECT_TRUE(received);
+
+  // Only the box model and its link are inside the region
+  std::lock_guard<std::mutex> lock(poseMutex);
+  ASSERT_EQ(2u, poseNames.size());
+  EXPECT_EQ("box", poseNames[0]);
+  EXPECT_EQ("box_link", poseNames[1]);
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneBroadcasterTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(StateStatic))
 {
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2023 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gz/msgs/clock.pb.h>
+
+#include <gz/common/Console.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+#include "gz/transport/Node.hh"
+
+#include "gz/sim/Server.hh"
+#include "gz/sim/ServerConfig.hh"
+#include "msgs/performance_metrics.pb.h"
+#include "test_config.hh"  // NOLINT(build/include)
+
+using namespace gz;
+using namespace sim;
+
+namespace
+{
+//////////////////////////////////////////////////
+/// \brief Peak resident set size of this process in bytes, or zero when
+/// not available on this platform.
+uint64_t PeakRss()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    // ru_maxrss is in bytes on macOS and in kilobytes on Linux.
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#endif
+  }
+#endif
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+/// \brief Escape a string for use inside a JSON string literal.
+std::string JsonEscape(const std::string &_in)
+{
+  std::string out;
+  out.reserve(_in.size());
+  for (const char c : _in)
+  {
+    if (c == '"' || c == '\\')
+      out += '\\';
+    out += c;
+  }
+  return out;
+}
+
+//////////////////////////////////////////////////
+/// \brief Write one PhaseTiming as a named JSON object member.
+void WritePhase(std::ofstream &_ofs, const std::string &_name,
+    const private_msgs::PhaseTiming &_timing, bool &_first)
+{
+  if (!_first)
+    _ofs << ", ";
+  _first = false;
+  _ofs << "\"" << _name << "\": {"
+       << "\"min\": " << _timing.min() << ", "
+       << "\"mean\": " << _timing.mean() << ", "
+       << "\"max\": " << _timing.max() << ", "
+       << "\"p99\": " << _timing.p99() << ", "
+       << "\"sample_count\": " << _timing.sample_count() << "}";
+}
+}  // namespace
+
+//////////////////////////////////////////////////
+/// \brief Headless runner for the scaling-world performance suite.
+///
+/// Executes a world for a fixed number of iterations and writes a
+/// machine-readable JSON result with the overall real time factor,
+/// per-system phase timings harvested from the
+/// `/world/<name>/performance` telemetry topic, and the peak resident
+/// set size of the process. See scaling_suite.py for the orchestration
+/// of a full suite run.
+///
+/// Arguments are parsed in order:
+///
+/// 1. SDF file to execute.
+/// 2. Number of iterations to run the simulation (default 2000).
+/// 3. Update rate in Hz, non-positive for unthrottled (default).
+/// 4. Output JSON file (default scaling_results.json).
+/// 5. Network role: 'primary', 'secondary' or empty for a standalone
+///    run (default).
+/// 6. Number of network secondaries, used with the 'primary' role
+///    (default 1).
+/// 7. Topic to additionally subscribe to, so that publishers which are
+///    throttled down without subscribers (cameras, state topics) do
+///    real work during the run. Empty to skip (default).
+int main(int _argc, char** _argv)
+{
+  common::Console::SetVerbosity(4);
+
+  std::string sdfFile{""};
+  if (_argc >= 2)
+  {
+    sdfFile = _argv[1];
+  }
+  gzdbg << "SDF file: " << sdfFile << std::endl;
+
+  unsigned int iterations{2000};
+  if (_argc >= 3)
+  {
+    iterations = atoi(_argv[2]);
+  }
+  gzdbg << "Iterations: " << iterations << std::endl;
+
+  double updateRate{-1};
+  if (_argc >= 4)
+  {
+    updateRate = atoi(_argv[3]);
+  }
+  gzdbg << "Update rate: " << updateRate << std::endl;
+
+  std::string outputFile{"scaling_results.json"};
+  if (_argc >= 5)
+  {
+    outputFile = _argv[4];
+  }
+  gzdbg << "Output file: " << outputFile << std::endl;
+
+  std::string networkRole{""};
+  if (_argc >= 6)
+  {
+    networkRole = _argv[5];
+  }
+
+  unsigned int networkSecondaries{1};
+  if (_argc >= 7)
+  {
+    networkSecondaries = atoi(_argv[6]);
+  }
+
+  std::string subscribeTopic{""};
+  if (_argc >= 8)
+  {
+    subscribeTopic = _argv[7];
+  }
+
+  // The telemetry topic is namespaced by world name.
+  std::string worldName{"default"};
+  {
+    sdf::Root root;
+    sdf::Errors errors = root.Load(sdfFile);
+    if (errors.empty() && nullptr != root.WorldByIndex(0))
+      worldName = root.WorldByIndex(0)->Name();
+  }
+
+  ServerConfig serverConfig;
+  if (!serverConfig.SetSdfFile(sdfFile))
+  {
+    gzerr << "Failed to set SDF file [" << sdfFile << "]" << std::endl;
+    return -1;
+  }
+
+  // Set the update rate.
+  if (updateRate > 0.0)
+    serverConfig.SetUpdateRate(updateRate);
+
+  serverConfig.SetHeadlessRendering(true);
+
+  if (!networkRole.empty())
+  {
+    serverConfig.SetNetworkRole(networkRole);
+    serverConfig.SetUseLevels(true);
+    if (networkRole == "primary")
+      serverConfig.SetNetworkSecondaries(networkSecondaries);
+  }
+
+  // Create the Gazebo server
+  Server server(serverConfig);
+
+  transport::Node node;
+
+  std::vector<msgs::Clock> clockMsgs;
+  clockMsgs.reserve(iterations);
+
+  std::function<void(const msgs::Clock &)> clockCb =
+    [&](const msgs::Clock &_msg)
+    {
+      clockMsgs.push_back(_msg);
+    };
+  node.Subscribe("/clock", clockCb);
+
+  // Keep the most recent telemetry sample. Timings are only collected
+  // by the server while this topic has subscribers.
+  std::mutex metricsMutex;
+  private_msgs::PerformanceMetrics lastMetrics;
+  bool haveMetrics{false};
+
+  std::function<void(const private_msgs::PerformanceMetrics &)> metricsCb =
+    [&](const private_msgs::PerformanceMetrics &_msg)
+    {
+      std::lock_guard<std::mutex> lock(metricsMutex);
+      lastMetrics = _msg;
+      haveMetrics = true;
+    };
+  node.Subscribe("/world/" + worldName + "/performance", metricsCb);
+
+  // Optional raw subscription that keeps otherwise-parked publishers
+  // (cameras, state topics) active during the run.
+  std::atomic<uint64_t> subscribedMsgCount{0};
+  if (!subscribeTopic.empty())
+  {
+    node.SubscribeRaw(subscribeTopic,
+        [&](const char *, const size_t, const transport::MessageInfo &)
+        {
+          ++subscribedMsgCount;
+        });
+  }
+
+  // Run the server
+  const auto runStart = std::chrono::steady_clock::now();
+  server.Run(true, iterations, false);
+  const std::chrono::duration<double> wallTime =
+      std::chrono::steady_clock::now() - runStart;
+
+  double simTime = 0.0;
+  if (clockMsgs.size() >= 2)
+  {
+    const auto &first = clockMsgs.front().sim();
+    const auto &last = clockMsgs.back().sim();
+    simTime = (last.sec() - first.sec()) + 1e-9 * (last.nsec() - first.nsec());
+  }
+
+  const double realTime = wallTime.count();
+  const double rtf = realTime > 0.0 ? simTime / realTime : 0.0;
+
+  std::ofstream ofs(outputFile, std::ofstream::out);
+  ofs << std::setprecision(9);
+  ofs << "{\n";
+  ofs << "  \"world\": \"" << JsonEscape(sdfFile) << "\",\n";
+  ofs << "  \"network_role\": \"" << JsonEscape(networkRole) << "\",\n";
+  ofs << "  \"iterations\": " << iterations << ",\n";
+  ofs << "  \"update_rate\": " << updateRate << ",\n";
+  ofs << "  \"sim_time\": " << simTime << ",\n";
+  ofs << "  \"real_time\": " << realTime << ",\n";
+  ofs << "  \"rtf\": " << rtf << ",\n";
+  ofs << "  \"peak_rss\": " << PeakRss() << ",\n";
+  ofs << "  \"subscribed_msg_count\": " << subscribedMsgCount << ",\n";
+
+  std::lock_guard<std::mutex> lock(metricsMutex);
+  ofs << "  \"entity_count\": "
+      << (haveMetrics ? lastMetrics.entity_count() : 0u) << ",\n";
+  ofs << "  \"component_count\": "
+      << (haveMetrics ? lastMetrics.component_count() : 0u) << ",\n";
+  ofs << "  \"systems\": [";
+  for (int i = 0; haveMetrics && i < lastMetrics.system_size(); ++i)
+  {
+    const auto &system = lastMetrics.system(i);
+    if (i > 0)
+      ofs << ",";
+    ofs << "\n    {\"name\": \"" << JsonEscape(system.name()) << "\", ";
+    bool first = true;
+    if (system.has_pre_update())
+      WritePhase(ofs, "pre_update", system.pre_update(), first);
+    if (system.has_update())
+      WritePhase(ofs, "update", system.update(), first);
+    if (system.has_post_update())
+      WritePhase(ofs, "post_update", system.post_update(), first);
+    ofs << "}";
+  }
+  ofs << "\n  ]\n";
+  ofs << "}\n";
+
+  gzmsg << "Wrote results to [" << outputFile << "]: rtf " << rtf
+        << ", peak rss " << PeakRss() << " bytes" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# Orchestrates the scaling-world performance suite.
+#
+# For every combination of profile and scale this script generates a
+# world from scaling.sdf.erb, executes it headless for a fixed number
+# of steps with PERFORMANCE_scaling_runner, and aggregates the per-run
+# JSON results (RTF, per-system timings from the telemetry topic, peak
+# RSS) into a single machine-readable file that can be diffed between
+# releases.
+#
+# Example, from the build directory:
+#
+#   ../test/performance/scaling_suite.py \
+#       --runner bin/PERFORMANCE_scaling_runner \
+#       --scales 1000,10000 --output scaling_results.json
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+PROFILES = ['physics', 'sensors', 'actors', 'distributed']
+
+# Topics that must have a subscriber for their publishers to do real
+# work during the run; subscriber-less cameras and state publishers are
+# parked by the server.
+SUBSCRIBE_TOPICS = {
+    'sensors': '/cameras',
+    'actors': '/world/scaling/dynamic_pose/info',
+}
+
+
+def generate_world(erb, template, profile, entities, out_path):
+    with open(out_path, 'w') as f:
+        subprocess.run(
+            [erb, f'profile={profile}', f'n={entities}', template],
+            stdout=f, check=True)
+
+
+def run_one(args, profile, entities, workdir):
+    world = os.path.join(workdir, f'{profile}_{entities}.sdf')
+    generate_world(args.erb, args.template, profile, entities, world)
+
+    # A unique partition isolates the run from other transport traffic,
+    # including other runs of this suite.
+    env = dict(os.environ)
+    env['GZ_PARTITION'] = f'scaling_{os.getpid()}_{profile}_{entities}'
+
+    result = {
+        'profile': profile,
+        'entities': entities,
+        'iterations': args.iterations,
+    }
+
+    out = os.path.join(workdir, f'{profile}_{entities}.json')
+    subscribe = SUBSCRIBE_TOPICS.get(profile, '')
+
+    if profile == 'distributed':
+        secondaries = []
+        for i in range(args.secondaries):
+            sec_out = os.path.join(
+                workdir, f'{profile}_{entities}_secondary_{i}.json')
+            secondaries.append(subprocess.Popen(
+                [args.runner, world, str(args.iterations), '-1', sec_out,
+                 'secondary'], env=env))
+        proc = subprocess.run(
+            [args.runner, world, str(args.iterations), '-1', out,
+             'primary', str(args.secondaries)], env=env)
+        for sec in secondaries:
+            try:
+                sec.wait(timeout=60)
+            except subprocess.TimeoutExpired:
+                sec.kill()
+    else:
+        proc = subprocess.run(
+            [args.runner, world, str(args.iterations), '-1', out,
+             '', '0', subscribe], env=env)
+
+    result['returncode'] = proc.returncode
+    try:
+        with open(out) as f:
+            result['results'] = json.load(f)
+    except (OSError, json.JSONDecodeError):
+        result['results'] = None
+    return result
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--runner', default='./PERFORMANCE_scaling_runner',
+                        help='Path to the PERFORMANCE_scaling_runner binary')
+    parser.add_argument('--template',
+                        default=os.path.join(os.path.dirname(__file__),
+                                             'scaling.sdf.erb'),
+                        help='Path to the scaling.sdf.erb world template')
+    parser.add_argument('--erb', default='erb',
+                        help='Path to the erb executable')
+    parser.add_argument('--profiles', default=','.join(PROFILES),
+                        help='Comma-separated list of profiles to run')
+    parser.add_argument('--scales', default='1000,10000,100000',
+                        help='Comma-separated list of entity counts')
+    parser.add_argument('--iterations', type=int, default=2000,
+                        help='Number of steps per run')
+    parser.add_argument('--secondaries', type=int, default=2,
+                        help='Secondaries for the distributed profile')
+    parser.add_argument('--output', default='scaling_results.json')
+    parser.add_argument('--keep-worlds', action='store_true',
+                        help='Keep the generated worlds and per-run output')
+    args = parser.parse_args()
+
+    profiles = [p for p in args.profiles.split(',') if p]
+    for p in profiles:
+        if p not in PROFILES:
+            sys.exit(f'Unknown profile [{p}], expected one of {PROFILES}')
+    scales = [int(s) for s in args.scales.split(',') if s]
+
+    workdir = tempfile.mkdtemp(prefix='gz_sim_scaling_')
+    runs = []
+    try:
+        for profile in profiles:
+            for entities in scales:
+                print(f'== {profile} with {entities} entities ==')
+                runs.append(run_one(args, profile, entities, workdir))
+    finally:
+        if args.keep_worlds:
+            print(f'Generated worlds kept in {workdir}')
+        else:
+            shutil.rmtree(workdir, ignore_errors=True)
+
+    report = {
+        'timestamp': time.strftime('%Y-%m-%dT%H:%M:%S%z'),
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'runs': runs,
+    }
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2)
+    print(f'Wrote {len(runs)} runs to {args.output}')